@@ -0,0 +1,77 @@
+/**
+  ******************************************************************************
+  * @file    boot.h
+  * @brief   Boot timing: header file for boot.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __BOOT_H
+#define __BOOT_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Cycle counter and TIM2 on the target, a hook of the test program on a host */
+#ifndef BOOT_HOST
+#if defined(STM32F429xx)
+#define BOOT_HOST                       0
+#else
+#define BOOT_HOST                       1
+#endif
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#if !BOOT_HOST
+#include "main.h"
+#endif
+
+/* 1: USB first, the sensor, the capture, DMA2D, the SDRAM and the frame
+   sources are set up on the first stream start. 0: all of them at boot,
+   before the main loop (benchmark builds). */
+#ifndef BOOT_LAZY_INIT
+#define BOOT_LAZY_INIT                  1
+#endif
+
+/* Boot stages, in the order they are reached. Times are in us from
+   Boot_Init(), 0 while a stage is not reached. */
+#define BOOT_STAGE_CLOCK                0U   /* SystemClock_Config() done */
+#define BOOT_STAGE_PERIPH               1U   /* GPIO, UART and TIM2, after Latency_Init() */
+#define BOOT_STAGE_USB                  2U   /* device connected to the bus */
+#define BOOT_STAGE_CONFIGURED           3U   /* SET_CONFIGURATION from the host */
+#define BOOT_STAGE_STREAM               4U   /* first alternate setting 1 */
+#define BOOT_STAGE_MEDIA                5U   /* sensor, capture and frame sources ready */
+#define BOOT_STAGE_FIRST_FRAME          6U   /* end of the first frame sent */
+#define BOOT_STAGE_NUM                  7U
+
+/* Bytes written by Boot_GetInfo(): a little endian dword per stage */
+#define BOOT_INFO_LEN                   (BOOT_STAGE_NUM * 4U)
+
+/* Exported functions ------------------------------------------------------- */
+void Boot_Init(void);
+void Boot_Mark(uint8_t stage);
+uint32_t Boot_GetTime(uint8_t stage);
+void Boot_GetInfo(uint8_t *data);
+void Boot_Report(void);
+#if BOOT_HOST
+uint32_t Boot_HostTime(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BOOT_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * @file    capture.h
+  * @brief   DCMI capture layer: header file for capture.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CAPTURE_H
+#define __CAPTURE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Sensor output, RGB565 */
+#define CAPTURE_SENSOR_WIDTH            640U
+#define CAPTURE_SENSOR_HEIGHT           480U
+#define CAPTURE_BYTES_PER_PIXEL         2U
+#define CAPTURE_FRAME_BYTES             (CAPTURE_SENSOR_WIDTH * CAPTURE_SENSOR_HEIGHT * CAPTURE_BYTES_PER_PIXEL)
+
+/* Smallest window, x, y, width and height are even so that 2x2 binning is exact */
+#define CAPTURE_MIN_WIDTH               16U
+#define CAPTURE_MIN_HEIGHT              16U
+
+/* Capture rates */
+#define CAPTURE_RATE_ALL                0U
+#define CAPTURE_RATE_1_OF_2             1U
+#define CAPTURE_RATE_1_OF_4             2U
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint16_t   x;          /* window inside the sensor frame */
+  uint16_t   y;
+  uint16_t   width;
+  uint16_t   height;
+  uint8_t    binning;    /* 1: 2x2 binning of the window */
+  uint8_t    rate;       /* CAPTURE_RATE_xxx */
+  uint8_t    throttle;   /* 1: static scene, 1 of 4 frames whatever the rate */
+} Capture_ConfigTypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef Capture_Init(DCMI_HandleTypeDef *hdcmi);
+uint8_t *Capture_GetFrameBuffer(void);
+HAL_StatusTypeDef Capture_Start(uint8_t *buffer);
+HAL_StatusTypeDef Capture_Stop(void);
+HAL_StatusTypeDef Capture_SetWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+void Capture_SetBinning(uint8_t enable);
+void Capture_SetRate(uint8_t rate);
+void Capture_SetThrottle(uint8_t enable);
+void Capture_Process(void);
+void Capture_GetOutputSize(uint16_t *width, uint16_t *height);
+void Capture_Bin2x2(const uint16_t *src, uint16_t *dst, uint16_t width, uint16_t height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CAPTURE_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
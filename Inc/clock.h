@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file    clock.h
+  * @brief   System clock profiles: header file for clock.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CLOCK_H
+#define __CLOCK_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Profiles */
+#define CLOCK_PROFILE_ECONOMY           0U   /* no function streams */
+#define CLOCK_PROFILE_FULL              1U   /* SystemClock_Config() */
+#define CLOCK_PROFILE_PERFORMANCE       2U   /* streaming, claimed */
+#define CLOCK_PROFILE_NUM               3U
+
+/* Parts with a 48 MHz clock mux feed the OTG core from PLLSAI, the main PLL
+   is then free to run at 180 MHz. On the STM32F429 the OTG core only takes
+   PLLQ: the main PLL stays at 336 MHz, the only VCO up to 432 MHz with both
+   a 48 MHz multiple and a system clock above 144 MHz, and the performance
+   profile is the full one. */
+#if defined(STM32F469xx) || defined(STM32F479xx)
+#define CLOCK_CK48_PLLSAI               1
+#else
+#define CLOCK_CK48_PLLSAI               0
+#endif
+
+/* PLLSAI at 48 MHz on its P output, from the 2 MHz PLL input */
+#define CLOCK_PLLSAI_N                  96U
+#define CLOCK_PLLSAI_P                  RCC_PLLSAIP_DIV4
+
+/* Claims on the performance profile, one bit each */
+#define CLOCK_CLAIM_ENCODER             0x01U
+
+/* Encode times the encoder claims from and gives its claim back below, us:
+   three quarters and half of the frame interval at 15 fps */
+#define CLOCK_ENCODER_CLAIM_US          50000U
+#define CLOCK_ENCODER_RELEASE_US        33000U
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint16_t   pll_n;          /* main PLL multiplier, from the 2 MHz input */
+  uint8_t    pll_p;          /* RCC_PLLP_DIVx */
+  uint8_t    overdrive;      /* 1 above 168 MHz */
+  uint32_t   ahb_div;        /* RCC_SYSCLK_DIVx */
+  uint32_t   apb1_div;       /* RCC_HCLK_DIVx, PCLK1 up to 45 MHz */
+  uint32_t   apb2_div;       /* RCC_HCLK_DIVx, PCLK2 up to 90 MHz */
+  uint32_t   latency;        /* FLASH_LATENCY_x at 2.7 V */
+  const char *name;
+} Clock_ProfileTypeDef;
+
+typedef struct
+{
+  uint32_t   switches;       /* profile changes */
+  uint32_t   pll_switches;   /* of them, with the main PLL reprogrammed */
+  uint32_t   switch_max_us;  /* longest change, interrupts disabled */
+  uint32_t   restore_max_us; /* longest return from the economy profile */
+  uint8_t    profile;        /* CLOCK_PROFILE_xxx */
+  uint8_t    claims;         /* CLOCK_CLAIM_xxx */
+} Clock_StatsTypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+void Clock_Init(void);
+void Clock_Process(uint8_t streaming);
+void Clock_Claim(uint8_t claim, uint8_t on);
+uint8_t Clock_GetProfile(void);
+void Clock_GetStats(Clock_StatsTypeDef *stats);
+void Clock_Report(void);
+void Clock_ChangedCallback(uint8_t profile);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CLOCK_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,73 @@
+/**
+  ******************************************************************************
+  * @file    codec_tables.h
+  * @brief   Codec tables: header file for codec_tables.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CODEC_TABLES_H
+#define __CODEC_TABLES_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Symbols of the Huffman code tables: DC sizes 0 to 11, AC run/size bytes */
+#define CODEC_HUFF_DC_SYMBOLS           12U
+#define CODEC_HUFF_AC_SYMBOLS           256U
+
+/* CRC of the STM32 CRC unit: CRC-32 polynomial, MSB first, no reflection */
+#define CODEC_CRC_POLY                  0x04C11DB7U
+#define CODEC_CRC_INIT                  0xFFFFFFFFU
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Entry of the Huffman code tables: code in bits 15:0, length in bits 23:16 */
+#define CODEC_HUFF_ENTRY(code, len)     ((uint32_t)(code) | ((uint32_t)(len) << 16))
+#define CODEC_HUFF_CODE(entry)          ((entry) & 0xFFFFU)
+#define CODEC_HUFF_LEN(entry)           (((entry) >> 16) & 0xFFU)
+
+/* Exported variables --------------------------------------------------------*/
+extern const uint8_t codecZigzagTable[64];
+
+extern const uint8_t codecQuantLumaTable[64];
+extern const uint8_t codecQuantChromaTable[64];
+extern const uint16_t codecQuantRecipLumaTable[64];
+extern const uint16_t codecQuantRecipChromaTable[64];
+
+extern const uint8_t codecHuffDcLumaBits[16];
+extern const uint8_t codecHuffDcChromaBits[16];
+extern const uint8_t codecHuffDcVals[12];
+extern const uint8_t codecHuffAcLumaBits[16];
+extern const uint8_t codecHuffAcLumaVals[162];
+extern const uint8_t codecHuffAcChromaBits[16];
+extern const uint8_t codecHuffAcChromaVals[162];
+
+extern const uint32_t codecHuffDcLumaTable[CODEC_HUFF_DC_SYMBOLS];
+extern const uint32_t codecHuffDcChromaTable[CODEC_HUFF_DC_SYMBOLS];
+extern const uint32_t codecHuffAcLumaTable[CODEC_HUFF_AC_SYMBOLS];
+extern const uint32_t codecHuffAcChromaTable[CODEC_HUFF_AC_SYMBOLS];
+
+extern const uint32_t codecCrcTable[256];
+extern const uint8_t codecCrcInverseTable[256];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CODEC_TABLES_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,66 @@
+/**
+  ******************************************************************************
+  * @file    color_convert.h
+  * @brief   Color space conversion kernels: header file for color_convert.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __COLOR_CONVERT_H
+#define __COLOR_CONVERT_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+
+/* 1: Cortex-M4 SIMD kernels, 0: scalar reference only (e.g. host build) */
+#ifndef COLOR_USE_SIMD
+#if defined(STM32F429xx)
+#define COLOR_USE_SIMD                  1
+#else
+#define COLOR_USE_SIMD                  0
+#endif
+#endif
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Output planes are packed: Y is width x height, Cb and Cr width/2 x height/2.
+   width and height are even, pitch is in pixels. */
+void Color_Rgb565ToYCbCr420(const uint16_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                            uint8_t *y, uint8_t *cb, uint8_t *cr);
+void Color_YuyvToYCbCr420(const uint8_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                          uint8_t *y, uint8_t *cb, uint8_t *cr);
+void Color_Rgb888ToY(const uint8_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                     uint8_t *y);
+
+/* Scalar reference versions, the kernels above give the same output */
+void Color_Rgb565ToYCbCr420_Ref(const uint16_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                                uint8_t *y, uint8_t *cb, uint8_t *cr);
+void Color_YuyvToYCbCr420_Ref(const uint8_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                              uint8_t *y, uint8_t *cb, uint8_t *cr);
+void Color_Rgb888ToY_Ref(const uint8_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                         uint8_t *y);
+
+#ifdef COLOR_BENCHMARK
+void Color_Benchmark(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __COLOR_CONVERT_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,96 @@
+/**
+  ******************************************************************************
+  * @file    defer.h
+  * @brief   Deferred work queue: header file for defer.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __DEFER_H
+#define __DEFER_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* PendSV or RTOS thread on the target, a hook of the test program on a host */
+#ifndef DEFER_HOST
+#if defined(STM32F429xx)
+#define DEFER_HOST                      0
+#else
+#define DEFER_HOST                      1
+#endif
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#if !DEFER_HOST
+#include "main.h"
+#include "pipeline.h"
+#endif
+
+/* Work items in the queue, a power of 2 */
+#define DEFER_QUEUE_SIZE                32U
+
+/* Bytes of data copied into a work item */
+#define DEFER_DATA_SIZE                 8U
+
+/* Cycles an interrupt top half may take, checked by Defer_IsrTime() */
+#ifndef DEFER_ISR_BUDGET
+#define DEFER_ISR_BUDGET                (168U * 10U)    /* 10 us at 168 MHz */
+#endif
+
+/* Bottom halves run in the RTOS thread with PIPELINE_USE_RTOS, PendSV does
+   not belong to the application then */
+#if !DEFER_HOST && PIPELINE_USE_RTOS
+#define DEFER_USE_THREAD                1
+#define DEFER_PRIO                      osPriorityRealtime
+#else
+#define DEFER_USE_THREAD                0
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Bottom half: arg as posted, data a copy of the bytes posted with it */
+typedef void (*Defer_FuncTypeDef)(void *arg, const uint8_t *data);
+
+typedef struct
+{
+  uint32_t   posted;
+  uint32_t   run;
+  uint32_t   overflow;   /* work items lost to a full queue */
+  uint32_t   depth_max;  /* most items waiting at once */
+  uint32_t   isr_max;    /* longest top half, in cycles */
+  uint32_t   isr_over;   /* top halves over DEFER_ISR_BUDGET */
+  uint32_t   work_max;   /* longest bottom half, in cycles */
+} Defer_StatsTypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+void Defer_Init(void);
+int32_t Defer_Post(Defer_FuncTypeDef func, void *arg, const void *data, uint32_t len);
+void Defer_Run(void);
+void Defer_IsrTime(uint32_t cycles);
+void Defer_GetStats(Defer_StatsTypeDef *stats);
+#if DEFER_HOST
+void Defer_HostTrigger(void);
+uint32_t Defer_HostCycles(void);
+#else
+void Defer_Report(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DEFER_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
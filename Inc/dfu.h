@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file    dfu.h
+  * @brief   Firmware update into the other flash bank: header file for dfu.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __DFU_H
+#define __DFU_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Flash controller and option bytes on the target, a model of the bank on a
+   host */
+#ifndef DFU_HOST
+#if defined(STM32F429xx)
+#define DFU_HOST                        0
+#else
+#define DFU_HOST                        1
+#endif
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#if !DFU_HOST
+#include "main.h"
+#endif
+
+/* DFU class requests (DFU 1.1) */
+#define DFU_DETACH                      0x00U
+#define DFU_DNLOAD                      0x01U
+#define DFU_UPLOAD                      0x02U
+#define DFU_GETSTATUS                   0x03U
+#define DFU_CLRSTATUS                   0x04U
+#define DFU_GETSTATE                    0x05U
+#define DFU_ABORT                       0x06U
+
+/* bState */
+#define DFU_STATE_APP_IDLE              0x00U
+#define DFU_STATE_APP_DETACH            0x01U
+#define DFU_STATE_IDLE                  0x02U
+#define DFU_STATE_DNLOAD_SYNC           0x03U
+#define DFU_STATE_DNBUSY                0x04U
+#define DFU_STATE_DNLOAD_IDLE           0x05U
+#define DFU_STATE_MANIFEST_SYNC         0x06U
+#define DFU_STATE_MANIFEST              0x07U
+#define DFU_STATE_MANIFEST_WAIT_RESET   0x08U
+#define DFU_STATE_UPLOAD_IDLE           0x09U
+#define DFU_STATE_ERROR                 0x0AU
+
+/* bStatus */
+#define DFU_STATUS_OK                   0x00U
+#define DFU_STATUS_ERR_TARGET           0x01U   /* image larger than the bank */
+#define DFU_STATUS_ERR_WRITE            0x03U
+#define DFU_STATUS_ERR_ERASE            0x04U
+#define DFU_STATUS_ERR_CHECK_ERASED     0x05U
+#define DFU_STATUS_ERR_PROG             0x06U
+#define DFU_STATUS_ERR_VERIFY           0x07U   /* image CRC differs */
+#define DFU_STATUS_ERR_NOTDONE          0x09U   /* no verified image to boot */
+#define DFU_STATUS_ERR_FIRMWARE         0x0AU   /* not an image of this device */
+#define DFU_STATUS_ERR_STALLEDPKT       0x0FU   /* request out of sequence */
+
+/* Length of the DFU_GETSTATUS data */
+#define DFU_STATUS_LEN                  6U
+
+/* Largest DNLOAD block, wTransferSize of the functional descriptor */
+#define DFU_TRANSFER_SIZE               1024U
+
+/* Blocks received ahead of the flash: while one is free the host gets a
+   poll timeout of 0 and sends the next block at once */
+#ifndef DFU_BUFFERS
+#define DFU_BUFFERS                     4U
+#endif
+
+/* The inactive bank, at this address whichever bank the device boots from */
+#define DFU_BANK_ADDRESS                0x08100000U
+#define DFU_BANK_SIZE                   0x00100000U
+
+/* An image ends with the CRC-32/MPEG-2 of what precedes it, little endian */
+#define DFU_CRC_LEN                     4U
+
+/* Time left to the host to end the DFU_DETACH request before the reset */
+#define DFU_DETACH_MS                   50U
+
+/* Image bytes run through the CRC per Dfu_Process() call */
+#define DFU_VERIFY_SLICE                0x4000U
+
+/* Exported functions ------------------------------------------------------- */
+void Dfu_Init(void);
+int32_t Dfu_Request(uint8_t request, uint16_t value, uint16_t length, uint8_t **data);
+void Dfu_DataReceived(void);
+void Dfu_FlashIrq(void);
+uint32_t Dfu_Process(void);
+uint8_t Dfu_GetState(void);
+#if DFU_HOST
+uint8_t *Dfu_HostBank(void);
+uint32_t Dfu_HostBusyUs(void);
+uint32_t Dfu_HostResets(void);
+uint8_t Dfu_HostLocked(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DFU_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
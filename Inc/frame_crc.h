@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file    frame_crc.h
+  * @brief   Frame CRC: header file for frame_crc.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __FRAME_CRC_H
+#define __FRAME_CRC_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* CRC unit on the target, a model of it or the table on a host */
+#ifndef FRAME_CRC_HOST
+#if defined(STM32F429xx)
+#define FRAME_CRC_HOST                  0
+#else
+#define FRAME_CRC_HOST                  1
+#endif
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#if !FRAME_CRC_HOST
+#include "main.h"
+#endif
+
+/* CRC-32/MPEG-2 of the bytes in stream order: polynomial 0x04C11DB7 MSB
+   first, initial value 0xFFFFFFFF, no final XOR */
+#define FRAME_CRC_INIT                  0xFFFFFFFFU
+
+/* Shorter runs take the table, the CRC unit state is not worth restoring */
+#define FRAME_CRC_MIN_WORDS             4U
+
+/* Exported functions ------------------------------------------------------- */
+#if !FRAME_CRC_HOST
+void FrameCrc_Init(CRC_HandleTypeDef *hcrc);
+#else
+void FrameCrc_Init(void);
+#endif
+uint32_t FrameCrc_Update(uint32_t crc, const uint8_t *data, uint32_t len);
+uint32_t FrameCrc_Software(uint32_t crc, const uint8_t *data, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FRAME_CRC_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
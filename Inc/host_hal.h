@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * @file    host_hal.h
+  * @brief   HAL status type for the host builds of the media modules, whose
+  *          API returns it while they do not use the HAL there.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __HOST_HAL_H
+#define __HOST_HAL_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Same values as stm32f4xx_hal_def.h */
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HOST_HAL_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
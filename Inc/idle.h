@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * @file    idle.h
+  * @brief   Idle manager: header file for idle.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __IDLE_H
+#define __IDLE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Longest sleep without a tick, in ms */
+#define IDLE_MAX_SLEEP                  1000U
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t   sleeps;
+  uint32_t   asleep_us;      /* time spent in WFI, LATENCY_CLOCK_HZ ticks */
+} Idle_StatsTypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+void Idle_Init(TIM_HandleTypeDef *htim, PCD_HandleTypeDef *hpcd);
+void Idle_Process(uint8_t active);
+void Idle_Enter(uint32_t sleep_ms);
+void Idle_Kick(void);
+void Idle_GetStats(Idle_StatsTypeDef *stats);
+void Idle_Report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IDLE_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
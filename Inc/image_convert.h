@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file    image_convert.h
+  * @brief   Image conversion stage: header file for image_convert.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __IMAGE_CONVERT_H
+#define __IMAGE_CONVERT_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* DMA2D on the target, the software path alone on a host */
+#ifndef IMAGE_HOST
+#if defined(STM32F429xx)
+#define IMAGE_HOST                      0
+#else
+#define IMAGE_HOST                      1
+#endif
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#if !IMAGE_HOST
+#include "main.h"
+#else
+#include "host_hal.h"
+#endif
+
+/* Pixel formats, same encoding as the DMA2D color modes */
+#define IMAGE_FORMAT_ARGB8888           0U   /* uint32_t 0xAARRGGBB */
+#define IMAGE_FORMAT_RGB888             1U   /* 3 bytes B, G, R */
+#define IMAGE_FORMAT_RGB565             2U   /* uint16_t RRRRRGGGGGGBBBBB */
+
+/* 0: software only, the DMA2D is never used */
+#if IMAGE_HOST
+#undef IMAGE_USE_DMA2D
+#define IMAGE_USE_DMA2D                 0
+#elif !defined(IMAGE_USE_DMA2D)
+#define IMAGE_USE_DMA2D                 1
+#endif
+
+#define IMAGE_DMA2D_TIMEOUT             100U
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Image or rectangle inside an image */
+typedef struct
+{
+  void      *data;      /* first pixel */
+  uint16_t   width;     /* pixels */
+  uint16_t   height;    /* lines */
+  uint16_t   pitch;     /* pixels from one line to the next, >= width */
+  uint8_t    format;    /* IMAGE_FORMAT_xxx */
+} Image_TypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+#if !IMAGE_HOST
+HAL_StatusTypeDef Image_Init(DMA2D_HandleTypeDef *hdma2d);
+#else
+HAL_StatusTypeDef Image_Init(void);
+#endif
+void Image_SetAccelerated(uint8_t enable);
+void Image_View(const Image_TypeDef *img, uint16_t x, uint16_t y,
+                uint16_t width, uint16_t height, Image_TypeDef *view);
+HAL_StatusTypeDef Image_Copy(const Image_TypeDef *src, const Image_TypeDef *dst);
+HAL_StatusTypeDef Image_Fill(const Image_TypeDef *dst, uint32_t argb);
+HAL_StatusTypeDef Image_Blend(const Image_TypeDef *fg, const Image_TypeDef *bg,
+                              const Image_TypeDef *dst, uint8_t alpha);
+HAL_StatusTypeDef Image_Wait(void);
+#ifdef IMAGE_BENCHMARK
+void Image_Benchmark(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IMAGE_CONVERT_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * @file    latency.h
+  * @brief   Latency probe: header file for latency.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __LATENCY_H
+#define __LATENCY_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Source clock of the capture and payload timestamps, the UVC dwClockFrequency */
+#define LATENCY_CLOCK_HZ                1000000U
+
+/* The marker LED lights during one frame of this many (2 s at 15 fps) */
+#define LATENCY_MARK_PERIOD             30U
+
+/* Exported functions ------------------------------------------------------- */
+void Latency_Init(TIM_HandleTypeDef *htim);
+void Latency_ClockUpdate(void);
+uint32_t Latency_Now(void);
+void Latency_SetProbe(uint8_t enable);
+uint8_t Latency_GetProbe(void);
+uint32_t Latency_Capture(uint32_t frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LATENCY_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
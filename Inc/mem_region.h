@@ -0,0 +1,113 @@
+/**
+  ******************************************************************************
+  * @file    mem_region.h
+  * @brief   Memory region manager: header file for mem_region.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MEM_REGION_H
+#define __MEM_REGION_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Regions are the linker regions on the target, plain arrays on a host */
+#ifndef MEM_REGION_HOST
+#if defined(STM32F429xx)
+#define MEM_REGION_HOST                 0
+#else
+#define MEM_REGION_HOST                 1
+#endif
+#endif
+
+/* External SDRAM on FMC bank 2 (IS42S16400J wiring of the STM32F429I-DISCO).
+   Off on the Nucleo: no SDRAM is fitted and PD8/PD9, the ST-LINK console,
+   are FMC data lines. */
+#ifndef MEM_USE_SDRAM
+#define MEM_USE_SDRAM                   0
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#if !MEM_REGION_HOST
+#include "main.h"
+#endif
+
+/* Regions */
+#define MEM_REGION_SRAM1                0U   /* 112 KB, own bus matrix slave, DMA capable */
+#define MEM_REGION_CCM                  1U   /* 64 KB core coupled, no wait state, CPU only */
+#define MEM_REGION_SDRAM                2U   /* 8 MB FMC SDRAM, DMA and DMA2D capable */
+#define MEM_REGION_NUM                  3U
+
+#define MEM_SRAM1_BASE                  0x20000000U
+#define MEM_SRAM1_SIZE                  0x0001C000U
+#define MEM_CCM_BASE                    0x10000000U
+#define MEM_CCM_SIZE                    0x00010000U
+#define MEM_SDRAM_BASE                  0xD0000000U
+#define MEM_SDRAM_SIZE                  0x00800000U
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Placement of static objects: hot state the CPU alone touches goes to CCM,
+   buffers of a DMA to SRAM1, large frame buffers to SDRAM (not cleared at
+   startup, only valid once MemRegion_Init() found the SDRAM). */
+#if MEM_REGION_HOST
+#define MEM_SRAM1
+#define MEM_CCMRAM
+#define MEM_SDRAM
+#elif defined(__CC_ARM)
+#define MEM_SRAM1                       __attribute__((section(".sram1"), zero_init))
+#define MEM_CCMRAM                      __attribute__((section(".ccmram"), zero_init))
+#define MEM_SDRAM                       __attribute__((section(".sdram"), zero_init))
+#else
+#define MEM_SRAM1                       __attribute__((section(".sram1")))
+#define MEM_CCMRAM                      __attribute__((section(".ccmram")))
+#define MEM_SDRAM                       __attribute__((section(".sdram")))
+#endif
+
+/* Typed allocation of count objects of type in a region, NULL if it does not fit */
+#define MEM_REGION_NEW(region, type, count)                                        \
+  ((type *)MemRegion_Alloc((region), (uint32_t)(sizeof(type) * (count)), __alignof__(type)))
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  const char   *name;
+  uint8_t      *base;
+  uint32_t      size;
+  uint32_t      placed;      /* bytes of static objects placed by the linker */
+  uint32_t      allocated;   /* bytes handed out by MemRegion_Alloc(), alignment included */
+  uint8_t       present;     /* 0: the memory is not available */
+} MemRegion_InfoTypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+#if !MEM_REGION_HOST && MEM_USE_SDRAM
+HAL_StatusTypeDef MemRegion_SdramInit(SDRAM_HandleTypeDef *hsdram);
+void MemRegion_SdramClock(uint32_t hclk);
+#endif
+void MemRegion_Init(void);
+void *MemRegion_Alloc(uint8_t region, uint32_t size, uint32_t align);
+int32_t MemRegion_GetInfo(uint8_t region, MemRegion_InfoTypeDef *info);
+void MemRegion_Report(void);
+#ifdef MEM_BENCHMARK
+void MemRegion_Benchmark(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MEM_REGION_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file    motion.h
+  * @brief   Motion detector: header file for motion.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MOTION_H
+#define __MOTION_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Capture throttle on the target, a hook of the test program on a host, where
+   the CMSIS-DSP functions build with ARM_MATH_CM0 */
+#ifndef MOTION_HOST
+#if defined(STM32F429xx)
+#define MOTION_HOST                     0
+#else
+#define MOTION_HOST                     1
+#endif
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#if !MOTION_HOST
+#include "main.h"
+#else
+#include "host_hal.h"
+#endif
+
+/* Modes */
+#define MOTION_MODE_OFF                 0U   /* every frame is streamed */
+#define MOTION_MODE_SKIP                1U   /* static frames are left out */
+#define MOTION_MODE_RATE                2U   /* the capture drops to 1 of 4 frames while static */
+
+/* Luma blocks compared from frame to frame, 16x16 pixels at 640x480 */
+#define MOTION_GRID_WIDTH               40U
+#define MOTION_GRID_HEIGHT              30U
+
+/* Default score above which the scene is moving */
+#define MOTION_THRESHOLD_DEFAULT        6U
+
+/* Frames under the threshold before the scene is static */
+#define MOTION_STATIC_FRAMES            5U
+
+/* While static and skipping, one frame of this many is still streamed (1 s at 15 fps) */
+#define MOTION_KEEPALIVE_FRAMES         15U
+
+/* Streams asking Motion_SkipFrame(), each keeps its own keep-alive count */
+#define MOTION_MAX_STREAMS              2U
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef Motion_Init(uint16_t width, uint16_t height);
+void Motion_PushLines(const uint8_t *y, uint32_t pitch, uint32_t lines);
+void Motion_SetMode(uint8_t mode);
+void Motion_SetThreshold(uint8_t threshold);
+uint8_t Motion_GetScore(void);
+uint8_t Motion_SkipFrame(uint8_t stream);
+void Motion_Process(void);
+#if MOTION_HOST
+void Motion_HostThrottle(uint8_t enable);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MOTION_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
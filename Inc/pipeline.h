@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file    pipeline.h
+  * @brief   Capture, encode and USB tasks: header file for pipeline.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __PIPELINE_H
+#define __PIPELINE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Tasks on a CMSIS-RTOS2 kernel (RTX5 from the CMSIS pack on the target, the
+   pthread shim of Utilities/rtos2_posix on a host), main loop otherwise */
+#ifndef PIPELINE_USE_RTOS
+#if defined(STM32F429xx)
+#define PIPELINE_USE_RTOS               0
+#else
+#define PIPELINE_USE_RTOS               1
+#endif
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#if PIPELINE_USE_RTOS
+#include "cmsis_os2.h"
+#endif
+
+/* Buffers of each stage: one being filled while the other is in flight */
+#define PIPELINE_BUFFERS                2U
+
+/* Milliseconds between two capture attempts while no function wants frames */
+#define PIPELINE_IDLE_DELAY             5U
+
+/* Milliseconds after which the USB task checks a frame again without a
+   FrameDone, a stopped stream drops its frame silently */
+#define PIPELINE_SEND_POLL              10U
+
+/* Stack of each task, in bytes */
+#define PIPELINE_STACK_SIZE             1024U
+
+/* Priorities: the USB task only hands buffers over and must catch the next
+   frame interval, the capture task follows the sensor, the encoder takes the
+   CPU time left. */
+#define PIPELINE_PRIO_USB               osPriorityHigh
+#define PIPELINE_PRIO_CAPTURE           osPriorityAboveNormal
+#define PIPELINE_PRIO_ENCODE            osPriorityNormal
+
+/* Buffer flags */
+#define PIPELINE_FLAG_KEY               0x01U   /* encode a key frame */
+
+/* Exported types ------------------------------------------------------------*/
+
+/* A buffer travels between the tasks by reference, never copied */
+typedef struct
+{
+  uint8_t   *data;
+  uint32_t   size;       /* bytes available at data */
+  uint32_t   len;        /* bytes used */
+  uint32_t   frame;      /* frame number */
+  uint32_t   capture;    /* capture time, USBD_UVC_CLOCK() */
+  uint8_t    streams;    /* functions the frame is for, one bit each */
+  uint8_t    flags;      /* PIPELINE_FLAG_xxx */
+} Pipeline_BufferTypeDef;
+
+/* Stages, each one called from its own task */
+typedef struct
+{
+  int32_t  (*Capture)(Pipeline_BufferTypeDef *raw);     /* 0 when raw holds a frame */
+  uint32_t (*Encode)(const Pipeline_BufferTypeDef *raw,
+                     Pipeline_BufferTypeDef *out);      /* out->len, 0 to drop the frame */
+  void     (*Send)(const Pipeline_BufferTypeDef *out);  /* hands out to the USB class */
+  uint8_t  (*Busy)(const Pipeline_BufferTypeDef *out);  /* 1 while a function reads out */
+} Pipeline_OpsTypeDef;
+
+typedef struct
+{
+  uint32_t   captured;
+  uint32_t   encoded;
+  uint32_t   sent;
+  uint32_t   dropped;    /* frames the encoder gave up */
+  uint32_t   encode_max; /* longest encode, in kernel ticks */
+} Pipeline_StatsTypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+#if PIPELINE_USE_RTOS
+int32_t Pipeline_Init(const Pipeline_OpsTypeDef *ops, Pipeline_BufferTypeDef *raw,
+                      Pipeline_BufferTypeDef *out);
+void Pipeline_FrameSent(void);
+void Pipeline_GetStats(Pipeline_StatsTypeDef *stats);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PIPELINE_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
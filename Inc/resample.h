@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * @file    resample.h
+  * @brief   Line streaming image resampler: header file for resample.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __RESAMPLE_H
+#define __RESAMPLE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Cortex-M4 DSP on the target; on a host, the portable C of the same CMSIS-DSP
+   functions, built with ARM_MATH_CM0 */
+#ifndef RESAMPLE_HOST
+#if defined(STM32F429xx)
+#define RESAMPLE_HOST                   0
+#else
+#define RESAMPLE_HOST                   1
+#endif
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#if !RESAMPLE_HOST
+#include "main.h"
+#else
+#include "host_hal.h"
+#endif
+#include "arm_math.h"
+
+/* Filters */
+#define RESAMPLE_BOX                    0U   /* mean of the covered input pixels */
+#define RESAMPLE_BILINEAR               1U   /* pixel centers aligned */
+
+/* Downscaling only, up to this ratio on each axis */
+#define RESAMPLE_MAX_RATIO              16U
+
+/* Work area of a resampler producing lines of out_width pixels, in 32-bit words */
+#define RESAMPLE_WORK_WORDS(out_width)  ((10U * (out_width) + 5U) / 4U)
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Resampler of one 8-bit plane (Y, Cb or Cr), fed line by line */
+typedef struct
+{
+  uint16_t   in_width;
+  uint16_t   in_height;
+  uint16_t   out_width;
+  uint16_t   out_height;
+  uint8_t    mode;        /* RESAMPLE_xxx */
+  uint32_t   step_x;      /* input pixels per output pixel, Q16 */
+  uint32_t   step_y;
+  uint16_t   in_line;     /* index of the next input line */
+  uint16_t   out_line;    /* index of the next output line */
+  uint16_t  *x0;          /* first input pixel of each output pixel, box: out_width + 1 entries */
+  q15_t     *fx;          /* bilinear: weight of the right pixel, Q15 */
+  q15_t     *line[2];     /* bilinear: last two input lines resampled horizontally, pixel x 128 */
+  q15_t     *tmp;         /* bilinear: vertical interpolation */
+  uint16_t  *sum;         /* box: sums of the input pixels of the current output line */
+} Resample_TypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef Resample_Init(Resample_TypeDef *rs, uint8_t mode,
+                                uint16_t in_width, uint16_t in_height,
+                                uint16_t out_width, uint16_t out_height, uint32_t *work);
+uint32_t Resample_PushLine(Resample_TypeDef *rs, const uint8_t *in, uint8_t *out);
+uint32_t Resample_PushStrip(Resample_TypeDef *rs, const uint8_t *in, uint32_t in_pitch, uint32_t lines,
+                            uint8_t *out, uint32_t out_pitch);
+#ifdef RESAMPLE_BENCHMARK
+void Resample_Benchmark(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RESAMPLE_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,174 @@
+/**
+  ******************************************************************************
+  * @file    sensor.h
+  * @brief   Image sensor control layer: header file for sensor.c and the
+  *          sensor backends.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SENSOR_H
+#define __SENSOR_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* I2C with DMA on the target, a model of the bus and a mock sensor on a host */
+#ifndef SENSOR_HOST
+#if defined(STM32F429xx)
+#define SENSOR_HOST                     0
+#else
+#define SENSOR_HOST                     1
+#endif
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#if !SENSOR_HOST
+#include "main.h"
+#endif
+
+#define SENSOR_I2C_TIMEOUT              10U
+
+/* A batch is applied at the next frame boundary, or after this delay when no frame is streamed */
+#define SENSOR_BATCH_TIMEOUT_MS         100U
+
+/* Pseudo register of a batch: wait value ms before the next write */
+#define SENSOR_REG_DELAY                0xFFFFU
+
+/* Bank select register of a banked sensor */
+#define SENSOR_BANK_REG                 0xFFU
+
+/* Sends of a write before its batch is given up */
+#define SENSOR_WRITE_TRIES              3U
+
+/* Longest control register list of a backend */
+#define SENSOR_CTRL_REGS_MAX            16U
+
+/* White balance temperature range the backends map onto their channel gains */
+#define SENSOR_WB_TEMPERATURE_MIN       2800
+#define SENSOR_WB_TEMPERATURE_MAX       6500
+
+#if SENSOR_HOST
+/* Register map of the mock sensor, bank in [15:8] */
+#define SENSOR_MOCK_ADDRESS             0x5AU
+#define SENSOR_MOCK_ID                  0x4DU
+#define SENSOR_MOCK_RESET_MS            5U      /* writes are not acknowledged meanwhile */
+#define SENSOR_MOCK_REG_ID              0x010AU
+#define SENSOR_MOCK_REG_RESET           0x0012U /* [7] reset */
+#define SENSOR_MOCK_REG_FORMAT          0x0040U
+#define SENSOR_MOCK_REG_WIDTH8          0x0041U
+#define SENSOR_MOCK_REG_HEIGHT8         0x0042U
+#define SENSOR_MOCK_REG_FLAGS           0x0110U
+#define SENSOR_MOCK_REG_EXPOSURE_HI     0x0111U
+#define SENSOR_MOCK_REG_EXPOSURE_LO     0x0112U
+#define SENSOR_MOCK_REG_BRIGHTNESS      0x0113U
+#define SENSOR_MOCK_REG_CONTRAST        0x0114U
+#define SENSOR_MOCK_REG_GAIN_HI         0x0115U
+#define SENSOR_MOCK_REG_GAIN_LO         0x0116U
+#define SENSOR_MOCK_REG_WB_HI           0x0118U
+#define SENSOR_MOCK_REG_WB_LO           0x0119U
+#define SENSOR_MOCK_FLAG_AE             0x01U
+#define SENSOR_MOCK_FLAG_AWB            0x02U
+#define SENSOR_MOCK_FLAG_BAND           0x04U
+#define SENSOR_MOCK_FLAG_HZ50           0x08U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Image controls exposed by the sensor, one pending slot each */
+typedef enum
+{
+  SENSOR_CTRL_AUTO_EXPOSURE = 0,   /* 0: manual exposure and gain, 1: automatic */
+  SENSOR_CTRL_EXPOSURE,            /* exposure time, 100 us units */
+  SENSOR_CTRL_BRIGHTNESS,          /* -127..127 */
+  SENSOR_CTRL_CONTRAST,            /* 0..255 */
+  SENSOR_CTRL_GAIN,                /* 0..1023, analog gain x16 */
+  SENSOR_CTRL_POWER_LINE,          /* 0: off, 1: 50 Hz, 2: 60 Hz */
+  SENSOR_CTRL_WB_TEMPERATURE,      /* white balance temperature, Kelvin */
+  SENSOR_CTRL_WB_AUTO,             /* 0: manual white balance, 1: automatic */
+  SENSOR_CTRL_NUM
+} Sensor_ControlTypeDef;
+
+/* One register write of a batch */
+typedef struct
+{
+  uint16_t   reg;        /* register, bank in [15:8] on a banked sensor */
+  uint8_t    value;      /* value, or ms for SENSOR_REG_DELAY */
+} Sensor_RegTypeDef;
+
+/* Completion of a batch: 0 when every write was acknowledged. Interrupt
+   context, or main loop after a bus timeout. */
+typedef void (*Sensor_DoneTypeDef)(int32_t status);
+
+/* Sensor backend, const in flash */
+typedef struct
+{
+  const char                *name;
+  uint8_t                    address;    /* SCCB write address, shifted for the HAL */
+  uint8_t                    reg_size;   /* register address bytes: 1 or 2 */
+  uint8_t                    banked;     /* 1: bank of reg [15:8] selected through SENSOR_BANK_REG */
+  uint16_t                   id_reg;     /* product ID, read to probe */
+  uint8_t                    id;
+  const Sensor_RegTypeDef   *init;       /* reset and VGA RGB565 output */
+  uint16_t                   init_len;
+  const Sensor_RegTypeDef   *ctrl;       /* registers driven by the controls, reset values */
+  uint8_t                    ctrl_len;
+  /* register values of the controls, regs holds the last values written */
+  void (*Build)(const int32_t *state, uint8_t *regs);
+} Sensor_DriverTypeDef;
+
+typedef struct
+{
+  uint32_t   batches;    /* batches completed */
+  uint32_t   writes;     /* register writes acknowledged */
+  uint32_t   retries;    /* writes sent again after a bus error */
+  uint32_t   errors;     /* batches given up */
+} Sensor_StatsTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+extern const Sensor_DriverTypeDef Sensor_OV7670;
+extern const Sensor_DriverTypeDef Sensor_OV2640;
+extern const Sensor_DriverTypeDef Sensor_OV5640;
+#if SENSOR_HOST
+extern const Sensor_DriverTypeDef Sensor_Mock;
+#endif
+
+/* Exported functions ------------------------------------------------------- */
+#if !SENSOR_HOST
+int32_t Sensor_Init(I2C_HandleTypeDef *hi2c);
+#else
+int32_t Sensor_Init(void);
+#endif
+int32_t Sensor_Write(const Sensor_RegTypeDef *regs, uint32_t len, Sensor_DoneTypeDef done);
+uint8_t Sensor_Busy(void);
+void Sensor_SetControl(Sensor_ControlTypeDef ctrl, int32_t value);
+void Sensor_FrameBoundary(void);
+uint32_t Sensor_Process(void);
+void Sensor_BusClockChanged(void);
+const char *Sensor_GetName(void);
+void Sensor_GetStats(Sensor_StatsTypeDef *stats);
+#if SENSOR_HOST
+uint32_t Sensor_HostTime(void);
+int32_t Sensor_HostRead(uint8_t address, uint16_t reg, uint8_t *value);
+int32_t Sensor_HostWrite(uint8_t address, uint16_t reg, uint8_t value);
+void Sensor_HostComplete(int32_t status);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SENSOR_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file    stats.h
+  * @brief   Streaming statistics: header file for stats.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STATS_H
+#define __STATS_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Exclusive access and TIM2 on the target, atomic builtins and a time hook
+   of the test program on a host */
+#ifndef STATS_HOST
+#if defined(STM32F429xx)
+#define STATS_HOST                      0
+#else
+#define STATS_HOST                      1
+#endif
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#if !STATS_HOST
+#include "main.h"
+#endif
+
+/* Rows of counters: one per UVC function (USBD_UVC_NUM_INSTANCES), then the
+   device row */
+#define STATS_NUM_STREAMS               2U
+#define STATS_DEVICE                    STATS_NUM_STREAMS
+#define STATS_ROWS                      (STATS_NUM_STREAMS + 1U)
+
+/* Counters of a stream row */
+#define STATS_FRAMES                    0U   /* frames sent, up to the EOF payload */
+#define STATS_BYTES                     1U   /* payload bytes sent, headers included */
+#define STATS_UNDERRUNS                 2U   /* frame intervals sent empty, no frame was ready */
+#define STATS_SKIPPED                   3U   /* frame intervals left empty on a static scene */
+#define STATS_DROPPED                   4U   /* frames captured for the stream and never sent */
+#define STATS_ISO_INCOMPLETE            5U   /* USB frames the isochronous IN transfers missed */
+#define STATS_STREAM_COUNTERS           6U
+
+/* Counters of the device row */
+#define STATS_ENCODED                   0U   /* frames encoded */
+#define STATS_ENCODE_TIME               1U   /* us spent encoding */
+#define STATS_ENCODE_MAX                2U   /* longest encode in us, a maximum, not a sum */
+#define STATS_DEVICE_COUNTERS           3U
+
+#define STATS_COUNTERS                  STATS_STREAM_COUNTERS
+
+/* Length of the rate window, in us of the TIM2 clock */
+#define STATS_WINDOW_US                 1000000U
+
+/* Windows between two console reports, 0 for none */
+#ifndef STATS_REPORT_WINDOWS
+#define STATS_REPORT_WINDOWS            10U
+#endif
+
+/* Bytes written by Stats_GetInfo(): little endian dwords, the time then
+   the counters of the stream row and of the device row */
+#define STATS_INFO_LEN                  ((1U + STATS_STREAM_COUNTERS + STATS_DEVICE_COUNTERS) * 4U)
+
+/* Exported functions ------------------------------------------------------- */
+void Stats_Init(void);
+void Stats_Add(uint32_t row, uint32_t counter, uint32_t value);
+void Stats_Max(uint32_t row, uint32_t counter, uint32_t value);
+uint32_t Stats_Process(void);
+void Stats_GetInfo(uint8_t stream, uint8_t rates, uint8_t *data);
+void Stats_Report(void);
+#if STATS_HOST
+uint32_t Stats_HostTime(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STATS_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,1021 @@
+/* Test clips of test_pattern.c: 80x60 pixels, 16 color palette.
+   Every frame is run length coded line by line, one byte per run: bits 7..4
+   run length - 1 (1 to 16 pixels), bits 3..0 palette index. The line table
+   gives the offset of each line of each frame (frame * TEST_CLIP_HEIGHT +
+   line), plus the end of the data, so that any line decodes on its own. */
+
+#ifndef AC_TEST_CLIPS
+#define AC_TEST_CLIPS
+
+#define TEST_CLIP_WIDTH                 80U
+#define TEST_CLIP_HEIGHT                60U
+
+/* Y, Cb, Cr */
+static const unsigned char _acCLIP_PALETTE[16][3] = {
+  { 77, 172, 108 },
+  { 108, 169, 105 },
+  { 141, 162, 106 },
+  { 173, 154, 107 },
+  { 108, 105, 99 },
+  { 91, 104, 198 },
+  { 182, 112, 164 },
+  { 30, 135, 127 },
+  { 189, 58, 152 },
+  { 154, 158, 65 },
+  { 125, 164, 180 },
+  { 226, 128, 128 },
+  { 119, 128, 128 },
+  { 72, 111, 106 },
+  { 154, 63, 184 },
+  { 16, 128, 128 }
+};
+
+#define TEST_CLIP_BALL_FRAMES             16U
+static const unsigned short _acCLIP_BALL_LINES[16 * TEST_CLIP_HEIGHT + 1] = {
+  0, 5, 10, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 65, 70, 75,
+  80, 85, 90, 95, 100, 105, 110, 115, 120, 125, 130, 135, 140, 145, 150, 155,
+  160, 165, 170, 175, 182, 189, 198, 207, 215, 223, 229, 235, 242, 249, 256, 263,
+  268, 288, 308, 328, 348, 368, 388, 408, 428, 448, 468, 488, 508, 513, 518, 523,
+  528, 533, 538, 543, 548, 553, 558, 563, 568, 573, 578, 583, 588, 593, 598, 603,
+  608, 613, 619, 625, 633, 641, 649, 657, 663, 669, 675, 681, 687, 693, 698, 703,
+  708, 713, 718, 723, 728, 733, 738, 743, 748, 753, 758, 763, 768, 788, 808, 828,
+  848, 868, 888, 908, 928, 948, 968, 988, 1008, 1013, 1018, 1023, 1028, 1033, 1038, 1043,
+  1048, 1053, 1058, 1063, 1069, 1075, 1083, 1091, 1099, 1107, 1113, 1119, 1125, 1131, 1137, 1143,
+  1148, 1153, 1158, 1163, 1168, 1173, 1178, 1183, 1188, 1193, 1198, 1203, 1208, 1213, 1218, 1223,
+  1228, 1233, 1238, 1243, 1248, 1253, 1258, 1263, 1268, 1288, 1308, 1328, 1348, 1368, 1388, 1408,
+  1428, 1448, 1468, 1488, 1508, 1513, 1518, 1523, 1528, 1533, 1540, 1547, 1555, 1563, 1571, 1579,
+  1585, 1591, 1597, 1603, 1610, 1617, 1622, 1627, 1632, 1637, 1642, 1647, 1652, 1657, 1662, 1667,
+  1672, 1677, 1682, 1687, 1692, 1697, 1702, 1707, 1712, 1717, 1722, 1727, 1732, 1737, 1742, 1747,
+  1752, 1757, 1762, 1767, 1772, 1792, 1812, 1832, 1852, 1872, 1892, 1912, 1932, 1952, 1972, 1992,
+  2012, 2017, 2022, 2027, 2034, 2041, 2050, 2059, 2068, 2077, 2084, 2091, 2098, 2105, 2112, 2119,
+  2124, 2129, 2134, 2139, 2144, 2149, 2154, 2159, 2164, 2169, 2174, 2179, 2184, 2189, 2194, 2199,
+  2204, 2209, 2214, 2219, 2224, 2229, 2234, 2239, 2244, 2249, 2254, 2259, 2264, 2269, 2274, 2279,
+  2284, 2304, 2324, 2344, 2364, 2384, 2404, 2424, 2444, 2464, 2484, 2504, 2524, 2529, 2534, 2539,
+  2544, 2549, 2556, 2562, 2570, 2578, 2586, 2594, 2600, 2606, 2612, 2618, 2624, 2631, 2636, 2641,
+  2646, 2651, 2656, 2661, 2666, 2671, 2676, 2681, 2686, 2691, 2696, 2701, 2706, 2711, 2716, 2721,
+  2726, 2731, 2736, 2741, 2746, 2751, 2756, 2761, 2766, 2771, 2776, 2781, 2786, 2806, 2826, 2846,
+  2866, 2886, 2906, 2926, 2946, 2966, 2986, 3006, 3026, 3031, 3036, 3041, 3046, 3051, 3056, 3061,
+  3066, 3071, 3076, 3081, 3087, 3093, 3101, 3109, 3117, 3125, 3131, 3137, 3143, 3149, 3155, 3161,
+  3166, 3171, 3176, 3181, 3186, 3191, 3196, 3201, 3206, 3211, 3216, 3221, 3226, 3231, 3236, 3241,
+  3246, 3251, 3256, 3261, 3266, 3271, 3276, 3281, 3286, 3306, 3326, 3346, 3366, 3386, 3406, 3426,
+  3446, 3466, 3486, 3506, 3526, 3531, 3536, 3541, 3546, 3551, 3556, 3561, 3566, 3571, 3576, 3581,
+  3586, 3591, 3596, 3601, 3606, 3611, 3616, 3621, 3626, 3631, 3638, 3644, 3652, 3660, 3668, 3676,
+  3682, 3688, 3694, 3700, 3706, 3713, 3718, 3723, 3728, 3733, 3738, 3743, 3748, 3753, 3758, 3763,
+  3768, 3773, 3778, 3783, 3788, 3808, 3828, 3848, 3868, 3888, 3908, 3928, 3948, 3968, 3988, 4008,
+  4028, 4033, 4038, 4043, 4048, 4053, 4058, 4063, 4068, 4073, 4078, 4083, 4088, 4093, 4098, 4103,
+  4108, 4113, 4118, 4123, 4128, 4133, 4138, 4143, 4148, 4153, 4158, 4163, 4168, 4173, 4178, 4183,
+  4188, 4193, 4198, 4203, 4210, 4217, 4226, 4235, 4244, 4253, 4260, 4267, 4274, 4281, 4288, 4295,
+  4300, 4320, 4340, 4360, 4380, 4400, 4420, 4440, 4460, 4480, 4500, 4520, 4540, 4545, 4550, 4555,
+  4560, 4565, 4570, 4575, 4580, 4585, 4590, 4595, 4600, 4605, 4610, 4615, 4620, 4625, 4630, 4635,
+  4640, 4645, 4652, 4658, 4666, 4674, 4682, 4690, 4696, 4702, 4708, 4714, 4720, 4727, 4732, 4737,
+  4742, 4747, 4752, 4757, 4762, 4767, 4772, 4777, 4782, 4787, 4792, 4797, 4802, 4822, 4842, 4862,
+  4882, 4902, 4922, 4942, 4962, 4982, 5002, 5022, 5042, 5047, 5052, 5057, 5062, 5067, 5072, 5077,
+  5082, 5087, 5092, 5097, 5103, 5109, 5117, 5125, 5133, 5141, 5147, 5153, 5159, 5165, 5171, 5177,
+  5182, 5187, 5192, 5197, 5202, 5207, 5212, 5217, 5222, 5227, 5232, 5237, 5242, 5247, 5252, 5257,
+  5262, 5267, 5272, 5277, 5282, 5287, 5292, 5297, 5302, 5322, 5342, 5362, 5382, 5402, 5422, 5442,
+  5462, 5482, 5502, 5522, 5542, 5547, 5552, 5557, 5562, 5567, 5574, 5580, 5588, 5596, 5604, 5612,
+  5618, 5624, 5630, 5636, 5642, 5649, 5654, 5659, 5664, 5669, 5674, 5679, 5684, 5689, 5694, 5699,
+  5704, 5709, 5714, 5719, 5724, 5729, 5734, 5739, 5744, 5749, 5754, 5759, 5764, 5769, 5774, 5779,
+  5784, 5789, 5794, 5799, 5804, 5824, 5844, 5864, 5884, 5904, 5924, 5944, 5964, 5984, 6004, 6024,
+  6044, 6049, 6054, 6059, 6066, 6073, 6082, 6091, 6100, 6109, 6116, 6123, 6130, 6137, 6144, 6151,
+  6156, 6161, 6166, 6171, 6176, 6181, 6186, 6191, 6196, 6201, 6206, 6211, 6216, 6221, 6226, 6231,
+  6236, 6241, 6246, 6251, 6256, 6261, 6266, 6271, 6276, 6281, 6286, 6291, 6296, 6301, 6306, 6311,
+  6316, 6336, 6356, 6376, 6396, 6416, 6436, 6456, 6476, 6496, 6516, 6536, 6556, 6561, 6566, 6571,
+  6576, 6581, 6588, 6595, 6603, 6611, 6619, 6627, 6633, 6639, 6645, 6651, 6658, 6665, 6670, 6675,
+  6680, 6685, 6690, 6695, 6700, 6705, 6710, 6715, 6720, 6725, 6730, 6735, 6740, 6745, 6750, 6755,
+  6760, 6765, 6770, 6775, 6780, 6785, 6790, 6795, 6800, 6805, 6810, 6815, 6820, 6840, 6860, 6880,
+  6900, 6920, 6940, 6960, 6980, 7000, 7020, 7040, 7060, 7065, 7070, 7075, 7080, 7085, 7090, 7095,
+  7100, 7105, 7110, 7115, 7121, 7127, 7135, 7143, 7151, 7159, 7165, 7171, 7177, 7183, 7189, 7195,
+  7200, 7205, 7210, 7215, 7220, 7225, 7230, 7235, 7240, 7245, 7250, 7255, 7260, 7265, 7270, 7275,
+  7280, 7285, 7290, 7295, 7300, 7305, 7310, 7315, 7320, 7340, 7360, 7380, 7400, 7420, 7440, 7460,
+  7480, 7500, 7520, 7540, 7560, 7565, 7570, 7575, 7580, 7585, 7590, 7595, 7600, 7605, 7610, 7615,
+  7620, 7625, 7630, 7635, 7640, 7645, 7650, 7655, 7660, 7665, 7671, 7677, 7685, 7693, 7701, 7709,
+  7715, 7721, 7727, 7733, 7739, 7745, 7750, 7755, 7760, 7765, 7770, 7775, 7780, 7785, 7790, 7795,
+  7800, 7805, 7810, 7815, 7820, 7840, 7860, 7880, 7900, 7920, 7940, 7960, 7980, 8000, 8020, 8040,
+  8060
+};
+static const unsigned char _acCLIP_BALL[8060U] = {
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x72, 0x35, 0xF2, 0xF2, 0xF2,
+  0xF2, 0x32, 0x53, 0x75, 0xF3, 0xF3, 0xF3, 0xF3, 0x13, 0x43, 0x15, 0x16, 0x55, 0xF3, 0xF3, 0xF3, 0xF3, 0x03, 0x43, 0x05,
+  0x36, 0x45, 0xF3, 0xF3, 0xF3, 0xF3, 0x03, 0x33, 0x15, 0x36, 0x55, 0xF3, 0xF3, 0xF3, 0xF3, 0x33, 0x25, 0x16, 0x65, 0xF3,
+  0xF3, 0xF3, 0xF3, 0x33, 0xB5, 0xF3, 0xF3, 0xF3, 0xF3, 0x33, 0xB5, 0xF3, 0xF3, 0xF3, 0xF3, 0x43, 0x95, 0xF3, 0xF3, 0xF3,
+  0xF3, 0x03, 0x43, 0x95, 0xF3, 0xF3, 0xF3, 0xF3, 0x03, 0x53, 0x75, 0xF3, 0xF3, 0xF3, 0xF3, 0x13, 0x73, 0x35, 0xF3, 0xF3,
+  0xF3, 0xF3, 0x33, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xA1, 0x45, 0xF1, 0xF1, 0xF1, 0xF1, 0x91,
+  0x75, 0xF1, 0xF1, 0xF1, 0xD1, 0x81, 0x05, 0x26, 0x55, 0xF1, 0xF1, 0xF1, 0xC1, 0x72, 0x15, 0x36, 0x45, 0xF2, 0xF2, 0xF2,
+  0xC2, 0x72, 0x15, 0x36, 0x55, 0xF2, 0xF2, 0xF2, 0xB2, 0x72, 0x15, 0x26, 0x65, 0xF2, 0xF2, 0xF2, 0xB2, 0x72, 0xB5, 0xF2,
+  0xF2, 0xF2, 0xB2, 0x72, 0xB5, 0xF2, 0xF2, 0xF2, 0xB2, 0x72, 0xA5, 0xF2, 0xF2, 0xF2, 0xC2, 0x82, 0x95, 0xF2, 0xF2, 0xF2,
+  0xC2, 0x92, 0x75, 0xF2, 0xF2, 0xF2, 0xD2, 0xA2, 0x45, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xE0, 0x45, 0xF0, 0xF0, 0xF0, 0xB0, 0xD1, 0x65, 0xF1, 0xF1, 0xF1, 0xA1, 0xC1, 0x05, 0x26, 0x45, 0xF1,
+  0xF1, 0xF1, 0x91, 0xB1, 0x15, 0x26, 0x55, 0xF1, 0xF1, 0xF1, 0x81, 0xB1, 0x15, 0x26, 0x55, 0xF1, 0xF1, 0xF1, 0x81, 0xB1,
+  0x15, 0x26, 0x55, 0xF1, 0xF1, 0xF1, 0x81, 0xB1, 0xA5, 0xF1, 0xF1, 0xF1, 0x81, 0xB1, 0xA5, 0xF1, 0xF1, 0xF1, 0x81, 0xB1,
+  0xA5, 0xF1, 0xF1, 0xF1, 0x81, 0xC1, 0x85, 0xF1, 0xF1, 0xF1, 0x91, 0xD1, 0x65, 0xF1, 0xF1, 0xF1, 0xA1, 0xE1, 0x45, 0xF1,
+  0xF1, 0xF1, 0xB1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x20, 0x45, 0xF0, 0xF0, 0xF0, 0x70,
+  0xF0, 0x00, 0x75, 0xF0, 0xF0, 0xF0, 0x60, 0xF0, 0x15, 0x26, 0x45, 0xF0, 0xF0, 0xF0, 0x50, 0xF0, 0x05, 0x36, 0x55, 0xF0,
+  0xF0, 0xF0, 0x40, 0xE0, 0x15, 0x36, 0x55, 0xF0, 0xF0, 0xF0, 0x40, 0xE0, 0x25, 0x26, 0x55, 0xF0, 0xF0, 0xF0, 0x40, 0xE0,
+  0xB5, 0xF0, 0xF0, 0xF0, 0x40, 0xE1, 0xB5, 0xF1, 0xF1, 0xF1, 0x41, 0xF1, 0xA5, 0xF1, 0xF1, 0xF1, 0x41, 0xF1, 0x95, 0xF1,
+  0xF1, 0xF1, 0x51, 0xF1, 0x01, 0x75, 0xF1, 0xF1, 0xF1, 0x61, 0xF1, 0x21, 0x45, 0xF1, 0xF1, 0xF1, 0x71, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, 0x35, 0xF0, 0xF0, 0xF0, 0x40, 0xF0, 0x40, 0x75, 0xF0, 0xF0, 0xF0,
+  0x20, 0xF0, 0x30, 0x15, 0x16, 0x55, 0xF0, 0xF0, 0xF0, 0x10, 0xF0, 0x30, 0x05, 0x36, 0x45, 0xF0, 0xF0, 0xF0, 0x10, 0xF0,
+  0x20, 0x15, 0x36, 0x55, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0x20, 0x25, 0x16, 0x65, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0x20, 0xB5,
+  0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0x20, 0xB5, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0x30, 0x95, 0xF0, 0xF0, 0xF0, 0x10, 0xF1, 0x31,
+  0x95, 0xF1, 0xF1, 0xF1, 0x11, 0xF1, 0x41, 0x75, 0xF1, 0xF1, 0xF1, 0x21, 0xF1, 0x61, 0x35, 0xF1, 0xF1, 0xF1, 0x41, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x90, 0x45, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0x80, 0x75, 0xF0,
+  0xF0, 0xE0, 0xF0, 0x70, 0x05, 0x26, 0x55, 0xF0, 0xF0, 0xD0, 0xF0, 0x60, 0x15, 0x36, 0x45, 0xF0, 0xF0, 0xD0, 0xF0, 0x60,
+  0x15, 0x36, 0x55, 0xF0, 0xF0, 0xC0, 0xF0, 0x60, 0x15, 0x26, 0x65, 0xF0, 0xF0, 0xC0, 0xF0, 0x60, 0xB5, 0xF0, 0xF0, 0xC0,
+  0xF1, 0x61, 0xB5, 0xF1, 0xF1, 0xC1, 0xF1, 0x61, 0xA5, 0xF1, 0xF1, 0xD1, 0xF1, 0x71, 0x95, 0xF1, 0xF1, 0xD1, 0xF1, 0x81,
+  0x75, 0xF1, 0xF1, 0xE1, 0xF1, 0x91, 0x45, 0xF1, 0xF1, 0xF1, 0x01, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xD0, 0x45, 0xF0, 0xF0, 0xC0, 0xF1, 0xC1, 0x65, 0xF1, 0xF1, 0xB1, 0xF1, 0xB1, 0x05, 0x26, 0x45, 0xF1, 0xF1,
+  0xA1, 0xF1, 0xA1, 0x15, 0x26, 0x55, 0xF1, 0xF1, 0x91, 0xF1, 0xA1, 0x15, 0x26, 0x55, 0xF1, 0xF1, 0x91, 0xF1, 0xA1, 0x15,
+  0x26, 0x55, 0xF1, 0xF1, 0x91, 0xF1, 0xA1, 0xA5, 0xF1, 0xF1, 0x91, 0xF1, 0xA1, 0xA5, 0xF1, 0xF1, 0x91, 0xF1, 0xA1, 0xA5,
+  0xF1, 0xF1, 0x91, 0xF1, 0xB1, 0x85, 0xF1, 0xF1, 0xA1, 0xF1, 0xC1, 0x65, 0xF1, 0xF1, 0xB1, 0xF1, 0xD1, 0x45, 0xF1, 0xF1,
+  0xC1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0x11, 0x45, 0xF1, 0xF1, 0x81, 0xF1, 0xF1,
+  0x75, 0xF1, 0xF1, 0x71, 0xF1, 0xE1, 0x15, 0x26, 0x45, 0xF1, 0xF1, 0x61, 0xF2, 0xE2, 0x05, 0x36, 0x55, 0xF2, 0xF2, 0x52,
+  0xF2, 0xD2, 0x15, 0x36, 0x55, 0xF2, 0xF2, 0x52, 0xF2, 0xD2, 0x25, 0x26, 0x55, 0xF2, 0xF2, 0x52, 0xF2, 0xD2, 0xB5, 0xF2,
+  0xF2, 0x52, 0xF2, 0xD2, 0xB5, 0xF2, 0xF2, 0x52, 0xF2, 0xE2, 0xA5, 0xF2, 0xF2, 0x52, 0xF2, 0xE2, 0x95, 0xF2, 0xF2, 0x62,
+  0xF2, 0xF2, 0x75, 0xF2, 0xF2, 0x72, 0xF2, 0xF2, 0x12, 0x45, 0xF2, 0xF2, 0x82, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x52, 0x35, 0xF2, 0xF2, 0x52, 0xF3, 0xF3, 0x33, 0x75, 0xF3, 0xF3, 0x33, 0xF3, 0xF3, 0x23,
+  0x15, 0x16, 0x55, 0xF3, 0xF3, 0x23, 0xF3, 0xF3, 0x23, 0x05, 0x36, 0x45, 0xF3, 0xF3, 0x23, 0xF3, 0xF3, 0x13, 0x15, 0x36,
+  0x55, 0xF3, 0xF3, 0x13, 0xF3, 0xF3, 0x13, 0x25, 0x16, 0x65, 0xF3, 0xF3, 0x13, 0xF3, 0xF3, 0x13, 0xB5, 0xF3, 0xF3, 0x13,
+  0xF3, 0xF3, 0x13, 0xB5, 0xF3, 0xF3, 0x13, 0xF3, 0xF3, 0x23, 0x95, 0xF3, 0xF3, 0x23, 0xF3, 0xF3, 0x23, 0x95, 0xF3, 0xF3,
+  0x23, 0xF3, 0xF3, 0x33, 0x75, 0xF3, 0xF3, 0x33, 0xF3, 0xF3, 0x53, 0x35, 0xF3, 0xF3, 0x53, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0x81, 0x45, 0xF1, 0xF1, 0x11, 0xF1, 0xF1, 0x71, 0x75, 0xF1, 0xF1, 0xF1, 0xF1,
+  0x61, 0x05, 0x26, 0x55, 0xF1, 0xE1, 0xF2, 0xF2, 0x52, 0x15, 0x36, 0x45, 0xF2, 0xE2, 0xF2, 0xF2, 0x52, 0x15, 0x36, 0x55,
+  0xF2, 0xD2, 0xF2, 0xF2, 0x52, 0x15, 0x26, 0x65, 0xF2, 0xD2, 0xF2, 0xF2, 0x52, 0xB5, 0xF2, 0xD2, 0xF2, 0xF2, 0x52, 0xB5,
+  0xF2, 0xD2, 0xF2, 0xF2, 0x52, 0xA5, 0xF2, 0xE2, 0xF2, 0xF2, 0x62, 0x95, 0xF2, 0xE2, 0xF2, 0xF2, 0x72, 0x75, 0xF2, 0xF2,
+  0xF2, 0xF2, 0x82, 0x45, 0xF2, 0xF2, 0x12, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0,
+  0x45, 0xF0, 0xD0, 0xF1, 0xF1, 0xB1, 0x65, 0xF1, 0xC1, 0xF1, 0xF1, 0xA1, 0x05, 0x26, 0x45, 0xF1, 0xB1, 0xF1, 0xF1, 0x91,
+  0x15, 0x26, 0x55, 0xF1, 0xA1, 0xF1, 0xF1, 0x91, 0x15, 0x26, 0x55, 0xF1, 0xA1, 0xF1, 0xF1, 0x91, 0x15, 0x26, 0x55, 0xF1,
+  0xA1, 0xF1, 0xF1, 0x91, 0xA5, 0xF1, 0xA1, 0xF1, 0xF1, 0x91, 0xA5, 0xF1, 0xA1, 0xF1, 0xF1, 0x91, 0xA5, 0xF1, 0xA1, 0xF1,
+  0xF1, 0xA1, 0x85, 0xF1, 0xB1, 0xF1, 0xF1, 0xB1, 0x65, 0xF1, 0xC1, 0xF1, 0xF1, 0xC1, 0x45, 0xF1, 0xD1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x45, 0xF0, 0x90, 0xF0, 0xF0, 0xE0, 0x75, 0xF0, 0x80,
+  0xF0, 0xF0, 0xD0, 0x15, 0x26, 0x45, 0xF0, 0x70, 0xF0, 0xF0, 0xD0, 0x05, 0x36, 0x55, 0xF0, 0x60, 0xF0, 0xF0, 0xC0, 0x15,
+  0x36, 0x55, 0xF0, 0x60, 0xF0, 0xF0, 0xC0, 0x25, 0x26, 0x55, 0xF0, 0x60, 0xF0, 0xF0, 0xC0, 0xB5, 0xF0, 0x60, 0xF1, 0xF1,
+  0xC1, 0xB5, 0xF1, 0x61, 0xF1, 0xF1, 0xD1, 0xA5, 0xF1, 0x61, 0xF1, 0xF1, 0xD1, 0x95, 0xF1, 0x71, 0xF1, 0xF1, 0xE1, 0x75,
+  0xF1, 0x81, 0xF1, 0xF1, 0xF1, 0x01, 0x45, 0xF1, 0x91, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0x40, 0x35, 0xF0, 0x60, 0xF0, 0xF0, 0xF0, 0x20, 0x75, 0xF0, 0x40, 0xF0, 0xF0, 0xF0, 0x10, 0x15, 0x16, 0x55,
+  0xF0, 0x30, 0xF0, 0xF0, 0xF0, 0x10, 0x05, 0x36, 0x45, 0xF0, 0x30, 0xF0, 0xF0, 0xF0, 0x00, 0x15, 0x36, 0x55, 0xF0, 0x20,
+  0xF0, 0xF0, 0xF0, 0x00, 0x25, 0x16, 0x65, 0xF0, 0x20, 0xF0, 0xF0, 0xF0, 0x00, 0xB5, 0xF0, 0x20, 0xF0, 0xF0, 0xF0, 0x00,
+  0xB5, 0xF0, 0x20, 0xF0, 0xF0, 0xF0, 0x10, 0x95, 0xF0, 0x30, 0xF1, 0xF1, 0xF1, 0x11, 0x95, 0xF1, 0x31, 0xF1, 0xF1, 0xF1,
+  0x21, 0x75, 0xF1, 0x41, 0xF1, 0xF1, 0xF1, 0x41, 0x35, 0xF1, 0x61, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x45, 0xF0, 0x20, 0xF0, 0xF0, 0xF0, 0x60, 0x75, 0xF0, 0x00, 0xF0, 0xF0, 0xF0, 0x50, 0x05,
+  0x26, 0x55, 0xF0, 0xF0, 0xF0, 0xF0, 0x40, 0x15, 0x36, 0x45, 0xF0, 0xF0, 0xF0, 0xF0, 0x40, 0x15, 0x36, 0x55, 0xE0, 0xF0,
+  0xF0, 0xF0, 0x40, 0x15, 0x26, 0x65, 0xE0, 0xF0, 0xF0, 0xF0, 0x40, 0xB5, 0xE0, 0xF1, 0xF1, 0xF1, 0x41, 0xB5, 0xE1, 0xF1,
+  0xF1, 0xF1, 0x41, 0xA5, 0xF1, 0xF1, 0xF1, 0xF1, 0x51, 0x95, 0xF1, 0xF1, 0xF1, 0xF1, 0x61, 0x75, 0xF1, 0x01, 0xF1, 0xF1,
+  0xF1, 0x71, 0x45, 0xF1, 0x21, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB0, 0x45,
+  0xE0, 0xF1, 0xF1, 0xF1, 0xA1, 0x65, 0xD1, 0xF1, 0xF1, 0xF1, 0x91, 0x05, 0x26, 0x45, 0xC1, 0xF1, 0xF1, 0xF1, 0x81, 0x15,
+  0x26, 0x55, 0xB1, 0xF1, 0xF1, 0xF1, 0x81, 0x15, 0x26, 0x55, 0xB1, 0xF1, 0xF1, 0xF1, 0x81, 0x15, 0x26, 0x55, 0xB1, 0xF1,
+  0xF1, 0xF1, 0x81, 0xA5, 0xB1, 0xF1, 0xF1, 0xF1, 0x81, 0xA5, 0xB1, 0xF1, 0xF1, 0xF1, 0x81, 0xA5, 0xB1, 0xF1, 0xF1, 0xF1,
+  0x91, 0x85, 0xC1, 0xF1, 0xF1, 0xF1, 0xA1, 0x65, 0xD1, 0xF1, 0xF1, 0xF1, 0xB1, 0x45, 0xE1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0x45, 0xA1, 0xF1, 0xF1, 0xF1, 0xD1, 0x75, 0x91, 0xF1, 0xF1, 0xF1,
+  0xC1, 0x15, 0x26, 0x45, 0x81, 0xF2, 0xF2, 0xF2, 0xC2, 0x05, 0x36, 0x55, 0x72, 0xF2, 0xF2, 0xF2, 0xB2, 0x15, 0x36, 0x55,
+  0x72, 0xF2, 0xF2, 0xF2, 0xB2, 0x25, 0x26, 0x55, 0x72, 0xF2, 0xF2, 0xF2, 0xB2, 0xB5, 0x72, 0xF2, 0xF2, 0xF2, 0xB2, 0xB5,
+  0x72, 0xF2, 0xF2, 0xF2, 0xC2, 0xA5, 0x72, 0xF2, 0xF2, 0xF2, 0xC2, 0x95, 0x82, 0xF2, 0xF2, 0xF2, 0xD2, 0x75, 0x92, 0xF2,
+  0xF2, 0xF2, 0xF2, 0x45, 0xA2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D,
+  0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D, 0x34, 0x3D
+};
+
+#define TEST_CLIP_ORBIT_FRAMES            24U
+static const unsigned short _acCLIP_ORBIT_LINES[24 * TEST_CLIP_HEIGHT + 1] = {
+  0, 5, 10, 15, 20, 25, 32, 37, 44, 49, 54, 59, 64, 71, 76, 81,
+  86, 91, 96, 101, 106, 111, 116, 121, 126, 133, 140, 147, 154, 163, 172, 181,
+  190, 197, 204, 211, 218, 223, 228, 233, 238, 245, 250, 255, 260, 265, 272, 277,
+  282, 287, 292, 297, 302, 309, 314, 319, 324, 329, 334, 339, 344, 349, 354, 359,
+  364, 369, 376, 381, 388, 393, 398, 403, 408, 415, 420, 425, 430, 435, 440, 445,
+  450, 455, 460, 465, 472, 480, 488, 496, 503, 510, 517, 524, 532, 539, 546, 553,
+  560, 566, 573, 578, 583, 590, 595, 600, 605, 610, 617, 622, 627, 632, 637, 642,
+  647, 654, 659, 664, 669, 674, 679, 684, 689, 694, 699, 704, 709, 714, 721, 726,
+  733, 738, 743, 748, 753, 760, 765, 770, 775, 780, 785, 790, 795, 801, 807, 813,
+  820, 827, 834, 841, 848, 855, 862, 869, 876, 883, 890, 897, 905, 912, 919, 926,
+  933, 941, 948, 953, 958, 963, 970, 975, 980, 985, 990, 995, 1000, 1007, 1012, 1017,
+  1022, 1027, 1032, 1037, 1042, 1047, 1052, 1057, 1062, 1067, 1074, 1079, 1086, 1091, 1096, 1101,
+  1106, 1113, 1118, 1123, 1128, 1133, 1138, 1145, 1152, 1159, 1166, 1173, 1178, 1185, 1192, 1199,
+  1206, 1213, 1220, 1227, 1234, 1241, 1248, 1255, 1262, 1267, 1272, 1277, 1284, 1292, 1299, 1306,
+  1313, 1320, 1329, 1334, 1339, 1344, 1349, 1354, 1359, 1366, 1371, 1376, 1381, 1386, 1391, 1396,
+  1401, 1406, 1411, 1416, 1421, 1426, 1433, 1438, 1445, 1450, 1455, 1460, 1465, 1472, 1477, 1482,
+  1487, 1492, 1497, 1502, 1507, 1513, 1519, 1525, 1532, 1539, 1546, 1553, 1560, 1567, 1574, 1581,
+  1588, 1595, 1602, 1609, 1616, 1621, 1626, 1631, 1636, 1643, 1648, 1655, 1661, 1667, 1675, 1681,
+  1687, 1694, 1699, 1704, 1709, 1716, 1721, 1726, 1731, 1736, 1741, 1746, 1751, 1756, 1761, 1766,
+  1771, 1776, 1783, 1788, 1795, 1800, 1805, 1810, 1815, 1822, 1827, 1832, 1837, 1842, 1847, 1852,
+  1857, 1862, 1867, 1872, 1879, 1887, 1895, 1903, 1910, 1917, 1924, 1931, 1938, 1945, 1952, 1959,
+  1966, 1971, 1976, 1981, 1986, 1993, 1998, 2003, 2008, 2014, 2022, 2028, 2034, 2040, 2046, 2051,
+  2056, 2063, 2068, 2073, 2078, 2083, 2088, 2093, 2098, 2103, 2108, 2113, 2118, 2123, 2130, 2135,
+  2142, 2147, 2152, 2157, 2162, 2169, 2174, 2179, 2184, 2189, 2194, 2199, 2204, 2209, 2214, 2219,
+  2224, 2231, 2238, 2245, 2252, 2260, 2268, 2276, 2284, 2291, 2298, 2305, 2312, 2317, 2322, 2327,
+  2332, 2339, 2344, 2349, 2354, 2361, 2370, 2377, 2384, 2391, 2398, 2405, 2410, 2417, 2422, 2427,
+  2432, 2437, 2442, 2447, 2452, 2457, 2462, 2467, 2472, 2477, 2484, 2489, 2496, 2501, 2506, 2511,
+  2516, 2523, 2528, 2533, 2538, 2543, 2548, 2553, 2558, 2563, 2568, 2573, 2578, 2585, 2592, 2599,
+  2606, 2613, 2620, 2627, 2634, 2641, 2649, 2657, 2665, 2672, 2677, 2682, 2687, 2694, 2699, 2704,
+  2709, 2715, 2723, 2729, 2735, 2741, 2747, 2752, 2757, 2764, 2769, 2774, 2779, 2784, 2789, 2794,
+  2799, 2804, 2809, 2814, 2819, 2824, 2831, 2836, 2843, 2848, 2853, 2858, 2863, 2870, 2875, 2880,
+  2885, 2890, 2895, 2900, 2905, 2910, 2915, 2920, 2925, 2932, 2939, 2946, 2953, 2960, 2967, 2974,
+  2981, 2988, 2995, 3002, 3009, 3016, 3022, 3028, 3034, 3041, 3046, 3053, 3059, 3065, 3073, 3079,
+  3085, 3092, 3097, 3102, 3107, 3114, 3119, 3124, 3129, 3134, 3139, 3144, 3149, 3154, 3159, 3164,
+  3169, 3174, 3181, 3186, 3193, 3198, 3203, 3208, 3213, 3220, 3225, 3230, 3235, 3240, 3245, 3250,
+  3255, 3260, 3265, 3270, 3275, 3282, 3289, 3296, 3303, 3310, 3317, 3324, 3331, 3338, 3345, 3352,
+  3359, 3364, 3371, 3378, 3386, 3395, 3403, 3410, 3417, 3424, 3433, 3438, 3443, 3448, 3453, 3458,
+  3463, 3470, 3475, 3480, 3485, 3490, 3495, 3500, 3505, 3510, 3515, 3520, 3525, 3530, 3537, 3542,
+  3549, 3554, 3559, 3564, 3569, 3576, 3581, 3586, 3591, 3596, 3601, 3606, 3611, 3616, 3621, 3626,
+  3631, 3638, 3645, 3652, 3659, 3666, 3673, 3680, 3687, 3694, 3701, 3708, 3716, 3725, 3733, 3741,
+  3749, 3757, 3764, 3769, 3774, 3779, 3786, 3791, 3796, 3801, 3806, 3811, 3816, 3823, 3828, 3833,
+  3838, 3843, 3848, 3853, 3858, 3863, 3868, 3873, 3878, 3883, 3890, 3895, 3902, 3907, 3912, 3917,
+  3922, 3929, 3934, 3939, 3944, 3949, 3954, 3959, 3964, 3969, 3974, 3979, 3984, 3991, 3998, 4005,
+  4012, 4019, 4026, 4033, 4041, 4048, 4056, 4064, 4072, 4079, 4086, 4091, 4096, 4103, 4108, 4113,
+  4118, 4123, 4130, 4135, 4140, 4145, 4150, 4155, 4160, 4167, 4172, 4177, 4182, 4187, 4192, 4197,
+  4202, 4207, 4212, 4217, 4222, 4227, 4234, 4239, 4246, 4251, 4256, 4261, 4266, 4273, 4278, 4283,
+  4288, 4293, 4298, 4303, 4308, 4313, 4318, 4323, 4328, 4335, 4342, 4349, 4356, 4364, 4372, 4380,
+  4388, 4395, 4402, 4409, 4416, 4421, 4426, 4431, 4436, 4443, 4448, 4453, 4458, 4463, 4470, 4475,
+  4480, 4485, 4490, 4495, 4500, 4507, 4512, 4517, 4522, 4527, 4532, 4537, 4542, 4547, 4552, 4557,
+  4562, 4567, 4574, 4579, 4586, 4591, 4596, 4601, 4606, 4613, 4618, 4623, 4628, 4633, 4638, 4643,
+  4648, 4653, 4658, 4665, 4672, 4680, 4688, 4696, 4703, 4711, 4718, 4725, 4732, 4739, 4746, 4753,
+  4760, 4765, 4770, 4775, 4780, 4787, 4792, 4797, 4802, 4807, 4814, 4819, 4824, 4829, 4834, 4839,
+  4844, 4851, 4856, 4861, 4866, 4871, 4876, 4881, 4886, 4891, 4896, 4901, 4906, 4911, 4918, 4923,
+  4930, 4935, 4940, 4945, 4950, 4957, 4962, 4967, 4972, 4977, 4982, 4989, 4996, 5004, 5012, 5020,
+  5029, 5037, 5044, 5051, 5058, 5065, 5072, 5079, 5086, 5093, 5100, 5107, 5114, 5119, 5124, 5129,
+  5134, 5141, 5146, 5151, 5156, 5161, 5168, 5173, 5178, 5183, 5188, 5193, 5198, 5205, 5210, 5215,
+  5220, 5225, 5230, 5235, 5240, 5245, 5250, 5255, 5260, 5265, 5272, 5277, 5284, 5289, 5294, 5299,
+  5304, 5311, 5316, 5323, 5330, 5337, 5344, 5352, 5360, 5368, 5375, 5382, 5387, 5394, 5401, 5408,
+  5415, 5422, 5429, 5436, 5443, 5450, 5457, 5464, 5471, 5476, 5481, 5486, 5491, 5498, 5503, 5508,
+  5513, 5518, 5525, 5530, 5535, 5540, 5545, 5550, 5555, 5562, 5567, 5572, 5577, 5582, 5587, 5592,
+  5597, 5602, 5607, 5612, 5617, 5622, 5629, 5634, 5641, 5646, 5651, 5656, 5663, 5671, 5677, 5683,
+  5689, 5695, 5702, 5707, 5712, 5718, 5724, 5730, 5737, 5744, 5751, 5758, 5765, 5772, 5779, 5786,
+  5793, 5800, 5807, 5814, 5821, 5826, 5831, 5836, 5841, 5848, 5853, 5858, 5863, 5868, 5875, 5880,
+  5885, 5890, 5895, 5900, 5905, 5912, 5917, 5922, 5927, 5932, 5937, 5942, 5947, 5952, 5957, 5962,
+  5967, 5972, 5979, 5984, 5991, 5996, 6001, 6007, 6013, 6021, 6027, 6033, 6039, 6044, 6049, 6054,
+  6059, 6064, 6069, 6074, 6081, 6089, 6097, 6105, 6112, 6119, 6126, 6133, 6140, 6147, 6154, 6161,
+  6168, 6173, 6178, 6183, 6188, 6195, 6200, 6205, 6210, 6215, 6222, 6227, 6232, 6237, 6242, 6247,
+  6252, 6259, 6264, 6269, 6274, 6279, 6284, 6289, 6294, 6299, 6304, 6309, 6314, 6319, 6326, 6331,
+  6338, 6343, 6350, 6357, 6364, 6372, 6379, 6386, 6393, 6398, 6403, 6408, 6413, 6418, 6423, 6428,
+  6433, 6440, 6447, 6454, 6461, 6469, 6477, 6485, 6493, 6500, 6507, 6514, 6521, 6526, 6531, 6536,
+  6541, 6548, 6553, 6558, 6563, 6568, 6575, 6580, 6585, 6590, 6595, 6600, 6605, 6612, 6617, 6622,
+  6627, 6632, 6637, 6642, 6647, 6652, 6657, 6662, 6667, 6672, 6679, 6684, 6691, 6696, 6701, 6707,
+  6713, 6721, 6727, 6733, 6739, 6744, 6749, 6754, 6759, 6764, 6769, 6774, 6779, 6786, 6793, 6800,
+  6807, 6814, 6821, 6828, 6835, 6842, 6850, 6858, 6866, 6873, 6878, 6883, 6888, 6895, 6900, 6905,
+  6910, 6915, 6922, 6927, 6932, 6937, 6942, 6947, 6952, 6959, 6964, 6969, 6974, 6979, 6984, 6989,
+  6994, 6999, 7004, 7009, 7014, 7019, 7026, 7031, 7038, 7043, 7048, 7053, 7060, 7068, 7074, 7080,
+  7086, 7092, 7099, 7104, 7109, 7114, 7119, 7124, 7129, 7136, 7143, 7150, 7157, 7164, 7171, 7178,
+  7185, 7192, 7199, 7206, 7213, 7220, 7226, 7232, 7238, 7245, 7250, 7255, 7260, 7265, 7272, 7277,
+  7282, 7287, 7292, 7297, 7302, 7309, 7314, 7319, 7324, 7329, 7334, 7339, 7344, 7349, 7354, 7359,
+  7364, 7369, 7376, 7381, 7388, 7393, 7398, 7403, 7408, 7415, 7420, 7427, 7434, 7441, 7448, 7455,
+  7462, 7469, 7474, 7479, 7484, 7491, 7498, 7505, 7512, 7519, 7526, 7533, 7540, 7547, 7554, 7561,
+  7568, 7573, 7580, 7587, 7594, 7602, 7609, 7614, 7619, 7624, 7631, 7636, 7641, 7646, 7651, 7656,
+  7661, 7668, 7673, 7678, 7683, 7688, 7693, 7698, 7703, 7708, 7713, 7718, 7723, 7728, 7735, 7740,
+  7747, 7752, 7757, 7762, 7767, 7774, 7779, 7784, 7789, 7794, 7799, 7806, 7813, 7820, 7827, 7834,
+  7841, 7849, 7856, 7863, 7870, 7877, 7884, 7891, 7898, 7905, 7912, 7919, 7926, 7933, 7939, 7945,
+  7951, 7958, 7963, 7968, 7973, 7978, 7985, 7990, 7995, 8000, 8005, 8010, 8015, 8022, 8027, 8032,
+  8037, 8042, 8047, 8052, 8057, 8062, 8067, 8072, 8077, 8082, 8089, 8094, 8101, 8106, 8111, 8116,
+  8121, 8128, 8133, 8138, 8143, 8148, 8153, 8158, 8163, 8168, 8173, 8180, 8186, 8193, 8200, 8207,
+  8214, 8222, 8229, 8236, 8243, 8250, 8258, 8266, 8274, 8281, 8286, 8291, 8296, 8303, 8308, 8313,
+  8318, 8323, 8330, 8335, 8340, 8345, 8350, 8355, 8360, 8367, 8372, 8377, 8382, 8387, 8392, 8397,
+  8402
+};
+static const unsigned char _acCLIP_ORBIT[8402U] = {
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7,
+  0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37,
+  0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xE7, 0x39, 0xF7, 0xF7, 0xF7, 0x17, 0xB8, 0x37, 0x3A,
+  0x47, 0x59, 0xE7, 0xF7, 0xF7, 0x17, 0xB8, 0x37, 0x3A, 0x47, 0x59, 0xE7, 0xF7, 0xF7, 0x17, 0xB8, 0x37, 0x3A, 0x47, 0x59,
+  0xE7, 0xF7, 0xF7, 0x17, 0xB8, 0x37, 0x3A, 0x47, 0x59, 0xE7, 0xF7, 0xF7, 0x27, 0x98, 0xE7, 0x39, 0xF7, 0xF7, 0xF7, 0x27,
+  0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B,
+  0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x2A, 0xF7, 0xB7, 0xF7, 0xF7, 0x57, 0x38, 0x57, 0x3A, 0xF7, 0xB7,
+  0xF7, 0xF7, 0x37, 0x78, 0x37, 0x4A, 0xF7, 0xA7, 0xF7, 0xF7, 0x27, 0x98, 0x37, 0x2A, 0xF7, 0xB7, 0xF7, 0xF7, 0x27, 0x98,
+  0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17,
+  0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xD7, 0x29, 0xF7, 0x07, 0xF7, 0xF7, 0x27, 0x98, 0xC7, 0x59, 0xF7, 0xF7,
+  0xF7, 0x27, 0x98, 0xC7, 0x69, 0xE7, 0xF7, 0xF7, 0x37, 0x78, 0xD7, 0x69, 0xE7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0x69, 0xE7,
+  0xF7, 0xF7, 0xF7, 0x97, 0x59, 0xF7, 0xF7, 0xF7, 0xF7, 0xA7, 0x39, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7,
+  0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x3A, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xB7, 0x3A, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x3A, 0xF7, 0xF7, 0xF7, 0xF7, 0xC7, 0x1A, 0xF7, 0xF7, 0x07,
+  0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7,
+  0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7,
+  0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98,
+  0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57,
+  0x38, 0xF7, 0x19, 0xF7, 0x37, 0xF7, 0xF7, 0xF7, 0x77, 0x59, 0xF7, 0x17, 0xF7, 0xF7, 0xF7, 0x77, 0x59, 0xF7, 0x17, 0xF7,
+  0xF7, 0xF7, 0x77, 0x69, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0x77, 0x59, 0xF7, 0x17, 0xD7, 0x0B, 0xF7, 0xF7, 0x87, 0x59, 0xF7,
+  0x17, 0xF7, 0xF7, 0xF7, 0x87, 0x39, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47,
+  0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x67, 0x1A, 0xF7, 0xF7, 0x67, 0xF7, 0xF7, 0x57, 0x3A, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x57, 0x3A, 0xF7, 0xF7, 0x57, 0xF7,
+  0xF7, 0x57, 0x3A, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x67, 0x1A, 0xF7, 0xF7, 0x67, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7,
+  0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17,
+  0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7,
+  0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7,
+  0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x57, 0x29, 0xF7, 0x67, 0xD7, 0x0B, 0xF7, 0xF7, 0x57, 0x49, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0x37, 0x69, 0xF7, 0x47, 0xF7,
+  0xF7, 0xF7, 0x37, 0x69, 0xF7, 0x47, 0xF7, 0xF7, 0xF7, 0x37, 0x69, 0xF7, 0x47, 0xF7, 0xF7, 0xF7, 0x47, 0x49, 0xF7, 0x57,
+  0xF7, 0xF7, 0xF7, 0x57, 0x29, 0x27, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B,
+  0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x3A, 0xF7, 0xF7, 0xB7, 0xF7, 0xF7, 0x3A, 0xF7, 0xF7, 0xB7, 0xF7,
+  0xF7, 0x3A, 0xF7, 0xF7, 0xB7, 0xF7, 0xF7, 0x07, 0x1A, 0xF7, 0xF7, 0xC7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7,
+  0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27,
+  0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7,
+  0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7,
+  0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x39, 0xF7, 0xA7, 0xF7, 0xF7, 0xF7, 0x59, 0xF7,
+  0x97, 0xF7, 0xF7, 0xF7, 0x59, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0x59, 0x57, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0x59, 0xF7,
+  0x97, 0xF7, 0xF7, 0xF7, 0x59, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0x17, 0x19, 0xF7, 0xB7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17,
+  0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67,
+  0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x2A, 0xF7, 0xF7, 0xF7, 0x07, 0xF7,
+  0xB7, 0x3A, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xA7, 0x4A, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xB7, 0x2A, 0x37, 0x98,
+  0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17,
+  0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7,
+  0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7,
+  0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xA7, 0x49, 0xF7, 0xF7, 0xF7, 0xF7, 0xA7, 0x59, 0xA7, 0x0B,
+  0xF7, 0x27, 0xF7, 0xF7, 0x97, 0x69, 0xF7, 0xE7, 0xF7, 0xF7, 0x97, 0x69, 0xF7, 0xE7, 0xF7, 0xF7, 0xA7, 0x59, 0xF7, 0xE7,
+  0xF7, 0xF7, 0xA7, 0x49, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B,
+  0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7,
+  0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7,
+  0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0x97, 0x3A, 0x37, 0xB8, 0xF7, 0xF7, 0x17,
+  0xF7, 0x97, 0x3A, 0x37, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0x97, 0x3A, 0x37, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0x97, 0x3A, 0x37,
+  0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7,
+  0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x39, 0xF7, 0xF7,
+  0x57, 0xF7, 0xF7, 0x47, 0x59, 0xF7, 0x07, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0x47, 0x59, 0xF7, 0xF7, 0x47, 0xF7, 0xF7, 0x47,
+  0x59, 0xF7, 0xF7, 0x47, 0xF7, 0xF7, 0x47, 0x59, 0xF7, 0xF7, 0x47, 0xF7, 0xF7, 0x47, 0x59, 0xF7, 0xF7, 0x47, 0xF7, 0xF7,
+  0x57, 0x39, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7,
+  0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17,
+  0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7,
+  0x27, 0xF7, 0xB7, 0x2A, 0x37, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xA7, 0x4A, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xB7, 0x3A,
+  0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xB7, 0x2A, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x49, 0xF7, 0xF7, 0xA7, 0xF7, 0xE7, 0x59, 0xF7, 0x67,
+  0x0B, 0xF7, 0x27, 0xF7, 0xE7, 0x69, 0xF7, 0xF7, 0x97, 0xF7, 0xE7, 0x69, 0xF7, 0xF7, 0x97, 0xF7, 0xE7, 0x59, 0xF7, 0xF7,
+  0xA7, 0xF7, 0xF7, 0x49, 0xF7, 0xF7, 0xA7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07,
+  0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7,
+  0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17,
+  0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7,
+  0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7,
+  0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x07, 0x1A, 0xF7, 0xF7, 0xC7, 0xF7, 0xF7, 0x3A, 0xF7,
+  0xF7, 0xB7, 0xF7, 0xF7, 0x3A, 0xF7, 0xF7, 0xB7, 0xF7, 0xF7, 0x3A, 0xF7, 0xF7, 0xB7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xA7, 0x39, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0x97, 0x59, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x97, 0x59, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0x59, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0x97, 0x59, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x97, 0x59, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x19, 0xF7, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7,
+  0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7,
+  0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98,
+  0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17,
+  0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7,
+  0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x1A, 0xF7, 0xF7, 0x67, 0xF7, 0xF7, 0x57, 0x3A, 0xF7, 0xF7, 0x57, 0xF7, 0x67,
+  0x29, 0xB7, 0x3A, 0xF7, 0xF7, 0x57, 0xD7, 0x0B, 0x67, 0x49, 0xA7, 0x3A, 0xF7, 0xF7, 0x57, 0xF7, 0x47, 0x69, 0xA7, 0x1A,
+  0xF7, 0xF7, 0x67, 0xF7, 0x47, 0x69, 0xF7, 0xF7, 0xF7, 0x37, 0xF7, 0x47, 0x69, 0xF7, 0xF7, 0xF7, 0x37, 0xF7, 0x57, 0x49,
+  0xF7, 0xF7, 0xF7, 0x47, 0xF7, 0x67, 0x29, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7,
+  0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7,
+  0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17,
+  0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7,
+  0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0x37, 0x19, 0xF7, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0x17, 0x59, 0xF7,
+  0x47, 0x1A, 0xF7, 0xF7, 0x07, 0xF7, 0x17, 0x59, 0xF7, 0x37, 0x3A, 0xF7, 0xF7, 0xF7, 0x07, 0x69, 0xF7, 0x37, 0x3A, 0xF7,
+  0xF7, 0xF7, 0x17, 0x59, 0xF7, 0x37, 0x3A, 0xF7, 0xF7, 0xD7, 0x0B, 0x27, 0x59, 0xF7, 0xF7, 0xF7, 0x77, 0xF7, 0x27, 0x39,
+  0xF7, 0xF7, 0xF7, 0x87, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B,
+  0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7,
+  0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7,
+  0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7,
+  0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0x07, 0x29, 0xD7, 0xB8, 0xF7, 0xF7,
+  0x17, 0xF7, 0x59, 0xC7, 0x98, 0xF7, 0xF7, 0x27, 0xE7, 0x69, 0xC7, 0x98, 0x37, 0x2A, 0xF7, 0xB7, 0xE7, 0x69, 0xD7, 0x78,
+  0x37, 0x4A, 0xF7, 0xA7, 0xE7, 0x69, 0xF7, 0x38, 0x57, 0x3A, 0xF7, 0xB7, 0xF7, 0x59, 0xF7, 0xA7, 0x2A, 0xF7, 0xB7, 0xF7,
+  0x07, 0x39, 0xF7, 0xF7, 0xF7, 0xA7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47,
+  0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7,
+  0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0x39, 0xE7, 0x98, 0xF7, 0xF7, 0x27, 0xE7, 0x59, 0xC7, 0xB8,
+  0x37, 0x3A, 0xF7, 0x97, 0xE7, 0x59, 0xC7, 0xB8, 0x37, 0x3A, 0xF7, 0x97, 0xE7, 0x59, 0xC7, 0xB8, 0x37, 0x3A, 0xF7, 0x97,
+  0xE7, 0x59, 0xC7, 0xB8, 0x37, 0x3A, 0xF7, 0x97, 0xF7, 0x39, 0xE7, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7,
+  0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47,
+  0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07,
+  0x39, 0xF7, 0xF7, 0xF7, 0xA7, 0xF7, 0x59, 0xF7, 0xA7, 0x2A, 0xF7, 0xB7, 0xE7, 0x69, 0xF7, 0x38, 0x57, 0x3A, 0xF7, 0xB7,
+  0xE7, 0x69, 0xD7, 0x78, 0x37, 0x4A, 0xF7, 0xA7, 0xE7, 0x69, 0xC7, 0x98, 0x37, 0x2A, 0xF7, 0xB7, 0xF7, 0x59, 0xC7, 0x98,
+  0xF7, 0xF7, 0x27, 0xF7, 0x07, 0x29, 0xD7, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7,
+  0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7,
+  0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0x27, 0x39, 0xF7, 0xF7, 0xF7, 0x87, 0xF7, 0x17, 0x59, 0xF7, 0xF7, 0xF7, 0x77, 0xF7, 0x17, 0x59, 0xF7,
+  0x37, 0x3A, 0xF7, 0xF7, 0xF7, 0x07, 0x69, 0xF7, 0x37, 0x3A, 0xF7, 0xF7, 0xF7, 0x17, 0x59, 0xF7, 0x37, 0x3A, 0xF7, 0xF7,
+  0xF7, 0x17, 0x59, 0xF7, 0x47, 0x1A, 0xF7, 0xF7, 0x07, 0xF7, 0x37, 0x19, 0xF7, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37,
+  0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7,
+  0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7,
+  0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27,
+  0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7,
+  0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x29, 0xF7,
+  0xF7, 0xF7, 0x57, 0xF7, 0x57, 0x49, 0xF7, 0xF7, 0xF7, 0x47, 0xF7, 0x47, 0x69, 0xF7, 0xF7, 0xF7, 0x37, 0xF7, 0x47, 0x69,
+  0xF7, 0xF7, 0xF7, 0x37, 0xF7, 0x47, 0x69, 0xA7, 0x1A, 0xF7, 0xF7, 0x67, 0xF7, 0x57, 0x49, 0xA7, 0x3A, 0xF7, 0xF7, 0x57,
+  0xF7, 0x67, 0x29, 0xB7, 0x3A, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x57, 0x3A, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x67, 0x1A, 0xF7,
+  0xF7, 0x67, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7,
+  0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7,
+  0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8,
+  0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37,
+  0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7,
+  0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x19, 0xF7,
+  0xF7, 0xF7, 0x17, 0xF7, 0x97, 0x59, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0x97, 0x59, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0x59,
+  0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0x59, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0x59, 0xF7, 0xF7, 0xF7, 0xF7, 0xA7, 0x39, 0xF7, 0xF7,
+  0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x3A, 0xF7, 0xF7, 0xB7, 0xF7, 0xF7,
+  0x3A, 0xF7, 0xF7, 0xB7, 0xF7, 0xF7, 0x3A, 0xF7, 0xF7, 0xB7, 0xF7, 0xF7, 0x07, 0x1A, 0xF7, 0xF7, 0xC7, 0xF7, 0xF7, 0x57,
+  0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7,
+  0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7,
+  0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27,
+  0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7,
+  0x57, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0x49, 0xF7, 0xF7, 0xA7, 0xF7, 0xE7, 0x59, 0xF7, 0xF7, 0xA7, 0xF7, 0xE7, 0x69, 0xF7, 0xF7, 0x07, 0x0B,
+  0x77, 0xF7, 0xE7, 0x69, 0xF7, 0xF7, 0x97, 0xF7, 0xE7, 0x59, 0xF7, 0xF7, 0xA7, 0xF7, 0xF7, 0x49, 0xF7, 0xF7, 0xA7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x2A, 0xF7, 0xF7, 0xF7,
+  0x07, 0xF7, 0xB7, 0x3A, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xA7, 0x4A, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xB7, 0x2A,
+  0x37, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7,
+  0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17,
+  0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7,
+  0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B,
+  0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x39, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x47, 0x59, 0xF7, 0xF7, 0x47, 0xF7, 0xF7, 0x47,
+  0x59, 0xF7, 0xF7, 0x47, 0xF7, 0xF7, 0x47, 0x59, 0xF7, 0xB7, 0x0B, 0x77, 0xF7, 0xF7, 0x47, 0x59, 0xF7, 0xF7, 0x47, 0xF7,
+  0xF7, 0x47, 0x59, 0xF7, 0xF7, 0x47, 0xF7, 0xF7, 0x57, 0x39, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57,
+  0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7,
+  0x27, 0xF7, 0x97, 0x3A, 0x37, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0x97, 0x3A, 0x37, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0x97, 0x3A,
+  0x37, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0x97, 0x3A, 0x37, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27,
+  0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7,
+  0x57, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xA7, 0x49, 0xF7, 0xF7, 0xF7, 0xF7, 0xA7, 0x59, 0xF7, 0xE7, 0xF7, 0xF7, 0x97, 0x69, 0xF7, 0x57, 0x0B,
+  0x77, 0xF7, 0xF7, 0x97, 0x69, 0xF7, 0xE7, 0xF7, 0xF7, 0xA7, 0x59, 0xF7, 0xE7, 0xF7, 0xF7, 0xA7, 0x49, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27,
+  0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7,
+  0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7,
+  0xF7, 0x27, 0xF7, 0xB7, 0x2A, 0x37, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xA7, 0x4A, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xB7,
+  0x3A, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xB7, 0x2A, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B,
+  0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x19, 0xF7, 0xB7,
+  0xF7, 0xF7, 0xF7, 0x59, 0xF7, 0x07, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0x59, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0x59, 0xF7, 0x97,
+  0xF7, 0xF7, 0xF7, 0x59, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0x59, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0x07, 0x39, 0xF7, 0xA7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78,
+  0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17,
+  0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7,
+  0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7,
+  0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x07, 0x1A, 0xF7, 0xF7, 0xC7,
+  0xF7, 0xF7, 0x3A, 0xF7, 0xF7, 0xB7, 0xF7, 0xF7, 0x3A, 0xF7, 0xF7, 0xB7, 0xF7, 0xF7, 0x3A, 0xF7, 0xF7, 0xB7, 0xD7, 0x0B,
+  0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0x57, 0x29, 0xF7, 0x67, 0xF7, 0xF7, 0xF7, 0x47, 0x49, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0x37, 0x69, 0xF7,
+  0x47, 0xF7, 0xF7, 0xF7, 0x37, 0x69, 0xF7, 0x47, 0xF7, 0xF7, 0xF7, 0x37, 0x69, 0xF7, 0x47, 0xF7, 0xF7, 0xF7, 0x47, 0x49,
+  0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0x57, 0x29, 0xF7, 0x67, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7,
+  0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7,
+  0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17,
+  0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7,
+  0x37, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x1A, 0xF7, 0xF7, 0x67,
+  0xF7, 0xF7, 0x57, 0x3A, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0x57, 0x3A, 0xF7, 0xF7, 0x57, 0xD7, 0x0B, 0xF7, 0x67, 0x3A, 0xF7,
+  0xF7, 0x57, 0xF7, 0xF7, 0x67, 0x1A, 0xF7, 0xF7, 0x67, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x87, 0x39, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0x77, 0x59, 0xF7, 0x17, 0xF7, 0xF7, 0xF7, 0x77, 0x59, 0xF7, 0x17,
+  0xF7, 0xF7, 0xF7, 0x77, 0x69, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0x77, 0x59, 0xF7, 0x17, 0xF7, 0xF7, 0xF7, 0x77, 0x59, 0xF7,
+  0x17, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0x19, 0xF7, 0x37, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7, 0xF7, 0x27, 0x98,
+  0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17,
+  0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7,
+  0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x37, 0x78, 0xF7, 0xF7, 0x37, 0xF7,
+  0xF7, 0x57, 0x38, 0xF7, 0xF7, 0x57, 0xF7, 0xF7, 0xC7, 0x1A, 0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xB7, 0x3A, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xB7, 0x3A, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x3A, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x07, 0x0B, 0xF7,
+  0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x17, 0x0B, 0xF7, 0xC7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x47, 0x0B, 0xF7, 0xF7, 0xF7, 0xF7,
+  0x97, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x67, 0x0B, 0x77, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xA7, 0x39, 0xF7, 0x07,
+  0xF7, 0xF7, 0xF7, 0x97, 0x59, 0xF7, 0xF7, 0xF7, 0x57, 0x38, 0xF7, 0x69, 0xE7, 0xF7, 0xF7, 0x37, 0x78, 0xD7, 0x69, 0xE7,
+  0xF7, 0xF7, 0x27, 0x98, 0xC7, 0x69, 0xE7, 0xF7, 0xF7, 0x27, 0x98, 0xC7, 0x59, 0xF7, 0xF7, 0xF7, 0x17, 0xB8, 0xD7, 0x29,
+  0xF7, 0x07, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8, 0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x17, 0xB8,
+  0xF7, 0xF7, 0x17, 0xF7, 0xF7, 0x27, 0x98, 0xF7, 0xF7, 0x27, 0xF7, 0xF7, 0x27, 0x98, 0x37, 0x2A, 0xF7, 0xB7, 0xF7, 0xF7,
+  0x37, 0x78, 0x37, 0x4A, 0xF7, 0xA7, 0xF7, 0xF7, 0x57, 0x38, 0x57, 0x3A, 0xF7, 0xB7, 0xF7, 0xF7, 0xF7, 0x07, 0x2A, 0xF7,
+  0xB7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xD7, 0x0B, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x07, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xB7, 0x0B, 0xF7, 0x27, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0x07, 0x0B, 0xF7, 0xF7, 0xD7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+  0xF7, 0xF7
+};
+
+#endif
@@ -0,0 +1,76 @@
+/**
+  ******************************************************************************
+  * @file    test_pattern.h
+  * @brief   Test pattern source: header file for test_pattern.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TEST_PATTERN_H
+#define __TEST_PATTERN_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Patterns */
+#define TEST_PATTERN_BARS               0U   /* 75% color bars */
+#define TEST_PATTERN_BOX                1U   /* white box bouncing over the bars */
+#define TEST_PATTERN_CLIP_BALL          2U   /* clip in flash: bouncing ball, 16 frames */
+#define TEST_PATTERN_CLIP_ORBIT         3U   /* clip in flash: orbiting discs, 24 frames */
+#define TEST_PATTERN_NUM                4U
+
+/* Lines rendered at a time, one row of tiles of the tile delta codec */
+#define TEST_PATTERN_STRIP_LINES        16U
+
+/* Frame counter burned in at the top left corner: 6 decimal digits of 5x7
+   cells, TEST_PATTERN_DIGIT_SCALE pixels each */
+#define TEST_PATTERN_DIGITS             6U
+#define TEST_PATTERN_DIGIT_SCALE        4U
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Planar YCbCr 4:2:0 destination, chroma pitch is half the luma pitch */
+typedef struct
+{
+  uint8_t   *y;
+  uint8_t   *cb;
+  uint8_t   *cr;
+  uint16_t   pitch;      /* luma bytes from one line to the next */
+} TestPattern_PlanesTypeDef;
+
+typedef struct
+{
+  uint16_t   width;      /* multiple of 16 */
+  uint16_t   height;     /* multiple of TEST_PATTERN_STRIP_LINES */
+  uint8_t    pattern;    /* TEST_PATTERN_xxx */
+  uint8_t    counter;    /* 1: burn the frame number in */
+} TestPattern_TypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+int32_t TestPattern_Init(TestPattern_TypeDef *tp, uint8_t pattern, uint16_t width, uint16_t height);
+int32_t TestPattern_Select(TestPattern_TypeDef *tp, uint8_t pattern);
+void TestPattern_SetCounter(TestPattern_TypeDef *tp, uint8_t enable);
+void TestPattern_RenderStrip(const TestPattern_TypeDef *tp, uint32_t frame, uint16_t strip,
+                             const TestPattern_PlanesTypeDef *dst);
+void TestPattern_Render(const TestPattern_TypeDef *tp, uint32_t frame, const TestPattern_PlanesTypeDef *dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TEST_PATTERN_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file    tile_delta.h
+  * @brief   Tile based conditional replenishment codec: header file for
+  *          tile_delta.c.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TILE_DELTA_H
+#define __TILE_DELTA_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+
+/* SIMD sum of absolute differences on the Cortex-M4, portable C elsewhere */
+#ifndef TILE_USE_SIMD
+#if defined(STM32F429xx)
+#define TILE_USE_SIMD                   1
+#else
+#define TILE_USE_SIMD                   0
+#endif
+#endif
+
+/* A tile is a 16x16 luma block and its two 8x8 chroma blocks (YCbCr 4:2:0) */
+#define TILE_SIZE                       16U
+#define TILE_BYTES                      ((TILE_SIZE * TILE_SIZE * 3U) / 2U)
+
+/* Payload header, little endian:
+     0  'T' 'D'    magic
+     2  version    TILE_DELTA_VERSION
+     3  flags      TILE_DELTA_FLAG_xxx
+     4  width      luma pixels, multiple of TILE_SIZE
+     6  height
+     8  frame      frame number
+    12  tiles      number of tiles that follow
+    14  reserved   0
+   then one bit per tile in raster order (LSB first), set for the tiles sent,
+   then the tiles sent: 256 Y, 64 Cb, 64 Cr bytes, each block row by row. */
+#define TILE_DELTA_HEADER_SIZE          16U
+#define TILE_DELTA_VERSION              1U
+#define TILE_DELTA_FLAG_KEY             0x01U   /* every tile is sent */
+
+/* Largest payload of a width x height frame */
+#define TILE_DELTA_MAX_SIZE(width, height)                                                   \
+  (TILE_DELTA_HEADER_SIZE + ((((width) / TILE_SIZE) * ((height) / TILE_SIZE) + 7U) / 8U) + \
+   (((width) / TILE_SIZE) * ((height) / TILE_SIZE) * TILE_BYTES))
+
+/* Default mean absolute difference above which a tile is sent */
+#define TILE_DELTA_THRESHOLD_DEFAULT    4U
+
+/* Default number of frames between key frames */
+#define TILE_DELTA_KEY_INTERVAL_DEFAULT 150U
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Planar YCbCr 4:2:0 frame */
+typedef struct
+{
+  uint8_t   *y;
+  uint8_t   *cb;
+  uint8_t   *cr;
+} TileDelta_FrameTypeDef;
+
+/* Encoder: the reference holds exactly what the decoder shows */
+typedef struct
+{
+  uint16_t                width;
+  uint16_t                height;
+  uint8_t                 threshold;      /* mean absolute difference of a tile sent */
+  uint16_t                key_interval;   /* frames between key frames, 0: only the first */
+  uint8_t                 force_key;      /* next frame is a key frame */
+  uint32_t                frame;          /* number of the next frame */
+  TileDelta_FrameTypeDef  ref;
+} TileDelta_EncoderTypeDef;
+
+/* Exported functions ------------------------------------------------------- */
+int32_t TileDelta_Init(TileDelta_EncoderTypeDef *enc, uint16_t width, uint16_t height, uint8_t *ref);
+void TileDelta_ForceKey(TileDelta_EncoderTypeDef *enc);
+uint32_t TileDelta_Encode(TileDelta_EncoderTypeDef *enc, const TileDelta_FrameTypeDef *src,
+                          uint8_t *out, uint32_t size);
+int32_t TileDelta_Decode(const uint8_t *payload, uint32_t len, const TileDelta_FrameTypeDef *dst,
+                         uint16_t width, uint16_t height);
+#ifdef TILE_BENCHMARK
+void TileDelta_Benchmark(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TILE_DELTA_H */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
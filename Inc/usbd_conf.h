@@ -36,7 +36,11 @@
 #include "stm32f4xx_hal.h"
 
 /* USER CODE BEGIN INCLUDE */
-
+#include "latency.h"
+#include "boot.h"
+#include "frame_crc.h"
+#include "stats.h"
+#include "dfu.h"
 /* USER CODE END INCLUDE */
 
 /** @addtogroup USBD_OTG_DRIVER
@@ -64,7 +68,7 @@
   */
 
 /*---------- -----------*/
-#define USBD_MAX_NUM_INTERFACES     2U
+#define USBD_MAX_NUM_INTERFACES     5U
 /*---------- -----------*/
 #define USBD_MAX_NUM_CONFIGURATION     1U
 /*---------- -----------*/
@@ -78,7 +82,42 @@
 /*---------- -----------*/
 #define USBD_SELF_POWERED     1U
 /*---------- -----------*/
+#define USBD_POOL_HANDLE_BLOCK_SIZE     640U
+/*---------- -----------*/
+#define USBD_POOL_HANDLE_BLOCK_COUNT     2U
+/*---------- -----------*/
+#define USBD_POOL_STREAM_BLOCK_SIZE     1024U
+/*---------- -----------*/
+#define USBD_POOL_STREAM_BLOCK_COUNT     2U
+/*---------- -----------*/
+#define USBD_UVC_NUM_INSTANCES     2U
+/*---------- -----------*/
+
+/* Source clock of the UVC PTS and SCR timestamps, with the USB frame number */
+#define USBD_UVC_CLOCK_FREQUENCY    LATENCY_CLOCK_HZ
+#define USBD_UVC_CLOCK()            Latency_Now()
+#define USBD_UVC_FRAME_NUMBER()     USBD_LL_GetSofNumber()
 
+/* Boot stages reported by the region of interest extension unit */
+#define USBD_UVC_BOOT_INFO(data)    Boot_GetInfo(data)
+
+/* Frame CRC of the payloads, with the CRC unit */
+#define USBD_UVC_FRAME_CRC(crc, data, len)  FrameCrc_Update((crc), (data), (len))
+
+/* Streaming counters read by the statistics extension unit */
+#define USBD_UVC_STATS(n, counter, value)    Stats_Add((n), STATS_##counter, (value))
+#define USBD_UVC_STATS_INFO(n, rates, data)  Stats_GetInfo((n), (rates), (data))
+
+/* DFU runtime interface: firmware update into the other flash bank */
+#define USBD_UVC_DFU_REQUEST(request, value, length, data)  Dfu_Request((request), (value), (length), (data))
+#define USBD_UVC_DFU_DATA()                  Dfu_DataReceived()
+#define USBD_UVC_DFU_TRANSFER_SIZE           DFU_TRANSFER_SIZE
+
+
+/* Static pools serving USBD_malloc: class handles and streaming buffers */
+#define USBD_POOL_HANDLE    0U
+#define USBD_POOL_STREAM    1U
+#define USBD_POOL_NUM       2U
 
 /****************************************/
 /* #define for FS and HS identification */
@@ -97,10 +136,10 @@
 /* Memory management macros */
 
 /** Alias for memory allocation. */
-#define USBD_malloc         malloc
+#define USBD_malloc         USBD_static_malloc
 
 /** Alias for memory release. */
-#define USBD_free           free
+#define USBD_free           USBD_static_free
 
 /** Alias for memory set. */
 #define USBD_memset         memset
@@ -146,6 +185,17 @@
   * @{
   */
 
+/** Usage counters of one static memory pool. */
+typedef struct
+{
+  uint32_t block_size;    /*!< Size in bytes of each block of the pool */
+  uint32_t block_count;   /*!< Number of blocks reserved at link time */
+  uint32_t in_use;        /*!< Number of blocks currently allocated */
+  uint32_t high_water;    /*!< Highest value reached by in_use since boot */
+  uint32_t spills;        /*!< Requests served by a larger pool, this one full */
+  uint32_t failures;      /*!< Number of requests that could not be served */
+} USBD_PoolStatsTypeDef;
+
 /**
   * @}
   */
@@ -156,6 +206,11 @@
   */
 
 /* Exported functions -------------------------------------------------------*/
+void *USBD_static_malloc(uint32_t size);
+void USBD_static_free(void *p);
+void USBD_Pool_GetStats(uint32_t pool, USBD_PoolStatsTypeDef *stats);
+void USBD_Pool_Report(void);
+uint16_t USBD_LL_GetSofNumber(void);
 
 /**
   * @}
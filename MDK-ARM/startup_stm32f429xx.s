@@ -54,7 +54,7 @@ __initial_sp
 ;   <o>  Heap Size (in Bytes) <0x0-0xFFFFFFFF:8>
 ; </h>
 
-Heap_Size      EQU     0x1200
+Heap_Size      EQU     0x0
 
                 AREA    HEAP, NOINIT, READWRITE, ALIGN=3
 __heap_base
@@ -71,7 +71,12 @@ __heap_limit
                 EXPORT  __Vectors_End
                 EXPORT  __Vectors_Size
 
-__Vectors       DCD     __initial_sp               ; Top of Stack
+; The dual bank boot of the boot loader only starts a bank whose initial stack
+; pointer is in SRAM: the table gives the top of SRAM3, Reset_Handler moves
+; to the main stack in CCM RAM before anything is pushed
+Boot_Stack_Top  EQU     0x20030000
+
+__Vectors       DCD     Boot_Stack_Top             ; Top of Stack
                 DCD     Reset_Handler              ; Reset Handler
                 DCD     NMI_Handler                ; NMI Handler
                 DCD     HardFault_Handler          ; Hard Fault Handler
@@ -193,6 +198,8 @@ Reset_Handler    PROC
         IMPORT  SystemInit
         IMPORT  __main
 
+                 LDR     R0, =__initial_sp
+                 MSR     MSP, R0
                  LDR     R0, =SystemInit
                  BLX     R0
                  LDR     R0, =__main
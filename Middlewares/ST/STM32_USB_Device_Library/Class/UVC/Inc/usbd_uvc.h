@@ -188,6 +188,24 @@
 // (USB_Video_Class_1.1.pdf, A.9.6 Extension Unit Control Selectors)
 #define XU_CONTROL_UNDEFINED            	   	   0x00
 
+// Region of interest extension unit control selectors
+#define XU_ROI_WINDOW_CONTROL                      0x01
+#define XU_ROI_BINNING_CONTROL                     0x02
+#define XU_ROI_CAPTURE_RATE_CONTROL                0x03
+#define XU_ROI_LATENCY_PROBE_CONTROL               0x04
+#define XU_ROI_LATENCY_INFO_CONTROL                0x05
+#define XU_ROI_BOOT_INFO_CONTROL                   0x06
+#define XU_ROI_FRAME_CRC_CONTROL                   0x07
+
+// Motion extension unit control selectors
+#define XU_MOTION_MODE_CONTROL                     0x01
+#define XU_MOTION_THRESHOLD_CONTROL                0x02
+#define XU_MOTION_SCORE_CONTROL                    0x03
+
+// Statistics extension unit control selectors
+#define XU_STATS_COUNTERS_CONTROL                  0x01
+#define XU_STATS_RATES_CONTROL                     0x02
+
 // VideoStreaming Interface Control Selectors
 // (USB_Video_Class_1.1.pdf, A.9.7 VideoStreaming Interface Control Selectors)
 #define VS_CONTROL_UNDEFINED             	       0x00
@@ -267,17 +285,170 @@ typedef struct  _VideoControl{
 
 
 
+// VS_STILL_PROBE_CONTROL / VS_STILL_COMMIT_CONTROL data
+typedef struct  _StillControl{
+  uint8_t    bFormatIndex[1];                // 1
+  uint8_t    bFrameIndex[1];                 // 2
+  uint8_t    bCompressionIndex[1];           // 3
+  uint8_t    dwMaxVideoFrameSize[4];         // 7
+  uint8_t    dwMaxPayloadTransferSize[4];    // 11
+}StillControl;
+
+#define UVC_STILL_CONTROL_LEN                      11
+
+// Current values of the Camera Terminal and Processing Unit controls, as sent on the bus
+typedef struct  _CameraControl{
+  uint8_t    bAutoExposureMode[1];           // CT_AE_MODE_CONTROL
+  uint8_t    dwExposureTimeAbsolute[4];      // CT_EXPOSURE_TIME_ABSOLUTE_CONTROL, 100 us units
+  uint8_t    wBrightness[2];                 // PU_BRIGHTNESS_CONTROL, signed
+  uint8_t    wContrast[2];                   // PU_CONTRAST_CONTROL
+  uint8_t    wGain[2];                       // PU_GAIN_CONTROL
+  uint8_t    bPowerLineFrequency[1];         // PU_POWER_LINE_FREQUENCY_CONTROL
+  uint8_t    wWhiteBalanceTemperature[2];    // PU_WHITE_BALANCE_TEMPERATURE_CONTROL
+  uint8_t    bWhiteBalanceTemperatureAuto[1];// PU_WHITE_BALANCE_TEMPERATURE_AUTO_CONTROL
+  uint8_t    bBinning[1];                    // XU_ROI_BINNING_CONTROL, 1: 2x2 binning
+  uint8_t    bCaptureRate[1];                // XU_ROI_CAPTURE_RATE_CONTROL, 0: all, 1: 1 of 2, 2: 1 of 4 frames
+  uint8_t    bLatencyProbe[1];               // XU_ROI_LATENCY_PROBE_CONTROL, 1: capture marker, PTS and SCR
+  uint8_t    bFrameCrc[1];                   // XU_ROI_FRAME_CRC_CONTROL, 1: frame number and CRC in the payload headers
+  uint8_t    bMotionMode[1];                 // XU_MOTION_MODE_CONTROL, 0: off, 1: skip static frames, 2: lower rate
+  uint8_t    bMotionThreshold[1];            // XU_MOTION_THRESHOLD_CONTROL, score of a moving scene
+  uint8_t    bMotionScore[1];                // XU_MOTION_SCORE_CONTROL, read-only, 0 static to 254
+}CameraControl;
+
+// XU_ROI_WINDOW_CONTROL data: window inside the sensor frame
+typedef struct  _RoiControl{
+  uint8_t    wLeft[2];                       // 2
+  uint8_t    wTop[2];                        // 4
+  uint8_t    wWidth[2];                      // 6
+  uint8_t    wHeight[2];                     // 8
+}RoiControl;
+
+#define UVC_ROI_CONTROL_LEN                        8
+
+// XU_ROI_LATENCY_INFO_CONTROL data: timing of the last frame sent, times in
+// dwClockFrequency units, SOF numbers are the 11-bit USB frame numbers
+typedef struct  _LatencyControl{
+  uint8_t    dwFrameNumber[4];               // 4  number burned into the test patterns
+  uint8_t    dwCaptureTime[4];               // 8  capture time, the PTS of the frame
+  uint8_t    dwFirstPayloadTime[4];          // 12 first payload filled
+  uint8_t    dwLastPayloadTime[4];           // 16 payload with the EOF bit filled
+  uint8_t    wFirstPayloadSof[2];            // 18
+  uint8_t    wLastPayloadSof[2];             // 20
+}LatencyControl;
+
+#define UVC_LATENCY_CONTROL_LEN                    20
+
+// XU_ROI_BOOT_INFO_CONTROL data: boot stages in us from reset, 0 while a
+// stage is not reached
+typedef struct  _BootControl{
+  uint8_t    dwClockReady[4];                // 4  system clock running
+  uint8_t    dwPeripheralsReady[4];          // 8  GPIO, UART, timestamp timer
+  uint8_t    dwConnected[4];                 // 12 pull-up on, enumeration can start
+  uint8_t    dwConfigured[4];                // 16 SET_CONFIGURATION
+  uint8_t    dwStreamStart[4];               // 20 first alternate setting 1
+  uint8_t    dwMediaReady[4];                // 24 sensor, capture and frame sources set up
+  uint8_t    dwFirstFrame[4];                // 28 end of the first frame sent
+}BootControl;
+
+#define UVC_BOOT_CONTROL_LEN                       28
+
+// XU_STATS_COUNTERS_CONTROL data: totals since boot, wrapping at 32 bits.
+// XU_STATS_RATES_CONTROL data: the same per second over the last window,
+// dwEncodeMax is the longest encode of the window
+typedef struct  _StatsControl{
+  uint8_t    dwTime[4];                      // 4  uptime in s, or window length in ms
+  uint8_t    dwFrames[4];                    // 8  frames sent by this function
+  uint8_t    dwBytes[4];                     // 12 payload bytes sent, headers included
+  uint8_t    dwUnderruns[4];                 // 16 frame intervals sent empty, no frame ready
+  uint8_t    dwSkipped[4];                   // 20 frame intervals left empty on a static scene
+  uint8_t    dwDropped[4];                   // 24 frames captured and never sent
+  uint8_t    dwIsoIncomplete[4];             // 28 USB frames the isochronous transfers missed
+  uint8_t    dwEncoded[4];                   // 32 frames encoded, device wide
+  uint8_t    dwEncodeTime[4];                // 36 us spent encoding
+  uint8_t    dwEncodeMax[4];                 // 40 longest encode in us
+}StatsControl;
+
+#define UVC_STATS_CONTROL_LEN                      40
+
+// Length of the probe/commit data exchanged with the host
+#ifdef UVC_1_1
+#define UVC_PROBE_CONTROL_LEN                      34
+#else
+#define UVC_PROBE_CONTROL_LEN                      26
+#endif
+
 #define WBVAL(x) (x & 0xFF),((x >> 8) & 0xFF)
 #define DBVAL(x) (x & 0xFF),((x >> 8) & 0xFF),((x >> 16) & 0xFF),((x >> 24) & 0xFF)
 
 #define USB_UVC_ENDPOINT															0x01
 
+// Number of UVC functions (VC + VS interface pairs) exposed by the device
+#ifndef USBD_UVC_NUM_INSTANCES
+#define USBD_UVC_NUM_INSTANCES                        1U
+#endif
+
+// Source clock of the PTS and SCR payload header fields and SOF number of the
+// current USB frame, usually provided by usbd_conf.h
+#ifndef USBD_UVC_CLOCK_FREQUENCY
+#define USBD_UVC_CLOCK_FREQUENCY                      48000000U
+#endif
+#ifndef USBD_UVC_CLOCK
+#define USBD_UVC_CLOCK()                              0U
+#endif
+#ifndef USBD_UVC_FRAME_NUMBER
+#define USBD_UVC_FRAME_NUMBER()                       0U
+#endif
+// Fills the XU_ROI_BOOT_INFO_CONTROL data before a GET_CUR
+#ifndef USBD_UVC_BOOT_INFO
+#define USBD_UVC_BOOT_INFO(data)
+#endif
+// Continues the frame CRC over len bytes of payload data: CRC-32/MPEG-2,
+// from UVC_FRAME_CRC_INIT. Without it XU_ROI_FRAME_CRC_CONTROL stays at 0
+#ifdef USBD_UVC_FRAME_CRC
+#define USBD_UVC_HAS_FRAME_CRC                        1U
+#else
+#define USBD_UVC_HAS_FRAME_CRC                        0U
+#define USBD_UVC_FRAME_CRC(crc, data, len)            (crc)
+#endif
+// Counts a streaming event of function n: FRAMES, BYTES, UNDERRUNS, SKIPPED
+// or ISO_INCOMPLETE, and fills the XU_STATS_xxx data before a GET_CUR, rates
+// 1 for XU_STATS_RATES_CONTROL. Called from the USB bottom half
+#ifndef USBD_UVC_STATS
+#define USBD_UVC_STATS(n, counter, value)
+#endif
+#ifndef USBD_UVC_STATS_INFO
+#define USBD_UVC_STATS_INFO(n, rates, data)
+#endif
+// DFU runtime interface after the UVC functions, for firmware updates:
+// USBD_UVC_DFU_REQUEST() handles a DFU class request and sets data to its IN
+// data or to the buffer of its OUT data stage, returns their length or -1 to
+// stall it, USBD_UVC_DFU_DATA() is called once that OUT data is in. Called
+// from the USB bottom half. Without them the device has no DFU interface
+#ifdef USBD_UVC_DFU_REQUEST
+#define USBD_UVC_HAS_DFU                              1U
+#else
+#define USBD_UVC_HAS_DFU                              0U
+#define USBD_UVC_DFU_REQUEST(request, value, length, data)  (-1)
+#define USBD_UVC_DFU_DATA()
+#endif
+#ifndef USBD_UVC_DFU_TRANSFER_SIZE
+#define USBD_UVC_DFU_TRANSFER_SIZE                    1024U
+#endif
+
 #define WIDTH                                         (unsigned int)640
 #define HEIGHT                                        (unsigned int)480
+// The still image is the stream image, sent once with the STI bit set
+#define STILL_WIDTH                                   WIDTH
+#define STILL_HEIGHT                                  HEIGHT
 #define MIN_FPS                                       15
 #define CAM_FPS                                       15
 #define MAX_FPS                                       15
+// The isochronous bandwidth of a frame and the 1.25 KB FS FIFO are shared by all VS functions
+#if (USBD_UVC_NUM_INSTANCES > 1)
+#define VIDEO_PACKET_SIZE                             (unsigned int)(448)
+#else
 #define VIDEO_PACKET_SIZE                             (unsigned int)(1022)//128+130
+#endif
 #define MIN_BIT_RATE                                  (unsigned long)(0x7CE000)//16 bit
 #define MAX_BIT_RATE                                  (unsigned long)(0x3E80000)
 //#define MAX_FRAME_SIZE                                (unsigned long)(WIDTH*HEIGHT*2)//yuy2
@@ -286,6 +457,13 @@ typedef struct  _VideoControl{
 #define MIN_INTERVAL                                      (unsigned long)(10000000/MIN_FPS)
 #define INTERVAL                                      (unsigned long)(10000000/CAM_FPS)
 #define MAX_INTERVAL                                      (unsigned long)(10000000/MAX_FPS)
+// Formats of the VS interface: the MJPEG stream and the tile delta frames (see tile_delta.h)
+#define UVC_FORMAT_INDEX_MJPEG                        0x01
+#define UVC_FORMAT_INDEX_TILE                         0x02
+// Largest tile delta frame: header, one bit and 384 bytes per 16x16 tile
+#define MAX_TILE_FRAME_SIZE                           (unsigned long)(16 + ((WIDTH/16)*(HEIGHT/16)+7)/8 + (WIDTH/16)*(HEIGHT/16)*384)
+// Payloads (1 ms FS frames) of one frame interval, sent empty when a frame is skipped
+#define FRAME_INTERVAL_PACKETS                        (unsigned int)(1000/CAM_FPS)
 
 //#define PACKETS_IN_FRAME                              (unsigned int)(MAX_FRAME_SIZE/(VIDEO_PACKET_SIZE-2) + 1)
 //#define LAST_PACKET_SIZE                              (unsigned int)(MAX_FRAME_SIZE - ((PACKETS_IN_FRAME-1) * (VIDEO_PACKET_SIZE-2)) + 2)
@@ -293,8 +471,8 @@ typedef struct  _VideoControl{
 #define VIDEO_USES_ISOC_EP  1
 
 
-#define VC_TERMINAL_SIZ (unsigned int)(UVC_VC_INTERFACE_HEADER_DESC_SIZE(1) + UVC_CAMERA_TERMINAL_DESC_SIZE(2) + UVC_OUTPUT_TERMINAL_DESC_SIZE(0))
-#define VC_HEADER_SIZ (unsigned int)(UVC_VS_INTERFACE_INPUT_HEADER_DESC_SIZE(1,1) + VS_FORMAT_UNCOMPRESSED_DESC_SIZE + VS_FRAME_UNCOMPRESSED_DESC_SIZE + VS_COLOR_MATCHING_DESC_SIZE)
+#define VC_TERMINAL_SIZ (unsigned int)(UVC_VC_INTERFACE_HEADER_DESC_SIZE(1) + UVC_CAMERA_TERMINAL_DESC_SIZE(2) + UVC_PROCESSING_UNIT_DESC_SIZE(2) + UVC_EXTENSION_UNIT_DESC_SIZE(1,1) + UVC_EXTENSION_UNIT_DESC_SIZE(1,1) + UVC_EXTENSION_UNIT_DESC_SIZE(1,1) + UVC_OUTPUT_TERMINAL_DESC_SIZE(0))
+#define VC_HEADER_SIZ (unsigned int)(UVC_VS_INTERFACE_INPUT_HEADER_DESC_SIZE(1,2) + VS_FORMAT_UNCOMPRESSED_DESC_SIZE + VS_FRAME_UNCOMPRESSED_DESC_SIZE + VS_STILL_IMAGE_FRAME_DESC_SIZE(1,0) + VS_COLOR_MATCHING_DESC_SIZE + VS_FORMAT_FRAME_BASED_DESC_SIZE + VS_FRAME_FRAME_BASED_DESC_SIZE)
 
 
 #define USB_CONFIGURATION_DESCRIPTOR_TYPE       0x02
@@ -311,6 +489,12 @@ typedef struct  _VideoControl{
 #define UVC_VC_INTERFACE_HEADER_DESC_SIZE(n)  (char)(12+n)
 #define UVC_CAMERA_TERMINAL_DESC_SIZE(n)      (char)(15+n)
 #define UVC_OUTPUT_TERMINAL_DESC_SIZE(n)      (char)(9+n)
+#ifdef UVC_1_1
+#define UVC_PROCESSING_UNIT_DESC_SIZE(n)      (char)(10+n)
+#else
+#define UVC_PROCESSING_UNIT_DESC_SIZE(n)      (char)(9+n)
+#endif
+#define UVC_EXTENSION_UNIT_DESC_SIZE(p,n)     (char)(24+p+n)
 #define UVC_VS_INTERFACE_INPUT_HEADER_DESC_SIZE(a,b) (char) (13+a*b)
 
 
@@ -318,11 +502,50 @@ typedef struct  _VideoControl{
 #define VS_FRAME_UNCOMPRESSED_DESC_SIZE   (char)(0x26)
 #define VS_FRAME_COMPRESSED_DESC_SIZE   (char)(0x26)
 #define VS_COLOR_MATCHING_DESC_SIZE   (char)(6)
-
-#define USB_UVC_VCIF_NUM 0
-#define USB_UVC_VSIF_NUM            (char)1
-
-#define VIDEO_TOTAL_IF_NUM 2
+#define VS_FORMAT_FRAME_BASED_DESC_SIZE   (char)(28)
+#define VS_FRAME_FRAME_BASED_DESC_SIZE   (char)(38)
+#define VS_STILL_IMAGE_FRAME_DESC_SIZE(n,m)   (char)(6+4*n+m)
+
+// interface numbers and streaming endpoint of UVC function n
+#define USB_UVC_VCIF_NUM(n)         (char)(2*(n))
+#define USB_UVC_VSIF_NUM(n)         (char)(2*(n)+1)
+#define USB_UVC_IN_EP(n)            USB_ENDPOINT_IN(USB_UVC_ENDPOINT + (n))
+#define USB_UVC_INSTANCE(itf)       ((itf) >> 1)
+// DFU runtime interface, after those of the UVC functions
+#define USB_DFU_IF_NUM              (char)(2*USBD_UVC_NUM_INSTANCES)
+
+// IDs of the units and terminals of the VC interface
+#define UVC_ID_CAMERA_TERMINAL      0x01
+#define UVC_ID_OUTPUT_TERMINAL      0x02
+#define UVC_ID_PROCESSING_UNIT      0x03
+#define UVC_ID_EXTENSION_UNIT       0x04
+#define UVC_ID_MOTION_UNIT          0x05
+#define UVC_ID_STATS_UNIT           0x06
+
+// guidExtensionCode of the region of interest extension unit {8a0f88dd-ba1c-5d4b-8c2e-3f6a5d901233}
+#define UVC_XU_ROI_GUID             0xDD, 0x88, 0x0F, 0x8A, 0x1C, 0xBA, 0x4B, 0x5D, \
+                                    0x8C, 0x2E, 0x3F, 0x6A, 0x5D, 0x90, 0x12, 0x33
+
+// guidExtensionCode of the motion extension unit {8a0f88de-ba1c-5d4b-8c2e-3f6a5d901233}
+#define UVC_XU_MOTION_GUID          0xDE, 0x88, 0x0F, 0x8A, 0x1C, 0xBA, 0x4B, 0x5D, \
+                                    0x8C, 0x2E, 0x3F, 0x6A, 0x5D, 0x90, 0x12, 0x33
+
+// guidExtensionCode of the statistics extension unit {8a0f88df-ba1c-5d4b-8c2e-3f6a5d901233}
+#define UVC_XU_STATS_GUID           0xDF, 0x88, 0x0F, 0x8A, 0x1C, 0xBA, 0x4B, 0x5D, \
+                                    0x8C, 0x2E, 0x3F, 0x6A, 0x5D, 0x90, 0x12, 0x33
+
+// guidFormat of the tile delta frames, FourCC 'TDLT' {544c4454-0000-0010-8000-00aa00389b71}
+#define UVC_TILE_FORMAT_GUID        0x54, 0x44, 0x4C, 0x54, 0x00, 0x00, 0x10, 0x00, \
+                                    0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71
+
+// CT_AE_MODE_CONTROL modes
+#define UVC_AE_MODE_MANUAL          0x01
+#define UVC_AE_MODE_AUTO            0x02
+#define UVC_AE_MODE_SHUTTER_PRIO    0x04
+#define UVC_AE_MODE_APERTURE_PRIO   0x08
+
+#define VIDEO_TOTAL_IF_NUM          (2*USBD_UVC_NUM_INSTANCES + USBD_UVC_HAS_DFU)
+#define VIDEO_VS_ALT_NUM            2
 
 
 /* bmRequestType.Dir */
@@ -364,9 +587,22 @@ typedef struct  _VideoControl{
 #define USB_DEVICE_CLASS_STORAGE               0x08
 #define USB_DEVICE_CLASS_HUB                   0x09
 #define USB_DEVICE_CLASS_MISCELLANEOUS         0xEF
+#define USB_DEVICE_CLASS_APPLICATION           0xFE
 #define USB_DEVICE_CLASS_VENDOR_SPECIFIC       0xFF
 
 
+/* DFU runtime interface (DFU 1.1) */
+#define DFU_SUBCLASS_UPGRADE                   0x01
+#define DFU_PROTOCOL_RUNTIME                   0x01
+#define DFU_FUNCTIONAL_DESCRIPTOR_TYPE         0x21
+#define DFU_FUNCTIONAL_DESC_SIZE               (char)9
+#define DFU_ATTR_CAN_DNLOAD                    0x01
+#define DFU_ATTR_MANIFESTATION_TOLERANT        0x04
+#define DFU_ATTR_WILL_DETACH                   0x08
+#define DFU_DETACH_TIMEOUT                     1000    /* ms */
+#define DFU_VERSION                            0x0110
+
+
 /* bmAttributes in Configuration Descriptor */
 #define USB_CONFIG_POWERED_MASK                0xC0
 #define USB_CONFIG_BUS_POWERED                 0x80
@@ -400,9 +636,132 @@ typedef struct  _VideoControl{
 #define USB_ENDPOINT_USAGE_RESERVED            0x30
 
 
+/* bmHeaderInfo bits of the payload header */
+#define UVC_HEADER_FID                         0x01
+#define UVC_HEADER_EOF                         0x02
+#define UVC_HEADER_PTS                         0x04
+#define UVC_HEADER_SCR                         0x08
+#define UVC_HEADER_STI                         0x20
+#define UVC_HEADER_EOH                         0x80
+
+/* Payload header lengths: bHeaderLength + bmHeaderInfo, then the optional
+   dwPresentationTime and the scrSourceClock (STC + 11-bit SOF number) */
+#define UVC_HEADER_LEN                         2U
+#define UVC_HEADER_LEN_SCR                     8U
+#define UVC_HEADER_LEN_PTS_SCR                 12U
+
+/* Frame CRC block, after the standard fields of the header while
+   XU_ROI_FRAME_CRC_CONTROL is on: dwFrameNumber, then the CRC of the frame
+   data up to the end of this payload, both little endian */
+#define UVC_HEADER_CRC_LEN                     8U
+#define UVC_FRAME_CRC_INIT                     0xFFFFFFFFU
+
+/* VS_STILL_IMAGE_TRIGGER_CONTROL values */
+#define UVC_STILL_TRIGGER_NORMAL               0x00
+#define UVC_STILL_TRIGGER_TRANSMIT             0x01
+#define UVC_STILL_TRIGGER_TRANSMIT_BULK        0x02
+#define UVC_STILL_TRIGGER_ABORT                0x03
+
+/* Still image states of a UVC function */
+#define UVC_STILL_IDLE                         0x00
+#define UVC_STILL_CAPTURE                      0x01   /* waiting for the capture pipeline */
+#define UVC_STILL_READY                        0x02   /* sent with the next frame */
+#define UVC_STILL_SENDING                      0x03
+
+/* Streaming states of the VS interface */
+#define UVC_PLAY_STATUS_STOP                   0x00
+#define UVC_PLAY_STATUS_READY                  0x01
+#define UVC_PLAY_STATUS_STREAMING              0x02
+
+// State of one UVC function
+typedef struct
+{
+  uint8_t            vcif;             // VideoControl interface number
+  uint8_t            vsif;             // VideoStreaming interface number
+  uint8_t            ep;               // isochronous IN endpoint address
+  uint32_t           alt_setting;      // current alternate setting of the VS interface
+  __IO uint8_t       play_status;      // UVC_PLAY_STATUS_xxx
+  __IO uint8_t       tx_enable_flag;   // 1 while a frame is being sent
+  uint8_t            header[2];        // payload header: length + bmHeaderInfo
+  uint8_t           *packet;           // payload buffer (VIDEO_PACKET_SIZE bytes)
+  const uint8_t     *frame_ptr;        // read position inside the current frame
+  const uint8_t     *frame_end;        // end of a tile delta frame, NULL when the MJPEG EOI ends the frame
+  const uint8_t * __IO next_frame;     // tile delta frame handed over by USBD_UVC_FrameReady
+  uint32_t           next_frame_len;
+  uint16_t           idle_packets;     // empty payloads left in a skipped frame interval
+  uint32_t           next_number;      // frame number and capture time of next_frame
+  uint32_t           next_pts;
+  uint32_t           frame_number;     // frame being sent
+  uint32_t           pts;              // its capture time
+  uint32_t           crc;              // its CRC, over the data sent so far
+  uint32_t           stc;              // source clock of the last payload
+  uint32_t           first_stc;        // and of the first payload of the frame
+  uint16_t           sof;              // USB frame numbers of the same payloads
+  uint16_t           first_sof;
+  LatencyControl     latency;          // XU_ROI_LATENCY_INFO_CONTROL data
+  VideoControl       probe;            // VS_PROBE_CONTROL data
+  VideoControl       commit;           // VS_COMMIT_CONTROL data
+  CameraControl      camera;           // CT, PU and XU controls data
+  RoiControl         roi;              // XU_ROI_WINDOW_CONTROL data
+  StillControl       still_probe;      // VS_STILL_PROBE_CONTROL data
+  StillControl       still_commit;     // VS_STILL_COMMIT_CONTROL data
+  uint8_t            still_trigger;    // VS_STILL_IMAGE_TRIGGER_CONTROL data
+  __IO uint8_t       still_state;      // UVC_STILL_xxx
+  const uint8_t     *still_image;      // encoded still frame, valid in UVC_STILL_READY
+  uint8_t            request_error;    // VC_REQUEST_ERROR_CODE_CONTROL data
+}USBD_UVC_InstanceTypeDef;
+
+struct _UVC_Control;
+
+// Class handle, allocated from the static USBD pools in USBD_UVC_Init
+typedef struct
+{
+  USBD_UVC_InstanceTypeDef    inst[USBD_UVC_NUM_INSTANCES];
+  const struct _UVC_Control  *ep0_ctrl;   // control waiting for its SET_CUR data stage
+  USBD_UVC_InstanceTypeDef   *ep0_inst;   // function addressed by that SET_CUR
+  uint8_t                     ep0_buf[UVC_PROBE_CONTROL_LEN]; // SET_CUR data, checked before it is applied
+  uint8_t                     ep0_dfu;    // 1 while the data stage of a DFU_DNLOAD is received
+}USBD_UVC_HandleTypeDef;
+
+// Video hardware callbacks, all called from the USB interrupt: they must not block
+typedef struct
+{
+  int8_t  (*Init)         (void);
+  int8_t  (*DeInit)       (void);
+  int8_t  (*Control)      (uint8_t n, uint8_t entity, uint8_t selector, int32_t value); // new CT/PU/XU value of function n
+  int8_t  (*Window)       (uint8_t n, uint16_t x, uint16_t y, uint16_t width, uint16_t height); // new region of interest
+  int8_t  (*FrameDone)    (uint8_t n);                                                  // function n sent the end of a frame
+  int8_t  (*SkipFrame)    (uint8_t n);                                                  // USBD_BUSY: leave the next frame interval of function n empty
+  int8_t  (*StillCapture) (uint8_t n);   // capture and encode a still for function n, then call USBD_UVC_StillReady
+                                         // USBD_FAIL: no still pipeline, the next frame of the stream is used
+}USBD_UVC_ItfTypeDef;
+
 extern USBD_ClassTypeDef  USBD_UVC;
 #define USBD_UVC_CLASS    &USBD_UVC
 
+uint8_t  USBD_UVC_RegisterInterface  (USBD_HandleTypeDef   *pdev,
+                                      USBD_UVC_ItfTypeDef *fops);
+
+uint8_t  USBD_UVC_StillTrigger       (USBD_HandleTypeDef   *pdev, uint8_t n);
+
+uint8_t  USBD_UVC_StillReady         (USBD_HandleTypeDef   *pdev, uint8_t n,
+                                      const uint8_t *image);
+
+uint8_t  USBD_UVC_SetMotionScore     (USBD_HandleTypeDef   *pdev, uint8_t n,
+                                      uint8_t score);
+
+uint8_t  USBD_UVC_FrameReady         (USBD_HandleTypeDef   *pdev, uint8_t n,
+                                      const uint8_t *frame, uint32_t len,
+                                      uint32_t number, uint32_t capture_time);
+
+uint8_t  USBD_UVC_GetFormat          (USBD_HandleTypeDef   *pdev, uint8_t n);
+
+uint8_t  USBD_UVC_FrameBusy          (USBD_HandleTypeDef   *pdev, uint8_t n);
+
+uint8_t  USBD_UVC_GetActive          (USBD_HandleTypeDef   *pdev);
+
+const uint8_t *USBD_UVC_GetStreamImage (void);
+
 
 #ifdef __cplusplus
 }
@@ -52,6 +52,7 @@
 #include "usbd_uvc.h"
 #include "usbd_ctlreq.h"
 #include "test_image.h"
+#include <stddef.h>
 
 
 /** @addtogroup STM32_USB_DEVICE_LIBRARY
@@ -67,6 +68,25 @@
 /** @defgroup USBD_UVC_Private_TypesDefinitions
   * @{
   */
+
+/* Class-specific control, addressed by (entity, selector) */
+typedef struct _UVC_Control
+{
+  uint8_t         info;       /* GET_INFO capabilities (SUPPORTS_GET, SUPPORTS_SET...) */
+  uint8_t         len;        /* GET_LEN, size of the control data */
+  uint16_t        cur;        /* offset of the current value inside the UVC function */
+  const uint8_t  *min;        /* GET_MIN data, NULL if not supported */
+  const uint8_t  *max;        /* GET_MAX data, NULL if not supported */
+  const uint8_t  *res;        /* GET_RES data, NULL if not supported */
+  const uint8_t  *def;        /* GET_DEF data, NULL if not supported */
+  uint8_t       (*set)(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                       const struct _UVC_Control *ctrl, const uint8_t *data);
+                              /* checks and applies a SET_CUR, returns a request error code */
+  uint8_t         entity;     /* unit or terminal ID, 0 for an interface control */
+  uint8_t         selector;   /* control selector */
+  uint8_t         flags;      /* UVC_CTRL_FLAG_xxx */
+} UVC_ControlTypeDef;
+
 /**
   * @}
   */
@@ -75,6 +95,54 @@
 /** @defgroup USBD_UVC_Private_Defines
   * @{
   */
+
+/* Rows of the control map: the two interfaces, then one row per entity ID */
+#define UVC_SLOT_VC_INTERFACE       0U
+#define UVC_SLOT_VS_INTERFACE       1U
+#define UVC_SLOT_ENTITY(id)         ((id) + 1U)
+#define UVC_MAX_ENTITY_ID           UVC_ID_STATS_UNIT
+#define UVC_NUM_SLOTS               (UVC_MAX_ENTITY_ID + 2U)
+#define UVC_MAX_SELECTOR            0x13U
+
+/* Control flags */
+#define UVC_CTRL_FLAG_CAMERA        0x01U   /* forwarded to the video hardware, range checked */
+#define UVC_CTRL_FLAG_SIGNED        0x02U   /* signed value */
+#define UVC_CTRL_FLAG_BITMAP        0x04U   /* one bit of the GET_RES bitmap, no GET_MIN/GET_MAX */
+#define UVC_CTRL_FLAG_MANUAL_AE     0x08U   /* read-only while the exposure is automatic */
+#define UVC_CTRL_FLAG_MANUAL_WB     0x10U   /* read-only while the white balance is automatic */
+
+/* Indexes of the control table, the map stores index + 1 so that 0 means "no control" */
+enum
+{
+  UVC_CTRL_REQUEST_ERROR_CODE,
+  UVC_CTRL_PROBE,
+  UVC_CTRL_COMMIT,
+  UVC_CTRL_STILL_PROBE,
+  UVC_CTRL_STILL_COMMIT,
+  UVC_CTRL_STILL_TRIGGER,
+  UVC_CTRL_AE_MODE,
+  UVC_CTRL_EXPOSURE_ABSOLUTE,
+  UVC_CTRL_BRIGHTNESS,
+  UVC_CTRL_CONTRAST,
+  UVC_CTRL_GAIN,
+  UVC_CTRL_POWER_LINE_FREQUENCY,
+  UVC_CTRL_WB_TEMPERATURE,
+  UVC_CTRL_WB_TEMPERATURE_AUTO,
+  UVC_CTRL_ROI_WINDOW,
+  UVC_CTRL_ROI_BINNING,
+  UVC_CTRL_ROI_CAPTURE_RATE,
+  UVC_CTRL_ROI_LATENCY_PROBE,
+  UVC_CTRL_ROI_LATENCY_INFO,
+  UVC_CTRL_ROI_BOOT_INFO,
+  UVC_CTRL_ROI_FRAME_CRC,
+  UVC_CTRL_MOTION_MODE,
+  UVC_CTRL_MOTION_THRESHOLD,
+  UVC_CTRL_MOTION_SCORE,
+  UVC_CTRL_STATS_COUNTERS,
+  UVC_CTRL_STATS_RATES,
+  UVC_CTRL_NUM
+};
+
 /**
   * @}
   */
@@ -123,9 +191,45 @@ static uint8_t  USBD_UVC_IsoINIncomplete (USBD_HandleTypeDef *pdev, uint8_t epnu
 
 static uint8_t  USBD_UVC_IsoOutIncomplete (USBD_HandleTypeDef *pdev, uint8_t epnum);
 
-static void UVC_REQ_GetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req);
+static uint8_t UVC_REQ_Control(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                               USBD_SetupReqTypedef *req);
+
+static uint8_t UVC_REQ_Dfu(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req);
+
+static USBD_UVC_InstanceTypeDef *UVC_GetInstance(USBD_HandleTypeDef *pdev, uint8_t itf);
+
+static uint8_t UVC_SetProbe(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                            const UVC_ControlTypeDef *ctrl, const uint8_t *data);
+
+static uint8_t UVC_SetCommit(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                             const UVC_ControlTypeDef *ctrl, const uint8_t *data);
+
+static uint8_t UVC_SetStillProbe(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                                 const UVC_ControlTypeDef *ctrl, const uint8_t *data);
+
+static uint8_t UVC_SetStillCommit(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                                  const UVC_ControlTypeDef *ctrl, const uint8_t *data);
+
+static uint8_t UVC_SetStillTrigger(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                                   const UVC_ControlTypeDef *ctrl, const uint8_t *data);
+
+static uint8_t UVC_SetCamera(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                             const UVC_ControlTypeDef *ctrl, const uint8_t *data);
+
+static uint8_t UVC_SetWindow(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                             const UVC_ControlTypeDef *ctrl, const uint8_t *data);
 
-static void UVC_REQ_SetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req);
+static int32_t UVC_GetValue(const UVC_ControlTypeDef *ctrl, const uint8_t *data);
+
+static void UVC_EndFrame(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst, uint8_t n);
+
+static uint16_t UVC_PutHeader(USBD_UVC_InstanceTypeDef *inst, uint8_t *packet, uint8_t info, uint8_t pts);
+
+static void UVC_PutFrameCrc(USBD_UVC_InstanceTypeDef *inst, uint8_t *packet, uint16_t header_len, uint16_t size);
+
+static void UVC_PutDword(uint8_t *dst, uint32_t value);
+
+static uint8_t UVC_IsDisabled(const USBD_UVC_InstanceTypeDef *inst, const UVC_ControlTypeDef *ctrl);
 
 	
 /**
@@ -168,193 +272,323 @@ __ALIGN_BEGIN static uint8_t USBD_UVC_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIER_
   0x00,
 };
 
-#define USB_VIDEO_DESC_SIZ 159
+/* Size of the descriptors of one UVC function, from the IAD to the streaming endpoint */
+#ifdef VIDEO_USES_ISOC_EP
+#define UVC_VS_EP_DESC_SIZ          (USB_INTERFACE_DESC_SIZE + USB_ENDPOINT_DESC_SIZE)
+#else
+#define UVC_VS_EP_DESC_SIZ          (USB_ENDPOINT_DESC_SIZE)
+#endif
+#define UVC_FUNCTION_DESC_SIZ       (UVC_INTERFACE_ASSOCIATION_DESC_SIZE + USB_INTERFACE_DESC_SIZE + \
+                                     VC_TERMINAL_SIZ + USB_INTERFACE_DESC_SIZE + VC_HEADER_SIZ + \
+                                     UVC_VS_EP_DESC_SIZ)
+#if USBD_UVC_HAS_DFU
+#define UVC_DFU_DESC_SIZ            (USB_INTERFACE_DESC_SIZE + DFU_FUNCTIONAL_DESC_SIZE)
+#else
+#define UVC_DFU_DESC_SIZ            0
+#endif
+#define USB_VIDEO_DESC_SIZ          (USB_CONFIGUARTION_DESC_SIZE + USBD_UVC_NUM_INSTANCES * UVC_FUNCTION_DESC_SIZ + \
+                                     UVC_DFU_DESC_SIZ)
+
+#ifndef VIDEO_USES_ISOC_EP
+/* Standard VS Bulk Video data Endpoint Descriptor, part of alternate setting 0 */
+#define UVC_VS_ALT0_NUM_EP          0x01
+#define UVC_VS_ALT0_EP_DESC(n)                                                                     \
+  USB_ENDPOINT_DESC_SIZE,                   /* bLength                  7 */                       \
+  USB_ENDPOINT_DESCRIPTOR_TYPE,             /* bDescriptorType          5 (ENDPOINT) */            \
+  USB_UVC_IN_EP(n),                         /* bEndpointAddress         EP IN of function n */     \
+  USB_ENDPOINT_TYPE_BULK,                   /* bmAttributes             Bulk transfer type */      \
+  WBVAL(VIDEO_PACKET_SIZE),                 /* wMaxPacketSize */                                   \
+  0x00,                                     /* bInterval */
+#define UVC_VS_ALT1_DESC(n)
+#else
+#define UVC_VS_ALT0_NUM_EP          0x00    /* bNumEndpoints - none, no bandwidth used */
+#define UVC_VS_ALT0_EP_DESC(n)
+/* Standard VS Interface Descriptor, alternate setting 1 = operational setting */
+#define UVC_VS_ALT1_DESC(n)                                                                        \
+  USB_INTERFACE_DESC_SIZE,                   /* bLength                  9 */                      \
+  USB_INTERFACE_DESCRIPTOR_TYPE,             /* bDescriptorType          4 */                      \
+  USB_UVC_VSIF_NUM(n),                       /* bInterfaceNumber         VS interface of function n */ \
+  0x01,                                      /* bAlternateSetting        1 index of this setting */ \
+  0x01,                                      /* bNumEndpoints            1 one EP used */          \
+  CC_VIDEO,                                  /* bInterfaceClass         14 Video */                \
+  SC_VIDEOSTREAMING,                         /* bInterfaceSubClass       2 Video Streaming */      \
+  PC_PROTOCOL_UNDEFINED,                     /* bInterfaceProtocol       0 (protocol undefined) */ \
+  0x00,                                      /* iInterface               0 no description available */ \
+                                                                                                   \
+  /* Standard VS Isochronous Video data Endpoint Descriptor */                                     \
+  USB_ENDPOINT_DESC_SIZE,                   /* bLength                  7 */                       \
+  USB_ENDPOINT_DESCRIPTOR_TYPE,             /* bDescriptorType          5 (ENDPOINT) */            \
+  USB_UVC_IN_EP(n),                         /* bEndpointAddress         EP IN of function n */     \
+  USB_ENDPOINT_TYPE_ISOCHRONOUS | USB_ENDPOINT_SYNC_ASYNCHRONOUS, /* bmAttributes isochronous */   \
+  WBVAL(VIDEO_PACKET_SIZE),                 /* wMaxPacketSize           share of the frame bandwidth */ \
+  0x01,                                     /* bInterval                1 one frame interval */
+#endif
+
+#ifdef UVC_1_1
+#define UVC_PU_VIDEO_STANDARDS      0x00,   /* bmVideoStandards         0 no analog video standard */
+#else
+#define UVC_PU_VIDEO_STANDARDS
+#endif
+
+/* All descriptors of UVC function n: IAD, VC interface and VS interface */
+#define UVC_FUNCTION_DESC(n)                                                                       \
+  /* Interface Association Descriptor */                                                           \
+  UVC_INTERFACE_ASSOCIATION_DESC_SIZE,       /* bLength                  8 */                      \
+  USB_INTERFACE_ASSOCIATION_DESCRIPTOR_TYPE, /* bDescriptorType         11 */                      \
+  USB_UVC_VCIF_NUM(n),                       /* bFirstInterface          VC interface of function n */ \
+  0x02,                                      /* bInterfaceCount          2 */                      \
+  CC_VIDEO,                                  /* bFunctionClass          14 Video */                \
+  SC_VIDEO_INTERFACE_COLLECTION,             /* bFunctionSubClass        3 Video Interface Collection */ \
+  PC_PROTOCOL_UNDEFINED,                     /* bInterfaceProtocol       0 (protocol undefined) */ \
+  0x02,                                      /* iFunction                2 */                      \
+                                                                                                   \
+  /* Standard VC Interface Descriptor */                                                           \
+  USB_INTERFACE_DESC_SIZE,                   /* bLength                  9 */                      \
+  USB_INTERFACE_DESCRIPTOR_TYPE,             /* bDescriptorType          4 */                      \
+  USB_UVC_VCIF_NUM(n),                       /* bInterfaceNumber         index of this interface (VC) */ \
+  0x00,                                      /* bAlternateSetting        0 index of this setting */ \
+  0x00,                                      /* bNumEndpoints            0 no endpoints */         \
+  CC_VIDEO,                                  /* bInterfaceClass         14 Video */                \
+  SC_VIDEOCONTROL,                           /* bInterfaceSubClass       1 Video Control */        \
+  PC_PROTOCOL_UNDEFINED,                     /* bInterfaceProtocol       0 (protocol undefined) */ \
+  0x02,                                      /* iFunction                2 */                      \
+                                                                                                   \
+  /* Class-specific VC Interface Descriptor */                                                     \
+  UVC_VC_INTERFACE_HEADER_DESC_SIZE(1),      /* bLength                 13 12 + 1 (header + 1*interface) */ \
+  CS_INTERFACE,                              /* bDescriptorType         36 (INTERFACE) */          \
+  VC_HEADER,                                 /* bDescriptorSubtype       1 (HEADER) */             \
+  WBVAL(UVC_VERSION),                        /* bcdUVC                  1.10 or 1.00 */            \
+  WBVAL(VC_TERMINAL_SIZ),                    /* wTotalLength            header+units+terminals */  \
+  DBVAL(USBD_UVC_CLOCK_FREQUENCY),           /* dwClockFrequency        PTS and SCR source clock */ \
+  0x01,                                      /* bInCollection            1 one streaming interface */ \
+  USB_UVC_VSIF_NUM(n),                       /* baInterfaceNr( 0)        VS interface belonging to this VC interface */ \
+                                                                                                   \
+  /* Input Terminal Descriptor (Camera) */                                                         \
+  UVC_CAMERA_TERMINAL_DESC_SIZE(2),          /* bLength                 17 15 + 2 controls */      \
+  CS_INTERFACE,                              /* bDescriptorType         36 (INTERFACE) */          \
+  VC_INPUT_TERMINAL,                         /* bDescriptorSubtype       2 (INPUT_TERMINAL) */     \
+  0x01,                                      /* bTerminalID              1 ID of this Terminal */  \
+  WBVAL(ITT_CAMERA),                         /* wTerminalType       0x0201 Camera Sensor */        \
+  0x00,                                      /* bAssocTerminal           0 no Terminal associated */ \
+  0x00,                                      /* iTerminal                0 no description available */ \
+  WBVAL(0x0000),                             /* wObjectiveFocalLengthMin 0 */                      \
+  WBVAL(0x0000),                             /* wObjectiveFocalLengthMax 0 */                      \
+  WBVAL(0x0000),                             /* wOcularFocalLength       0 */                      \
+  0x02,                                      /* bControlSize             2 */                      \
+  0x0A, 0x00,                                /* bmControls          0x000A AE mode, exposure time absolute */ \
+                                                                                                   \
+  /* Processing Unit Descriptor */                                                                 \
+  UVC_PROCESSING_UNIT_DESC_SIZE(2),          /* bLength                 12 10 + 2 controls */      \
+  CS_INTERFACE,                              /* bDescriptorType         36 (INTERFACE) */          \
+  VC_PROCESSING_UNIT,                        /* bDescriptorSubtype       5 (PROCESSING_UNIT) */    \
+  UVC_ID_PROCESSING_UNIT,                    /* bUnitID                  3 ID of this Unit */      \
+  UVC_ID_CAMERA_TERMINAL,                    /* bSourceID                1 camera terminal */      \
+  WBVAL(0x0000),                             /* wMaxMultiplier           0 no digital zoom */      \
+  0x02,                                      /* bControlSize             2 */                      \
+  0x43, 0x16,                                /* bmControls          0x1643 brightness, contrast, WB temperature, gain, power line, WB temperature auto */ \
+  0x00,                                      /* iProcessing              0 no description available */ \
+  UVC_PU_VIDEO_STANDARDS                                                                           \
+                                                                                                   \
+  /* Extension Unit Descriptor (region of interest) */                                             \
+  UVC_EXTENSION_UNIT_DESC_SIZE(1,1),         /* bLength                 26 24 + 1 pin + 1 control byte */ \
+  CS_INTERFACE,                              /* bDescriptorType         36 (INTERFACE) */          \
+  VC_EXTENSION_UNIT,                         /* bDescriptorSubtype       6 (EXTENSION_UNIT) */     \
+  UVC_ID_EXTENSION_UNIT,                     /* bUnitID                  4 ID of this Unit */      \
+  UVC_XU_ROI_GUID,                           /* guidExtensionCode        region of interest */     \
+  0x07,                                      /* bNumControls             7 */                      \
+  0x01,                                      /* bNrInPins                1 */                      \
+  UVC_ID_PROCESSING_UNIT,                    /* baSourceID(1)            3 processing unit */      \
+  0x01,                                      /* bControlSize             1 */                      \
+  0x7F,                                      /* bmControls            0x7F window, binning, capture rate, latency probe, latency info, boot info, frame CRC */ \
+  0x00,                                      /* iExtension               0 no description available */ \
+                                                                                                   \
+  /* Extension Unit Descriptor (motion) */                                                         \
+  UVC_EXTENSION_UNIT_DESC_SIZE(1,1),         /* bLength                 26 24 + 1 pin + 1 control byte */ \
+  CS_INTERFACE,                              /* bDescriptorType         36 (INTERFACE) */          \
+  VC_EXTENSION_UNIT,                         /* bDescriptorSubtype       6 (EXTENSION_UNIT) */     \
+  UVC_ID_MOTION_UNIT,                        /* bUnitID                  5 ID of this Unit */      \
+  UVC_XU_MOTION_GUID,                        /* guidExtensionCode        motion */                 \
+  0x03,                                      /* bNumControls             3 */                      \
+  0x01,                                      /* bNrInPins                1 */                      \
+  UVC_ID_EXTENSION_UNIT,                     /* baSourceID(1)            4 region of interest unit */ \
+  0x01,                                      /* bControlSize             1 */                      \
+  0x07,                                      /* bmControls            0x07 mode, threshold, score */ \
+  0x00,                                      /* iExtension               0 no description available */ \
+                                                                                                   \
+  /* Extension Unit Descriptor (statistics) */                                                     \
+  UVC_EXTENSION_UNIT_DESC_SIZE(1,1),         /* bLength                 26 24 + 1 pin + 1 control byte */ \
+  CS_INTERFACE,                              /* bDescriptorType         36 (INTERFACE) */          \
+  VC_EXTENSION_UNIT,                         /* bDescriptorSubtype       6 (EXTENSION_UNIT) */     \
+  UVC_ID_STATS_UNIT,                         /* bUnitID                  6 ID of this Unit */      \
+  UVC_XU_STATS_GUID,                         /* guidExtensionCode        statistics */             \
+  0x02,                                      /* bNumControls             2 */                      \
+  0x01,                                      /* bNrInPins                1 */                      \
+  UVC_ID_MOTION_UNIT,                        /* baSourceID(1)            5 motion unit */          \
+  0x01,                                      /* bControlSize             1 */                      \
+  0x03,                                      /* bmControls            0x03 counters, rates */      \
+  0x00,                                      /* iExtension               0 no description available */ \
+                                                                                                   \
+  /* Output Terminal Descriptor */                                                                 \
+  UVC_OUTPUT_TERMINAL_DESC_SIZE(0),          /* bLength                  9 */                      \
+  CS_INTERFACE,                              /* bDescriptorType         36 (INTERFACE) */          \
+  VC_OUTPUT_TERMINAL,                        /* bDescriptorSubtype       3 (OUTPUT_TERMINAL) */    \
+  0x02,                                      /* bTerminalID              2 ID of this Terminal */  \
+  WBVAL(TT_STREAMING),                       /* wTerminalType       0x0101 USB streaming terminal */ \
+  0x00,                                      /* bAssocTerminal           0 no Terminal assiciated */ \
+  UVC_ID_STATS_UNIT,                         /* bSourceID                6 input pin connected to output pin unit 6 */ \
+  0x00,                                      /* iTerminal                0 no description available */ \
+                                                                                                   \
+  /* Standard VS Interface Descriptor, alternate setting 0 = Zero Bandwidth */                     \
+  USB_INTERFACE_DESC_SIZE,                   /* bLength                  9 */                      \
+  USB_INTERFACE_DESCRIPTOR_TYPE,             /* bDescriptorType          4 */                      \
+  USB_UVC_VSIF_NUM(n),                       /* bInterfaceNumber         index of this interface */ \
+  0x00,                                      /* bAlternateSetting        0 index of this setting */ \
+  UVC_VS_ALT0_NUM_EP,                        /* bNumEndpoints */                                   \
+  CC_VIDEO,                                  /* bInterfaceClass         14 Video */                \
+  SC_VIDEOSTREAMING,                         /* bInterfaceSubClass       2 Video Streaming */      \
+  PC_PROTOCOL_UNDEFINED,                     /* bInterfaceProtocol       0 (protocol undefined) */ \
+  0x00,                                      /* iInterface               0 no description available */ \
+  UVC_VS_ALT0_EP_DESC(n)                                                                           \
+                                                                                                   \
+  /* Class-specific VS Header Descriptor (Input) */                                                \
+  UVC_VS_INTERFACE_INPUT_HEADER_DESC_SIZE(1,2),/* bLength               15 13 + (1*2) (no specific controls used) */ \
+  CS_INTERFACE,                              /* bDescriptorType         36 (INTERFACE) */          \
+  VS_INPUT_HEADER,                           /* bDescriptorSubtype       1 (INPUT_HEADER) */       \
+  0x02,                                      /* bNumFormats              2 MJPEG and tile delta */ \
+  WBVAL(VC_HEADER_SIZ),                                                                            \
+  USB_UVC_IN_EP(n),                          /* bEndPointAddress         EP IN of function n */    \
+  0x00,                                      /* bmInfo                   0 no dynamic format change supported */ \
+  0x02,                                      /* bTerminalLink            2 supplies terminal ID 2 (Output terminal) */ \
+  0x02,                                      /* bStillCaptureMethod      2 still image capture method 2 */ \
+  0x01,                                      /* bTriggerSupport          1 HW trigger supported for still image capture */ \
+  0x00,                                      /* bTriggerUsage            0 HW trigger initiate a still image capture */ \
+  0x01,                                      /* bControlSize             1 one byte bmaControls field size */ \
+  0x00,                                      /* bmaControls(0)           0 no VS specific controls */ \
+  0x00,                                      /* bmaControls(1)           0 no VS specific controls */ \
+                                                                                                   \
+  /* Class-specific VS Format Descriptor */                                                        \
+  VS_FORMAT_UNCOMPRESSED_DESC_SIZE,     /* bLength 27*/                                            \
+  CS_INTERFACE,                         /* bDescriptorType : CS_INTERFACE */                       \
+  VS_FORMAT_MJPEG,                      /* bDescriptorSubType : VS_FORMAT_MJPEG subtype */         \
+  0x01,                                 /* bFormatIndex : First format descriptor, MJPEG */        \
+  0x01,                                 /* bNumFrameDescriptors : One frame descriptor for this format follows. */ \
+  0x01,                                 /* bmFlags : Uses fixed size samples.. */                  \
+  0x01,                                 /* bDefaultFrameIndex : Default frame index is 1. */       \
+  0x00,                                 /* bAspectRatioX : Non-interlaced stream not required. */  \
+  0x00,                                 /* bAspectRatioY : Non-interlaced stream not required. */  \
+  0x00,                                 /* bmInterlaceFlags : Non-interlaced stream */             \
+  0x00,                                 /* bCopyProtect : No restrictions imposed on the duplication of this video stream. */ \
+                                                                                                   \
+  /* Class-specific VS Frame Descriptor */                                                         \
+  VS_FRAME_COMPRESSED_DESC_SIZE,        /* bLength 2A */                                           \
+  CS_INTERFACE,                         /* bDescriptorType : CS_INTERFACE */                       \
+  VS_FRAME_MJPEG,                       /* bDescriptorSubType : VS_FRAME_MJPEG */                  \
+  0x01,                                 /* bFrameIndex : Only frame descriptor of the MJPEG format */ \
+  0x00,                                 /* bmCapabilities : Still images using capture method 0 are supported at this frame setting.D1: Fixed frame-rate. */ \
+  WBVAL(WIDTH),                         /* wWidth (2bytes) */                                      \
+  WBVAL(HEIGHT),                        /* wHeight (2bytes) */                                     \
+  DBVAL(MIN_BIT_RATE),                  /* dwMinBitRate (4bytes): Min bit rate in bits/s  */       \
+  DBVAL(MAX_BIT_RATE),                  /* dwMaxBitRate (4bytes): Max bit rate in bits/s  */       \
+  DBVAL(MAX_FRAME_SIZE),                /* dwMaxVideoFrameBufSize (4bytes): Maximum video or still frame size, in bytes. */ \
+  DBVAL(INTERVAL),                      /* dwDefaultFrameInterval */                               \
+  0x00,                                 /* bFrameIntervalType : Continuous frame interval */       \
+  DBVAL(INTERVAL),                      /* dwMinFrameInterval */                                   \
+  DBVAL(INTERVAL),                      /* dwMaxFrameInterval */                                   \
+  0x00, 0x00, 0x00, 0x00,               /* dwFrameIntervalStep : No frame interval step supported. */ \
+                                                                                                   \
+  /* Still Image Frame Descriptor */                                                               \
+  VS_STILL_IMAGE_FRAME_DESC_SIZE(1,0),  /* bLength 10 */                                           \
+  CS_INTERFACE,                         /* bDescriptorType : CS_INTERFACE */                       \
+  VS_STILL_IMAGE_FRAME,                 /* bDescriptorSubType : VS_STILL_IMAGE_FRAME */            \
+  0x00,                                 /* bEndpointAddress : 0, method 2 uses the video endpoint */ \
+  0x01,                                 /* bNumImageSizePatterns : 1 */                            \
+  WBVAL(STILL_WIDTH),                   /* wWidth(1) : size of the stream image */                 \
+  WBVAL(STILL_HEIGHT),                  /* wHeight(1) */                                           \
+  0x00,                                 /* bNumCompressionPattern : 0 */                           \
+                                                                                                   \
+  /* Color Matching Descriptor */                                                                  \
+  VS_COLOR_MATCHING_DESC_SIZE,          /* bLength */                                              \
+  CS_INTERFACE,                         /* bDescriptorType : CS_INTERFACE */                       \
+  VS_COLORFORMAT,                       /* bDescriptorSubType : VS_COLORFORMAT */                  \
+  0x00,                                 /* bColorPrimarie : 1: BT.709, sRGB (default) */           \
+  0x00,                                 /* bTransferCharacteristics : 1: BT.709 (default) */       \
+  0x00,                                 /* bMatrixCoefficients : 1: BT. 709. */                    \
+                                                                                                   \
+  /* Class-specific VS Frame Based Format Descriptor (tile delta) */                               \
+  VS_FORMAT_FRAME_BASED_DESC_SIZE,      /* bLength 28 */                                           \
+  CS_INTERFACE,                         /* bDescriptorType : CS_INTERFACE */                       \
+  VS_FORMAT_FRAME_BASED,                /* bDescriptorSubType : VS_FORMAT_FRAME_BASED */           \
+  UVC_FORMAT_INDEX_TILE,                /* bFormatIndex : 2 */                                     \
+  0x01,                                 /* bNumFrameDescriptors : 1 */                             \
+  UVC_TILE_FORMAT_GUID,                 /* guidFormat : 'TDLT' */                                  \
+  0x0C,                                 /* bBitsPerPixel : 12, YCbCr 4:2:0 tiles */                \
+  0x01,                                 /* bDefaultFrameIndex : 1 */                               \
+  0x00,                                 /* bAspectRatioX */                                        \
+  0x00,                                 /* bAspectRatioY */                                        \
+  0x00,                                 /* bmInterlaceFlags : Non-interlaced stream */             \
+  0x00,                                 /* bCopyProtect : No restrictions */                       \
+  0x01,                                 /* bVariableSize : only the changed tiles are sent */      \
+                                                                                                   \
+  /* Class-specific VS Frame Based Frame Descriptor */                                             \
+  VS_FRAME_FRAME_BASED_DESC_SIZE,       /* bLength 38 */                                           \
+  CS_INTERFACE,                         /* bDescriptorType : CS_INTERFACE */                       \
+  VS_FRAME_FRAME_BASED,                 /* bDescriptorSubType : VS_FRAME_FRAME_BASED */            \
+  0x01,                                 /* bFrameIndex : 1 */                                      \
+  0x00,                                 /* bmCapabilities : no still image */                      \
+  WBVAL(WIDTH),                         /* wWidth */                                               \
+  WBVAL(HEIGHT),                        /* wHeight */                                              \
+  DBVAL(MIN_BIT_RATE),                  /* dwMinBitRate */                                         \
+  DBVAL(MAX_BIT_RATE),                  /* dwMaxBitRate */                                         \
+  DBVAL(INTERVAL),                      /* dwDefaultFrameInterval */                               \
+  0x00,                                 /* bFrameIntervalType : Continuous frame interval */       \
+  DBVAL(0),                             /* dwBytesPerLine : 0, variable size */                    \
+  DBVAL(INTERVAL),                      /* dwMinFrameInterval */                                   \
+  DBVAL(INTERVAL),                      /* dwMaxFrameInterval */                                   \
+  0x00, 0x00, 0x00, 0x00,               /* dwFrameIntervalStep : No frame interval step supported. */ \
+                                                                                                   \
+  UVC_VS_ALT1_DESC(n)
+
 /* USB UVC device Configuration Descriptor */
 __ALIGN_BEGIN static uint8_t USBD_UVC_CfgDesc[] __ALIGN_END =
 {
   /* Configuration 1 */
   USB_CONFIGUARTION_DESC_SIZE,               // bLength                  9
   USB_CONFIGURATION_DESCRIPTOR_TYPE,         // bDescriptorType          2
-#ifndef VIDEO_USES_ISOC_EP
-  WBVAL((USB_VIDEO_DESC_SIZ-9)),
-#else
-  WBVAL(USB_VIDEO_DESC_SIZ),	
-#endif
-  0x02,                                      // bNumInterfaces           2
+  WBVAL(USB_VIDEO_DESC_SIZ),
+  VIDEO_TOTAL_IF_NUM,                        // bNumInterfaces           2 per UVC function, then DFU
   0x01,                                      // bConfigurationValue      1 ID of this configuration
   0x00,                                      // iConfiguration           0 no description available
   USB_CONFIG_BUS_POWERED ,                   // bmAttributes          0x80 Bus Powered
   USB_CONFIG_POWER_MA(500),                  // bMaxPower              500 mA
-  
-  /* Interface Association Descriptor */
-  UVC_INTERFACE_ASSOCIATION_DESC_SIZE,       // bLength                  8
-  USB_INTERFACE_ASSOCIATION_DESCRIPTOR_TYPE, // bDescriptorType         11
-  0x00,                                      // bFirstInterface          0
-  0x02,                                      // bInterfaceCount          2
-  CC_VIDEO,                                  // bFunctionClass          14 Video
-  SC_VIDEO_INTERFACE_COLLECTION,             // bFunctionSubClass        3 Video Interface Collection
-  PC_PROTOCOL_UNDEFINED,                     // bInterfaceProtocol       0 (protocol undefined)
-  0x02,                                      // iFunction                2
-    
-  /* VideoControl Interface Descriptor */
-  
-  
-  /* Standard VC Interface Descriptor  = interface 0 */
-  USB_INTERFACE_DESC_SIZE,                   // bLength                  9
-  USB_INTERFACE_DESCRIPTOR_TYPE,             // bDescriptorType          4
-  USB_UVC_VCIF_NUM,                          // bInterfaceNumber         0 index of this interface (VC)
-  0x00,                                      // bAlternateSetting        0 index of this setting
-  0x00,                                      // bNumEndpoints            0 no endpoints
-  CC_VIDEO,                                  // bInterfaceClass         14 Video
-  SC_VIDEOCONTROL,                           // bInterfaceSubClass       1 Video Control
-  PC_PROTOCOL_UNDEFINED,                     // bInterfaceProtocol       0 (protocol undefined)
-  0x02,                                      // iFunction                2
-  
-  
-  /* Class-specific VC Interface Descriptor */
-  UVC_VC_INTERFACE_HEADER_DESC_SIZE(1),      // bLength                 13 12 + 1 (header + 1*interface
-  CS_INTERFACE,                              // bDescriptorType         36 (INTERFACE)
-  VC_HEADER,                                 // bDescriptorSubtype      1 (HEADER)
-  WBVAL(UVC_VERSION),                        // bcdUVC                  1.10 or 1.00
-  WBVAL(VC_TERMINAL_SIZ),                    // wTotalLength            header+units+terminals
-  DBVAL(48000000),                         // dwClockFrequency  			48.000000 MHz
-  0x01,                                      // bInCollection            1 one streaming interface
-  0x01,                                      // baInterfaceNr( 0)        1 VS interface 1 belongs to this VC interface
-  
-  
-  /* Input Terminal Descriptor (Camera) */
-  UVC_CAMERA_TERMINAL_DESC_SIZE(2),          // bLength                 17 15 + 2 controls
-  CS_INTERFACE,                              // bDescriptorType         36 (INTERFACE)
-  VC_INPUT_TERMINAL,                         // bDescriptorSubtype       2 (INPUT_TERMINAL)
-  0x01,                                      // bTerminalID              1 ID of this Terminal
-  WBVAL(ITT_CAMERA),                         // wTerminalType       0x0201 Camera Sensor
-  0x00,                                      // bAssocTerminal           0 no Terminal associated
-  0x00,                                      // iTerminal                0 no description available
-  WBVAL(0x0000),                             // wObjectiveFocalLengthMin 0
-  WBVAL(0x0000),                             // wObjectiveFocalLengthMax 0
-  WBVAL(0x0000),                             // wOcularFocalLength       0
-  0x02,                                      // bControlSize             2
-  0x00, 0x00,                                // bmControls          0x0000 no controls supported
-  
-  /* Output Terminal Descriptor */
-  UVC_OUTPUT_TERMINAL_DESC_SIZE(0),          // bLength                  9
-  CS_INTERFACE,                              // bDescriptorType         36 (INTERFACE)
-  VC_OUTPUT_TERMINAL,                        // bDescriptorSubtype       3 (OUTPUT_TERMINAL)
-  0x02,                                      // bTerminalID              2 ID of this Terminal
-  WBVAL(TT_STREAMING),                       // wTerminalType       0x0101 USB streaming terminal
-  0x00,                                      // bAssocTerminal           0 no Terminal assiciated
-  0x01,                                      // bSourceID                1 input pin connected to output pin unit 1
-  0x00,                                      // iTerminal                0 no description available
-  
-  
-  /* Video Streaming (VS) Interface Descriptor */
-  
-  /* Standard VS Interface Descriptor  = interface 1 */
-  // alternate setting 0 = Zero Bandwidth
-  USB_INTERFACE_DESC_SIZE,                   // bLength                  9
-  USB_INTERFACE_DESCRIPTOR_TYPE,             // bDescriptorType          4
-  USB_UVC_VSIF_NUM,                          // bInterfaceNumber         1 index of this interface
-  0x00,                                      // bAlternateSetting        0 index of this setting
-	
-#ifndef VIDEO_USES_ISOC_EP
-  0x01,                                      // bNumEndpoints            0 no EP used
-#else
-	0x00,                                        /* bNumEndpoints - none, no bandwidth used */
-#endif
-
-  CC_VIDEO,                                  // bInterfaceClass         14 Video
-  SC_VIDEOSTREAMING,                         // bInterfaceSubClass       2 Video Streaming
-  PC_PROTOCOL_UNDEFINED,                     // bInterfaceProtocol       0 (protocol undefined)
-  0x00,                                      // iInterface               0 no description available
 
-#ifndef VIDEO_USES_ISOC_EP
-  /* Standard VS Isochronous Video data Endpoint Descriptor */
-  USB_ENDPOINT_DESC_SIZE,                   // bLength                  7
-  USB_ENDPOINT_DESCRIPTOR_TYPE,             // bDescriptorType          5 (ENDPOINT)
-  USB_ENDPOINT_IN(USB_UVC_ENDPOINT),        // bEndpointAddress      0x83 EP 3 IN
-  USB_ENDPOINT_TYPE_BULK,            				// bmAttributes             Bulk transfer type
-  WBVAL(VIDEO_PACKET_SIZE),                 // wMaxPacketSize
-  0x00,                                      // bInterval                
+  UVC_FUNCTION_DESC(0)
+#if (USBD_UVC_NUM_INSTANCES > 1)
+  UVC_FUNCTION_DESC(1)
 #endif
-  
-  /* Class-specific VS Header Descriptor (Input) */
-  UVC_VS_INTERFACE_INPUT_HEADER_DESC_SIZE(1,1),// bLength               14 13 + (1*1) (no specific controls used)
-  CS_INTERFACE,                              // bDescriptorType         36 (INTERFACE)
-  VS_INPUT_HEADER,                           // bDescriptorSubtype       1 (INPUT_HEADER)
-  0x01,                                      // bNumFormats              1 one format descriptor follows
-  WBVAL(VC_HEADER_SIZ),
-  USB_ENDPOINT_IN(USB_UVC_ENDPOINT),         // bEndPointAddress      0x83 EP 3 IN
-  0x00,                                      // bmInfo                   0 no dynamic format change supported
-  0x02,                                      // bTerminalLink            2 supplies terminal ID 2 (Output terminal)
-  0x02,                                      // bStillCaptureMethod      0 NO supports still image capture
-  0x01,                                      // bTriggerSupport          0 HW trigger supported for still image capture
-  0x00,                                      // bTriggerUsage            0 HW trigger initiate a still image capture
-  0x01,                                      // bControlSize             1 one byte bmaControls field size
-  0x00,                                      // bmaControls(0)           0 no VS specific controls
-  
-  /* Class-specific VS Format Descriptor  */
-  VS_FORMAT_UNCOMPRESSED_DESC_SIZE,     /* bLength 27*/
-  CS_INTERFACE,                         /* bDescriptorType : CS_INTERFACE */
-  VS_FORMAT_MJPEG,                      /* bDescriptorSubType : VS_FORMAT_MJPEG subtype */
-  0x01,                                 /* bFormatIndex : First (and only) format descriptor */
-  0x01,                                 /* bNumFrameDescriptors : One frame descriptor for this format follows. */
-  0x01,                                 /* bmFlags : Uses fixed size samples.. */
-  0x01,                                 /* bDefaultFrameIndex : Default frame index is 1. */
-  0x00,                                 /* bAspectRatioX : Non-interlaced stream not required. */
-  0x00,                                 /* bAspectRatioY : Non-interlaced stream not required. */
-  0x00,                                 /* bmInterlaceFlags : Non-interlaced stream */
-  0x00,                                 /* bCopyProtect : No restrictions imposed on the duplication of this video stream. */
-  
-  /* Class-specific VS Frame Descriptor */
-  VS_FRAME_COMPRESSED_DESC_SIZE,      	/* bLength 2A */
-  CS_INTERFACE,                         /* bDescriptorType : CS_INTERFACE */
-  VS_FRAME_MJPEG,                				/* bDescriptorSubType : VS_FRAME_UNCOMPRESSED */
-  0x01,                                 /* bFrameIndex : First (and only) frame descriptor */
-  0x00,                                 /* bmCapabilities : Still images using capture method 0 are supported at this frame setting.D1: Fixed frame-rate. */
-  WBVAL(WIDTH),                         /* wWidth (2bytes): Width of frame is 128 pixels. */
-  WBVAL(HEIGHT),                        /* wHeight (2bytes): Height of frame is 64 pixels. */
-  DBVAL(MIN_BIT_RATE),                  /* dwMinBitRate (4bytes): Min bit rate in bits/s  */ // 128*64*16*5 = 655360 = 0x000A0000 //5fps
-  DBVAL(MAX_BIT_RATE),                  /* dwMaxBitRate (4bytes): Max bit rate in bits/s  */ // 128*64*16*5 = 655360 = 0x000A0000
-  DBVAL(MAX_FRAME_SIZE),                /* dwMaxVideoFrameBufSize (4bytes): Maximum video or still frame size, in bytes. */ // 128*64*2 = 16384 = 0x00004000
-  DBVAL(INTERVAL),				        			/* dwDefaultFrameInterval : 1,000,000 * 100ns -> 10 FPS */ // 5 FPS -> 200ms -> 200,000 us -> 2,000,000 X 100ns = 0x001e8480
-  0x00,                                 /* bFrameIntervalType : Continuous frame interval */
-  DBVAL(INTERVAL),                      /* dwMaxFrameInterval : 1,000,000 ns  *100ns -> 10 FPS */
-  DBVAL(INTERVAL),                      /* dwMFrameInterval : 1,000,000 ns  *100ns -> 10 FPS */
-  0x00, 0x00, 0x00, 0x00,               /* dwFrameIntervalStep : No frame interval step supported. */
-  
-  /* Color Matching Descriptor */
-  VS_COLOR_MATCHING_DESC_SIZE,          /* bLength */
-  CS_INTERFACE,                         /* bDescriptorType : CS_INTERFACE */
-  0x0D,                                 /* bDescriptorSubType : VS_COLORFORMAT */
-  0x00,                                 /* bColorPrimarie : 1: BT.709, sRGB (default) */
-  0x00,                                 /* bTransferCharacteristics : 1: BT.709 (default) */
-  0x00,                                 /* bMatrixCoefficients : 1: BT. 709. */
-  
-#ifdef VIDEO_USES_ISOC_EP  
-  /* Standard VS Interface Descriptor  = interface 1 */
-  // alternate setting 1 = operational setting
+#if USBD_UVC_HAS_DFU
+  /* Standard DFU runtime Interface Descriptor */
   USB_INTERFACE_DESC_SIZE,                   // bLength                  9
   USB_INTERFACE_DESCRIPTOR_TYPE,             // bDescriptorType          4
-  USB_UVC_VSIF_NUM,                          // bInterfaceNumber         1 index of this interface
-  0x01,                                      // bAlternateSetting        1 index of this setting
-  0x01,                                      // bNumEndpoints            1 one EP used
-  CC_VIDEO,                                  // bInterfaceClass         14 Video
-  SC_VIDEOSTREAMING,                         // bInterfaceSubClass       2 Video Streaming
-  PC_PROTOCOL_UNDEFINED,                     // bInterfaceProtocol       0 (protocol undefined)
+  USB_DFU_IF_NUM,                            // bInterfaceNumber         after the UVC functions
+  0x00,                                      // bAlternateSetting        0
+  0x00,                                      // bNumEndpoints            0 control pipe only
+  USB_DEVICE_CLASS_APPLICATION,              // bInterfaceClass       0xFE Application Specific
+  DFU_SUBCLASS_UPGRADE,                      // bInterfaceSubClass       1 Device Firmware Upgrade
+  DFU_PROTOCOL_RUNTIME,                      // bInterfaceProtocol       1 Runtime
   0x00,                                      // iInterface               0 no description available
-  
-  /* Standard VS Isochronous Video data Endpoint Descriptor */
-  USB_ENDPOINT_DESC_SIZE,                   // bLength                  7
-  USB_ENDPOINT_DESCRIPTOR_TYPE,             // bDescriptorType          5 (ENDPOINT)
-  USB_ENDPOINT_IN(USB_UVC_ENDPOINT),        // bEndpointAddress      0x83 EP 3 IN
-  USB_ENDPOINT_TYPE_ISOCHRONOUS | USB_ENDPOINT_SYNC_ASYNCHRONOUS,            // bmAttributes             1 isochronous transfer type
-  WBVAL(VIDEO_PACKET_SIZE),                 // wMaxPacketSize
-  0x01,                                      // bInterval                1 one frame interval
+
+  /* DFU Functional Descriptor */
+  DFU_FUNCTIONAL_DESC_SIZE,                  // bLength                  9
+  DFU_FUNCTIONAL_DESCRIPTOR_TYPE,            // bDescriptorType       0x21 DFU FUNCTIONAL
+  DFU_ATTR_CAN_DNLOAD | DFU_ATTR_MANIFESTATION_TOLERANT | DFU_ATTR_WILL_DETACH, // bmAttributes
+  WBVAL(DFU_DETACH_TIMEOUT),                 // wDetachTimeOut           ms
+  WBVAL(USBD_UVC_DFU_TRANSFER_SIZE),         // wTransferSize            bytes per DFU_DNLOAD
+  WBVAL(DFU_VERSION),                        // bcdDFUVersion            1.1
 #endif
 };
 
-//data array for Video Probe and Commit
-VideoControl    videoCommitControl =
+//default data of Video Probe and Commit, copied into every UVC function on Init
+static const VideoControl videoDefaultControl =
 {
   {0x00,0x00},                      // bmHint
   {0x01},                           // bFormatIndex
@@ -374,24 +608,278 @@ VideoControl    videoCommitControl =
   {0x00},                           // bMaxVersion
 };
 
-VideoControl    videoProbeControl =
+//GET_RES of the probe control: no field can be stepped
+static const VideoControl videoResControl;
+
+//default data of Still Probe and Commit
+static const StillControl stillDefaultControl =
 {
-  {0x00,0x00},                      // bmHint
   {0x01},                           // bFormatIndex
-  {0x01},                           // bFrameIndex
-  {DBVAL(INTERVAL),},          // dwFrameInterval
-  {0x00,0x00,},                     // wKeyFrameRate
-  {0x00,0x00,},                     // wPFrameRate
-  {0x00,0x00,},                     // wCompQuality
-  {0x00,0x00,},                     // wCompWindowSize
-  {0x00,0x00},                      // wDelay
-  {DBVAL(MAX_FRAME_SIZE)},    // dwMaxVideoFrameSize
-  {DBVAL(VIDEO_PACKET_SIZE)},          // dwMaxPayloadTransferSize
-  {DBVAL(48000000)},         // dwClockFrequency
-  {0x00},                           // bmFramingInfo
-  {0x00},                           // bPreferedVersion
-  {0x00},                           // bMinVersion
-  {0x00},                           // bMaxVersion
+  {0x01},                           // bFrameIndex, still image size pattern 1
+  {0x01},                           // bCompressionIndex
+  {DBVAL(MAX_FRAME_SIZE)},          // dwMaxVideoFrameSize
+  {DBVAL(VIDEO_PACKET_SIZE)},       // dwMaxPayloadTransferSize
+};
+
+static const StillControl stillResControl;
+
+//ranges of the camera terminal and processing unit controls
+static const uint8_t uvcAeModeRes[1]       = {UVC_AE_MODE_MANUAL | UVC_AE_MODE_APERTURE_PRIO};
+static const uint8_t uvcAeModeDef[1]       = {UVC_AE_MODE_APERTURE_PRIO};
+static const uint8_t uvcExposureMin[4]     = {DBVAL(1)};       // 100 us
+static const uint8_t uvcExposureMax[4]     = {DBVAL(666)};     // one frame at 15 fps
+static const uint8_t uvcExposureDef[4]     = {DBVAL(333)};
+static const uint8_t uvcBrightnessMin[2]   = {WBVAL(0xFF81)};  // -127
+static const uint8_t uvcBrightnessMax[2]   = {WBVAL(127)};
+static const uint8_t uvcContrastMax[2]     = {WBVAL(255)};
+static const uint8_t uvcContrastDef[2]     = {WBVAL(64)};
+static const uint8_t uvcGainMax[2]         = {WBVAL(1023)};
+static const uint8_t uvcPowerLineMax[1]    = {2};              // 0 disabled, 1 50 Hz, 2 60 Hz
+static const uint8_t uvcWbTempMin[2]       = {WBVAL(2800)};
+static const uint8_t uvcWbTempMax[2]       = {WBVAL(6500)};
+static const uint8_t uvcWbTempDef[2]       = {WBVAL(4600)};
+static const uint8_t uvcCaptureRateMax[1] = {2};              // 0 all, 1 one of 2, 2 one of 4 frames
+static const uint8_t uvcMotionModeMax[1]   = {2};              // 0 off, 1 skip static frames, 2 lower rate
+static const uint8_t uvcMotionThresholdDef[1] = {6};
+static const uint8_t uvcByteMax[1]         = {255};
+static const uint8_t uvcZero[4]            = {0x00, 0x00, 0x00, 0x00};
+static const uint8_t uvcOne[4]             = {DBVAL(1)};
+
+//region of interest: even coordinates, at least 16x16, inside the sensor frame
+static const RoiControl uvcRoiMin = {{WBVAL(0)}, {WBVAL(0)}, {WBVAL(16)}, {WBVAL(16)}};
+static const RoiControl uvcRoiMax = {{WBVAL((WIDTH - 16))}, {WBVAL((HEIGHT - 16))}, {WBVAL(WIDTH)}, {WBVAL(HEIGHT)}};
+static const RoiControl uvcRoiRes = {{WBVAL(2)}, {WBVAL(2)}, {WBVAL(2)}, {WBVAL(2)}};
+static const RoiControl uvcRoiDef = {{WBVAL(0)}, {WBVAL(0)}, {WBVAL(WIDTH)}, {WBVAL(HEIGHT)}};
+
+//boot stages of the device, the same for both functions, filled on GET_CUR
+static BootControl uvc_boot;
+
+//statistics of the function addressed, filled on GET_CUR
+static StatsControl uvc_stats;
+
+//the frame CRC can only be turned on with a CRC engine behind USBD_UVC_FRAME_CRC
+#if USBD_UVC_HAS_FRAME_CRC
+#define uvcFrameCrcMax              uvcOne
+#else
+#define uvcFrameCrcMax              uvcZero
+#endif
+
+#define UVC_CAMERA_INFO             (SUPPORTS_GET | SUPPORTS_SET)
+#define UVC_CAMERA_CUR(field)       offsetof(USBD_UVC_InstanceTypeDef, camera.field)
+
+static const UVC_ControlTypeDef uvc_controls[UVC_CTRL_NUM] =
+{
+  [UVC_CTRL_REQUEST_ERROR_CODE] =
+  {
+    SUPPORTS_GET, 1U, offsetof(USBD_UVC_InstanceTypeDef, request_error),
+    NULL, NULL, NULL, NULL, NULL,
+    0U, VC_REQUEST_ERROR_CODE_CONTROL, 0U
+  },
+  [UVC_CTRL_PROBE] =
+  {
+    SUPPORTS_GET | SUPPORTS_SET, UVC_PROBE_CONTROL_LEN, offsetof(USBD_UVC_InstanceTypeDef, probe),
+    (const uint8_t *)&videoDefaultControl, (const uint8_t *)&videoDefaultControl,
+    (const uint8_t *)&videoResControl, (const uint8_t *)&videoDefaultControl, UVC_SetProbe,
+    0U, VS_PROBE_CONTROL, 0U
+  },
+  [UVC_CTRL_COMMIT] =
+  {
+    SUPPORTS_GET | SUPPORTS_SET, UVC_PROBE_CONTROL_LEN, offsetof(USBD_UVC_InstanceTypeDef, commit),
+    NULL, NULL, NULL, NULL, UVC_SetCommit,
+    0U, VS_COMMIT_CONTROL, 0U
+  },
+  [UVC_CTRL_STILL_PROBE] =
+  {
+    SUPPORTS_GET | SUPPORTS_SET, UVC_STILL_CONTROL_LEN, offsetof(USBD_UVC_InstanceTypeDef, still_probe),
+    (const uint8_t *)&stillDefaultControl, (const uint8_t *)&stillDefaultControl,
+    (const uint8_t *)&stillResControl, (const uint8_t *)&stillDefaultControl, UVC_SetStillProbe,
+    0U, VS_STILL_PROBE_CONTROL, 0U
+  },
+  [UVC_CTRL_STILL_COMMIT] =
+  {
+    SUPPORTS_GET | SUPPORTS_SET, UVC_STILL_CONTROL_LEN, offsetof(USBD_UVC_InstanceTypeDef, still_commit),
+    NULL, NULL, NULL, NULL, UVC_SetStillCommit,
+    0U, VS_STILL_COMMIT_CONTROL, 0U
+  },
+  [UVC_CTRL_STILL_TRIGGER] =
+  {
+    SUPPORTS_GET | SUPPORTS_SET, 1U, offsetof(USBD_UVC_InstanceTypeDef, still_trigger),
+    NULL, NULL, NULL, NULL, UVC_SetStillTrigger,
+    0U, VS_STILL_IMAGE_TRIGGER_CONTROL, 0U
+  },
+  [UVC_CTRL_AE_MODE] =
+  {
+    UVC_CAMERA_INFO, 1U, UVC_CAMERA_CUR(bAutoExposureMode),
+    NULL, NULL, uvcAeModeRes, uvcAeModeDef, UVC_SetCamera,
+    UVC_ID_CAMERA_TERMINAL, CT_AE_MODE_CONTROL, UVC_CTRL_FLAG_CAMERA | UVC_CTRL_FLAG_BITMAP
+  },
+  [UVC_CTRL_EXPOSURE_ABSOLUTE] =
+  {
+    UVC_CAMERA_INFO, 4U, UVC_CAMERA_CUR(dwExposureTimeAbsolute),
+    uvcExposureMin, uvcExposureMax, uvcOne, uvcExposureDef, UVC_SetCamera,
+    UVC_ID_CAMERA_TERMINAL, CT_EXPOSURE_TIME_ABSOLUTE_CONTROL, UVC_CTRL_FLAG_CAMERA | UVC_CTRL_FLAG_MANUAL_AE
+  },
+  [UVC_CTRL_BRIGHTNESS] =
+  {
+    UVC_CAMERA_INFO, 2U, UVC_CAMERA_CUR(wBrightness),
+    uvcBrightnessMin, uvcBrightnessMax, uvcOne, uvcZero, UVC_SetCamera,
+    UVC_ID_PROCESSING_UNIT, PU_BRIGHTNESS_CONTROL, UVC_CTRL_FLAG_CAMERA | UVC_CTRL_FLAG_SIGNED
+  },
+  [UVC_CTRL_CONTRAST] =
+  {
+    UVC_CAMERA_INFO, 2U, UVC_CAMERA_CUR(wContrast),
+    uvcZero, uvcContrastMax, uvcOne, uvcContrastDef, UVC_SetCamera,
+    UVC_ID_PROCESSING_UNIT, PU_CONTRAST_CONTROL, UVC_CTRL_FLAG_CAMERA
+  },
+  [UVC_CTRL_GAIN] =
+  {
+    UVC_CAMERA_INFO, 2U, UVC_CAMERA_CUR(wGain),
+    uvcZero, uvcGainMax, uvcOne, uvcZero, UVC_SetCamera,
+    UVC_ID_PROCESSING_UNIT, PU_GAIN_CONTROL, UVC_CTRL_FLAG_CAMERA | UVC_CTRL_FLAG_MANUAL_AE
+  },
+  [UVC_CTRL_POWER_LINE_FREQUENCY] =
+  {
+    UVC_CAMERA_INFO, 1U, UVC_CAMERA_CUR(bPowerLineFrequency),
+    uvcZero, uvcPowerLineMax, uvcOne, uvcOne, UVC_SetCamera,
+    UVC_ID_PROCESSING_UNIT, PU_POWER_LINE_FREQUENCY_CONTROL, UVC_CTRL_FLAG_CAMERA
+  },
+  [UVC_CTRL_WB_TEMPERATURE] =
+  {
+    UVC_CAMERA_INFO, 2U, UVC_CAMERA_CUR(wWhiteBalanceTemperature),
+    uvcWbTempMin, uvcWbTempMax, uvcOne, uvcWbTempDef, UVC_SetCamera,
+    UVC_ID_PROCESSING_UNIT, PU_WHITE_BALANCE_TEMPERATURE_CONTROL, UVC_CTRL_FLAG_CAMERA | UVC_CTRL_FLAG_MANUAL_WB
+  },
+  [UVC_CTRL_WB_TEMPERATURE_AUTO] =
+  {
+    UVC_CAMERA_INFO, 1U, UVC_CAMERA_CUR(bWhiteBalanceTemperatureAuto),
+    uvcZero, uvcOne, uvcOne, uvcOne, UVC_SetCamera,
+    UVC_ID_PROCESSING_UNIT, PU_WHITE_BALANCE_TEMPERATURE_AUTO_CONTROL, UVC_CTRL_FLAG_CAMERA
+  },
+  [UVC_CTRL_ROI_WINDOW] =
+  {
+    UVC_CAMERA_INFO, UVC_ROI_CONTROL_LEN, offsetof(USBD_UVC_InstanceTypeDef, roi),
+    (const uint8_t *)&uvcRoiMin, (const uint8_t *)&uvcRoiMax,
+    (const uint8_t *)&uvcRoiRes, (const uint8_t *)&uvcRoiDef, UVC_SetWindow,
+    UVC_ID_EXTENSION_UNIT, XU_ROI_WINDOW_CONTROL, 0U
+  },
+  [UVC_CTRL_ROI_BINNING] =
+  {
+    UVC_CAMERA_INFO, 1U, UVC_CAMERA_CUR(bBinning),
+    uvcZero, uvcOne, uvcOne, uvcZero, UVC_SetCamera,
+    UVC_ID_EXTENSION_UNIT, XU_ROI_BINNING_CONTROL, UVC_CTRL_FLAG_CAMERA
+  },
+  [UVC_CTRL_ROI_CAPTURE_RATE] =
+  {
+    UVC_CAMERA_INFO, 1U, UVC_CAMERA_CUR(bCaptureRate),
+    uvcZero, uvcCaptureRateMax, uvcOne, uvcZero, UVC_SetCamera,
+    UVC_ID_EXTENSION_UNIT, XU_ROI_CAPTURE_RATE_CONTROL, UVC_CTRL_FLAG_CAMERA
+  },
+  [UVC_CTRL_ROI_LATENCY_PROBE] =
+  {
+    UVC_CAMERA_INFO, 1U, UVC_CAMERA_CUR(bLatencyProbe),
+    uvcZero, uvcOne, uvcOne, uvcZero, UVC_SetCamera,
+    UVC_ID_EXTENSION_UNIT, XU_ROI_LATENCY_PROBE_CONTROL, UVC_CTRL_FLAG_CAMERA
+  },
+  [UVC_CTRL_ROI_LATENCY_INFO] =
+  {
+    SUPPORTS_GET, UVC_LATENCY_CONTROL_LEN, offsetof(USBD_UVC_InstanceTypeDef, latency),
+    NULL, NULL, NULL, NULL, NULL,
+    UVC_ID_EXTENSION_UNIT, XU_ROI_LATENCY_INFO_CONTROL, 0U
+  },
+  [UVC_CTRL_ROI_BOOT_INFO] =
+  {
+    SUPPORTS_GET, UVC_BOOT_CONTROL_LEN, 0U,   /* device wide, uvc_boot */
+    NULL, NULL, NULL, NULL, NULL,
+    UVC_ID_EXTENSION_UNIT, XU_ROI_BOOT_INFO_CONTROL, 0U
+  },
+  [UVC_CTRL_ROI_FRAME_CRC] =
+  {
+    UVC_CAMERA_INFO, 1U, UVC_CAMERA_CUR(bFrameCrc),
+    uvcZero, uvcFrameCrcMax, uvcOne, uvcZero, UVC_SetCamera,
+    UVC_ID_EXTENSION_UNIT, XU_ROI_FRAME_CRC_CONTROL, 0U
+  },
+  [UVC_CTRL_MOTION_MODE] =
+  {
+    UVC_CAMERA_INFO, 1U, UVC_CAMERA_CUR(bMotionMode),
+    uvcZero, uvcMotionModeMax, uvcOne, uvcZero, UVC_SetCamera,
+    UVC_ID_MOTION_UNIT, XU_MOTION_MODE_CONTROL, UVC_CTRL_FLAG_CAMERA
+  },
+  [UVC_CTRL_MOTION_THRESHOLD] =
+  {
+    UVC_CAMERA_INFO, 1U, UVC_CAMERA_CUR(bMotionThreshold),
+    uvcOne, uvcByteMax, uvcOne, uvcMotionThresholdDef, UVC_SetCamera,
+    UVC_ID_MOTION_UNIT, XU_MOTION_THRESHOLD_CONTROL, UVC_CTRL_FLAG_CAMERA
+  },
+  [UVC_CTRL_MOTION_SCORE] =
+  {
+    SUPPORTS_GET, 1U, UVC_CAMERA_CUR(bMotionScore),
+    uvcZero, uvcByteMax, uvcOne, uvcZero, NULL,
+    UVC_ID_MOTION_UNIT, XU_MOTION_SCORE_CONTROL, 0U
+  },
+  [UVC_CTRL_STATS_COUNTERS] =
+  {
+    SUPPORTS_GET, UVC_STATS_CONTROL_LEN, 0U,  /* uvc_stats */
+    NULL, NULL, NULL, NULL, NULL,
+    UVC_ID_STATS_UNIT, XU_STATS_COUNTERS_CONTROL, 0U
+  },
+  [UVC_CTRL_STATS_RATES] =
+  {
+    SUPPORTS_GET, UVC_STATS_CONTROL_LEN, 0U,  /* uvc_stats */
+    NULL, NULL, NULL, NULL, NULL,
+    UVC_ID_STATS_UNIT, XU_STATS_RATES_CONTROL, 0U
+  },
+};
+
+//(entity, selector) -> index + 1 in uvc_controls, 0 when the control does not exist
+static const uint8_t uvc_control_map[UVC_NUM_SLOTS][UVC_MAX_SELECTOR + 1U] =
+{
+  [UVC_SLOT_VC_INTERFACE] =
+  {
+    [VC_REQUEST_ERROR_CODE_CONTROL] = UVC_CTRL_REQUEST_ERROR_CODE + 1U,
+  },
+  [UVC_SLOT_VS_INTERFACE] =
+  {
+    [VS_PROBE_CONTROL]  = UVC_CTRL_PROBE + 1U,
+    [VS_COMMIT_CONTROL] = UVC_CTRL_COMMIT + 1U,
+    [VS_STILL_PROBE_CONTROL]         = UVC_CTRL_STILL_PROBE + 1U,
+    [VS_STILL_COMMIT_CONTROL]        = UVC_CTRL_STILL_COMMIT + 1U,
+    [VS_STILL_IMAGE_TRIGGER_CONTROL] = UVC_CTRL_STILL_TRIGGER + 1U,
+  },
+  [UVC_SLOT_ENTITY(UVC_ID_CAMERA_TERMINAL)] =
+  {
+    [CT_AE_MODE_CONTROL]                = UVC_CTRL_AE_MODE + 1U,
+    [CT_EXPOSURE_TIME_ABSOLUTE_CONTROL] = UVC_CTRL_EXPOSURE_ABSOLUTE + 1U,
+  },
+  [UVC_SLOT_ENTITY(UVC_ID_PROCESSING_UNIT)] =
+  {
+    [PU_BRIGHTNESS_CONTROL]                     = UVC_CTRL_BRIGHTNESS + 1U,
+    [PU_CONTRAST_CONTROL]                       = UVC_CTRL_CONTRAST + 1U,
+    [PU_GAIN_CONTROL]                           = UVC_CTRL_GAIN + 1U,
+    [PU_POWER_LINE_FREQUENCY_CONTROL]           = UVC_CTRL_POWER_LINE_FREQUENCY + 1U,
+    [PU_WHITE_BALANCE_TEMPERATURE_CONTROL]      = UVC_CTRL_WB_TEMPERATURE + 1U,
+    [PU_WHITE_BALANCE_TEMPERATURE_AUTO_CONTROL] = UVC_CTRL_WB_TEMPERATURE_AUTO + 1U,
+  },
+  [UVC_SLOT_ENTITY(UVC_ID_EXTENSION_UNIT)] =
+  {
+    [XU_ROI_WINDOW_CONTROL]       = UVC_CTRL_ROI_WINDOW + 1U,
+    [XU_ROI_BINNING_CONTROL]      = UVC_CTRL_ROI_BINNING + 1U,
+    [XU_ROI_CAPTURE_RATE_CONTROL] = UVC_CTRL_ROI_CAPTURE_RATE + 1U,
+    [XU_ROI_LATENCY_PROBE_CONTROL] = UVC_CTRL_ROI_LATENCY_PROBE + 1U,
+    [XU_ROI_LATENCY_INFO_CONTROL]  = UVC_CTRL_ROI_LATENCY_INFO + 1U,
+    [XU_ROI_BOOT_INFO_CONTROL]     = UVC_CTRL_ROI_BOOT_INFO + 1U,
+    [XU_ROI_FRAME_CRC_CONTROL]     = UVC_CTRL_ROI_FRAME_CRC + 1U,
+  },
+  [UVC_SLOT_ENTITY(UVC_ID_MOTION_UNIT)] =
+  {
+    [XU_MOTION_MODE_CONTROL]      = UVC_CTRL_MOTION_MODE + 1U,
+    [XU_MOTION_THRESHOLD_CONTROL] = UVC_CTRL_MOTION_THRESHOLD + 1U,
+    [XU_MOTION_SCORE_CONTROL]     = UVC_CTRL_MOTION_SCORE + 1U,
+  },
+  [UVC_SLOT_ENTITY(UVC_ID_STATS_UNIT)] =
+  {
+    [XU_STATS_COUNTERS_CONTROL]   = UVC_CTRL_STATS_COUNTERS + 1U,
+    [XU_STATS_RATES_CONTROL]      = UVC_CTRL_STATS_RATES + 1U,
+  },
 };
 
 static void DumpHex(const void* data, size_t size) {
@@ -423,9 +911,9 @@ static void DumpHex(const void* data, size_t size) {
 	}
 }
 
-static uint32_t  usbd_video_AltSet = 0;//number of current interface alternative setting
-
-uint8_t play_status = 0;
+/* the class handle and the payload buffer must fit the static USBD pools */
+typedef char USBD_UVC_HandleFitsPool[(sizeof(USBD_UVC_HandleTypeDef) <= USBD_POOL_HANDLE_BLOCK_SIZE) ? 1 : -1];
+typedef char USBD_UVC_PacketFitsPool[(VIDEO_PACKET_SIZE <= USBD_POOL_STREAM_BLOCK_SIZE) ? 1 : -1];
 
 /**
   * @}
@@ -435,6 +923,24 @@ uint8_t play_status = 0;
   * @{
   */
 
+/**
+  * @brief  UVC_GetInstance
+  *         Return the UVC function owning an interface number
+  * @param  pdev: device instance
+  * @param  itf: interface number (VC or VS)
+  * @retval UVC function, NULL if the interface is not a UVC one
+  */
+static USBD_UVC_InstanceTypeDef *UVC_GetInstance(USBD_HandleTypeDef *pdev, uint8_t itf)
+{
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+
+  if ((huvc == NULL) || (USB_UVC_INSTANCE(itf) >= USBD_UVC_NUM_INSTANCES))
+  {
+    return NULL;
+  }
+  return &huvc->inst[USB_UVC_INSTANCE(itf)];
+}
+
 /**
   * @brief  USBD_UVC_Init
   *         Initialize the UVC interface
@@ -444,29 +950,91 @@ uint8_t play_status = 0;
   */
 static uint8_t  USBD_UVC_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
 {
-	printf("%s\r\n", __func__);	
-	printf("TEST IMAGE Len: %d\r\n", sizeof(_acTEST_IMAGE));
+	USBD_UVC_HandleTypeDef *huvc;
+	USBD_UVC_InstanceTypeDef *inst;
+	USBD_UVC_ItfTypeDef *fops = (USBD_UVC_ItfTypeDef *)pdev->pUserData;
+	const UVC_ControlTypeDef *ctrl;
+	uint8_t n;
+	
+	//printf("%s\r\n", __func__);  
+	
+  /* Allocate UVC structure */
+  pdev->pClassData = USBD_malloc(sizeof (USBD_UVC_HandleTypeDef));
+
+  if(pdev->pClassData == NULL)
+  {
+    return USBD_FAIL;
+  }
+
+  huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+  USBD_memset(huvc, 0, sizeof (USBD_UVC_HandleTypeDef));
+
+  for (n = 0U; n < USBD_UVC_NUM_INSTANCES; n++)
+  {
+    inst = &huvc->inst[n];
+    inst->vcif = USB_UVC_VCIF_NUM(n);
+    inst->vsif = USB_UVC_VSIF_NUM(n);
+    inst->ep = USB_UVC_IN_EP(n);
+    inst->play_status = UVC_PLAY_STATUS_STOP;
+    inst->header[0] = UVC_HEADER_LEN;
+    inst->probe = videoDefaultControl;
+    inst->commit = videoDefaultControl;
+    inst->still_probe = stillDefaultControl;
+    inst->still_commit = stillDefaultControl;
+    inst->roi = uvcRoiDef;
+
+    /* Allocate the payload buffer */
+    inst->packet = USBD_malloc(VIDEO_PACKET_SIZE);
+
+    if(inst->packet == NULL)
+    {
+      USBD_UVC_DeInit(pdev, cfgidx);
+      return USBD_FAIL;
+    }
 	
 #ifndef VIDEO_USES_ISOC_EP		
-  /* Open EP IN */
-  USBD_LL_OpenEP(pdev,
-		      USB_ENDPOINT_IN(USB_UVC_ENDPOINT),		      
+    /* Open EP IN */
+    USBD_LL_OpenEP(pdev,
+		      inst->ep,		      
           USBD_EP_TYPE_BULK,
 					VIDEO_PACKET_SIZE);
-
-  /* Initialize the Video Hardware layer */
-  USBD_LL_FlushEP(pdev, USB_ENDPOINT_IN(USB_UVC_ENDPOINT));
-
 #else
-  /* Open EP IN */
-  USBD_LL_OpenEP(pdev,
-		      USB_ENDPOINT_IN(USB_UVC_ENDPOINT),		      
+    /* Open EP IN */
+    USBD_LL_OpenEP(pdev,
+		      inst->ep,		      
           USBD_EP_TYPE_ISOC,
 					VIDEO_PACKET_SIZE);
+#endif	
+    pdev->ep_in[inst->ep & 0xFU].is_used = 1U;
+
+    USBD_LL_FlushEP(pdev, inst->ep);
+  }
 
   /* Initialize the Video Hardware layer */
-  USBD_LL_FlushEP(pdev, USB_ENDPOINT_IN(USB_UVC_ENDPOINT));
-#endif	
+  if (fops != NULL)
+  {
+    fops->Init();
+  }
+
+  /* the camera controls restart from their default, push them to the hardware */
+  for (n = 0U; n < USBD_UVC_NUM_INSTANCES; n++)
+  {
+    for (ctrl = uvc_controls; ctrl < &uvc_controls[UVC_CTRL_NUM]; ctrl++)
+    {
+      if ((ctrl->flags & UVC_CTRL_FLAG_CAMERA) != 0U)
+      {
+        USBD_memcpy((uint8_t *)&huvc->inst[n] + ctrl->cur, ctrl->def, ctrl->len);
+        if (fops != NULL)
+        {
+          fops->Control(n, ctrl->entity, ctrl->selector, UVC_GetValue(ctrl, ctrl->def));
+        }
+      }
+    }
+    if (fops != NULL)
+    {
+      fops->Window(n, 0U, 0U, WIDTH, HEIGHT);
+    }
+  }
   return USBD_OK;
 }
 
@@ -481,9 +1049,31 @@ static uint8_t  USBD_UVC_DeInit (USBD_HandleTypeDef *pdev,
                                  uint8_t cfgidx)
 {
 	// printf("%s\r\n", __func__);
-  USBD_LL_CloseEP (pdev , USB_ENDPOINT_IN(USB_UVC_ENDPOINT));
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+  uint8_t n;
+
+  for (n = 0U; n < USBD_UVC_NUM_INSTANCES; n++)
+  {
+    USBD_LL_CloseEP (pdev , USB_UVC_IN_EP(n));
+    pdev->ep_in[USB_UVC_IN_EP(n) & 0xFU].is_used = 0U;
+  }
   
-  /* DeInitialize the Audio output Hardware layer */
+  /* Release the class handle and the payload buffers */
+  if(huvc != NULL)
+  {
+    for (n = 0U; n < USBD_UVC_NUM_INSTANCES; n++)
+    {
+      USBD_free(huvc->inst[n].packet);
+    }
+    USBD_free(pdev->pClassData);
+    pdev->pClassData = NULL;
+
+    /* DeInit the Video Hardware layer */
+    if (pdev->pUserData != NULL)
+    {
+      ((USBD_UVC_ItfTypeDef *)pdev->pUserData)->DeInit();
+    }
+  }
 
   return USBD_OK;
 }
@@ -499,49 +1089,36 @@ static uint8_t  USBD_UVC_Setup (USBD_HandleTypeDef *pdev,
                                 USBD_SetupReqTypedef *req)
 {
 // printf("%s\r\n", __func__);
+  USBD_UVC_InstanceTypeDef *inst = UVC_GetInstance(pdev, LOBYTE(req->wIndex));
   uint16_t len;
   uint8_t  *pbuf;
   
+  if ((USBD_UVC_HAS_DFU != 0U) && (LOBYTE(req->wIndex) == USB_DFU_IF_NUM) &&
+      ((req->bmRequest & USB_REQ_RECIPIENT_MASK) == USB_REQ_RECIPIENT_INTERFACE))
+  {
+    return UVC_REQ_Dfu(pdev, req);
+  }
+
   switch (req->bmRequest & USB_REQ_TYPE_MASK)
   {
   case USB_REQ_TYPE_CLASS :   
 		// printf("CLASS REQ\r\n");		
-    switch (req->bRequest)
+    if (inst == NULL)
     {
-    case GET_CUR:
-			printf("GET_CUR\r\n");		
-      UVC_REQ_GetCurrent(pdev, req);
-      break;
-    case GET_DEF:
-			printf("GET_DEF\r\n");	
-      UVC_REQ_GetCurrent(pdev, req);
-      break;
-    case GET_MIN:
-			printf("GET_MIN\r\n");	
-      UVC_REQ_GetCurrent(pdev, req);
-      break;
-    case GET_MAX:
-			printf("GET_MAX\r\n");	
-      UVC_REQ_GetCurrent(pdev, req);
-      break;
-
-    case SET_CUR:
-			printf("SET_CUR\r\n");
-    	UVC_REQ_SetCurrent(pdev, req);
-      break;
-
-    default:
-			printf("USBD_CtlError\r\n");
       USBD_CtlError (pdev, req);
-		
       return USBD_FAIL;
     }
-    break;
+    return UVC_REQ_Control(pdev, inst, req);
 
     
     /* Standard Requests -------------------------------*/
   case USB_REQ_TYPE_STANDARD:
 		// printf("STD REQ\r\n");	
+    if ((inst == NULL) && (req->bRequest != USB_REQ_GET_DESCRIPTOR))
+    {
+      USBD_CtlError (pdev, req);
+      return USBD_FAIL;
+    }
     switch (req->bRequest)
     {
     case USB_REQ_GET_DESCRIPTOR: 
@@ -554,39 +1131,50 @@ static uint8_t  USBD_UVC_Setup (USBD_HandleTypeDef *pdev,
         pbuf = USBD_UVC_CfgDesc + 18;
 #endif 
         len = MIN(USB_VIDEO_DESC_SIZ , req->wLength);
+        USBD_CtlSendData (pdev, pbuf, len);
       }
-      
-      USBD_CtlSendData (pdev, pbuf, len);
       break;
       
     case USB_REQ_GET_INTERFACE :
-			printf("USB_REQ_GET_INTERFACE\r\n");
-      USBD_CtlSendData (pdev, (uint8_t *)&usbd_video_AltSet, 1);
+      if (LOBYTE(req->wIndex) == inst->vsif)
+      {
+        USBD_CtlSendData (pdev, (uint8_t *)&inst->alt_setting, 1);
+      }
+      else
+      {
+        static uint8_t vc_alt_setting = 0U;
+        USBD_CtlSendData (pdev, &vc_alt_setting, 1);
+      }
       break;
       
     case USB_REQ_SET_INTERFACE :
-			printf("USB_REQ_SET_INTERFACE\r\n");
-      if ((uint8_t)(req->wValue) < VIDEO_TOTAL_IF_NUM)
+      if ((LOBYTE(req->wIndex) == inst->vsif) && ((uint8_t)(req->wValue) < VIDEO_VS_ALT_NUM))
       {
-        usbd_video_AltSet = (uint8_t)(req->wValue);
+        inst->alt_setting = (uint8_t)(req->wValue);
 
-        if (usbd_video_AltSet == 1) {
-					printf("EP Enabled\r\n");
+        if (inst->alt_setting == 1) {
 					// clear the circular buffer					
 					//camera_desired_state = 1;
-        	play_status = 1;
+        	inst->play_status = UVC_PLAY_STATUS_READY;
         } else {
-					printf("EP Disabled\r\n");
 					//camera_desired_state = 0;
-        	USBD_LL_FlushEP(pdev, USB_ENDPOINT_IN(USB_UVC_ENDPOINT));
-        	play_status = 0;
+        	USBD_LL_FlushEP(pdev, inst->ep);
+        	inst->play_status = UVC_PLAY_STATUS_STOP;
+        	inst->tx_enable_flag = 0;
+        	inst->frame_end = NULL;
+        	inst->next_frame = NULL;   // a frame handed over is dropped, its buffer is free again
+        	inst->still_state = UVC_STILL_IDLE;
+        	inst->still_trigger = UVC_STILL_TRIGGER_NORMAL;
 					HAL_GPIO_WritePin(LD3_GPIO_Port, LD3_Pin, GPIO_PIN_RESET);  // high signal led OFF  
         }
       }
+      else if ((LOBYTE(req->wIndex) == inst->vcif) && ((uint8_t)(req->wValue) == 0U))
+      {
+        /* the VC interface only has alternate setting 0 */
+      }
       else
       {
         /* Call the error management function (command will be nacked */
-				printf("USBD_CtlError\r\n");
         USBD_CtlError (pdev, req);
       }
       break;
@@ -595,13 +1183,125 @@ static uint8_t  USBD_UVC_Setup (USBD_HandleTypeDef *pdev,
   return USBD_OK;
 }
 
-__IO uint8_t header[2] = {2,0};//length + data
-__IO uint8_t packet[VIDEO_PACKET_SIZE];
-__IO uint8_t *QspiAddr = NULL;
-__IO uint8_t *CurrentByteAddr = NULL;
-__IO uint8_t *NextByteAddr = NULL;
-__IO uint8_t tx_enable_flag;
-__IO uint32_t last;
+/**
+  * @brief  UVC_EndFrame
+  *         Closes the frame just sent and tells the application.
+  * @param  pdev: device instance
+  * @param  inst: UVC function
+  * @param  n: UVC function index
+  * @retval None
+  */
+static void UVC_EndFrame(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst, uint8_t n)
+{
+  LatencyControl *lat = &inst->latency;
+
+  UVC_PutDword(lat->dwFrameNumber, inst->frame_number);
+  UVC_PutDword(lat->dwCaptureTime, inst->pts);
+  UVC_PutDword(lat->dwFirstPayloadTime, inst->first_stc);
+  UVC_PutDword(lat->dwLastPayloadTime, inst->stc);
+  lat->wFirstPayloadSof[0] = LOBYTE(inst->first_sof);
+  lat->wFirstPayloadSof[1] = HIBYTE(inst->first_sof);
+  lat->wLastPayloadSof[0] = LOBYTE(inst->sof);
+  lat->wLastPayloadSof[1] = HIBYTE(inst->sof);
+
+  inst->tx_enable_flag = 0;
+  inst->frame_ptr = NULL;
+  inst->frame_end = NULL;
+  USBD_UVC_STATS(n, FRAMES, 1U);
+  if (inst->still_state == UVC_STILL_SENDING)
+  {
+    /* still sent, the trigger control returns to normal operation and the
+       header-only payloads until the next frame no longer carry STI */
+    inst->still_state = UVC_STILL_IDLE;
+    inst->header[1] &= (uint8_t)~UVC_HEADER_STI;
+    inst->still_image = NULL;
+    inst->still_trigger = UVC_STILL_TRIGGER_NORMAL;
+  }
+  if (pdev->pUserData != NULL)
+  {
+    ((USBD_UVC_ItfTypeDef *)pdev->pUserData)->FrameDone(n);
+  }
+}
+
+/**
+  * @brief  UVC_PutHeader
+  *         Writes the payload header of the next packet. In latency probe
+  *         mode it carries the capture time of the frame (PTS) and the
+  *         source clock sampled with the USB frame number (SCR), so that the
+  *         host can tell how old the frame is when it arrives. With the
+  *         frame CRC on, payloads of a frame end with the frame CRC block,
+  *         its CRC is filled by UVC_PutFrameCrc() once the data is in.
+  * @param  inst: UVC function
+  * @param  packet: payload buffer
+  * @param  info: bmHeaderInfo FID, EOF and STI bits
+  * @param  pts: 1 if the payload belongs to a frame, 0 for an empty payload
+  * @retval header length
+  */
+static uint16_t UVC_PutHeader(USBD_UVC_InstanceTypeDef *inst, uint8_t *packet, uint8_t info, uint8_t pts)
+{
+  uint8_t *p = &packet[UVC_HEADER_LEN];
+
+  inst->stc = USBD_UVC_CLOCK();
+  inst->sof = (uint16_t)(USBD_UVC_FRAME_NUMBER() & 0x07FFU);
+  if (inst->camera.bLatencyProbe[0] != 0U)
+  {
+    info |= UVC_HEADER_SCR | UVC_HEADER_EOH;
+    if (pts != 0U)
+    {
+      info |= UVC_HEADER_PTS;
+      UVC_PutDword(p, inst->pts);
+      p += 4;
+    }
+    UVC_PutDword(p, inst->stc);
+    p[4] = LOBYTE(inst->sof);
+    p[5] = HIBYTE(inst->sof);
+    p += 6;
+  }
+  if ((inst->camera.bFrameCrc[0] != 0U) && (pts != 0U))
+  {
+    info |= UVC_HEADER_EOH;
+    UVC_PutDword(p, inst->frame_number);
+    p += UVC_HEADER_CRC_LEN;
+  }
+  packet[0] = (uint8_t)(p - packet);
+  packet[1] = info;
+  return packet[0];
+}
+
+/**
+  * @brief  UVC_PutFrameCrc
+  *         Adds the data of a payload of the frame to the frame CRC and
+  *         stores the result in its header.
+  * @param  inst: UVC function
+  * @param  packet: payload, header from UVC_PutHeader() and data
+  * @param  header_len: length of that header
+  * @param  size: payload length
+  * @retval None
+  */
+static void UVC_PutFrameCrc(USBD_UVC_InstanceTypeDef *inst, uint8_t *packet, uint16_t header_len, uint16_t size)
+{
+  if (inst->camera.bFrameCrc[0] == 0U)
+  {
+    return;
+  }
+  inst->crc = USBD_UVC_FRAME_CRC(inst->crc, &packet[header_len], (uint32_t)(size - header_len));
+  UVC_PutDword(&packet[header_len - 4U], inst->crc);
+}
+
+/**
+  * @brief  UVC_PutDword
+  *         Stores a 32-bit value little endian, as every field on the bus.
+  * @param  dst: destination
+  * @param  value: value
+  * @retval None
+  */
+static void UVC_PutDword(uint8_t *dst, uint32_t value)
+{
+  dst[0] = (uint8_t)value;
+  dst[1] = (uint8_t)(value >> 8);
+  dst[2] = (uint8_t)(value >> 16);
+  dst[3] = (uint8_t)(value >> 24);
+}
 
 /**
   * @brief  USBD_UVC_DataIn
@@ -614,57 +1314,147 @@ static uint8_t  USBD_UVC_DataIn (USBD_HandleTypeDef *pdev,
                               uint8_t epnum)
 {
 	// printf("%s\r\n", __func__);
+	USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+	USBD_UVC_InstanceTypeDef *inst;
+	
+	if ((huvc == NULL) || (epnum < USB_UVC_ENDPOINT) ||
+	    (epnum >= (USB_UVC_ENDPOINT + USBD_UVC_NUM_INSTANCES)))
+	{
+		return USBD_FAIL;
+	}
+	inst = &huvc->inst[epnum - USB_UVC_ENDPOINT];
+	
 	HAL_GPIO_WritePin(LD3_GPIO_Port, LD3_Pin, GPIO_PIN_SET);  // high signal led ON  
 		
-	uint32_t t = HAL_GetTick();
   uint16_t i;  
   uint16_t packet_size = 0;
+	uint16_t header_len;
+	uint8_t first = 0U;
+	uint8_t *packet = inst->packet;
 	
-	USBD_LL_FlushEP(pdev, USB_ENDPOINT_IN(USB_UVC_ENDPOINT));
+	USBD_LL_FlushEP(pdev, inst->ep);
 	
-	if (play_status == 2)
+	if (inst->play_status == UVC_PLAY_STATUS_STREAMING)
 	{
-		if (tx_enable_flag == 0)
+		if ((inst->tx_enable_flag == 0) && (inst->idle_packets == 0U) &&
+		    (inst->still_state != UVC_STILL_READY))
+		{
+			if ((pdev->pUserData != NULL) &&
+			    (((USBD_UVC_ItfTypeDef *)pdev->pUserData)->SkipFrame(epnum - USB_UVC_ENDPOINT) == USBD_BUSY))
+			{
+				// static scene: header only payloads for one frame interval, the FID does not toggle
+				inst->idle_packets = FRAME_INTERVAL_PACKETS;
+				USBD_UVC_STATS(epnum - USB_UVC_ENDPOINT, SKIPPED, 1U);
+			}
+			else if ((inst->commit.bFormatIndex[0] == UVC_FORMAT_INDEX_TILE) && (inst->next_frame == NULL))
+			{
+				// no encoded frame handed over yet: the interval stays empty
+				inst->idle_packets = FRAME_INTERVAL_PACKETS;
+				USBD_UVC_STATS(epnum - USB_UVC_ENDPOINT, UNDERRUNS, 1U);
+			}
+		}
+		if (inst->idle_packets != 0U)
+		{
+			inst->idle_packets--;
+			packet_size = UVC_PutHeader(inst, packet, inst->header[1], 0U);
+			if (USBD_LL_Transmit(pdev, inst->ep, packet, (uint32_t)packet_size) == USBD_FAIL){
+				Error_Handler();
+			}
+			USBD_UVC_STATS(epnum - USB_UVC_ENDPOINT, BYTES, packet_size);
+			HAL_GPIO_WritePin(LD3_GPIO_Port, LD3_Pin, GPIO_PIN_RESET);  // high signal led OFF  
+			return USBD_OK;
+		}
+		if (inst->tx_enable_flag == 0)
 		{		
-			tx_enable_flag = 1;
-			// check if we need to loop to beginning
-			if(QspiAddr == NULL || *(uint16_t*)QspiAddr == 0xd8ff){
-				QspiAddr = (__IO uint8_t *)(_acTEST_IMAGE);
+			inst->tx_enable_flag = 1;
+			inst->frame_end = NULL;
+			first = 1U;
+			// a pending still image replaces the next frame of the stream
+			// frames without a capture time are stamped when they start
+			inst->frame_number++;
+			inst->pts = USBD_UVC_CLOCK();
+			inst->crc = UVC_FRAME_CRC_INIT;
+			if (inst->still_state == UVC_STILL_READY)
+			{
+				inst->frame_ptr = inst->still_image;
+				inst->header[1] |= UVC_HEADER_STI;
+				inst->still_state = UVC_STILL_SENDING;
+			}
+			else if (inst->commit.bFormatIndex[0] == UVC_FORMAT_INDEX_TILE)
+			{
+				// frame based payload: its length is known, it has no end marker
+				inst->frame_ptr = inst->next_frame;
+				inst->frame_end = inst->next_frame + inst->next_frame_len;
+				inst->frame_number = inst->next_number;
+				inst->pts = inst->next_pts;
+				inst->next_frame = NULL;
+				inst->header[1] &= (uint8_t)~UVC_HEADER_STI;
+			}
+			else
+			{
+				inst->frame_ptr = _acTEST_IMAGE;
+				inst->header[1] &= (uint8_t)~UVC_HEADER_STI;
 			}
 			//printf("SOF\r\n");				
 			//start of new frame
-			header[1]^= 1;//toggle bit0 every new frame
+			inst->header[1]^= UVC_HEADER_FID;//toggle bit0 every new frame
 		}
 
-		packet[0] = header[0];
-		packet[1] = header[1];
-		packet_size += 2;
+		packet_size = UVC_PutHeader(inst, packet, inst->header[1] & (uint8_t)~UVC_HEADER_EOF, 1U);
+		header_len = packet_size;
+		if (first != 0U)
+		{
+			inst->first_stc = inst->stc;
+			inst->first_sof = inst->sof;
+		}
 
-		for (i=2;i<VIDEO_PACKET_SIZE;i++)
+		if (inst->frame_end != NULL)
 		{
-			if ((*QspiAddr == 0xFF) && (*(QspiAddr + 1) == 0xD9))
+			i = (uint16_t)(VIDEO_PACKET_SIZE - packet_size);
+			if ((uint32_t)(inst->frame_end - inst->frame_ptr) <= i)
+			{
+				i = (uint16_t)(inst->frame_end - inst->frame_ptr);
+				packet[1] |= UVC_HEADER_EOF;
+			}
+			USBD_memcpy(&packet[packet_size], inst->frame_ptr, i);
+			inst->frame_ptr += i;
+			packet_size += i;
+			if (packet[1] & UVC_HEADER_EOF)
 			{
-				// frame complete
-				//printf("EOF\r\n");
-				packet[i] = *QspiAddr++;
-				packet[i+1] = *QspiAddr++;		
-				packet_size+=2;
-				tx_enable_flag = 0;
-				QspiAddr = NULL;
-				break;
+				UVC_EndFrame(pdev, inst, epnum - USB_UVC_ENDPOINT);
+			}
+		}
+		else
+		{
+			for (i=packet_size;i<VIDEO_PACKET_SIZE;i++)
+			{
+				if ((*inst->frame_ptr == 0xFF) && (*(inst->frame_ptr + 1) == 0xD9))
+				{
+					// frame complete
+					//printf("EOF\r\n");
+					packet[i] = *inst->frame_ptr++;
+					packet[i+1] = *inst->frame_ptr++;		
+					packet_size+=2;
+					UVC_EndFrame(pdev, inst, epnum - USB_UVC_ENDPOINT);
+					break;
+				}
+				
+				packet[i] = *inst->frame_ptr++;			
+				packet_size++;
 			}
-			
-			packet[i] = *QspiAddr++;			
-			packet_size++;
 		}
 
+		UVC_PutFrameCrc(inst, packet, header_len, packet_size);
+
 		// send packet
-		// DumpHex((uint8_t*)&packet, packet_size);
-		if(USBD_LL_Transmit(pdev,USB_ENDPOINT_IN(USB_UVC_ENDPOINT), (uint8_t*)&packet, (uint32_t)packet_size) == USBD_FAIL){
+		// DumpHex(packet, packet_size);
+		if(USBD_LL_Transmit(pdev, inst->ep, packet, (uint32_t)packet_size) == USBD_FAIL){
 			Error_Handler();
 		}
+		USBD_UVC_STATS(epnum - USB_UVC_ENDPOINT, BYTES, packet_size);
 	}else{
-		QspiAddr = (__IO uint8_t *)(_acTEST_IMAGE);
+		inst->frame_ptr = _acTEST_IMAGE;
+		inst->frame_end = NULL;
 	}
 	
 	HAL_GPIO_WritePin(LD3_GPIO_Port, LD3_Pin, GPIO_PIN_RESET);  // high signal led OFF  
@@ -679,11 +1469,26 @@ static uint8_t  USBD_UVC_DataIn (USBD_HandleTypeDef *pdev,
   */
 static uint8_t  USBD_UVC_EP0_RxReady (USBD_HandleTypeDef *pdev)
 {
-	printf("%s\r\n", __func__);
-	USBD_SetupReqTypedef sReq = pdev->request;
-	
-	printf("usbd_video bmRequest: 0x%02X bRequest: 0x%02X wIndex: 0x%04X wValue: 0x%04X wLength %d\r\n", sReq.bmRequest,sReq.bRequest,sReq.wIndex,sReq.wValue,sReq.wLength);
-	
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+
+  if ((huvc != NULL) && (huvc->ep0_dfu != 0U))
+  {
+    /* DFU_DNLOAD block received */
+    huvc->ep0_dfu = 0U;
+    USBD_UVC_DFU_DATA();
+    return USBD_OK;
+  }
+
+  /* SET_CUR data stage completed: let the control apply the new value */
+  if ((huvc != NULL) && (huvc->ep0_ctrl != NULL))
+  {
+    if (huvc->ep0_ctrl->set != NULL)
+    {
+      huvc->ep0_inst->request_error = huvc->ep0_ctrl->set(pdev, huvc->ep0_inst, huvc->ep0_ctrl, huvc->ep0_buf);
+    }
+    huvc->ep0_ctrl = NULL;
+    huvc->ep0_inst = NULL;
+  }
   return USBD_OK;
 }
 /**
@@ -694,7 +1499,6 @@ static uint8_t  USBD_UVC_EP0_RxReady (USBD_HandleTypeDef *pdev)
   */
 static uint8_t  USBD_UVC_EP0_TxReady (USBD_HandleTypeDef *pdev)
 {
-	printf("%s\r\n", __func__);
   /* Only OUT control data are processed */
   return USBD_OK;
 }
@@ -707,27 +1511,56 @@ static uint8_t  USBD_UVC_EP0_TxReady (USBD_HandleTypeDef *pdev)
 static uint8_t  USBD_UVC_SOF (USBD_HandleTypeDef *pdev)
 {
 	//printf("%s\r\n", __func__);  
-	if (play_status == 1)
-  {
-		uint16_t hdr = 0x0002;
-	  USBD_LL_FlushEP(pdev, USB_ENDPOINT_IN(USB_UVC_ENDPOINT));
-	  USBD_LL_Transmit(pdev, USB_ENDPOINT_IN(USB_UVC_ENDPOINT), (uint8_t*)&hdr, 2);//header
-	  play_status = 2;
-		tx_enable_flag = 0;		
-  }
+	USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+	USBD_UVC_InstanceTypeDef *inst;
+	uint8_t n;
+	
+	if (huvc == NULL)
+	{
+		return USBD_OK;
+	}
+	
+	for (n = 0U; n < USBD_UVC_NUM_INSTANCES; n++)
+	{
+		inst = &huvc->inst[n];
+		if (inst->play_status == UVC_PLAY_STATUS_READY)
+	  {
+		  inst->packet[0] = 0x02;
+		  inst->packet[1] = 0x00;
+		  USBD_LL_FlushEP(pdev, inst->ep);
+		  USBD_LL_Transmit(pdev, inst->ep, inst->packet, 2);//header
+		  inst->play_status = UVC_PLAY_STATUS_STREAMING;
+			inst->tx_enable_flag = 0;		
+			inst->idle_packets = 0U;
+	  }
+	}
   return USBD_OK;
 }
 
 /**
   * @brief  USBD_UVC_IsoINIncomplete
-  *         handle data ISO IN Incomplete event
+  *         handle data ISO IN Incomplete event: the core does not tell which
+  *         endpoint missed its frame, every streaming function counts it
   * @param  pdev: device instance
-  * @param  epnum: endpoint index
+  * @param  epnum: endpoint index, always 0
   * @retval status
   */
 static uint8_t  USBD_UVC_IsoINIncomplete (USBD_HandleTypeDef *pdev, uint8_t epnum)
 {
-	printf("%s\r\n", __func__);
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+  uint8_t n;
+
+  if (huvc == NULL)
+  {
+    return USBD_OK;
+  }
+  for (n = 0U; n < USBD_UVC_NUM_INSTANCES; n++)
+  {
+    if (huvc->inst[n].play_status == UVC_PLAY_STATUS_STREAMING)
+    {
+      USBD_UVC_STATS(n, ISO_INCOMPLETE, 1U);
+    }
+  }
   return USBD_OK;
 }
 /**
@@ -757,59 +1590,471 @@ static uint8_t  USBD_UVC_DataOut (USBD_HandleTypeDef *pdev,
 }
 
 /**
-  * @brief  UVC_Req_GetCurrent
-  *         Handles the GET_CUR UVC control request.
+  * @brief  UVC_REQ_Control
+  *         Handles the class-specific requests of UVC function inst.
+  *         The control is looked up by (entity, selector) in constant time.
   * @param  pdev: instance
+  * @param  inst: UVC function owning the interface in wIndex
   * @param  req: setup class request
   * @retval status
   */
-static void UVC_REQ_GetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req)
+static uint8_t UVC_REQ_Control(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                               USBD_SetupReqTypedef *req)
 {
-	printf("%s\r\n", __func__);  USBD_LL_FlushEP (pdev, USB_ENDPOINT_OUT(0));
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+  const UVC_ControlTypeDef *ctrl = NULL;
+  uint8_t entity = HIBYTE(req->wIndex);
+  uint8_t selector = HIBYTE(req->wValue);
+  uint32_t slot;
+  const uint8_t *pbuf = NULL;
+  uint16_t len = 0U;
+  static uint8_t reply[2];
+
+  if (entity != 0U)
+  {
+    slot = UVC_SLOT_ENTITY(entity);
+  }
+  else if (LOBYTE(req->wIndex) == inst->vsif)
+  {
+    slot = UVC_SLOT_VS_INTERFACE;
+  }
+  else
+  {
+    slot = UVC_SLOT_VC_INTERFACE;
+  }
 
-  if(req->wValue == 256)
+  if ((entity > UVC_MAX_ENTITY_ID) || ((entity != 0U) && (LOBYTE(req->wIndex) != inst->vcif)))
   {
-	  //Probe Request
-	  USBD_CtlSendData (pdev, (uint8_t*)&videoProbeControl, req->wLength);
+    inst->request_error = INVALID_UNIT_ERR;
+    USBD_CtlError (pdev, req);
+    return USBD_FAIL;
   }
-  else if (req->wValue == 512)
+  if ((selector <= UVC_MAX_SELECTOR) && (uvc_control_map[slot][selector] != 0U))
   {
-	  //Commit Request
-	  USBD_CtlSendData (pdev, (uint8_t*)&videoCommitControl, req->wLength);
-  }else{
-	  USBD_CtlSendData (pdev, (uint8_t*)&videoCommitControl, req->wLength);		
-	}
+    ctrl = &uvc_controls[uvc_control_map[slot][selector] - 1U];
+  }
+  if (ctrl == NULL)
+  {
+    inst->request_error = INVALID_CONTROL_ERR;
+    USBD_CtlError (pdev, req);
+    return USBD_FAIL;
+  }
+
+  switch (req->bRequest)
+  {
+  case SET_CUR:
+    if (((ctrl->info & SUPPORTS_SET) == 0U) || (req->wLength != ctrl->len))
+    {
+      break;
+    }
+    /* the value is checked and applied by USBD_UVC_EP0_RxReady once the data stage is received */
+    huvc->ep0_ctrl = ctrl;
+    huvc->ep0_inst = inst;
+    USBD_CtlPrepareRx (pdev, huvc->ep0_buf, ctrl->len);
+    inst->request_error = NO_ERROR_ERR;
+    return USBD_OK;
+
+  case GET_CUR:
+    if (ctrl == &uvc_controls[UVC_CTRL_ROI_BOOT_INFO])
+    {
+      USBD_UVC_BOOT_INFO((uint8_t *)&uvc_boot);
+      pbuf = (const uint8_t *)&uvc_boot;
+      len = ctrl->len;
+      break;
+    }
+    if (ctrl->entity == UVC_ID_STATS_UNIT)
+    {
+      USBD_UVC_STATS_INFO((uint8_t)(inst - huvc->inst), (ctrl == &uvc_controls[UVC_CTRL_STATS_RATES]) ? 1U : 0U,
+                          (uint8_t *)&uvc_stats);
+      pbuf = (const uint8_t *)&uvc_stats;
+      len = ctrl->len;
+      break;
+    }
+    pbuf = (const uint8_t *)inst + ctrl->cur;
+    len = ctrl->len;
+    break;
+  case GET_MIN:
+    pbuf = ctrl->min;
+    len = ctrl->len;
+    break;
+  case GET_MAX:
+    pbuf = ctrl->max;
+    len = ctrl->len;
+    break;
+  case GET_RES:
+    pbuf = ctrl->res;
+    len = ctrl->len;
+    break;
+  case GET_DEF:
+    pbuf = ctrl->def;
+    len = ctrl->len;
+    break;
+  case GET_LEN:
+    reply[0] = ctrl->len;
+    reply[1] = 0U;
+    pbuf = reply;
+    len = 2U;
+    break;
+  case GET_INFO:
+    reply[0] = ctrl->info;
+    if (UVC_IsDisabled(inst, ctrl) != 0U)
+    {
+      reply[0] |= STATE_DISABLED;
+    }
+    pbuf = reply;
+    len = 1U;
+    break;
+  default:
+    break;
+  }
+
+  if (pbuf == NULL)
+  {
+    inst->request_error = INVALID_REQUEST_ERR;
+    USBD_CtlError (pdev, req);
+    return USBD_FAIL;
+  }
+
+  /* the request error code reports the previous request, do not overwrite it with its own read */
+  if (ctrl != &uvc_controls[UVC_CTRL_REQUEST_ERROR_CODE])
+  {
+    inst->request_error = NO_ERROR_ERR;
+  }
+  USBD_CtlSendData (pdev, (uint8_t *)pbuf, MIN(req->wLength, len));
+  return USBD_OK;
 }
 
 /**
-  * @brief  UVC_Req_SetCurrent
-  *         Handles the SET_CUR UVC control request.
+  * @brief  UVC_REQ_Dfu
+  *         Handles the requests to the DFU runtime interface: the class
+  *         requests go to USBD_UVC_DFU_REQUEST(), a DFU_DNLOAD block is
+  *         received straight into the buffer it returns.
   * @param  pdev: instance
-  * @param  req: setup class request
+  * @param  req: setup request with the DFU interface in wIndex
   * @retval status
   */
-static void UVC_REQ_SetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req)
+static uint8_t UVC_REQ_Dfu(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req)
 {
-	printf("%s\r\n", __func__);  if (req->wLength)
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+  static uint8_t alt_setting = 0U;
+  uint8_t *data = NULL;
+  int32_t len;
+
+  switch (req->bmRequest & USB_REQ_TYPE_MASK)
   {
-    /* Prepare the reception of the buffer over EP0 */
+  case USB_REQ_TYPE_CLASS:
+    len = USBD_UVC_DFU_REQUEST(req->bRequest, req->wValue, req->wLength, &data);
+    if ((huvc == NULL) || (len < 0) || ((len != 0) && (data == NULL)))
+    {
+      break;
+    }
+    if ((req->bmRequest & 0x80U) != 0U)
+    {
+      USBD_CtlSendData (pdev, data, MIN(req->wLength, (uint16_t)len));
+    }
+    else if (req->wLength != 0U)
+    {
+      if (len != req->wLength)
+      {
+        break;
+      }
+      /* USBD_UVC_EP0_RxReady hands the block over once it is in */
+      huvc->ep0_dfu = 1U;
+      USBD_CtlPrepareRx (pdev, data, req->wLength);
+    }
+    return USBD_OK;
+
+  case USB_REQ_TYPE_STANDARD:
+    if (req->bRequest == USB_REQ_GET_INTERFACE)
+    {
+      USBD_CtlSendData (pdev, &alt_setting, 1);
+      return USBD_OK;
+    }
+    if ((req->bRequest == USB_REQ_SET_INTERFACE) && ((uint8_t)(req->wValue) == 0U))
+    {
+      return USBD_OK;
+    }
+    break;
 
+  default:
+    break;
+  }
+  USBD_CtlError (pdev, req);
+  return USBD_FAIL;
+}
 
-	  if(req->wValue == 256)
-	  {
-		  //Probe Request
-		  USBD_CtlPrepareRx (pdev, (uint8_t*)&videoProbeControl, req->wLength);
-	  }
-	  else if (req->wValue == 512)
-	  {
-		  //Commit Request
-		  USBD_CtlPrepareRx (pdev, (uint8_t*)&videoCommitControl, req->wLength);
-	  }else{
-		  USBD_CtlPrepareRx (pdev, (uint8_t*)&videoCommitControl, req->wLength);
-			
-		}
+/**
+  * @brief  UVC_SetProbe
+  *         Negotiates a new probe state: MJPEG or tile delta, the other
+  *         fields owned by the device are forced back to the values of the
+  *         only frame of that format.
+  * @param  pdev: instance
+  * @param  inst: UVC function
+  * @param  ctrl: probe control
+  * @param  data: SET_CUR data
+  * @retval request error code
+  */
+static uint8_t UVC_SetProbe(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                            const UVC_ControlTypeDef *ctrl, const uint8_t *data)
+{
+  static const uint8_t tileFrameSize[4] = {DBVAL(MAX_TILE_FRAME_SIZE)};
+
+  USBD_memcpy(&inst->probe, data, ctrl->len);
+  if (inst->probe.bFormatIndex[0] != UVC_FORMAT_INDEX_TILE)
+  {
+    inst->probe.bFormatIndex[0] = videoDefaultControl.bFormatIndex[0];
+  }
+  inst->probe.bFrameIndex[0] = videoDefaultControl.bFrameIndex[0];
+  USBD_memcpy(inst->probe.dwFrameInterval, videoDefaultControl.dwFrameInterval, 4U);
+  USBD_memcpy(inst->probe.dwMaxVideoFrameSize,
+              (inst->probe.bFormatIndex[0] == UVC_FORMAT_INDEX_TILE) ? tileFrameSize :
+                                                                      videoDefaultControl.dwMaxVideoFrameSize, 4U);
+  USBD_memcpy(inst->probe.dwMaxPayloadTransferSize, videoDefaultControl.dwMaxPayloadTransferSize, 4U);
+  USBD_memcpy(inst->probe.dwClockFrequency, videoDefaultControl.dwClockFrequency, 4U);
+  return NO_ERROR_ERR;
+}
 
+/**
+  * @brief  UVC_SetCommit
+  *         Commits a negotiated state, rejected if it differs from the probe.
+  * @param  pdev: instance
+  * @param  inst: UVC function
+  * @param  ctrl: commit control
+  * @param  data: SET_CUR data
+  * @retval request error code
+  */
+static uint8_t UVC_SetCommit(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                             const UVC_ControlTypeDef *ctrl, const uint8_t *data)
+{
+  USBD_memcpy(&inst->commit, data, ctrl->len);
+  if ((inst->commit.bFormatIndex[0] != inst->probe.bFormatIndex[0]) ||
+      (inst->commit.bFrameIndex[0] != inst->probe.bFrameIndex[0]))
+  {
+    inst->commit = inst->probe;
+    return OUT_OF_RANGE_ERR;
   }
+  return NO_ERROR_ERR;
+}
+
+/**
+  * @brief  UVC_SetStillProbe
+  *         Negotiates the still image: only one size and format is supported.
+  * @param  pdev: instance
+  * @param  inst: UVC function
+  * @param  ctrl: still probe control
+  * @param  data: SET_CUR data
+  * @retval request error code
+  */
+static uint8_t UVC_SetStillProbe(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                                 const UVC_ControlTypeDef *ctrl, const uint8_t *data)
+{
+  USBD_memcpy(&inst->still_probe, data, ctrl->len);
+  inst->still_probe.bFormatIndex[0] = stillDefaultControl.bFormatIndex[0];
+  inst->still_probe.bFrameIndex[0] = stillDefaultControl.bFrameIndex[0];
+  inst->still_probe.bCompressionIndex[0] = stillDefaultControl.bCompressionIndex[0];
+  USBD_memcpy(inst->still_probe.dwMaxVideoFrameSize, stillDefaultControl.dwMaxVideoFrameSize, 4U);
+  USBD_memcpy(inst->still_probe.dwMaxPayloadTransferSize, stillDefaultControl.dwMaxPayloadTransferSize, 4U);
+  return NO_ERROR_ERR;
+}
+
+/**
+  * @brief  UVC_SetStillCommit
+  *         Commits the still image settings, rejected if they differ from the probe.
+  * @param  pdev: instance
+  * @param  inst: UVC function
+  * @param  ctrl: still commit control
+  * @param  data: SET_CUR data
+  * @retval request error code
+  */
+static uint8_t UVC_SetStillCommit(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                                  const UVC_ControlTypeDef *ctrl, const uint8_t *data)
+{
+  USBD_memcpy(&inst->still_commit, data, ctrl->len);
+  if ((inst->still_commit.bFormatIndex[0] != inst->still_probe.bFormatIndex[0]) ||
+      (inst->still_commit.bFrameIndex[0] != inst->still_probe.bFrameIndex[0]))
+  {
+    inst->still_commit = inst->still_probe;
+    return OUT_OF_RANGE_ERR;
+  }
+  return NO_ERROR_ERR;
+}
+
+/**
+  * @brief  UVC_SetStillTrigger
+  *         Starts or aborts a still image capture (method 2, video endpoint).
+  * @param  pdev: instance
+  * @param  inst: UVC function
+  * @param  ctrl: still image trigger control
+  * @param  data: SET_CUR data
+  * @retval request error code
+  */
+static uint8_t UVC_SetStillTrigger(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                                   const UVC_ControlTypeDef *ctrl, const uint8_t *data)
+{
+  switch (data[0])
+  {
+  case UVC_STILL_TRIGGER_NORMAL:
+    return NO_ERROR_ERR;
+
+  case UVC_STILL_TRIGGER_TRANSMIT:
+    if (inst->alt_setting == 0U)
+    {
+      /* method 2 sends the still inside the video stream */
+      return WRONG_STATE_ERR;
+    }
+    if (inst->commit.bFormatIndex[0] == UVC_FORMAT_INDEX_TILE)
+    {
+      /* only the MJPEG format has a still image frame descriptor */
+      return WRONG_STATE_ERR;
+    }
+    if (USBD_UVC_StillTrigger(pdev, USB_UVC_INSTANCE(inst->vcif)) != USBD_OK)
+    {
+      return NOT_READY_ERR;
+    }
+    return NO_ERROR_ERR;
+
+  case UVC_STILL_TRIGGER_ABORT:
+    inst->still_state = UVC_STILL_IDLE;
+    inst->still_image = NULL;
+    inst->still_trigger = UVC_STILL_TRIGGER_NORMAL;
+    return NO_ERROR_ERR;
+
+  default:
+    /* no bulk still endpoint (method 3) */
+    return OUT_OF_RANGE_ERR;
+  }
+}
+
+/**
+  * @brief  UVC_SetCamera
+  *         Range checks a camera terminal or processing unit value, stores it
+  *         and forwards it to the video hardware. A rejected value leaves the
+  *         current one untouched.
+  * @param  pdev: instance
+  * @param  inst: UVC function
+  * @param  ctrl: camera control
+  * @param  data: SET_CUR data
+  * @retval request error code
+  */
+static uint8_t UVC_SetCamera(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                             const UVC_ControlTypeDef *ctrl, const uint8_t *data)
+{
+  USBD_UVC_ItfTypeDef *fops = (USBD_UVC_ItfTypeDef *)pdev->pUserData;
+  int32_t value = UVC_GetValue(ctrl, data);
+
+  if (UVC_IsDisabled(inst, ctrl) != 0U)
+  {
+    return WRONG_STATE_ERR;
+  }
+  if ((ctrl->flags & UVC_CTRL_FLAG_BITMAP) != 0U)
+  {
+    /* exactly one of the modes advertised by GET_RES */
+    if ((value == 0) || ((value & (value - 1)) != 0) || ((value & ~UVC_GetValue(ctrl, ctrl->res)) != 0))
+    {
+      return OUT_OF_RANGE_ERR;
+    }
+  }
+  else if ((value < UVC_GetValue(ctrl, ctrl->min)) || (value > UVC_GetValue(ctrl, ctrl->max)))
+  {
+    return OUT_OF_RANGE_ERR;
+  }
+
+  USBD_memcpy((uint8_t *)inst + ctrl->cur, data, ctrl->len);
+  if (fops != NULL)
+  {
+    fops->Control(USB_UVC_INSTANCE(inst->vcif), ctrl->entity, ctrl->selector, value);
+  }
+  return NO_ERROR_ERR;
+}
+
+/**
+  * @brief  UVC_SetWindow
+  *         Checks a region of interest against GET_MIN, GET_MAX and GET_RES
+  *         and the sensor frame, stores it and forwards it to the video
+  *         hardware.
+  * @param  pdev: instance
+  * @param  inst: UVC function
+  * @param  ctrl: window control
+  * @param  data: SET_CUR data
+  * @retval request error code
+  */
+static uint8_t UVC_SetWindow(USBD_HandleTypeDef *pdev, USBD_UVC_InstanceTypeDef *inst,
+                             const UVC_ControlTypeDef *ctrl, const uint8_t *data)
+{
+  USBD_UVC_ItfTypeDef *fops = (USBD_UVC_ItfTypeDef *)pdev->pUserData;
+  uint16_t field[UVC_ROI_CONTROL_LEN / 2U];
+  uint16_t min, max, res;
+  uint8_t i;
+
+  for (i = 0U; i < (UVC_ROI_CONTROL_LEN / 2U); i++)
+  {
+    field[i] = (uint16_t)(data[2U * i] | (data[(2U * i) + 1U] << 8));
+    min = (uint16_t)(ctrl->min[2U * i] | (ctrl->min[(2U * i) + 1U] << 8));
+    max = (uint16_t)(ctrl->max[2U * i] | (ctrl->max[(2U * i) + 1U] << 8));
+    res = (uint16_t)(ctrl->res[2U * i] | (ctrl->res[(2U * i) + 1U] << 8));
+    if ((field[i] < min) || (field[i] > max) || ((field[i] % res) != 0U))
+    {
+      return OUT_OF_RANGE_ERR;
+    }
+  }
+  /* wLeft + wWidth and wTop + wHeight */
+  if (((uint32_t)field[0] + field[2] > WIDTH) || ((uint32_t)field[1] + field[3] > HEIGHT))
+  {
+    return OUT_OF_RANGE_ERR;
+  }
+
+  USBD_memcpy(&inst->roi, data, ctrl->len);
+  if (fops != NULL)
+  {
+    fops->Window(USB_UVC_INSTANCE(inst->vcif), field[0], field[1], field[2], field[3]);
+  }
+  return NO_ERROR_ERR;
+}
+
+/**
+  * @brief  UVC_GetValue
+  *         Decodes little endian control data of 1, 2 or 4 bytes.
+  * @param  ctrl: control
+  * @param  data: control data
+  * @retval value, sign extended for signed controls
+  */
+static int32_t UVC_GetValue(const UVC_ControlTypeDef *ctrl, const uint8_t *data)
+{
+  uint32_t value = 0U;
+  uint8_t i;
+
+  for (i = ctrl->len; i > 0U; i--)
+  {
+    value = (value << 8) | data[i - 1U];
+  }
+  if (((ctrl->flags & UVC_CTRL_FLAG_SIGNED) != 0U) && (ctrl->len < 4U) &&
+      ((value & (1UL << ((ctrl->len * 8U) - 1U))) != 0U))
+  {
+    value |= ~((1UL << (ctrl->len * 8U)) - 1U);
+  }
+  return (int32_t)value;
+}
+
+/**
+  * @brief  UVC_IsDisabled
+  *         Tells whether a manual control is overridden by its automatic mode.
+  * @param  inst: UVC function
+  * @param  ctrl: control
+  * @retval 1 if the control is disabled
+  */
+static uint8_t UVC_IsDisabled(const USBD_UVC_InstanceTypeDef *inst, const UVC_ControlTypeDef *ctrl)
+{
+  if (((ctrl->flags & UVC_CTRL_FLAG_MANUAL_AE) != 0U) &&
+      (inst->camera.bAutoExposureMode[0] != UVC_AE_MODE_MANUAL))
+  {
+    return 1U;
+  }
+  if (((ctrl->flags & UVC_CTRL_FLAG_MANUAL_WB) != 0U) &&
+      (inst->camera.bWhiteBalanceTemperatureAuto[0] != 0U))
+  {
+    return 1U;
+  }
+  return 0U;
 }
 
 
@@ -822,7 +2067,6 @@ static void UVC_REQ_SetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *r
 static uint8_t  *USBD_UVC_GetDeviceQualifierDesc (uint16_t *length)
 {
   *length = sizeof (USBD_UVC_DeviceQualifierDesc);
-	printf("%s Len: %d\r\n", __func__, *length);
   return USBD_UVC_DeviceQualifierDesc;
 }
 
@@ -836,10 +2080,222 @@ static uint8_t  *USBD_UVC_GetDeviceQualifierDesc (uint16_t *length)
 static uint8_t  *USBD_UVC_GetCfgDesc (uint16_t *length)
 {
   *length = sizeof (USBD_UVC_CfgDesc);
-	printf("%s Len: %d\r\n", __func__, *length);
   return USBD_UVC_CfgDesc;
 }
 
+/**
+* @brief  USBD_UVC_RegisterInterface
+* @param  fops: Video hardware callbacks
+* @retval status
+*/
+uint8_t  USBD_UVC_RegisterInterface  (USBD_HandleTypeDef   *pdev,
+                                      USBD_UVC_ItfTypeDef *fops)
+{
+  if(fops != NULL)
+  {
+    pdev->pUserData= fops;
+  }
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_UVC_StillTrigger
+*         Requests a still image on function n, from the host trigger control
+*         or from a hardware button. Context of the class callbacks only:
+*         a button interrupt posts it with Defer_Post().
+* @param  n: UVC function
+* @retval status, USBD_BUSY while a previous still is not sent, USBD_FAIL
+*         while the frame based format is committed or when the interface
+*         cannot capture a still
+*/
+uint8_t  USBD_UVC_StillTrigger  (USBD_HandleTypeDef *pdev, uint8_t n)
+{
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+  USBD_UVC_ItfTypeDef *fops = (USBD_UVC_ItfTypeDef *)pdev->pUserData;
+  USBD_UVC_InstanceTypeDef *inst;
+
+  if ((huvc == NULL) || (n >= USBD_UVC_NUM_INSTANCES))
+  {
+    return USBD_FAIL;
+  }
+  inst = &huvc->inst[n];
+  if (inst->commit.bFormatIndex[0] == UVC_FORMAT_INDEX_TILE)
+  {
+    /* the still is a JPEG image: not inside a TDLT stream */
+    return USBD_FAIL;
+  }
+  if (inst->still_state != UVC_STILL_IDLE)
+  {
+    return USBD_BUSY;
+  }
+
+  inst->still_trigger = UVC_STILL_TRIGGER_TRANSMIT;
+  inst->still_state = UVC_STILL_CAPTURE;
+  if ((fops == NULL) || (fops->StillCapture(n) != USBD_OK))
+  {
+    inst->still_state = UVC_STILL_IDLE;
+    inst->still_trigger = UVC_STILL_TRIGGER_NORMAL;
+    return USBD_FAIL;
+  }
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_UVC_StillReady
+*         Hands over the encoded still image of function n, it is sent in
+*         place of the next frame with the STI bit set.
+* @param  n: UVC function
+* @param  image: JPEG image, must stay valid until it is sent
+* @retval status, USBD_FAIL if the capture was aborted
+*/
+uint8_t  USBD_UVC_StillReady  (USBD_HandleTypeDef *pdev, uint8_t n,
+                               const uint8_t *image)
+{
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+
+  if ((huvc == NULL) || (n >= USBD_UVC_NUM_INSTANCES) ||
+      (huvc->inst[n].still_state != UVC_STILL_CAPTURE))
+  {
+    return USBD_FAIL;
+  }
+  huvc->inst[n].still_image = image;
+  huvc->inst[n].still_state = UVC_STILL_READY;
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_UVC_SetMotionScore
+*         Updates the value read by XU_MOTION_SCORE_CONTROL of function n.
+* @param  n: UVC function
+* @param  score: motion score of the last analysed frame
+* @retval status
+*/
+uint8_t  USBD_UVC_SetMotionScore  (USBD_HandleTypeDef *pdev, uint8_t n,
+                                   uint8_t score)
+{
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+
+  if ((huvc == NULL) || (n >= USBD_UVC_NUM_INSTANCES))
+  {
+    return USBD_FAIL;
+  }
+  huvc->inst[n].camera.bMotionScore[0] = score;
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_UVC_FrameReady
+*         Hands an encoded frame to function n when the frame based format
+*         is committed. It is sent from the next frame start, the buffer must
+*         stay untouched until FrameDone() is called.
+* @param  n: UVC function
+* @param  frame: payload, at most MAX_TILE_FRAME_SIZE bytes
+* @param  len: payload length
+* @param  number: frame number, reported by XU_ROI_LATENCY_INFO_CONTROL
+* @param  capture_time: USBD_UVC_CLOCK() when the frame was captured, its PTS
+* @retval status: USBD_BUSY while the previous frame is still pending
+*/
+uint8_t  USBD_UVC_FrameReady  (USBD_HandleTypeDef *pdev, uint8_t n,
+                               const uint8_t *frame, uint32_t len,
+                               uint32_t number, uint32_t capture_time)
+{
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+
+  if ((huvc == NULL) || (n >= USBD_UVC_NUM_INSTANCES) || (frame == NULL) || (len == 0U))
+  {
+    return USBD_FAIL;
+  }
+  if (huvc->inst[n].next_frame != NULL)
+  {
+    return USBD_BUSY;
+  }
+  huvc->inst[n].next_frame_len = len;
+  huvc->inst[n].next_number = number;
+  huvc->inst[n].next_pts = capture_time;
+  /* the length, number and PTS are stored before the IN interrupt can see the frame */
+  __DMB();
+  huvc->inst[n].next_frame = frame;
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_UVC_GetFormat
+*         Tells which format function n streams.
+* @param  n: UVC function
+* @retval committed bFormatIndex while streaming, 0 when the stream is stopped
+*/
+uint8_t  USBD_UVC_GetFormat  (USBD_HandleTypeDef *pdev, uint8_t n)
+{
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+
+  if ((huvc == NULL) || (n >= USBD_UVC_NUM_INSTANCES) ||
+      (huvc->inst[n].play_status != UVC_PLAY_STATUS_STREAMING))
+  {
+    return 0U;
+  }
+  return huvc->inst[n].commit.bFormatIndex[0];
+}
+
+/**
+* @brief  USBD_UVC_FrameBusy
+*         Tells whether the frame handed over to function n is still in use:
+*         pending, or being sent. Polled from thread mode, next_frame is read
+*         before the transmit state it moves to.
+* @param  n: UVC function
+* @retval 1 while the buffer given to USBD_UVC_FrameReady must stay untouched
+*/
+uint8_t  USBD_UVC_FrameBusy  (USBD_HandleTypeDef *pdev, uint8_t n)
+{
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+
+  if ((huvc == NULL) || (n >= USBD_UVC_NUM_INSTANCES))
+  {
+    return 0U;
+  }
+  if (huvc->inst[n].next_frame != NULL)
+  {
+    return 1U;
+  }
+  return ((huvc->inst[n].tx_enable_flag != 0U) &&
+          (huvc->inst[n].frame_end != NULL)) ? 1U : 0U;
+}
+
+/**
+* @brief  USBD_UVC_GetStreamImage
+*         The JPEG image the MJPEG format streams, in flash.
+* @retval image, valid for as long as the firmware runs
+*/
+const uint8_t *USBD_UVC_GetStreamImage  (void)
+{
+  return _acTEST_IMAGE;
+}
+
+/**
+* @brief  USBD_UVC_GetActive
+*         Tells which functions selected alternate setting 1: the stream is
+*         started or about to start on the next SOF.
+* @retval bit n set for function n
+*/
+uint8_t  USBD_UVC_GetActive  (USBD_HandleTypeDef *pdev)
+{
+  USBD_UVC_HandleTypeDef *huvc = (USBD_UVC_HandleTypeDef*) pdev->pClassData;
+  uint8_t active = 0U;
+  uint8_t n;
+
+  if (huvc == NULL)
+  {
+    return 0U;
+  }
+  for (n = 0U; n < USBD_UVC_NUM_INSTANCES; n++)
+  {
+    if (huvc->inst[n].play_status != UVC_PLAY_STATUS_STOP)
+    {
+      active |= (uint8_t)(1U << n);
+    }
+  }
+  return active;
+}
+
 
 /**
   * @}
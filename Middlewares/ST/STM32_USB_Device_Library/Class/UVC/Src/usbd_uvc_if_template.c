@@ -55,23 +55,23 @@
   * @{
   */
 
-static int8_t  TEMPLATE_Init         (uint32_t  UVCFreq, uint32_t Volume, uint32_t options);
-static int8_t  TEMPLATE_DeInit       (uint32_t options);
-static int8_t  TEMPLATE_UVCCmd     (uint8_t* pbuf, uint32_t size, uint8_t cmd);
-static int8_t  TEMPLATE_VolumeCtl    (uint8_t vol);
-static int8_t  TEMPLATE_MuteCtl      (uint8_t cmd);
-static int8_t  TEMPLATE_PeriodicTC   (uint8_t cmd);
-static int8_t  TEMPLATE_GetState     (void);
+static int8_t  TEMPLATE_Init         (void);
+static int8_t  TEMPLATE_DeInit       (void);
+static int8_t  TEMPLATE_Control      (uint8_t n, uint8_t entity, uint8_t selector, int32_t value);
+static int8_t  TEMPLATE_Window       (uint8_t n, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+static int8_t  TEMPLATE_FrameDone    (uint8_t n);
+static int8_t  TEMPLATE_SkipFrame    (uint8_t n);
+static int8_t  TEMPLATE_StillCapture (uint8_t n);
 
 USBD_UVC_ItfTypeDef USBD_UVC_Template_fops =
 {
   TEMPLATE_Init,
   TEMPLATE_DeInit,
-  TEMPLATE_UVCCmd,
-  TEMPLATE_VolumeCtl,
-  TEMPLATE_MuteCtl,
-  TEMPLATE_PeriodicTC,
-  TEMPLATE_GetState,
+  TEMPLATE_Control,
+  TEMPLATE_Window,
+  TEMPLATE_FrameDone,
+  TEMPLATE_SkipFrame,
+  TEMPLATE_StillCapture,
 };
 
 /* Private functions ---------------------------------------------------------*/
@@ -82,7 +82,7 @@ USBD_UVC_ItfTypeDef USBD_UVC_Template_fops =
   * @param  None
   * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
   */
-static int8_t TEMPLATE_Init(uint32_t  UVCFreq, uint32_t Volume, uint32_t options)
+static int8_t TEMPLATE_Init(void)
 {
   /*
      Add your initialization code here
@@ -96,7 +96,7 @@ static int8_t TEMPLATE_Init(uint32_t  UVCFreq, uint32_t Volume, uint32_t options
   * @param  None
   * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
   */
-static int8_t TEMPLATE_DeInit(uint32_t options)
+static int8_t TEMPLATE_DeInit(void)
 {
   /*
      Add your deinitialization code here
@@ -106,61 +106,67 @@ static int8_t TEMPLATE_DeInit(uint32_t options)
 
 
 /**
-  * @brief  TEMPLATE_UVCCmd
-  *         UVC command handler
-  * @param  Buf: Buffer of data to be sent
-  * @param  size: Number of data to be sent (in bytes)
-  * @param  cmd: command opcode
+  * @brief  TEMPLATE_Control
+  *         Camera terminal / processing unit control handler, called from
+  *         the USB interrupt: latch the value, do not access the sensor here
+  * @param  n: UVC function
+  * @param  entity: unit or terminal ID
+  * @param  selector: control selector
+  * @param  value: new value, already range checked
   * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
   */
-static int8_t TEMPLATE_UVCCmd (uint8_t* pbuf, uint32_t size, uint8_t cmd)
+static int8_t TEMPLATE_Control (uint8_t n, uint8_t entity, uint8_t selector, int32_t value)
 {
 
   return (0);
 }
 
 /**
-  * @brief  TEMPLATE_VolumeCtl
-  * @param  vol: volume level (0..100)
+  * @brief  TEMPLATE_Window
+  *         Region of interest handler, called from the USB interrupt
+  * @param  n: UVC function
+  * @param  x, y: top left corner in the sensor frame
+  * @param  width, height: window size, already range checked
   * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
   */
-static int8_t TEMPLATE_VolumeCtl (uint8_t vol)
+static int8_t TEMPLATE_Window (uint8_t n, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
 {
 
   return (0);
 }
 
 /**
-  * @brief  TEMPLATE_MuteCtl
-  * @param  cmd: vmute command
+  * @brief  TEMPLATE_FrameDone
+  * @param  n: UVC function which sent the end of a frame
   * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
   */
-static int8_t TEMPLATE_MuteCtl (uint8_t cmd)
+static int8_t TEMPLATE_FrameDone (uint8_t n)
 {
 
   return (0);
 }
 
 /**
-  * @brief  TEMPLATE_PeriodicTC
-  * @param  cmd
-  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  * @brief  TEMPLATE_SkipFrame
+  * @param  n: UVC function about to start a frame
+  * @retval USBD_OK to send the frame, USBD_BUSY to leave the frame interval empty
   */
-static int8_t TEMPLATE_PeriodicTC (uint8_t cmd)
+static int8_t TEMPLATE_SkipFrame (uint8_t n)
 {
 
   return (0);
 }
 
 /**
-  * @brief  TEMPLATE_GetState
-  * @param  None
-  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  * @brief  TEMPLATE_StillCapture
+  *         Start capturing a still image, then call USBD_UVC_StillReady
+  * @param  n: UVC function
+  * @retval Result of the operation: USBD_OK if a capture was started else USBD_FAIL
   */
-static int8_t TEMPLATE_GetState (void)
+static int8_t TEMPLATE_StillCapture (uint8_t n)
 {
 
-  return (0);
+  return (USBD_FAIL);
 }
 /**
   * @}
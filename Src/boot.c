@@ -0,0 +1,204 @@
+/**
+  ******************************************************************************
+  * @file    boot.c
+  * @brief   Boot timing: time of each init stage, up to the first frame.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                  Boot timing
+  *          ===================================================================
+  *           Boot_Mark() records the first time a stage is reached, in us
+  *           from Boot_Init() right after HAL_Init():
+  *             - up to BOOT_STAGE_PERIPH from the DWT cycle counter, each
+  *               interval at the core clock of the mark that opened it,
+  *             - from BOOT_STAGE_PERIPH on from the TIM2 timestamp clock of
+  *               latency.c, which keeps counting while the CPU sleeps and
+  *               across the clock changes of the idle manager.
+  *           The stages from USB connection to the first frame sent show
+  *           what the host waits for: with BOOT_LAZY_INIT the media are set
+  *           up between BOOT_STAGE_STREAM and BOOT_STAGE_MEDIA. The host
+  *           reads all stages with XU_ROI_BOOT_INFO_CONTROL, the console
+  *           gets them once the first frame is sent. The file builds on a
+  *           host with a time hook instead of the timers.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "boot.h"
+#include <stdio.h>
+#if !BOOT_HOST
+#include "latency.h"
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+static const char * const boot_stage_name[BOOT_STAGE_NUM] =
+{
+  "clock", "peripherals", "USB connected", "configured",
+  "stream start", "media ready", "first frame"
+};
+
+static volatile uint32_t boot_time[BOOT_STAGE_NUM];
+#if !BOOT_HOST
+static uint32_t boot_us;             /* time of the last cycle counter sample */
+static uint32_t boot_cycles;         /* that sample */
+static uint32_t boot_mhz;            /* core clock since that sample */
+static uint32_t boot_timer_base;     /* TIM2 count at BOOT_STAGE_PERIPH */
+static uint8_t boot_timer;           /* 1: the times come from TIM2 */
+#else
+static uint32_t boot_host_base;
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Boot_Now(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Boot_Now
+  * @retval us from Boot_Init()
+  */
+static uint32_t Boot_Now(void)
+{
+#if BOOT_HOST
+  return Boot_HostTime() - boot_host_base;
+#else
+  uint32_t cycles;
+
+  if (boot_timer != 0U)
+  {
+    return boot_us + (Latency_Now() - boot_timer_base);
+  }
+  cycles = DWT->CYCCNT;
+  boot_us += (cycles - boot_cycles) / boot_mhz;
+  boot_cycles = cycles;
+  boot_mhz = SystemCoreClock / 1000000U;
+  return boot_us;
+#endif
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Boot_Init
+  *         Starts the count, right after HAL_Init().
+  * @retval None
+  */
+void Boot_Init(void)
+{
+  uint32_t n;
+
+  for (n = 0U; n < BOOT_STAGE_NUM; n++)
+  {
+    boot_time[n] = 0U;
+  }
+#if BOOT_HOST
+  boot_host_base = Boot_HostTime();
+#else
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  boot_us = 0U;
+  boot_cycles = DWT->CYCCNT;
+  boot_mhz = SystemCoreClock / 1000000U;
+  boot_timer = 0U;
+#endif
+}
+
+/**
+  * @brief  Boot_Mark
+  *         Records the first time a stage is reached. BOOT_STAGE_PERIPH is
+  *         marked from the main loop after Latency_Init(), the later stages
+  *         from any context.
+  * @param  stage: BOOT_STAGE_xxx
+  * @retval None
+  */
+void Boot_Mark(uint8_t stage)
+{
+  uint32_t now;
+
+  if ((stage >= BOOT_STAGE_NUM) || (boot_time[stage] != 0U))
+  {
+    return;
+  }
+  now = Boot_Now();
+#if !BOOT_HOST
+  if (stage == BOOT_STAGE_PERIPH)
+  {
+    boot_timer_base = Latency_Now();
+    boot_us = now;
+    boot_timer = 1U;
+  }
+#endif
+  /* 0 means not reached */
+  boot_time[stage] = (now != 0U) ? now : 1U;
+}
+
+/**
+  * @brief  Boot_GetTime
+  *         Interrupt safe.
+  * @param  stage: BOOT_STAGE_xxx
+  * @retval us from Boot_Init(), 0 if the stage is not reached
+  */
+uint32_t Boot_GetTime(uint8_t stage)
+{
+  return (stage < BOOT_STAGE_NUM) ? boot_time[stage] : 0U;
+}
+
+/**
+  * @brief  Boot_GetInfo
+  *         Data of XU_ROI_BOOT_INFO_CONTROL. Interrupt safe.
+  * @param  data: BOOT_INFO_LEN bytes, the stage times as little endian dwords
+  * @retval None
+  */
+void Boot_GetInfo(uint8_t *data)
+{
+  uint32_t n, t;
+
+  for (n = 0U; n < BOOT_STAGE_NUM; n++)
+  {
+    t = boot_time[n];
+    data[(n * 4U) + 0U] = (uint8_t)t;
+    data[(n * 4U) + 1U] = (uint8_t)(t >> 8);
+    data[(n * 4U) + 2U] = (uint8_t)(t >> 16);
+    data[(n * 4U) + 3U] = (uint8_t)(t >> 24);
+  }
+}
+
+/**
+  * @brief  Boot_Report
+  *         Prints the stages reached and the time from the configuration by
+  *         the host to the first frame.
+  * @retval None
+  */
+void Boot_Report(void)
+{
+  uint32_t n;
+
+  printf("Boot:");
+  for (n = 0U; n < BOOT_STAGE_NUM; n++)
+  {
+    if (boot_time[n] != 0U)
+    {
+      printf(" %s %lu.%03lu ms,", boot_stage_name[n],
+             (unsigned long)(boot_time[n] / 1000U), (unsigned long)(boot_time[n] % 1000U));
+    }
+  }
+  if ((boot_time[BOOT_STAGE_CONFIGURED] != 0U) && (boot_time[BOOT_STAGE_FIRST_FRAME] != 0U))
+  {
+    printf(" configured to first frame %lu us",
+           (unsigned long)(boot_time[BOOT_STAGE_FIRST_FRAME] - boot_time[BOOT_STAGE_CONFIGURED]));
+  }
+  printf("\r\n");
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,297 @@
+/**
+  ******************************************************************************
+  * @file    capture.c
+  * @brief   DCMI capture layer: region of interest, capture rate and binning.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Capture layer
+  *          ===================================================================
+  *           Only the pixels that are streamed reach memory:
+  *             - the DCMI crop window keeps the region of interest, the
+  *               counters are in pixel clocks so x and width are doubled
+  *               for the two bytes of an RGB565 pixel,
+  *             - the DCMI frame rate control drops 1 of 2 or 3 of 4 frames,
+  *               or 3 of 4 while the motion detector throttles a static scene,
+  *             - 2x2 binning halves the window in software, in place.
+  *           Settings come from the USB interrupt; they are latched and
+  *           applied by Capture_Process() in the main loop, which stops and
+  *           restarts a running capture around the change.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "capture.h"
+#include "mem_region.h"
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t capture_dcmi_rate[] =
+{
+  [CAPTURE_RATE_ALL]    = DCMI_CR_ALL_FRAME,
+  [CAPTURE_RATE_1_OF_2] = DCMI_CR_ALTERNATE_2_FRAME,
+  [CAPTURE_RATE_1_OF_4] = DCMI_CR_ALTERNATE_4_FRAME,
+};
+
+static DCMI_HandleTypeDef *capture_dcmi;
+static Capture_ConfigTypeDef capture_cur;      /* programmed in the DCMI */
+static Capture_ConfigTypeDef capture_next =    /* latched from the USB interrupt */
+{
+  0U, 0U, CAPTURE_SENSOR_WIDTH, CAPTURE_SENSOR_HEIGHT, 0U, CAPTURE_RATE_ALL, 0U
+};
+static __IO uint8_t capture_pending;
+static uint8_t *capture_buffer;                /* DMA target while the capture runs */
+static uint8_t *capture_frame;                 /* full sensor frame in SDRAM, NULL without SDRAM */
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef Capture_Apply(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Capture_Apply
+  *         Programs capture_cur in the DCMI, the capture must be stopped.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Capture_Apply(void)
+{
+  capture_dcmi->Init.CaptureRate = capture_dcmi_rate[(capture_cur.throttle != 0U) ? CAPTURE_RATE_1_OF_4 :
+                                                                                    capture_cur.rate];
+  if (HAL_DCMI_Init(capture_dcmi) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((capture_cur.width == CAPTURE_SENSOR_WIDTH) && (capture_cur.height == CAPTURE_SENSOR_HEIGHT))
+  {
+    return HAL_DCMI_DisableCrop(capture_dcmi);
+  }
+  if (HAL_DCMI_ConfigCrop(capture_dcmi,
+                          (uint32_t)capture_cur.x * CAPTURE_BYTES_PER_PIXEL, capture_cur.y,
+                          ((uint32_t)capture_cur.width * CAPTURE_BYTES_PER_PIXEL) - 1U,
+                          (uint32_t)capture_cur.height - 1U) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  return HAL_DCMI_EnableCrop(capture_dcmi);
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Capture_Init
+  *         Programs the full sensor frame, every frame, no binning. A window,
+  *         binning or rate the host set before is kept latched and applied
+  *         by the first Capture_Process().
+  * @param  hdcmi: initialized DCMI handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef Capture_Init(DCMI_HandleTypeDef *hdcmi)
+{
+  capture_dcmi = hdcmi;
+  capture_buffer = NULL;
+  if (capture_frame == NULL)
+  {
+    capture_frame = MEM_REGION_NEW(MEM_REGION_SDRAM, uint8_t, CAPTURE_FRAME_BYTES);
+  }
+  capture_cur.x = 0U;
+  capture_cur.y = 0U;
+  capture_cur.width = CAPTURE_SENSOR_WIDTH;
+  capture_cur.height = CAPTURE_SENSOR_HEIGHT;
+  capture_cur.binning = 0U;
+  capture_cur.rate = CAPTURE_RATE_ALL;
+  capture_cur.throttle = 0U;
+  return Capture_Apply();
+}
+
+/**
+  * @brief  Capture_GetFrameBuffer
+  * @retval CAPTURE_FRAME_BYTES bytes in SDRAM for Capture_Start(), NULL if
+  *         no SDRAM is fitted
+  */
+uint8_t *Capture_GetFrameBuffer(void)
+{
+  return capture_frame;
+}
+
+/**
+  * @brief  Capture_Start
+  *         Starts the continuous capture of the window into buffer.
+  * @param  buffer: window width x height x 2 bytes, word aligned
+  * @retval HAL status, HAL_ERROR if no DMA is linked to the DCMI
+  */
+HAL_StatusTypeDef Capture_Start(uint8_t *buffer)
+{
+  if ((capture_dcmi == NULL) || (capture_dcmi->DMA_Handle == NULL))
+  {
+    return HAL_ERROR;
+  }
+  capture_buffer = buffer;
+  return HAL_DCMI_Start_DMA(capture_dcmi, DCMI_MODE_CONTINUOUS, (uint32_t)buffer,
+                            ((uint32_t)capture_cur.width * capture_cur.height * CAPTURE_BYTES_PER_PIXEL) / 4U);
+}
+
+/**
+  * @brief  Capture_Stop
+  * @retval HAL status
+  */
+HAL_StatusTypeDef Capture_Stop(void)
+{
+  if (capture_buffer == NULL)
+  {
+    return HAL_OK;
+  }
+  capture_buffer = NULL;
+  return HAL_DCMI_Stop(capture_dcmi);
+}
+
+/**
+  * @brief  Capture_SetWindow
+  *         Selects the region of interest, applied by Capture_Process().
+  *         Interrupt safe.
+  * @param  x, y: top left corner in the sensor frame, even
+  * @param  width, height: window size, even
+  * @retval HAL_ERROR if the window does not fit the sensor frame
+  */
+HAL_StatusTypeDef Capture_SetWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  if ((((x | y | width | height) & 1U) != 0U) ||
+      (width < CAPTURE_MIN_WIDTH) || (height < CAPTURE_MIN_HEIGHT) ||
+      (((uint32_t)x + width) > CAPTURE_SENSOR_WIDTH) || (((uint32_t)y + height) > CAPTURE_SENSOR_HEIGHT))
+  {
+    return HAL_ERROR;
+  }
+  capture_next.x = x;
+  capture_next.y = y;
+  capture_next.width = width;
+  capture_next.height = height;
+  capture_pending = 1U;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Capture_SetBinning
+  *         Interrupt safe.
+  * @param  enable: 1 to bin the window 2x2
+  * @retval None
+  */
+void Capture_SetBinning(uint8_t enable)
+{
+  capture_next.binning = (enable != 0U) ? 1U : 0U;
+  capture_pending = 1U;
+}
+
+/**
+  * @brief  Capture_SetRate
+  *         Interrupt safe.
+  * @param  rate: CAPTURE_RATE_xxx
+  * @retval None
+  */
+void Capture_SetRate(uint8_t rate)
+{
+  if (rate <= CAPTURE_RATE_1_OF_4)
+  {
+    capture_next.rate = rate;
+    capture_pending = 1U;
+  }
+}
+
+/**
+  * @brief  Capture_SetThrottle
+  *         Drops to 1 of 4 frames while the scene is static, the rate
+  *         selected by Capture_SetRate() comes back when released.
+  * @param  enable: 1 to throttle
+  * @retval None
+  */
+void Capture_SetThrottle(uint8_t enable)
+{
+  enable = (enable != 0U) ? 1U : 0U;
+  if (capture_next.throttle != enable)
+  {
+    capture_next.throttle = enable;
+    capture_pending = 1U;
+  }
+}
+
+/**
+  * @brief  Capture_Process
+  *         Applies the pending settings. Main loop only.
+  * @retval None
+  */
+void Capture_Process(void)
+{
+  uint32_t primask;
+  uint8_t *buffer = capture_buffer;
+
+  if ((capture_pending == 0U) || (capture_dcmi == NULL))
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  capture_cur = capture_next;
+  capture_pending = 0U;
+  __set_PRIMASK(primask);
+
+  Capture_Stop();
+  Capture_Apply();
+  if (buffer != NULL)
+  {
+    Capture_Start(buffer);
+  }
+}
+
+/**
+  * @brief  Capture_GetOutputSize
+  *         Size of the frames handed to the encoder, after binning.
+  * @param  width, height: output size
+  * @retval None
+  */
+void Capture_GetOutputSize(uint16_t *width, uint16_t *height)
+{
+  *width = capture_cur.width >> capture_cur.binning;
+  *height = capture_cur.height >> capture_cur.binning;
+}
+
+/**
+  * @brief  Capture_Bin2x2
+  *         Averages every 2x2 block of an RGB565 image, per channel and
+  *         rounded. dst may be src.
+  * @param  src: width x height pixels
+  * @param  dst: width/2 x height/2 pixels
+  * @param  width, height: source size, even
+  * @retval None
+  */
+void Capture_Bin2x2(const uint16_t *src, uint16_t *dst, uint16_t width, uint16_t height)
+{
+  uint32_t row, col, r, g, b;
+  const uint16_t *p0, *p1;
+
+  for (row = 0U; row < height; row += 2U)
+  {
+    p0 = src + (row * width);
+    p1 = p0 + width;
+    for (col = 0U; col < width; col += 2U)
+    {
+      r = ((uint32_t)p0[0] >> 11) + ((uint32_t)p0[1] >> 11) + ((uint32_t)p1[0] >> 11) + ((uint32_t)p1[1] >> 11);
+      g = ((p0[0] >> 5) & 0x3FU) + ((p0[1] >> 5) & 0x3FU) + ((p1[0] >> 5) & 0x3FU) + ((p1[1] >> 5) & 0x3FU);
+      b = (p0[0] & 0x1FU) + (p0[1] & 0x1FU) + (p1[0] & 0x1FU) + (p1[1] & 0x1FU);
+      *dst++ = (uint16_t)((((r + 2U) >> 2) << 11) | (((g + 2U) >> 2) << 5) | ((b + 2U) >> 2));
+      p0 += 2;
+      p1 += 2;
+    }
+  }
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,360 @@
+/**
+  ******************************************************************************
+  * @file    clock.c
+  * @brief   System clock profiles: economy while no function streams, full
+  *          while one does, performance while the encoder claims it.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                 Clock profiles
+  *          ===================================================================
+  *           Clock_Process() picks the profile of the main loop:
+  *             - economy: no function streams, the bus dividers drop the
+  *               HCLK to 21 MHz,
+  *             - full: the SystemClock_Config() tree, 168 MHz,
+  *             - performance: a function streams and Clock_Claim() holds a
+  *               claim, 180 MHz with the regulator over-drive. A claim ends
+  *               with the last stream.
+  *           The OTG core needs its 48 MHz all along and an HCLK above
+  *           14.2 MHz. A profile on the same main PLL only changes the bus
+  *           dividers. A profile on another main PLL needs the 48 MHz from
+  *           PLLSAI (CLOCK_CK48_PLLSAI): the system clock moves to the HSI
+  *           at 16 MHz, the over-drive goes off, the PLL is relocked, the
+  *           over-drive comes back on if the profile needs it, then the
+  *           system clock returns to the PLL. Both run with interrupts
+  *           disabled, so no interrupt sees a half changed tree, and the
+  *           bus stays enumerated.
+  *           After a change the HAL tick (SysTick, or TIM6 and the
+  *           kernel tick with PIPELINE_USE_RTOS), the TIM2 prescaler and
+  *           the SDRAM refresh count follow the new clocks; the UART baud
+  *           rate and the I2C timing are set up again from
+  *           Clock_ChangedCallback(). The
+  *           refresh count, in SDCLK cycles, is programmed for the lowest
+  *           clock met before the change, so no row waits too long.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "clock.h"
+#include <stdio.h>
+#include "latency.h"
+#include "mem_region.h"
+#include "pipeline.h"
+
+/* Private define ------------------------------------------------------------*/
+
+/* Main PLL input: HSE 8 MHz / PLLM 4 */
+#define CLOCK_PLL_INPUT_HZ              2000000U
+
+/* Profiles ------------------------------------------------------------------*/
+static const Clock_ProfileTypeDef clock_profiles[CLOCK_PROFILE_NUM] =
+{
+  /* economy: the OTG core needs HCLK above 14.2 MHz, latency 0 up to 30 MHz */
+  { 168U, RCC_PLLP_DIV2, 0U, RCC_SYSCLK_DIV8, RCC_HCLK_DIV1, RCC_HCLK_DIV1, FLASH_LATENCY_0, "economy" },
+  /* full: same as SystemClock_Config() */
+  { 168U, RCC_PLLP_DIV2, 0U, RCC_SYSCLK_DIV1, RCC_HCLK_DIV4, RCC_HCLK_DIV2, FLASH_LATENCY_5, "full" },
+#if CLOCK_CK48_PLLSAI
+  { 180U, RCC_PLLP_DIV2, 1U, RCC_SYSCLK_DIV1, RCC_HCLK_DIV4, RCC_HCLK_DIV2, FLASH_LATENCY_5, "performance" },
+#else
+  { 168U, RCC_PLLP_DIV2, 0U, RCC_SYSCLK_DIV1, RCC_HCLK_DIV4, RCC_HCLK_DIV2, FLASH_LATENCY_5, "performance" },
+#endif
+};
+
+/* Private variables ---------------------------------------------------------*/
+static Clock_StatsTypeDef clock_stats;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Clock_Hclk(const Clock_ProfileTypeDef *p);
+static uint8_t Clock_SamePll(const Clock_ProfileTypeDef *a, const Clock_ProfileTypeDef *b);
+#if CLOCK_CK48_PLLSAI
+static void Clock_SetPll(const Clock_ProfileTypeDef *from, const Clock_ProfileTypeDef *to);
+#endif
+static void Clock_Set(uint8_t profile);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Clock_Hclk
+  * @param  p: profile
+  * @retval HCLK of the profile, Hz
+  */
+static uint32_t Clock_Hclk(const Clock_ProfileTypeDef *p)
+{
+  uint32_t sysclk = (CLOCK_PLL_INPUT_HZ * p->pll_n) / p->pll_p;
+
+  return sysclk >> AHBPrescTable[(p->ahb_div & RCC_CFGR_HPRE) >> RCC_CFGR_HPRE_Pos];
+}
+
+/**
+  * @brief  Clock_SamePll
+  * @retval 1 if both profiles run from the same main PLL setting
+  */
+static uint8_t Clock_SamePll(const Clock_ProfileTypeDef *a, const Clock_ProfileTypeDef *b)
+{
+  return ((a->pll_n == b->pll_n) && (a->pll_p == b->pll_p) && (a->overdrive == b->overdrive)) ? 1U : 0U;
+}
+
+#if CLOCK_CK48_PLLSAI
+/**
+  * @brief  Clock_SetPll
+  *         Relocks the main PLL from the HSI. The OTG core runs from PLLSAI
+  *         meanwhile. Interrupts disabled.
+  * @param  from: running profile
+  * @param  to: new profile
+  * @retval None
+  */
+static void Clock_SetPll(const Clock_ProfileTypeDef *from, const Clock_ProfileTypeDef *to)
+{
+  RCC_ClkInitTypeDef clk;
+
+  __HAL_RCC_HSI_ENABLE();
+  while (__HAL_RCC_GET_FLAG(RCC_FLAG_HSIRDY) == RESET)
+  {
+  }
+  clk.ClockType = RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+  clk.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
+  clk.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  clk.APB1CLKDivider = RCC_HCLK_DIV1;
+  clk.APB2CLKDivider = RCC_HCLK_DIV1;
+  HAL_RCC_ClockConfig(&clk, from->latency);
+
+  /* the over-drive only switches while the system clock is not the PLL */
+  if (from->overdrive != 0U)
+  {
+    HAL_PWREx_DisableOverDrive();
+  }
+  __HAL_RCC_PLL_DISABLE();
+  while (__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY) != RESET)
+  {
+  }
+  MODIFY_REG(RCC->PLLCFGR, RCC_PLLCFGR_PLLN | RCC_PLLCFGR_PLLP,
+             ((uint32_t)to->pll_n << RCC_PLLCFGR_PLLN_Pos) |
+             ((((uint32_t)to->pll_p >> 1U) - 1U) << RCC_PLLCFGR_PLLP_Pos));
+  __HAL_RCC_PLL_ENABLE();
+  while (__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY) == RESET)
+  {
+  }
+  if (to->overdrive != 0U)
+  {
+    HAL_PWREx_EnableOverDrive();
+  }
+
+  clk.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  clk.AHBCLKDivider = to->ahb_div;
+  clk.APB1CLKDivider = to->apb1_div;
+  clk.APB2CLKDivider = to->apb2_div;
+  HAL_RCC_ClockConfig(&clk, to->latency);
+}
+#endif
+
+/**
+  * @brief  Clock_Set
+  *         Changes the profile. Main loop only.
+  * @param  profile: CLOCK_PROFILE_xxx
+  * @retval None
+  */
+static void Clock_Set(uint8_t profile)
+{
+  const Clock_ProfileTypeDef *from = &clock_profiles[clock_stats.profile];
+  const Clock_ProfileTypeDef *to = &clock_profiles[profile];
+  RCC_ClkInitTypeDef clk;
+  uint32_t start = Latency_Now();
+  uint32_t lowest = Clock_Hclk(to);
+  uint32_t primask, time;
+
+  if ((Clock_SamePll(from, to) != 0U) && (from->ahb_div == to->ahb_div) &&
+      (from->apb1_div == to->apb1_div) && (from->apb2_div == to->apb2_div))
+  {
+    /* the performance profile of a part without PLLSAI 48 MHz */
+    clock_stats.profile = profile;
+    return;
+  }
+  if (Clock_SamePll(from, to) == 0U)
+  {
+    lowest = HSI_VALUE;
+  }
+  else if (SystemCoreClock < lowest)
+  {
+    lowest = SystemCoreClock;
+  }
+
+  /* no interrupt runs on a half changed clock tree */
+  primask = __get_PRIMASK();
+  __disable_irq();
+#if MEM_USE_SDRAM
+  MemRegion_SdramClock(lowest);
+#else
+  (void)lowest;
+#endif
+#if CLOCK_CK48_PLLSAI
+  if (Clock_SamePll(from, to) == 0U)
+  {
+    Clock_SetPll(from, to);
+    clock_stats.pll_switches++;
+  }
+  else
+#endif
+  {
+    clk.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+    clk.AHBCLKDivider = to->ahb_div;
+    clk.APB1CLKDivider = to->apb1_div;
+    clk.APB2CLKDivider = to->apb2_div;
+    HAL_RCC_ClockConfig(&clk, to->latency);
+  }
+#if PIPELINE_USE_RTOS
+  SysTick->LOAD = (SystemCoreClock / osKernelGetTickFreq()) - 1U;
+  SysTick->VAL = 0U;
+#endif
+  Latency_ClockUpdate();
+#if MEM_USE_SDRAM
+  MemRegion_SdramClock(SystemCoreClock);
+#endif
+  __set_PRIMASK(primask);
+
+  time = Latency_Now() - start;
+  if (time > clock_stats.switch_max_us)
+  {
+    clock_stats.switch_max_us = time;
+  }
+  if ((clock_stats.profile == CLOCK_PROFILE_ECONOMY) && (time > clock_stats.restore_max_us))
+  {
+    clock_stats.restore_max_us = time;
+  }
+  clock_stats.profile = profile;
+  clock_stats.switches++;
+  Clock_ChangedCallback(profile);
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Clock_Init
+  *         After SystemClock_Config(), before MX_USB_DEVICE_Init(): with
+  *         CLOCK_CK48_PLLSAI the 48 MHz moves to PLLSAI while the OTG core
+  *         is still off.
+  * @retval None
+  */
+void Clock_Init(void)
+{
+#if CLOCK_CK48_PLLSAI
+  RCC_PeriphCLKInitTypeDef periph = {0};
+
+  periph.PeriphClockSelection = RCC_PERIPHCLK_CLK48;
+  periph.PLLSAI.PLLSAIN = CLOCK_PLLSAI_N;
+  periph.PLLSAI.PLLSAIP = CLOCK_PLLSAI_P;
+  periph.PLLSAI.PLLSAIQ = 4U;
+  periph.PLLSAI.PLLSAIR = 2U;
+  periph.Clk48ClockSelection = RCC_CLK48CLKSOURCE_PLLSAIP;
+  if (HAL_RCCEx_PeriphCLKConfig(&periph) != HAL_OK)
+  {
+    Error_Handler();
+  }
+#endif
+  clock_stats.profile = CLOCK_PROFILE_FULL;
+}
+
+/**
+  * @brief  Clock_Process
+  *         Picks the profile. Main loop only.
+  * @param  streaming: functions with alternate setting 1, one bit each
+  * @retval None
+  */
+void Clock_Process(uint8_t streaming)
+{
+  uint8_t profile = CLOCK_PROFILE_ECONOMY;
+
+  if (streaming != 0U)
+  {
+    profile = (clock_stats.claims != 0U) ? CLOCK_PROFILE_PERFORMANCE : CLOCK_PROFILE_FULL;
+  }
+  else
+  {
+    Clock_Claim(0xFFU, 0U);
+  }
+  if (profile != clock_stats.profile)
+  {
+    Clock_Set(profile);
+  }
+}
+
+/**
+  * @brief  Clock_Claim
+  *         Asks for the performance profile, granted while a function
+  *         streams. Interrupt and task safe.
+  * @param  claim: CLOCK_CLAIM_xxx
+  * @param  on: 1 to claim, 0 to give the claim back
+  * @retval None
+  */
+void Clock_Claim(uint8_t claim, uint8_t on)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (on != 0U)
+  {
+    clock_stats.claims |= claim;
+  }
+  else
+  {
+    clock_stats.claims &= (uint8_t)~claim;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Clock_GetProfile
+  * @retval CLOCK_PROFILE_xxx
+  */
+uint8_t Clock_GetProfile(void)
+{
+  return clock_stats.profile;
+}
+
+/**
+  * @brief  Clock_GetStats
+  * @param  stats: copy of the counters
+  * @retval None
+  */
+void Clock_GetStats(Clock_StatsTypeDef *stats)
+{
+  *stats = clock_stats;
+}
+
+/**
+  * @brief  Clock_Report
+  *         Prints the profile and the cost of the changes.
+  * @retval None
+  */
+void Clock_Report(void)
+{
+  printf("Clock: %s %lu MHz, %lu switches (%lu PLL), switch max %lu us, restore max %lu us, claims %02X\r\n",
+         clock_profiles[clock_stats.profile].name, (unsigned long)(SystemCoreClock / 1000000U),
+         (unsigned long)clock_stats.switches, (unsigned long)clock_stats.pll_switches,
+         (unsigned long)clock_stats.switch_max_us, (unsigned long)clock_stats.restore_max_us,
+         (unsigned int)clock_stats.claims);
+}
+
+/**
+  * @brief  Clock_ChangedCallback
+  *         The bus clocks changed, peripherals timed from them are set up
+  *         again. Main loop.
+  * @param  profile: CLOCK_PROFILE_xxx
+  * @retval None
+  */
+__weak void Clock_ChangedCallback(uint8_t profile)
+{
+  UNUSED(profile);
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,319 @@
+/**
+  ******************************************************************************
+  * @file    codec_tables.c
+  * @brief   Precomputed tables of the JPEG baseline coder and of the frame
+  *          CRC, in flash.
+  *
+  * @verbatim
+  *
+  *          Generated by Utilities/codec_tables/codec_tables_gen.c, do not
+  *          edit: change the generator, then
+  *            codec_tables_gen > Src/codec_tables.c
+  *            codec_tables_gen -c
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "codec_tables.h"
+
+/*
+ * Zigzag scan: position k of the scan -> index of the coefficient in
+ * the natural (row major) order of the block.
+ * <pre>for (s = 0; s < 15; s++)  anti-diagonal row + col == s
+ *   walked up and right when s is even, down and left when s is odd</pre>
+ */
+const uint8_t codecZigzagTable[64] =
+{
+    0,   1,   8,  16,   9,   2,   3,  10,
+   17,  24,  32,  25,  18,  11,   4,   5,
+   12,  19,  26,  33,  40,  48,  41,  34,
+   27,  20,  13,   6,   7,  14,  21,  28,
+   35,  42,  49,  56,  57,  50,  43,  36,
+   29,  22,  15,  23,  30,  37,  44,  51,
+   58,  59,  52,  45,  38,  31,  39,  46,
+   53,  60,  61,  54,  47,  55,  62,  63
+};
+
+/*
+ * Quantization tables of ITU T.81 Annex K.1, natural order, and their
+ * Q16 reciprocals: (c * recip[i]) >> 16 is c / quant[i].
+ * <pre>recip[i] = (65536 + quant[i] / 2) / quant[i]</pre>
+ */
+const uint8_t codecQuantLumaTable[64] =
+{
+   16,  11,  10,  16,  24,  40,  51,  61,
+   12,  12,  14,  19,  26,  58,  60,  55,
+   14,  13,  16,  24,  40,  57,  69,  56,
+   14,  17,  22,  29,  51,  87,  80,  62,
+   18,  22,  37,  56,  68, 109, 103,  77,
+   24,  35,  55,  64,  81, 104, 113,  92,
+   49,  64,  78,  87, 103, 121, 120, 101,
+   72,  92,  95,  98, 112, 100, 103,  99
+};
+
+const uint8_t codecQuantChromaTable[64] =
+{
+   17,  18,  24,  47,  99,  99,  99,  99,
+   18,  21,  26,  66,  99,  99,  99,  99,
+   24,  26,  56,  99,  99,  99,  99,  99,
+   47,  66,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99
+};
+
+const uint16_t codecQuantRecipLumaTable[64] =
+{
+   4096,  5958,  6554,  4096,  2731,  1638,  1285,  1074,
+   5461,  5461,  4681,  3449,  2521,  1130,  1092,  1192,
+   4681,  5041,  4096,  2731,  1638,  1150,   950,  1170,
+   4681,  3855,  2979,  2260,  1285,   753,   819,  1057,
+   3641,  2979,  1771,  1170,   964,   601,   636,   851,
+   2731,  1872,  1192,  1024,   809,   630,   580,   712,
+   1337,  1024,   840,   753,   636,   542,   546,   649,
+    910,   712,   690,   669,   585,   655,   636,   662
+};
+
+const uint16_t codecQuantRecipChromaTable[64] =
+{
+   3855,  3641,  2731,  1394,   662,   662,   662,   662,
+   3641,  3121,  2521,   993,   662,   662,   662,   662,
+   2731,  2521,  1170,   662,   662,   662,   662,   662,
+   1394,   993,   662,   662,   662,   662,   662,   662,
+    662,   662,   662,   662,   662,   662,   662,   662,
+    662,   662,   662,   662,   662,   662,   662,   662,
+    662,   662,   662,   662,   662,   662,   662,   662,
+    662,   662,   662,   662,   662,   662,   662,   662
+};
+
+/*
+ * Huffman tables of ITU T.81 Annex K.3, as written to the DHT segment:
+ * BITS, the number of codes of each length 1 to 16, and HUFFVAL.
+ */
+const uint8_t codecHuffDcLumaBits[16] =
+{
+    0,   1,   5,   1,   1,   1,   1,   1,   1,   0,   0,   0,   0,   0,   0,   0
+};
+
+const uint8_t codecHuffDcChromaBits[16] =
+{
+    0,   3,   1,   1,   1,   1,   1,   1,   1,   1,   1,   0,   0,   0,   0,   0
+};
+
+const uint8_t codecHuffDcVals[12] =
+{
+    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11
+};
+
+const uint8_t codecHuffAcLumaBits[16] =
+{
+    0,   2,   1,   3,   3,   2,   4,   3,   5,   5,   4,   4,   0,   0,   1, 125
+};
+
+const uint8_t codecHuffAcLumaVals[162] =
+{
+  0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+  0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0,
+  0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+  0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+  0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7,
+  0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5,
+  0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2,
+  0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+  0xF9, 0xFA
+};
+
+const uint8_t codecHuffAcChromaBits[16] =
+{
+    0,   2,   1,   2,   4,   4,   3,   4,   7,   5,   4,   4,   0,   1,   2, 119
+};
+
+const uint8_t codecHuffAcChromaVals[162] =
+{
+  0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+  0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0,
+  0x15, 0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+  0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+  0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+  0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5,
+  0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3,
+  0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA,
+  0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+  0xF9, 0xFA
+};
+
+/*
+ * Huffman code of each symbol: CODEC_HUFF_ENTRY(code, length), 0 for a
+ * symbol without code. DC symbols are the sizes 0 to 11, AC symbols the
+ * run/size bytes.
+ * <pre>code = 0
+ * for (len = 1; len <= 16; len++, code <<= 1)
+ *   for (n = 0; n < BITS[len - 1]; n++)
+ *     table[HUFFVAL[k++]] = CODEC_HUFF_ENTRY(code++, len)</pre>
+ */
+const uint32_t codecHuffDcLumaTable[CODEC_HUFF_DC_SYMBOLS] =
+{
+  0x00020000, 0x00030002, 0x00030003, 0x00030004, 0x00030005, 0x00030006, 0x0004000E, 0x0005001E,
+  0x0006003E, 0x0007007E, 0x000800FE, 0x000901FE
+};
+
+const uint32_t codecHuffDcChromaTable[CODEC_HUFF_DC_SYMBOLS] =
+{
+  0x00020000, 0x00020001, 0x00020002, 0x00030006, 0x0004000E, 0x0005001E, 0x0006003E, 0x0007007E,
+  0x000800FE, 0x000901FE, 0x000A03FE, 0x000B07FE
+};
+
+const uint32_t codecHuffAcLumaTable[CODEC_HUFF_AC_SYMBOLS] =
+{
+  0x0004000A, 0x00020000, 0x00020001, 0x00030004, 0x0004000B, 0x0005001A, 0x00070078, 0x000800F8,
+  0x000A03F6, 0x0010FF82, 0x0010FF83, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0004000C, 0x0005001B, 0x00070079, 0x000901F6, 0x000B07F6, 0x0010FF84, 0x0010FF85,
+  0x0010FF86, 0x0010FF87, 0x0010FF88, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0005001C, 0x000800F9, 0x000A03F7, 0x000C0FF4, 0x0010FF89, 0x0010FF8A, 0x0010FF8B,
+  0x0010FF8C, 0x0010FF8D, 0x0010FF8E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0006003A, 0x000901F7, 0x000C0FF5, 0x0010FF8F, 0x0010FF90, 0x0010FF91, 0x0010FF92,
+  0x0010FF93, 0x0010FF94, 0x0010FF95, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0006003B, 0x000A03F8, 0x0010FF96, 0x0010FF97, 0x0010FF98, 0x0010FF99, 0x0010FF9A,
+  0x0010FF9B, 0x0010FF9C, 0x0010FF9D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0007007A, 0x000B07F7, 0x0010FF9E, 0x0010FF9F, 0x0010FFA0, 0x0010FFA1, 0x0010FFA2,
+  0x0010FFA3, 0x0010FFA4, 0x0010FFA5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0007007B, 0x000C0FF6, 0x0010FFA6, 0x0010FFA7, 0x0010FFA8, 0x0010FFA9, 0x0010FFAA,
+  0x0010FFAB, 0x0010FFAC, 0x0010FFAD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000800FA, 0x000C0FF7, 0x0010FFAE, 0x0010FFAF, 0x0010FFB0, 0x0010FFB1, 0x0010FFB2,
+  0x0010FFB3, 0x0010FFB4, 0x0010FFB5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000901F8, 0x000F7FC0, 0x0010FFB6, 0x0010FFB7, 0x0010FFB8, 0x0010FFB9, 0x0010FFBA,
+  0x0010FFBB, 0x0010FFBC, 0x0010FFBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000901F9, 0x0010FFBE, 0x0010FFBF, 0x0010FFC0, 0x0010FFC1, 0x0010FFC2, 0x0010FFC3,
+  0x0010FFC4, 0x0010FFC5, 0x0010FFC6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000901FA, 0x0010FFC7, 0x0010FFC8, 0x0010FFC9, 0x0010FFCA, 0x0010FFCB, 0x0010FFCC,
+  0x0010FFCD, 0x0010FFCE, 0x0010FFCF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000A03F9, 0x0010FFD0, 0x0010FFD1, 0x0010FFD2, 0x0010FFD3, 0x0010FFD4, 0x0010FFD5,
+  0x0010FFD6, 0x0010FFD7, 0x0010FFD8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000A03FA, 0x0010FFD9, 0x0010FFDA, 0x0010FFDB, 0x0010FFDC, 0x0010FFDD, 0x0010FFDE,
+  0x0010FFDF, 0x0010FFE0, 0x0010FFE1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000B07F8, 0x0010FFE2, 0x0010FFE3, 0x0010FFE4, 0x0010FFE5, 0x0010FFE6, 0x0010FFE7,
+  0x0010FFE8, 0x0010FFE9, 0x0010FFEA, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0010FFEB, 0x0010FFEC, 0x0010FFED, 0x0010FFEE, 0x0010FFEF, 0x0010FFF0, 0x0010FFF1,
+  0x0010FFF2, 0x0010FFF3, 0x0010FFF4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x000B07F9, 0x0010FFF5, 0x0010FFF6, 0x0010FFF7, 0x0010FFF8, 0x0010FFF9, 0x0010FFFA, 0x0010FFFB,
+  0x0010FFFC, 0x0010FFFD, 0x0010FFFE, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+
+const uint32_t codecHuffAcChromaTable[CODEC_HUFF_AC_SYMBOLS] =
+{
+  0x00020000, 0x00020001, 0x00030004, 0x0004000A, 0x00050018, 0x00050019, 0x00060038, 0x00070078,
+  0x000901F4, 0x000A03F6, 0x000C0FF4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0004000B, 0x00060039, 0x000800F6, 0x000901F5, 0x000B07F6, 0x000C0FF5, 0x0010FF88,
+  0x0010FF89, 0x0010FF8A, 0x0010FF8B, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0005001A, 0x000800F7, 0x000A03F7, 0x000C0FF6, 0x000F7FC2, 0x0010FF8C, 0x0010FF8D,
+  0x0010FF8E, 0x0010FF8F, 0x0010FF90, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0005001B, 0x000800F8, 0x000A03F8, 0x000C0FF7, 0x0010FF91, 0x0010FF92, 0x0010FF93,
+  0x0010FF94, 0x0010FF95, 0x0010FF96, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0006003A, 0x000901F6, 0x0010FF97, 0x0010FF98, 0x0010FF99, 0x0010FF9A, 0x0010FF9B,
+  0x0010FF9C, 0x0010FF9D, 0x0010FF9E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0006003B, 0x000A03F9, 0x0010FF9F, 0x0010FFA0, 0x0010FFA1, 0x0010FFA2, 0x0010FFA3,
+  0x0010FFA4, 0x0010FFA5, 0x0010FFA6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00070079, 0x000B07F7, 0x0010FFA7, 0x0010FFA8, 0x0010FFA9, 0x0010FFAA, 0x0010FFAB,
+  0x0010FFAC, 0x0010FFAD, 0x0010FFAE, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0007007A, 0x000B07F8, 0x0010FFAF, 0x0010FFB0, 0x0010FFB1, 0x0010FFB2, 0x0010FFB3,
+  0x0010FFB4, 0x0010FFB5, 0x0010FFB6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000800F9, 0x0010FFB7, 0x0010FFB8, 0x0010FFB9, 0x0010FFBA, 0x0010FFBB, 0x0010FFBC,
+  0x0010FFBD, 0x0010FFBE, 0x0010FFBF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000901F7, 0x0010FFC0, 0x0010FFC1, 0x0010FFC2, 0x0010FFC3, 0x0010FFC4, 0x0010FFC5,
+  0x0010FFC6, 0x0010FFC7, 0x0010FFC8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000901F8, 0x0010FFC9, 0x0010FFCA, 0x0010FFCB, 0x0010FFCC, 0x0010FFCD, 0x0010FFCE,
+  0x0010FFCF, 0x0010FFD0, 0x0010FFD1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000901F9, 0x0010FFD2, 0x0010FFD3, 0x0010FFD4, 0x0010FFD5, 0x0010FFD6, 0x0010FFD7,
+  0x0010FFD8, 0x0010FFD9, 0x0010FFDA, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000901FA, 0x0010FFDB, 0x0010FFDC, 0x0010FFDD, 0x0010FFDE, 0x0010FFDF, 0x0010FFE0,
+  0x0010FFE1, 0x0010FFE2, 0x0010FFE3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000B07F9, 0x0010FFE4, 0x0010FFE5, 0x0010FFE6, 0x0010FFE7, 0x0010FFE8, 0x0010FFE9,
+  0x0010FFEA, 0x0010FFEB, 0x0010FFEC, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x000E3FE0, 0x0010FFED, 0x0010FFEE, 0x0010FFEF, 0x0010FFF0, 0x0010FFF1, 0x0010FFF2,
+  0x0010FFF3, 0x0010FFF4, 0x0010FFF5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x000A03FA, 0x000F7FC3, 0x0010FFF6, 0x0010FFF7, 0x0010FFF8, 0x0010FFF9, 0x0010FFFA, 0x0010FFFB,
+  0x0010FFFC, 0x0010FFFD, 0x0010FFFE, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+
+/*
+ * CRC of the polynomial CODEC_CRC_POLY, MSB first like the STM32 CRC unit.
+ * <pre>c = i << 24
+ * repeat 8 times: c = (c & 0x80000000) ? (c << 1) ^ CODEC_CRC_POLY : c << 1</pre>
+ */
+const uint32_t codecCrcTable[256] =
+{
+  0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+  0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+  0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9, 0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75,
+  0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011, 0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
+  0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039, 0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5,
+  0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81, 0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
+  0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49, 0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95,
+  0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1, 0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
+  0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE, 0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072,
+  0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16, 0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
+  0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE, 0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02,
+  0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066, 0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
+  0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E, 0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692,
+  0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6, 0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
+  0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E, 0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2,
+  0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686, 0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
+  0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637, 0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB,
+  0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F, 0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53,
+  0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47, 0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B,
+  0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF, 0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
+  0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7, 0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B,
+  0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F, 0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
+  0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7, 0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B,
+  0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F, 0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3,
+  0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640, 0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C,
+  0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8, 0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
+  0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30, 0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC,
+  0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088, 0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
+  0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0, 0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C,
+  0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18, 0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4,
+  0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C,
+  0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4
+};
+
+/*
+ * Index of the CRC table entry with a given low byte. A step of the CRC
+ * over a zero byte, c' = (c << 8) ^ T[c >> 24], is undone by
+ * <pre>i = codecCrcInverseTable[c' & 0xFF]
+ * c = ((c' ^ T[i]) >> 8) | (i << 24)</pre>
+ */
+const uint8_t codecCrcInverseTable[256] =
+{
+    0, 169,  87, 254, 174,   7, 249,  80,  89, 240,  14, 167, 247,  94, 160,   9,
+  178,  27, 229,  76,  28, 181,  75, 226, 235,  66, 188,  21,  69, 236,  18, 187,
+   97, 200,  54, 159, 207, 102, 152,  49,  56, 145, 111, 198, 150,  63, 193, 104,
+  211, 122, 132,  45, 125, 212,  42, 131, 138,  35, 221, 116,  36, 141, 115, 218,
+  195, 106, 148,  61, 109, 196,  58, 147, 154,  51, 205, 100,  52, 157,  99, 202,
+  113, 216,  38, 143, 223, 118, 136,  33,  40, 129, 127, 214, 134,  47, 209, 120,
+  162,  11, 245,  92,  12, 165,  91, 242, 251,  82, 172,   5,  85, 252,   2, 171,
+   16, 185,  71, 238, 190,  23, 233,  64,  73, 224,  30, 183, 231,  78, 176,  25,
+  130,  43, 213, 124,  44, 133, 123, 210, 219, 114, 140,  37, 117, 220,  34, 139,
+   48, 153, 103, 206, 158,  55, 201,  96, 105, 192,  62, 151, 199, 110, 144,  57,
+  227,  74, 180,  29,  77, 228,  26, 179, 186,  19, 237,  68,  20, 189,  67, 234,
+   81, 248,   6, 175, 255,  86, 168,   1,   8, 161,  95, 246, 166,  15, 241,  88,
+   65, 232,  22, 191, 239,  70, 184,  17,  24, 177,  79, 230, 182,  31, 225,  72,
+  243,  90, 164,  13,  93, 244,  10, 163, 170,   3, 253,  84,   4, 173,  83, 250,
+   32, 137, 119, 222, 142,  39, 217, 112, 121, 208,  46, 135, 215, 126, 128,  41,
+  146,  59, 197, 108,  60, 149, 107, 194, 203,  98, 156,  53, 101, 204,  50, 155
+};
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
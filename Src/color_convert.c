@@ -0,0 +1,476 @@
+/**
+  ******************************************************************************
+  * @file    color_convert.c
+  * @brief   Color space conversion kernels for the encoder front end.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Color conversion
+  *          ===================================================================
+  *           Full range BT.601 (JFIF) YCbCr, 8-bit fixed point:
+  *             Y  = (  77 R + 150 G +  29 B + 128) >> 8
+  *             Cb = ( -43 R -  84 G + 127 B + 128) >> 8) + 128
+  *             Cr = ( 127 R - 106 G -  21 B + 128) >> 8) + 128
+  *           The chroma coefficients sum to 0 and stay within 127 so no
+  *           clamping is needed; >> is an arithmetic shift.
+  *           4:2:0 chroma is computed from the rounded mean of the 2x2 RGB
+  *           block (RGB565) or the truncated mean of the two lines (YUYV, as
+  *           UHADD8 does). RGB565 channels are expanded to 8 bits by copying
+  *           their MSBs into the LSBs.
+  *           The SIMD kernels work on two 16-bit lanes per register and fall
+  *           back to the reference when the source is not word aligned.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "color_convert.h"
+#if COLOR_USE_SIMD
+#include "stm32f4xx.h"
+#endif
+#ifdef COLOR_BENCHMARK
+#include <stdio.h>
+#include <string.h>
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define COLOR_Y_R                       77
+#define COLOR_Y_G                       150
+#define COLOR_Y_B                       29
+#define COLOR_CB_R                      (-43)
+#define COLOR_CB_G                      (-84)
+#define COLOR_CB_B                      127
+#define COLOR_CR_R                      127
+#define COLOR_CR_G                      (-106)
+#define COLOR_CR_B                      (-21)
+
+/* Private macro -------------------------------------------------------------*/
+#define COLOR_Y(r, g, b)                ((uint8_t)(((COLOR_Y_R * (int32_t)(r)) + (COLOR_Y_G * (int32_t)(g)) + \
+                                                    (COLOR_Y_B * (int32_t)(b)) + 128) >> 8))
+#define COLOR_CB(r, g, b)               ((uint8_t)((((COLOR_CB_R * (int32_t)(r)) + (COLOR_CB_G * (int32_t)(g)) + \
+                                                     (COLOR_CB_B * (int32_t)(b)) + 128) >> 8) + 128))
+#define COLOR_CR(r, g, b)               ((uint8_t)((((COLOR_CR_R * (int32_t)(r)) + (COLOR_CR_G * (int32_t)(g)) + \
+                                                     (COLOR_CR_B * (int32_t)(b)) + 128) >> 8) + 128))
+
+/* Two signed 16-bit coefficients in one register, lo in the bottom lane */
+#define COLOR_PACK(lo, hi)              (((uint32_t)(uint16_t)(int16_t)(lo)) | \
+                                         ((uint32_t)(uint16_t)(int16_t)(hi) << 16))
+
+/* Private function prototypes -----------------------------------------------*/
+static void Color_Rgb565Expand(uint32_t c, uint32_t *r, uint32_t *g, uint32_t *b);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Color_Rgb565Expand
+  *         Splits RGB565 pixels into 8-bit channels. Works on one pixel or on
+  *         two pixels packed in the two lanes of c.
+  * @param  c: pixel(s)
+  * @param  r, g, b: channels, same lanes as c
+  * @retval None
+  */
+static void Color_Rgb565Expand(uint32_t c, uint32_t *r, uint32_t *g, uint32_t *b)
+{
+  uint32_t v;
+
+  v = (c >> 11) & 0x001F001FUL;
+  *r = (v << 3) | ((v >> 2) & 0x00070007UL);
+  v = (c >> 5) & 0x003F003FUL;
+  *g = (v << 2) | ((v >> 4) & 0x00030003UL);
+  v = c & 0x001F001FUL;
+  *b = (v << 3) | ((v >> 2) & 0x00070007UL);
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Color_Rgb565ToYCbCr420_Ref
+  *         RGB565 to planar YCbCr 4:2:0, scalar reference.
+  * @param  src: first pixel
+  * @param  pitch: pixels from one source line to the next
+  * @param  width, height: image size, even
+  * @param  y, cb, cr: output planes
+  * @retval None
+  */
+void Color_Rgb565ToYCbCr420_Ref(const uint16_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                                uint8_t *y, uint8_t *cb, uint8_t *cr)
+{
+  uint32_t row, col, i, r, g, b, sr, sg, sb;
+  const uint16_t *p;
+  uint8_t *py;
+
+  for (row = 0U; row < height; row += 2U)
+  {
+    for (col = 0U; col < width; col += 2U)
+    {
+      sr = sg = sb = 0U;
+      for (i = 0U; i < 4U; i++)
+      {
+        p = src + ((row + (i >> 1)) * pitch) + col + (i & 1U);
+        py = y + ((row + (i >> 1)) * width) + col + (i & 1U);
+        Color_Rgb565Expand(*p, &r, &g, &b);
+        *py = COLOR_Y(r, g, b);
+        sr += r;
+        sg += g;
+        sb += b;
+      }
+      sr = (sr + 2U) >> 2;
+      sg = (sg + 2U) >> 2;
+      sb = (sb + 2U) >> 2;
+      *cb++ = COLOR_CB(sr, sg, sb);
+      *cr++ = COLOR_CR(sr, sg, sb);
+    }
+  }
+}
+
+/**
+  * @brief  Color_YuyvToYCbCr420_Ref
+  *         YUYV (YUV 4:2:2 interleaved) to planar YCbCr 4:2:0, scalar reference.
+  * @param  src: first pixel
+  * @param  pitch: pixels from one source line to the next
+  * @param  width, height: image size, even
+  * @param  y, cb, cr: output planes
+  * @retval None
+  */
+void Color_YuyvToYCbCr420_Ref(const uint8_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                              uint8_t *y, uint8_t *cb, uint8_t *cr)
+{
+  uint32_t row, col;
+  const uint8_t *p0, *p1;
+
+  for (row = 0U; row < height; row += 2U)
+  {
+    p0 = src + (row * pitch * 2U);
+    p1 = p0 + (pitch * 2U);
+    for (col = 0U; col < width; col += 2U)
+    {
+      y[(row * width) + col] = p0[0];
+      y[(row * width) + col + 1U] = p0[2];
+      y[((row + 1U) * width) + col] = p1[0];
+      y[((row + 1U) * width) + col + 1U] = p1[2];
+      *cb++ = (uint8_t)(((uint32_t)p0[1] + p1[1]) >> 1);
+      *cr++ = (uint8_t)(((uint32_t)p0[3] + p1[3]) >> 1);
+      p0 += 4;
+      p1 += 4;
+    }
+  }
+}
+
+/**
+  * @brief  Color_Rgb888ToY_Ref
+  *         RGB888 (bytes B, G, R) to luma, scalar reference.
+  * @param  src: first pixel
+  * @param  pitch: pixels from one source line to the next
+  * @param  width, height: image size
+  * @param  y: output plane
+  * @retval None
+  */
+void Color_Rgb888ToY_Ref(const uint8_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                         uint8_t *y)
+{
+  uint32_t row, col;
+  const uint8_t *p;
+
+  for (row = 0U; row < height; row++)
+  {
+    p = src + (row * pitch * 3U);
+    for (col = 0U; col < width; col++)
+    {
+      *y++ = COLOR_Y(p[2], p[1], p[0]);
+      p += 3;
+    }
+  }
+}
+
+#if COLOR_USE_SIMD
+/**
+  * @brief  Color_Rgb565ToYCbCr420
+  *         RGB565 to planar YCbCr 4:2:0, two pixels per register.
+  * @param  src: first pixel
+  * @param  pitch: pixels from one source line to the next
+  * @param  width, height: image size, even
+  * @param  y, cb, cr: output planes
+  * @retval None
+  */
+void Color_Rgb565ToYCbCr420(const uint16_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                            uint8_t *y, uint8_t *cb, uint8_t *cr)
+{
+  uint32_t row, col, i, c, r, g, b, sr, sg, sb;
+  const uint32_t *p[2];
+  uint8_t *py[2];
+
+  if ((((uint32_t)src & 3U) != 0U) || ((pitch & 1U) != 0U))
+  {
+    Color_Rgb565ToYCbCr420_Ref(src, pitch, width, height, y, cb, cr);
+    return;
+  }
+
+  for (row = 0U; row < height; row += 2U)
+  {
+    p[0] = (const uint32_t *)(src + (row * pitch));
+    p[1] = (const uint32_t *)(src + ((row + 1U) * pitch));
+    py[0] = y + (row * width);
+    py[1] = py[0] + width;
+    for (col = 0U; col < width; col += 2U)
+    {
+      sr = sg = sb = 0U;
+      for (i = 0U; i < 2U; i++)
+      {
+        c = *p[i]++;
+        Color_Rgb565Expand(c, &r, &g, &b);
+        /* R|G of each pixel against 77|150, B and rounding in the accumulator */
+        *py[i]++ = (uint8_t)(__SMLAD(__PKHBT(r, g, 16), COLOR_PACK(COLOR_Y_R, COLOR_Y_G),
+                                     (COLOR_Y_B * (b & 0xFFFFU)) + 128U) >> 8);
+        *py[i]++ = (uint8_t)(__SMLAD(__PKHTB(g, r, 16), COLOR_PACK(COLOR_Y_R, COLOR_Y_G),
+                                     (COLOR_Y_B * (b >> 16)) + 128U) >> 8);
+        sr += r;
+        sg += g;
+        sb += b;
+      }
+      /* Lanes hold the vertical sums, add them horizontally */
+      sr = (__SMUAD(sr, 0x00010001UL) + 2U) >> 2;
+      sg = (__SMUAD(sg, 0x00010001UL) + 2U) >> 2;
+      sb = (__SMUAD(sb, 0x00010001UL) + 2U) >> 2;
+      c = __PKHBT(sr, sg, 16);
+      *cb++ = (uint8_t)(((int32_t)__SMLAD(c, COLOR_PACK(COLOR_CB_R, COLOR_CB_G),
+                                          (COLOR_CB_B * sb) + 128U) >> 8) + 128);
+      *cr++ = (uint8_t)(((int32_t)__SMLAD(c, COLOR_PACK(COLOR_CR_R, COLOR_CR_G),
+                                          (uint32_t)(COLOR_CR_B * (int32_t)sb) + 128U) >> 8) + 128);
+    }
+  }
+}
+
+/**
+  * @brief  Color_YuyvToYCbCr420
+  *         YUYV to planar YCbCr 4:2:0, one Y0 U Y1 V word per line and step.
+  * @param  src: first pixel
+  * @param  pitch: pixels from one source line to the next
+  * @param  width, height: image size, even
+  * @param  y, cb, cr: output planes
+  * @retval None
+  */
+void Color_YuyvToYCbCr420(const uint8_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                          uint8_t *y, uint8_t *cb, uint8_t *cr)
+{
+  uint32_t row, col, w0, w1, uv;
+  const uint32_t *p0, *p1;
+  uint8_t *py0, *py1;
+
+  if ((((uint32_t)src & 3U) != 0U) || ((pitch & 1U) != 0U))
+  {
+    Color_YuyvToYCbCr420_Ref(src, pitch, width, height, y, cb, cr);
+    return;
+  }
+
+  for (row = 0U; row < height; row += 2U)
+  {
+    p0 = (const uint32_t *)(src + (row * pitch * 2U));
+    p1 = (const uint32_t *)(src + ((row + 1U) * pitch * 2U));
+    py0 = y + (row * width);
+    py1 = py0 + width;
+    for (col = 0U; col < width; col += 2U)
+    {
+      w0 = *p0++;
+      w1 = *p1++;
+      uv = __UXTB16(w0);
+      *py0++ = (uint8_t)uv;
+      *py0++ = (uint8_t)(uv >> 16);
+      uv = __UXTB16(w1);
+      *py1++ = (uint8_t)uv;
+      *py1++ = (uint8_t)(uv >> 16);
+      /* Per byte (a + b) >> 1 of both lines, then U and V into the lanes */
+      uv = __UXTB16(__ROR(__UHADD8(w0, w1), 8));
+      *cb++ = (uint8_t)uv;
+      *cr++ = (uint8_t)(uv >> 16);
+    }
+  }
+}
+
+/**
+  * @brief  Color_Rgb888ToY
+  *         RGB888 to luma, four pixels (three words) per step.
+  * @param  src: first pixel
+  * @param  pitch: pixels from one source line to the next
+  * @param  width, height: image size
+  * @param  y: output plane
+  * @retval None
+  */
+void Color_Rgb888ToY(const uint8_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                     uint8_t *y)
+{
+  uint32_t row, col, w0, w1, w2, a, b, c, d;
+  const uint32_t *p;
+  const uint8_t *t;
+
+  if ((((uint32_t)src & 3U) != 0U) || ((pitch & 3U) != 0U))
+  {
+    Color_Rgb888ToY_Ref(src, pitch, width, height, y);
+    return;
+  }
+
+  for (row = 0U; row < height; row++)
+  {
+    p = (const uint32_t *)(src + (row * pitch * 3U));
+    for (col = 0U; (col + 4U) <= width; col += 4U)
+    {
+      /* w0 = B0 G0 R0 B1, w1 = G1 R1 B2 G2, w2 = R2 B3 G3 R3 */
+      w0 = *p++;
+      w1 = *p++;
+      w2 = *p++;
+      a = __UXTB16(w0);                 /* B0 | R0 */
+      b = __UXTB16(__ROR(w0, 8));       /* G0 | B1 */
+      c = __UXTB16(w1);                 /* G1 | B2 */
+      d = __UXTB16(__ROR(w1, 8));       /* R1 | G2 */
+      *y++ = (uint8_t)(__SMLAD(a, COLOR_PACK(COLOR_Y_B, COLOR_Y_R),
+                               (COLOR_Y_G * (b & 0xFFFFU)) + 128U) >> 8);
+      *y++ = (uint8_t)(__SMLAD(__PKHBT(c, d, 16), COLOR_PACK(COLOR_Y_G, COLOR_Y_R),
+                               (COLOR_Y_B * (b >> 16)) + 128U) >> 8);
+      a = __UXTB16(w2);                 /* R2 | G3 */
+      *y++ = (uint8_t)(__SMLAD(__PKHTB(d, c, 16), COLOR_PACK(COLOR_Y_B, COLOR_Y_G),
+                               (COLOR_Y_R * (a & 0xFFFFU)) + 128U) >> 8);
+      b = __UXTB16(__ROR(w2, 8));       /* B3 | R3 */
+      *y++ = (uint8_t)(__SMLAD(b, COLOR_PACK(COLOR_Y_B, COLOR_Y_R),
+                               (COLOR_Y_G * (a >> 16)) + 128U) >> 8);
+    }
+    for (t = (const uint8_t *)p; col < width; col++)
+    {
+      *y++ = COLOR_Y(t[2], t[1], t[0]);
+      t += 3;
+    }
+  }
+}
+#else
+void Color_Rgb565ToYCbCr420(const uint16_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                            uint8_t *y, uint8_t *cb, uint8_t *cr)
+{
+  Color_Rgb565ToYCbCr420_Ref(src, pitch, width, height, y, cb, cr);
+}
+
+void Color_YuyvToYCbCr420(const uint8_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                          uint8_t *y, uint8_t *cb, uint8_t *cr)
+{
+  Color_YuyvToYCbCr420_Ref(src, pitch, width, height, y, cb, cr);
+}
+
+void Color_Rgb888ToY(const uint8_t *src, uint32_t pitch, uint32_t width, uint32_t height,
+                     uint8_t *y)
+{
+  Color_Rgb888ToY_Ref(src, pitch, width, height, y);
+}
+#endif /* COLOR_USE_SIMD */
+
+#if defined(COLOR_BENCHMARK) && COLOR_USE_SIMD
+#define COLOR_BENCH_WIDTH               64U
+#define COLOR_BENCH_HEIGHT              32U
+#define COLOR_BENCH_PIXELS              (COLOR_BENCH_WIDTH * COLOR_BENCH_HEIGHT)
+
+static uint32_t bench_src[(COLOR_BENCH_PIXELS * 3U) / 4U];
+static uint8_t bench_out[2][COLOR_BENCH_PIXELS + (COLOR_BENCH_PIXELS / 2U)];
+
+/**
+  * @brief  Color_BenchReport
+  * @param  name: kernel name
+  * @param  cycles: reference and SIMD cycles for one block
+  * @param  errors: number of blocks with different outputs
+  * @retval None
+  */
+static void Color_BenchReport(const char *name, const uint32_t cycles[2], uint32_t errors)
+{
+  uint32_t ref = (cycles[0] * 100U) / COLOR_BENCH_PIXELS;
+  uint32_t simd = (cycles[1] * 100U) / COLOR_BENCH_PIXELS;
+
+  printf("%-14s ref %lu.%02lu simd %lu.%02lu cycles/pixel, %s\r\n", name,
+         (unsigned long)(ref / 100U), (unsigned long)(ref % 100U),
+         (unsigned long)(simd / 100U), (unsigned long)(simd % 100U),
+         (errors == 0U) ? "bit exact" : "MISMATCH");
+}
+
+/**
+  * @brief  Color_Benchmark
+  *         Checks every kernel against its reference over all input values
+  *         and prints the cycles per pixel of both.
+  * @retval None
+  */
+void Color_Benchmark(void)
+{
+  uint8_t *src = (uint8_t *)bench_src;
+  uint8_t *out[2] = {bench_out[0], bench_out[1]};
+  uint32_t cycles[2], errors, blk, i, k, line;
+  const uint32_t chroma = COLOR_BENCH_PIXELS / 4U;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  /* RGB565: the 65536 colors in 32 blocks */
+  for (errors = 0U, blk = 0U; blk < (0x10000U / COLOR_BENCH_PIXELS); blk++)
+  {
+    for (i = 0U; i < COLOR_BENCH_PIXELS; i++)
+    {
+      ((uint16_t *)src)[i] = (uint16_t)((blk * COLOR_BENCH_PIXELS) + i);
+    }
+    DWT->CYCCNT = 0U;
+    Color_Rgb565ToYCbCr420_Ref((const uint16_t *)src, COLOR_BENCH_WIDTH, COLOR_BENCH_WIDTH, COLOR_BENCH_HEIGHT,
+                               out[0], out[0] + COLOR_BENCH_PIXELS, out[0] + COLOR_BENCH_PIXELS + chroma);
+    cycles[0] = DWT->CYCCNT;
+    DWT->CYCCNT = 0U;
+    Color_Rgb565ToYCbCr420((const uint16_t *)src, COLOR_BENCH_WIDTH, COLOR_BENCH_WIDTH, COLOR_BENCH_HEIGHT,
+                           out[1], out[1] + COLOR_BENCH_PIXELS, out[1] + COLOR_BENCH_PIXELS + chroma);
+    cycles[1] = DWT->CYCCNT;
+    errors += (memcmp(out[0], out[1], sizeof(bench_out[0])) != 0) ? 1U : 0U;
+  }
+  Color_BenchReport("RGB565->420", cycles, errors);
+
+  /* YUYV: every pair of bytes on two lines, the mean is the only arithmetic */
+  for (errors = 0U, blk = 0U; blk < (0x10000U / COLOR_BENCH_PIXELS); blk++)
+  {
+    for (i = 0U; i < (COLOR_BENCH_PIXELS * 2U); i++)
+    {
+      line = i / (COLOR_BENCH_WIDTH * 2U);
+      k = (blk * COLOR_BENCH_PIXELS) + ((line >> 1) * COLOR_BENCH_WIDTH * 2U) + (i % (COLOR_BENCH_WIDTH * 2U));
+      src[i] = (uint8_t)(((line & 1U) != 0U) ? (k >> 8) : k);
+    }
+    DWT->CYCCNT = 0U;
+    Color_YuyvToYCbCr420_Ref(src, COLOR_BENCH_WIDTH, COLOR_BENCH_WIDTH, COLOR_BENCH_HEIGHT,
+                             out[0], out[0] + COLOR_BENCH_PIXELS, out[0] + COLOR_BENCH_PIXELS + chroma);
+    cycles[0] = DWT->CYCCNT;
+    DWT->CYCCNT = 0U;
+    Color_YuyvToYCbCr420(src, COLOR_BENCH_WIDTH, COLOR_BENCH_WIDTH, COLOR_BENCH_HEIGHT,
+                         out[1], out[1] + COLOR_BENCH_PIXELS, out[1] + COLOR_BENCH_PIXELS + chroma);
+    cycles[1] = DWT->CYCCNT;
+    errors += (memcmp(out[0], out[1], sizeof(bench_out[0])) != 0) ? 1U : 0U;
+  }
+  Color_BenchReport("YUYV->420", cycles, errors);
+
+  /* RGB888: the 2^24 colors in 8192 blocks */
+  for (errors = 0U, blk = 0U; blk < (0x1000000UL / COLOR_BENCH_PIXELS); blk++)
+  {
+    for (i = 0U; i < COLOR_BENCH_PIXELS; i++)
+    {
+      k = (blk * COLOR_BENCH_PIXELS) + i;
+      src[(i * 3U)] = (uint8_t)k;
+      src[(i * 3U) + 1U] = (uint8_t)(k >> 8);
+      src[(i * 3U) + 2U] = (uint8_t)(k >> 16);
+    }
+    DWT->CYCCNT = 0U;
+    Color_Rgb888ToY_Ref(src, COLOR_BENCH_WIDTH, COLOR_BENCH_WIDTH, COLOR_BENCH_HEIGHT, out[0]);
+    cycles[0] = DWT->CYCCNT;
+    DWT->CYCCNT = 0U;
+    Color_Rgb888ToY(src, COLOR_BENCH_WIDTH, COLOR_BENCH_WIDTH, COLOR_BENCH_HEIGHT, out[1]);
+    cycles[1] = DWT->CYCCNT;
+    errors += (memcmp(out[0], out[1], COLOR_BENCH_PIXELS) != 0) ? 1U : 0U;
+  }
+  Color_BenchReport("RGB888->Y", cycles, errors);
+}
+#endif /* COLOR_BENCHMARK */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,273 @@
+/**
+  ******************************************************************************
+  * @file    defer.c
+  * @brief   Deferred work queue: interrupt top halves, PendSV bottom halves.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                              Deferred work queue
+  *          ===================================================================
+  *           An interrupt handler only acknowledges its peripheral and posts
+  *           the rest of its work with Defer_Post(): a function, an argument
+  *           and up to DEFER_DATA_SIZE bytes copied from volatile state. The
+  *           work runs in Defer_Run(), in order:
+  *             - from PendSV, at the lowest priority, so it only delays the
+  *               main loop and tail-chains right after the interrupt,
+  *             - from a thread at DEFER_PRIO with PIPELINE_USE_RTOS, the
+  *               kernel owns PendSV.
+  *           The queue is a ring without lock: the producers (interrupts of
+  *           one preemption priority, they cannot preempt each other) only
+  *           write the head, Defer_Run() only writes the tail, and a slot is
+  *           released once its work has returned. Posting is a bounded copy
+  *           whatever the state of the queue. A full queue loses the work and
+  *           counts it, it is sized far above the events of a USB frame.
+  *           Defer_IsrTime() records the top half cycles against
+  *           DEFER_ISR_BUDGET. The file builds on a host with a trigger hook
+  *           instead of PendSV.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "defer.h"
+#include <string.h>
+#include "mem_region.h"
+#if !DEFER_HOST
+#include <stdio.h>
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define DEFER_MASK                      (DEFER_QUEUE_SIZE - 1U)
+#define DEFER_SIGNAL                    0x0001U
+
+#if (DEFER_QUEUE_SIZE & DEFER_MASK) != 0U
+#error "DEFER_QUEUE_SIZE must be a power of 2"
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+#if DEFER_HOST
+#define DEFER_BARRIER()                 __sync_synchronize()
+#define DEFER_TRIGGER()                 Defer_HostTrigger()
+#define DEFER_CYCLES()                  Defer_HostCycles()
+#elif DEFER_USE_THREAD
+#define DEFER_BARRIER()                 __DMB()
+#define DEFER_TRIGGER()                 osThreadFlagsSet(defer_thread, DEFER_SIGNAL)
+#define DEFER_CYCLES()                  (DWT->CYCCNT)
+#else
+#define DEFER_BARRIER()                 __DMB()
+#define DEFER_TRIGGER()                 (SCB->ICSR = SCB_ICSR_PENDSVSET_Msk)
+#define DEFER_CYCLES()                  (DWT->CYCCNT)
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  Defer_FuncTypeDef  func;
+  void              *arg;
+  uint8_t            data[DEFER_DATA_SIZE];
+} Defer_ItemTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static Defer_ItemTypeDef defer_queue[DEFER_QUEUE_SIZE] MEM_CCMRAM;
+static volatile uint32_t defer_head;           /* next slot to fill, producers only */
+static volatile uint32_t defer_tail;           /* next slot to run, Defer_Run() only */
+static Defer_StatsTypeDef defer_stats;
+#if DEFER_USE_THREAD
+static osThreadId_t defer_thread;
+static uint64_t defer_stack[512U / 8U] MEM_CCMRAM;
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+#if DEFER_USE_THREAD
+static void Defer_Task(void *argument);
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+
+#if DEFER_USE_THREAD
+/**
+  * @brief  Defer_Task
+  *         Runs the bottom halves when a top half signals them.
+  * @retval None
+  */
+static void Defer_Task(void *argument)
+{
+  (void)argument;
+  for (;;)
+  {
+    osThreadFlagsWait(DEFER_SIGNAL, osFlagsWaitAny, osWaitForever);
+    Defer_Run();
+  }
+}
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Defer_Init
+  *         Empties the queue and sets up the bottom half context, before the
+  *         interrupts that post are enabled (after osKernelInitialize() with
+  *         PIPELINE_USE_RTOS).
+  * @retval None
+  */
+void Defer_Init(void)
+{
+#if DEFER_USE_THREAD
+  osThreadAttr_t attr;
+#endif
+
+  defer_head = 0U;
+  defer_tail = 0U;
+  memset(&defer_stats, 0, sizeof(defer_stats));
+
+#if !DEFER_HOST
+  /* cycle counter of the top and bottom half times */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+#if DEFER_USE_THREAD
+  memset(&attr, 0, sizeof(attr));
+  attr.name = "defer";
+  attr.stack_mem = defer_stack;
+  attr.stack_size = sizeof(defer_stack);
+  attr.priority = DEFER_PRIO;
+  defer_thread = osThreadNew(Defer_Task, NULL, &attr);
+#elif !DEFER_HOST
+  HAL_NVIC_SetPriority(PendSV_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL, 0U);
+#endif
+}
+
+/**
+  * @brief  Defer_Post
+  *         Queues work for the bottom half. Interrupts of one priority only.
+  * @param  func: work
+  * @param  arg: argument passed to func
+  * @param  data: bytes copied into the work item, NULL if len is 0
+  * @param  len: at most DEFER_DATA_SIZE
+  * @retval 0 on success, -1 if the queue is full
+  */
+int32_t Defer_Post(Defer_FuncTypeDef func, void *arg, const void *data, uint32_t len)
+{
+  uint32_t head = defer_head;
+  uint32_t depth;
+  Defer_ItemTypeDef *item;
+
+  if ((func == NULL) || (len > DEFER_DATA_SIZE))
+  {
+    return -1;
+  }
+  if ((head - defer_tail) >= DEFER_QUEUE_SIZE)
+  {
+    defer_stats.overflow++;
+    return -1;
+  }
+  item = &defer_queue[head & DEFER_MASK];
+  item->func = func;
+  item->arg = arg;
+  if (len != 0U)
+  {
+    memcpy(item->data, data, len);
+  }
+  /* the item is complete before Defer_Run() can see it */
+  DEFER_BARRIER();
+  defer_head = head + 1U;
+
+  defer_stats.posted++;
+  depth = (head + 1U) - defer_tail;
+  if (depth > defer_stats.depth_max)
+  {
+    defer_stats.depth_max = depth;
+  }
+  DEFER_TRIGGER();
+  return 0;
+}
+
+/**
+  * @brief  Defer_Run
+  *         Runs the queued work in order, until the queue is empty. PendSV
+  *         handler, or the defer thread.
+  * @retval None
+  */
+void Defer_Run(void)
+{
+  uint32_t tail = defer_tail;
+  uint32_t start, cycles;
+  Defer_ItemTypeDef *item;
+
+  while (tail != defer_head)
+  {
+    DEFER_BARRIER();
+    item = &defer_queue[tail & DEFER_MASK];
+    start = DEFER_CYCLES();
+    item->func(item->arg, item->data);
+    cycles = DEFER_CYCLES() - start;
+    if (cycles > defer_stats.work_max)
+    {
+      defer_stats.work_max = cycles;
+    }
+    /* the slot is only reused once its work has returned */
+    DEFER_BARRIER();
+    tail++;
+    defer_tail = tail;
+    defer_stats.run++;
+  }
+}
+
+/**
+  * @brief  Defer_IsrTime
+  *         Records the cycles of a top half.
+  * @param  cycles: time from handler entry to exit
+  * @retval None
+  */
+void Defer_IsrTime(uint32_t cycles)
+{
+  if (cycles > defer_stats.isr_max)
+  {
+    defer_stats.isr_max = cycles;
+  }
+  if (cycles > DEFER_ISR_BUDGET)
+  {
+    defer_stats.isr_over++;
+  }
+}
+
+/**
+  * @brief  Defer_GetStats
+  *         Counters of the queue.
+  * @param  stats: copy of the counters
+  * @retval None
+  */
+void Defer_GetStats(Defer_StatsTypeDef *stats)
+{
+  *stats = defer_stats;
+}
+
+#if !DEFER_HOST
+/**
+  * @brief  Defer_Report
+  *         Prints the counters of the queue.
+  * @retval None
+  */
+void Defer_Report(void)
+{
+  Defer_StatsTypeDef s = defer_stats;
+
+  printf("Defer: %lu posted, %lu run, %lu lost, depth %lu, "
+         "top half max %lu cycles (%lu over %u), bottom half max %lu cycles\r\n",
+         (unsigned long)s.posted, (unsigned long)s.run, (unsigned long)s.overflow,
+         (unsigned long)s.depth_max, (unsigned long)s.isr_max, (unsigned long)s.isr_over,
+         DEFER_ISR_BUDGET, (unsigned long)s.work_max);
+}
+#endif
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,842 @@
+/**
+  ******************************************************************************
+  * @file    dfu.c
+  * @brief   Firmware update into the other flash bank, over the DFU runtime
+  *          interface, while the video streams.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Firmware update
+  *          ===================================================================
+  *           The 2 MB flash is two banks of 1 MB. The image runs from the
+  *           bank at 0x08000000 and a new one is written to the bank at
+  *           DFU_BANK_ADDRESS: the flash controller erases and programs one
+  *           bank while the CPU keeps fetching from the other, so nothing
+  *           else stops. The update runs in three contexts:
+  *             - USB bottom half: the DFU class requests of the interface
+  *               after the UVC functions. A DFU_DNLOAD block goes into a
+  *               ring of DFU_BUFFERS buffers, DFU_GETSTATUS answers
+  *               dfuDNLOAD-IDLE with a poll timeout of 0 while a buffer is
+  *               free, so the host sends the next block while the flash
+  *               still programs the previous ones,
+  *             - flash interrupt: one operation at a time, each started
+  *               from the end of the previous one, once HAL_FLASH_IRQHandler()
+  *               has released the flash. A received block is programmed a
+  *               word at a time, after the sector it falls into is erased.
+  *               With no block waiting, the sector after the one being
+  *               received is erased ahead. The flash control register is
+  *               unlocked at the first block of an image and locked again
+  *               once it is programmed or dropped,
+  *             - main loop: once the last block is programmed, the CRC of the
+  *               image is checked in slices of DFU_VERIFY_SLICE bytes with
+  *               the table, the CRC unit belongs to the USB bottom half.
+  *           An image is the binary linked at 0x08000000, padded to a word,
+  *           then its CRC-32/MPEG-2. After the check the interface is back in
+  *           dfuIDLE: the update is manifestation tolerant, the stream goes
+  *           on. DFU_DETACH then sets the dual bank boot option byte for the
+  *           other bank and resets: with BFB2 set the boot loader starts bank
+  *           2 mapped at 0x08000000 (UFB_MODE), with BFB2 clear the device
+  *           boots bank 1. The boot loader only starts a bank whose vector
+  *           table begins with a stack in SRAM, and falls back to the other
+  *           bank otherwise, so a bad image does not lose the device.
+  *           Under UFB_MODE the CPU sees bank 1 at DFU_BANK_ADDRESS, the
+  *           sectors are erased by their number in the controller, 0 to 11
+  *           for bank 1 and 12 to 23 for bank 2, and each word is checked
+  *           erased before it is programmed. The file builds on a host with
+  *           a model of the bank instead of the controller.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "dfu.h"
+#include <stdio.h>
+#include <string.h>
+#include "frame_crc.h"
+#include "mem_region.h"
+#if !DFU_HOST
+#include "idle.h"
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define DFU_SECTORS                     12U      /* sectors of a bank */
+#define DFU_ERASED                      0xFFFFFFFFU
+
+/* Flash operation in progress */
+#define DFU_OP_NONE                     0U
+#define DFU_OP_ERASE                    1U
+#define DFU_OP_PROGRAM                  2U
+
+/* bwPollTimeout of dfuDNBUSY, in ms: a sector erase takes up to 2 s, the
+   words of a block about 4 ms */
+#define DFU_POLL_ERASE_MS               20U
+#define DFU_POLL_PROGRAM_MS             2U
+#define DFU_POLL_MANIFEST_MS            10U
+
+/* Where an image may start: stack in SRAM1 to SRAM3, as the boot loader
+   checks, reset handler in the image */
+#define DFU_SRAM_BASE                   0x20000000U
+#define DFU_SRAM_END                    0x20030000U
+#define DFU_IMAGE_BASE                  0x08000000U
+
+/* Private macro -------------------------------------------------------------*/
+#if DFU_HOST
+#define DFU_BANK                        dfu_model
+#define DFU_KICK()
+#define DFU_WAKE()
+#else
+#define DFU_BANK                        ((const uint8_t *)DFU_BANK_ADDRESS)
+#define DFU_KICK()                      NVIC_SetPendingIRQ(FLASH_IRQn)
+#define DFU_WAKE()                      Idle_Kick()
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+/* CPU copies the OTG FIFO and programs the words: the buffers can stay in CCM */
+MEM_CCMRAM static uint32_t dfu_buf[DFU_BUFFERS][DFU_TRANSFER_SIZE / 4U];
+static uint32_t dfu_offset[DFU_BUFFERS];  /* image offset of each buffer */
+static uint16_t dfu_len[DFU_BUFFERS];
+static volatile uint32_t dfu_head;        /* blocks received, USB bottom half */
+static volatile uint32_t dfu_tail;        /* blocks programmed, flash interrupt */
+static volatile uint32_t dfu_size;        /* image bytes received */
+static uint16_t dfu_block;                /* wBlockNum expected next */
+static volatile uint8_t dfu_state;        /* bState */
+static volatile uint8_t dfu_status;       /* bStatus */
+static volatile uint8_t dfu_end;          /* the zero length DFU_DNLOAD came */
+static volatile uint8_t dfu_programmed;   /* and every block is in the bank */
+static volatile uint8_t dfu_ready;        /* verified image, waits for DFU_DETACH */
+static volatile uint8_t dfu_detach;
+#if !DFU_HOST
+static uint32_t dfu_detach_tick;
+#endif
+static uint8_t dfu_reply[DFU_STATUS_LEN];
+
+/* Flash interrupt side */
+static volatile uint8_t dfu_op;           /* DFU_OP_xxx running */
+static volatile uint8_t dfu_op_error;     /* bStatus of a failed operation */
+static uint32_t dfu_word;                 /* next word of the buffer at dfu_tail */
+static uint32_t dfu_erased;               /* bytes of the bank erased from its start */
+static uint32_t dfu_erase_offset;         /* sector being erased */
+static uint32_t dfu_erase_size;
+
+/* Main loop side */
+static uint32_t dfu_verified;             /* image bytes through the CRC */
+static uint32_t dfu_crc;
+
+/* Sizes of the sectors of a bank */
+static const uint32_t dfu_sector_size[DFU_SECTORS] =
+{
+  0x4000U, 0x4000U, 0x4000U, 0x4000U, 0x10000U,
+  0x20000U, 0x20000U, 0x20000U, 0x20000U, 0x20000U, 0x20000U, 0x20000U
+};
+
+#if DFU_HOST
+/* Typical operation times of the model, x32 parallelism */
+#define DFU_MODEL_PROGRAM_US            16U
+#define DFU_MODEL_ERASE_US(size)        (((size) == 0x4000U) ? 250000U : (((size) == 0x10000U) ? 550000U : 1000000U))
+
+static uint8_t dfu_model[DFU_BANK_SIZE];
+static uint32_t dfu_model_offset;         /* word programmed on the model */
+static uint32_t dfu_model_value;
+static uint32_t dfu_resets;
+static uint8_t dfu_model_locked = 1U;     /* FLASH_CR_LOCK of the model */
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Dfu_Downloading(void);
+static void Dfu_Fail(uint8_t status);
+static void Dfu_Start(void);
+static void Dfu_Lock(void);
+static void Dfu_Next(void);
+static void Dfu_Erased(void);
+static uint32_t Dfu_StartErase(uint32_t offset);
+static uint32_t Dfu_StartProgram(uint32_t offset, uint32_t word);
+static uint32_t Dfu_Get32(const uint8_t *p);
+static void Dfu_Verify(void);
+static void Dfu_Swap(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Dfu_Downloading
+  * @retval 1 from the first block of an image until its check
+  */
+static uint32_t Dfu_Downloading(void)
+{
+  switch (dfu_state)
+  {
+  case DFU_STATE_DNLOAD_SYNC:
+  case DFU_STATE_DNBUSY:
+  case DFU_STATE_DNLOAD_IDLE:
+  case DFU_STATE_MANIFEST_SYNC:
+  case DFU_STATE_MANIFEST:
+    return 1U;
+  default:
+    return 0U;
+  }
+}
+
+/**
+  * @brief  Dfu_Fail
+  *         Drops the image, dfuERROR until DFU_CLRSTATUS. The flash interrupt
+  *         ends the operation it runs and starts no other.
+  * @param  status: DFU_STATUS_ERR_xxx
+  * @retval None
+  */
+static void Dfu_Fail(uint8_t status)
+{
+  dfu_status = status;
+  dfu_state = DFU_STATE_ERROR;
+  dfu_ready = 0U;
+  dfu_programmed = 0U;
+  Dfu_Lock();
+}
+
+/**
+  * @brief  Dfu_Start
+  *         First block of an image: the bank is erased again from its start,
+  *         the flash control register is unlocked until the image is
+  *         programmed or dropped.
+  * @retval None
+  */
+static void Dfu_Start(void)
+{
+  dfu_head = 0U;
+  dfu_tail = 0U;
+  dfu_size = 0U;
+  dfu_block = 0U;
+  dfu_end = 0U;
+  dfu_programmed = 0U;
+  dfu_ready = 0U;
+  dfu_word = 0U;
+  dfu_erased = 0U;
+  dfu_op_error = DFU_STATUS_OK;
+  dfu_verified = 0U;
+  dfu_status = DFU_STATUS_OK;
+#if DFU_HOST
+  dfu_model_locked = 0U;
+#else
+  HAL_FLASH_Unlock();
+#endif
+}
+
+/**
+  * @brief  Dfu_Lock
+  *         Locks the flash control register once the flash is idle. An
+  *         operation still running ends in the flash interrupt, which locks
+  *         it then, as the image is no longer downloading.
+  * @retval None
+  */
+static void Dfu_Lock(void)
+{
+  if (dfu_op != DFU_OP_NONE)
+  {
+    return;
+  }
+#if DFU_HOST
+  dfu_model_locked = 1U;
+#else
+  HAL_FLASH_Lock();
+#endif
+}
+
+/**
+  * @brief  Dfu_StartErase
+  *         Erases the sector of the inactive bank that starts at an offset.
+  *         Flash interrupt.
+  * @param  offset: sector start, from DFU_BANK_ADDRESS
+  * @retval 0 on success
+  */
+static uint32_t Dfu_StartErase(uint32_t offset)
+{
+  uint32_t sector, start = 0U;
+
+  for (sector = 0U; (sector < DFU_SECTORS) && (start != offset); sector++)
+  {
+    start += dfu_sector_size[sector];
+  }
+  if (sector == DFU_SECTORS)
+  {
+    return 1U;
+  }
+  dfu_op = DFU_OP_ERASE;
+  dfu_erase_offset = offset;
+  dfu_erase_size = dfu_sector_size[sector];
+#if DFU_HOST
+  if (dfu_model_locked != 0U)
+  {
+    dfu_op = DFU_OP_NONE;
+    return 1U;
+  }
+  return 0U;
+#else
+  {
+    FLASH_EraseInitTypeDef erase;
+
+    erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase.Banks = 0U;
+    /* the other bank than the one mapped at 0x08000000 */
+    erase.Sector = (((SYSCFG->MEMRMP & SYSCFG_MEMRMP_UFB_MODE) != 0U) ? FLASH_SECTOR_0 : FLASH_SECTOR_12) + sector;
+    erase.NbSectors = 1U;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    if (HAL_FLASHEx_Erase_IT(&erase) != HAL_OK)
+    {
+      dfu_op = DFU_OP_NONE;
+      return 1U;
+    }
+    return 0U;
+  }
+#endif
+}
+
+/**
+  * @brief  Dfu_StartProgram
+  *         Programs a word of the inactive bank. Flash interrupt.
+  * @param  offset: word offset, from DFU_BANK_ADDRESS
+  * @param  word: value
+  * @retval 0 on success
+  */
+static uint32_t Dfu_StartProgram(uint32_t offset, uint32_t word)
+{
+  dfu_op = DFU_OP_PROGRAM;
+#if DFU_HOST
+  if (dfu_model_locked != 0U)
+  {
+    dfu_op = DFU_OP_NONE;
+    return 1U;
+  }
+  dfu_model_offset = offset;
+  dfu_model_value = word;
+  return 0U;
+#else
+  if (HAL_FLASH_Program_IT(FLASH_TYPEPROGRAM_WORD, DFU_BANK_ADDRESS + offset, word) != HAL_OK)
+  {
+    dfu_op = DFU_OP_NONE;
+    return 1U;
+  }
+  return 0U;
+#endif
+}
+
+/**
+  * @brief  Dfu_Next
+  *         Starts the next flash operation, the flash being idle: a word of
+  *         the oldest block, the erase of the sector it falls into, or the
+  *         erase of the next sector. Flash interrupt.
+  * @retval None
+  */
+static void Dfu_Next(void)
+{
+  const uint32_t *buf;
+  uint32_t slot, words, offset, end, sector;
+
+  while (dfu_tail != dfu_head)
+  {
+    slot = dfu_tail % DFU_BUFFERS;
+    buf = dfu_buf[slot];
+    words = dfu_len[slot] / 4U;
+
+    /* words at the erased value are already programmed */
+    while ((dfu_word < words) && (buf[dfu_word] == DFU_ERASED))
+    {
+      dfu_word++;
+    }
+    if (dfu_word == words)
+    {
+      /* block written, its buffer takes the next one */
+      dfu_word = 0U;
+      dfu_tail++;
+      continue;
+    }
+
+    offset = dfu_offset[slot] + (dfu_word * 4U);
+    if (offset >= dfu_erased)
+    {
+      if (Dfu_StartErase(dfu_erased) != 0U)
+      {
+        Dfu_Fail(DFU_STATUS_ERR_ERASE);
+      }
+      return;
+    }
+    if (Dfu_Get32(&DFU_BANK[offset]) != DFU_ERASED)
+    {
+      Dfu_Fail(DFU_STATUS_ERR_CHECK_ERASED);
+      return;
+    }
+    if (Dfu_StartProgram(offset, buf[dfu_word]) != 0U)
+    {
+      Dfu_Fail(DFU_STATUS_ERR_PROG);
+      return;
+    }
+    dfu_word++;
+    return;
+  }
+
+  if (dfu_end != 0U)
+  {
+    if (dfu_programmed == 0U)
+    {
+      /* the check only reads the bank */
+      Dfu_Lock();
+      dfu_programmed = 1U;
+      DFU_WAKE();
+    }
+    return;
+  }
+
+  /* nothing to program: erase the sector after the one being received */
+  for (sector = 0U, end = 0U; (sector < DFU_SECTORS) && (end <= dfu_size); sector++)
+  {
+    end += dfu_sector_size[sector];
+  }
+  if ((dfu_erased < DFU_BANK_SIZE) && (dfu_erased <= end))
+  {
+    if (Dfu_StartErase(dfu_erased) != 0U)
+    {
+      Dfu_Fail(DFU_STATUS_ERR_ERASE);
+    }
+  }
+}
+
+/**
+  * @brief  Dfu_Erased
+  *         End of a sector erase. The sector of an image dropped while it
+  *         was erased counts for none.
+  * @retval None
+  */
+static void Dfu_Erased(void)
+{
+  if (dfu_erase_offset == dfu_erased)
+  {
+    dfu_erased += dfu_erase_size;
+  }
+}
+
+/**
+  * @brief  Dfu_Get32
+  * @param  p: little endian dword
+  * @retval value
+  */
+static uint32_t Dfu_Get32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+  * @brief  Dfu_Verify
+  *         Runs the next slice of the image through the CRC, then checks
+  *         its CRC and vector table. Main loop.
+  * @retval None
+  */
+static void Dfu_Verify(void)
+{
+  uint32_t len = dfu_size - DFU_CRC_LEN;
+  uint32_t n, sp, pc;
+
+  if (dfu_verified == 0U)
+  {
+#if !DFU_HOST
+    /* no line of the bank read before it was programmed may remain */
+    if ((FLASH->ACR & FLASH_ACR_DCEN) != 0U)
+    {
+      __HAL_FLASH_DATA_CACHE_DISABLE();
+      __HAL_FLASH_DATA_CACHE_RESET();
+      __HAL_FLASH_DATA_CACHE_ENABLE();
+    }
+#endif
+    dfu_crc = FRAME_CRC_INIT;
+  }
+  n = ((len - dfu_verified) < DFU_VERIFY_SLICE) ? (len - dfu_verified) : DFU_VERIFY_SLICE;
+  dfu_crc = FrameCrc_Software(dfu_crc, &DFU_BANK[dfu_verified], n);
+  dfu_verified += n;
+  if (dfu_verified < len)
+  {
+    return;
+  }
+
+  dfu_programmed = 0U;
+  if (dfu_crc != Dfu_Get32(&DFU_BANK[len]))
+  {
+    Dfu_Fail(DFU_STATUS_ERR_VERIFY);
+    return;
+  }
+  sp = Dfu_Get32(&DFU_BANK[0]);
+  pc = Dfu_Get32(&DFU_BANK[4]);
+  if ((sp <= DFU_SRAM_BASE) || (sp > DFU_SRAM_END) || ((pc & 1U) == 0U) ||
+      (pc < DFU_IMAGE_BASE) || (pc >= (DFU_IMAGE_BASE + len)))
+  {
+    Dfu_Fail(DFU_STATUS_ERR_FIRMWARE);
+    return;
+  }
+  dfu_ready = 1U;
+  dfu_state = DFU_STATE_IDLE;
+  printf("DFU: %lu bytes verified, DFU_DETACH boots them\r\n", (unsigned long)len);
+}
+
+/**
+  * @brief  Dfu_Swap
+  *         Boots the other bank: sets the dual bank boot option byte for it
+  *         and resets. Main loop.
+  * @retval None
+  */
+static void Dfu_Swap(void)
+{
+#if DFU_HOST
+  dfu_resets++;
+  dfu_ready = 0U;
+  dfu_state = DFU_STATE_APP_IDLE;
+#else
+  FLASH_AdvOBProgramInitTypeDef ob;
+  HAL_StatusTypeDef status;
+
+  HAL_FLASHEx_AdvOBGetConfig(&ob);
+  ob.OptionType = OPTIONBYTE_BOOTCONFIG;
+  /* bank 2 holds the image when bank 1 runs, and the other way round */
+  ob.BootConfig = ((SYSCFG->MEMRMP & SYSCFG_MEMRMP_UFB_MODE) != 0U) ? OB_DUAL_BOOT_DISABLE : OB_DUAL_BOOT_ENABLE;
+  HAL_FLASH_Unlock();
+  HAL_FLASH_OB_Unlock();
+  status = HAL_FLASHEx_AdvOBProgram(&ob);
+  if (status == HAL_OK)
+  {
+    status = HAL_FLASH_OB_Launch();
+  }
+  HAL_FLASH_OB_Lock();
+  HAL_FLASH_Lock();
+  if (status != HAL_OK)
+  {
+    Dfu_Fail(DFU_STATUS_ERR_WRITE);
+    return;
+  }
+  NVIC_SystemReset();
+#endif
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Dfu_Init
+  *         Runtime state, and the flash interrupt below the USB one.
+  * @retval None
+  */
+void Dfu_Init(void)
+{
+  dfu_op = DFU_OP_NONE;
+  Dfu_Start();
+  /* no image yet */
+  Dfu_Lock();
+  dfu_state = DFU_STATE_APP_IDLE;
+  dfu_detach = 0U;
+#if !DFU_HOST
+  HAL_NVIC_SetPriority(FLASH_IRQn, 14U, 0U);
+  HAL_NVIC_EnableIRQ(FLASH_IRQn);
+  printf("DFU: running from bank %u\r\n", ((SYSCFG->MEMRMP & SYSCFG_MEMRMP_UFB_MODE) != 0U) ? 2U : 1U);
+#endif
+}
+
+/**
+  * @brief  Dfu_Request
+  *         Class request to the DFU interface. USB bottom half.
+  * @param  request: bRequest, DFU_xxx
+  * @param  value: wValue
+  * @param  length: wLength
+  * @param  data: set to the IN data, or to the buffer of the OUT data stage
+  * @retval length of that data, 0 for none, -1 to stall the request
+  */
+int32_t Dfu_Request(uint8_t request, uint16_t value, uint16_t length, uint8_t **data)
+{
+  uint32_t slot, poll = 0U;
+
+  switch (request)
+  {
+  case DFU_DNLOAD:
+    if (length == 0U)
+    {
+      if ((dfu_state != DFU_STATE_DNLOAD_IDLE) || (dfu_size <= (8U + DFU_CRC_LEN)))
+      {
+        break;
+      }
+      dfu_end = 1U;
+      dfu_state = DFU_STATE_MANIFEST_SYNC;
+      DFU_KICK();
+      return 0;
+    }
+    if ((value == 0U) && (Dfu_Downloading() == 0U) && (dfu_state != DFU_STATE_ERROR))
+    {
+      Dfu_Start();
+      dfu_state = DFU_STATE_DNLOAD_IDLE;
+    }
+    if ((dfu_state != DFU_STATE_DNLOAD_IDLE) || (value != dfu_block) ||
+        ((dfu_head - dfu_tail) >= DFU_BUFFERS) || (length > DFU_TRANSFER_SIZE) || ((length % 4U) != 0U))
+    {
+      Dfu_Fail(DFU_STATUS_ERR_STALLEDPKT);
+      break;
+    }
+    if ((dfu_size + length) > DFU_BANK_SIZE)
+    {
+      Dfu_Fail(DFU_STATUS_ERR_TARGET);
+      break;
+    }
+    slot = dfu_head % DFU_BUFFERS;
+    dfu_offset[slot] = dfu_size;
+    dfu_len[slot] = length;
+    dfu_state = DFU_STATE_DNLOAD_SYNC;
+    *data = (uint8_t *)dfu_buf[slot];
+    return length;
+
+  case DFU_GETSTATUS:
+    if ((dfu_state == DFU_STATE_DNLOAD_SYNC) || (dfu_state == DFU_STATE_DNBUSY) ||
+        (dfu_state == DFU_STATE_DNLOAD_IDLE))
+    {
+      if ((dfu_head - dfu_tail) < DFU_BUFFERS)
+      {
+        dfu_state = DFU_STATE_DNLOAD_IDLE;
+      }
+      else
+      {
+        dfu_state = DFU_STATE_DNBUSY;
+        poll = (dfu_op == DFU_OP_ERASE) ? DFU_POLL_ERASE_MS : DFU_POLL_PROGRAM_MS;
+      }
+    }
+    else if ((dfu_state == DFU_STATE_MANIFEST_SYNC) || (dfu_state == DFU_STATE_MANIFEST))
+    {
+      dfu_state = DFU_STATE_MANIFEST;
+      poll = DFU_POLL_MANIFEST_MS;
+    }
+    dfu_reply[0] = dfu_status;
+    dfu_reply[1] = (uint8_t)poll;
+    dfu_reply[2] = (uint8_t)(poll >> 8);
+    dfu_reply[3] = (uint8_t)(poll >> 16);
+    dfu_reply[4] = dfu_state;
+    dfu_reply[5] = 0U;
+    *data = dfu_reply;
+    return DFU_STATUS_LEN;
+
+  case DFU_GETSTATE:
+    dfu_reply[0] = dfu_state;
+    *data = dfu_reply;
+    return 1;
+
+  case DFU_CLRSTATUS:
+    if (dfu_state == DFU_STATE_ERROR)
+    {
+      dfu_status = DFU_STATUS_OK;
+      dfu_state = DFU_STATE_IDLE;
+    }
+    return 0;
+
+  case DFU_ABORT:
+    if (Dfu_Downloading() != 0U)
+    {
+      dfu_programmed = 0U;
+      dfu_state = DFU_STATE_IDLE;
+      Dfu_Lock();
+    }
+    return 0;
+
+  case DFU_DETACH:
+    if (dfu_ready == 0U)
+    {
+      Dfu_Fail(DFU_STATUS_ERR_NOTDONE);
+      break;
+    }
+    dfu_state = DFU_STATE_APP_DETACH;
+#if !DFU_HOST
+    dfu_detach_tick = HAL_GetTick();
+#endif
+    dfu_detach = 1U;
+    DFU_WAKE();
+    return 0;
+
+  default:
+    break;
+  }
+  return -1;
+}
+
+/**
+  * @brief  Dfu_DataReceived
+  *         The data stage of the DFU_DNLOAD is in its buffer. USB bottom
+  *         half.
+  * @retval None
+  */
+void Dfu_DataReceived(void)
+{
+  if (dfu_state != DFU_STATE_DNLOAD_SYNC)
+  {
+    return;
+  }
+  dfu_size += dfu_len[dfu_head % DFU_BUFFERS];
+  dfu_block++;
+  dfu_head++;
+  DFU_KICK();
+}
+
+/**
+  * @brief  Dfu_FlashIrq
+  *         After HAL_FLASH_IRQHandler(): starts the next operation once the
+  *         previous one is over. On a host, completes the operation on the
+  *         model first.
+  * @retval None
+  */
+void Dfu_FlashIrq(void)
+{
+#if DFU_HOST
+  uint32_t n;
+
+  if (dfu_op == DFU_OP_ERASE)
+  {
+    memset(&dfu_model[dfu_erase_offset], 0xFF, dfu_erase_size);
+    Dfu_Erased();
+  }
+  else if (dfu_op == DFU_OP_PROGRAM)
+  {
+    for (n = 0U; n < 4U; n++)
+    {
+      dfu_model[dfu_model_offset + n] &= (uint8_t)(dfu_model_value >> (n * 8U));
+    }
+  }
+  dfu_op = DFU_OP_NONE;
+#endif
+  if (dfu_op != DFU_OP_NONE)
+  {
+    return;
+  }
+  if (dfu_op_error != DFU_STATUS_OK)
+  {
+    if (Dfu_Downloading() != 0U)
+    {
+      Dfu_Fail(dfu_op_error);
+    }
+    dfu_op_error = DFU_STATUS_OK;
+  }
+  if (Dfu_Downloading() != 0U)
+  {
+    Dfu_Next();
+  }
+  else
+  {
+    /* the image was dropped while the operation ran */
+    Dfu_Lock();
+  }
+}
+
+/**
+  * @brief  Dfu_Process
+  *         Checks a programmed image, boots it after DFU_DETACH. Main loop,
+  *         or control task.
+  * @retval milliseconds before the next call is needed
+  */
+uint32_t Dfu_Process(void)
+{
+  if (dfu_detach != 0U)
+  {
+#if !DFU_HOST
+    uint32_t elapsed = HAL_GetTick() - dfu_detach_tick;
+
+    /* the status stage of DFU_DETACH first */
+    if (elapsed < DFU_DETACH_MS)
+    {
+      return DFU_DETACH_MS - elapsed;
+    }
+#endif
+    dfu_detach = 0U;
+    Dfu_Swap();
+    return 0xFFFFFFFFU;
+  }
+  if ((dfu_programmed != 0U) && (Dfu_Downloading() != 0U))
+  {
+    Dfu_Verify();
+    return (dfu_programmed != 0U) ? 0U : 0xFFFFFFFFU;
+  }
+  return 0xFFFFFFFFU;
+}
+
+/**
+  * @brief  Dfu_GetState
+  * @retval bState
+  */
+uint8_t Dfu_GetState(void)
+{
+  return dfu_state;
+}
+
+#if DFU_HOST
+/**
+  * @brief  Dfu_HostBank
+  * @retval the model of the inactive bank
+  */
+uint8_t *Dfu_HostBank(void)
+{
+  return dfu_model;
+}
+
+/**
+  * @brief  Dfu_HostBusyUs
+  * @retval time the operation started on the model takes, 0 if none
+  */
+uint32_t Dfu_HostBusyUs(void)
+{
+  if (dfu_op == DFU_OP_ERASE)
+  {
+    return DFU_MODEL_ERASE_US(dfu_erase_size);
+  }
+  return (dfu_op == DFU_OP_PROGRAM) ? DFU_MODEL_PROGRAM_US : 0U;
+}
+
+/**
+  * @brief  Dfu_HostResets
+  * @retval resets into the other bank so far
+  */
+uint32_t Dfu_HostResets(void)
+{
+  return dfu_resets;
+}
+
+/**
+  * @brief  Dfu_HostLocked
+  * @retval 1 while the control register of the model is locked
+  */
+uint8_t Dfu_HostLocked(void)
+{
+  return dfu_model_locked;
+}
+#else
+/**
+  * @brief  FLASH end of operation callback: a sector erased or a word
+  *         programmed.
+  * @param  ReturnValue: sector or address
+  * @retval None
+  */
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
+{
+  (void)ReturnValue;
+  if (dfu_op == DFU_OP_ERASE)
+  {
+    Dfu_Erased();
+  }
+  dfu_op = DFU_OP_NONE;
+}
+
+/**
+  * @brief  FLASH operation error callback.
+  * @param  ReturnValue: sector or address that failed
+  * @retval None
+  */
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
+{
+  (void)ReturnValue;
+  dfu_op_error = (dfu_op == DFU_OP_ERASE) ? DFU_STATUS_ERR_ERASE : DFU_STATUS_ERR_PROG;
+  dfu_op = DFU_OP_NONE;
+}
+#endif
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,200 @@
+/**
+  ******************************************************************************
+  * @file    frame_crc.c
+  * @brief   Frame CRC: CRC-32 of the payload data with the CRC unit.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                  Frame CRC
+  *          ===================================================================
+  *           The UVC class runs FrameCrc_Update() over the frame data of
+  *           each payload it sends, and the payload header carries the CRC
+  *           so far (XU_ROI_FRAME_CRC_CONTROL). The CRC unit takes a word
+  *           per write, a few cycles each:
+  *             - it reads a word MSB first, so the bytes of each word are
+  *               reversed first (HAL_CRC_Accumulate() would feed them in
+  *               memory order) and the result is the CRC-32/MPEG-2 of the
+  *               byte stream, which the host computes with a byte table,
+  *             - it keeps a single running value, and the two functions
+  *               interleave their payloads. Unless its data register still
+  *               holds the CRC of the caller, the unit is reset and fed the
+  *               one word that leads from the reset value to that CRC: the
+  *               CRC run four bytes backwards with codecCrcInverseTable,
+  *             - the 1 to 3 bytes left after the words, and runs shorter
+  *               than FRAME_CRC_MIN_WORDS, go through codecCrcTable.
+  *           Without FrameCrc_Init() everything goes through the table. On a
+  *           host FrameCrc_Init() selects a model of the unit, so the same
+  *           restore path runs there. Calls come from one context at a time,
+  *           the USB bottom half.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "frame_crc.h"
+#include <stddef.h>
+#include "codec_tables.h"
+
+/* Private macro -------------------------------------------------------------*/
+#if FRAME_CRC_HOST
+#define FRAME_CRC_RESET()               (frame_crc_dr = FRAME_CRC_INIT)
+#define FRAME_CRC_WRITE(word)           (frame_crc_dr = FrameCrc_Word(frame_crc_dr ^ (word)))
+#define FRAME_CRC_READ()                (frame_crc_dr)
+#define FRAME_CRC_LOAD(p)               FrameCrc_Load(p)
+#else
+#define FRAME_CRC_RESET()               (frame_crc_unit->CR = CRC_CR_RESET)
+#define FRAME_CRC_WRITE(word)           (frame_crc_unit->DR = (word))
+#define FRAME_CRC_READ()                (frame_crc_unit->DR)
+#define FRAME_CRC_LOAD(p)               __REV(__UNALIGNED_UINT32_READ(p))
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+#if FRAME_CRC_HOST
+static uint32_t frame_crc_dr;          /* data register of the model */
+static const uint32_t *frame_crc_unit; /* the model, once in use */
+#else
+static CRC_TypeDef *frame_crc_unit;
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static void FrameCrc_Restore(uint32_t crc);
+#if FRAME_CRC_HOST
+static uint32_t FrameCrc_Word(uint32_t c);
+static uint32_t FrameCrc_Load(const uint8_t *p);
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  FrameCrc_Restore
+  *         Leaves crc in the data register of the unit.
+  * @param  crc: CRC to continue from
+  * @retval None
+  */
+static void FrameCrc_Restore(uint32_t crc)
+{
+  uint32_t n, i;
+
+  FRAME_CRC_RESET();
+  if (crc == FRAME_CRC_INIT)
+  {
+    return;
+  }
+  /* writing w to the reset unit gives M(FRAME_CRC_INIT ^ w), M being four
+     steps over zero bytes: run them backwards from crc */
+  for (n = 0U; n < 4U; n++)
+  {
+    i = codecCrcInverseTable[crc & 0xFFU];
+    crc = ((crc ^ codecCrcTable[i]) >> 8) | (i << 24);
+  }
+  FRAME_CRC_WRITE(crc ^ FRAME_CRC_INIT);
+}
+
+#if FRAME_CRC_HOST
+/**
+  * @brief  FrameCrc_Word
+  *         What the unit does with a word written to its data register.
+  * @param  c: data register XOR the word
+  * @retval new data register
+  */
+static uint32_t FrameCrc_Word(uint32_t c)
+{
+  uint32_t n;
+
+  for (n = 0U; n < 4U; n++)
+  {
+    c = (c << 8) ^ codecCrcTable[c >> 24];
+  }
+  return c;
+}
+
+/**
+  * @brief  FrameCrc_Load
+  * @param  p: 4 bytes, any alignment
+  * @retval the bytes as a big endian word
+  */
+static uint32_t FrameCrc_Load(const uint8_t *p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  FrameCrc_Init
+  *         Routes FrameCrc_Update() to the CRC unit.
+  * @param  hcrc: CRC handle, initialized (target only)
+  * @retval None
+  */
+#if !FRAME_CRC_HOST
+void FrameCrc_Init(CRC_HandleTypeDef *hcrc)
+{
+  frame_crc_unit = hcrc->Instance;
+  FRAME_CRC_RESET();
+}
+#else
+void FrameCrc_Init(void)
+{
+  frame_crc_unit = &frame_crc_dr;
+  FRAME_CRC_RESET();
+}
+#endif
+
+/**
+  * @brief  FrameCrc_Update
+  *         Continues a CRC over len bytes, with the CRC unit when it is set
+  *         up. One context at a time.
+  * @param  crc: FRAME_CRC_INIT, or the result over the previous bytes
+  * @param  data: bytes, any alignment
+  * @param  len: byte count
+  * @retval CRC including data
+  */
+uint32_t FrameCrc_Update(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+  uint32_t words = len / 4U;
+
+  if ((frame_crc_unit == NULL) || (words < FRAME_CRC_MIN_WORDS))
+  {
+    return FrameCrc_Software(crc, data, len);
+  }
+  if (FRAME_CRC_READ() != crc)
+  {
+    FrameCrc_Restore(crc);
+  }
+  while (words-- != 0U)
+  {
+    FRAME_CRC_WRITE(FRAME_CRC_LOAD(data));
+    data += 4;
+  }
+  return FrameCrc_Software(FRAME_CRC_READ(), data, len & 3U);
+}
+
+/**
+  * @brief  FrameCrc_Software
+  *         Same CRC from the table, a byte at a time.
+  * @param  crc: FRAME_CRC_INIT, or the result over the previous bytes
+  * @param  data: bytes
+  * @param  len: byte count
+  * @retval CRC including data
+  */
+uint32_t FrameCrc_Software(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+  while (len-- != 0U)
+  {
+    crc = (crc << 8) ^ codecCrcTable[(crc >> 24) ^ *data++];
+  }
+  return crc;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
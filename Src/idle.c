@@ -0,0 +1,260 @@
+/**
+  ******************************************************************************
+  * @file    idle.c
+  * @brief   Idle manager: sleep between events, economy clock while no
+  *          function streams.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                  Idle manager
+  *          ===================================================================
+  *           The main loop calls Idle_Process() with the functions that
+  *           selected alternate setting 1, then Idle_Enter() with the time
+  *           to its next deadline:
+  *             - streaming: the CPU sleeps in WFI until the next interrupt,
+  *               the OTG SOF every millisecond at least,
+  *             - stopped: the clock manager drops to the economy profile,
+  *               the SOF interrupt is masked and the SysTick stopped. The
+  *               CPU sleeps until a USB request, the user button or a
+  *               compare of the TIM2 timestamp clock at the deadline, then
+  *               the HAL tick is advanced by the time slept.
+  *           The profiles and their changes are in clock.c.
+  *           Interrupts that leave work to the main loop call Idle_Kick(),
+  *           Idle_Enter() then returns at once instead of sleeping on it.
+  *           With PIPELINE_USE_RTOS the RTX idle thread sleeps the same way
+  *           for as long as osKernelSuspend() allows.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "idle.h"
+#include <stdio.h>
+#include "clock.h"
+#include "latency.h"
+#include "pipeline.h"
+
+/* Private define ------------------------------------------------------------*/
+#define IDLE_TICKS_PER_MS               (LATENCY_CLOCK_HZ / 1000U)
+
+/* Private variables ---------------------------------------------------------*/
+extern __IO uint32_t uwTick;
+
+static TIM_HandleTypeDef *idle_tim;
+static PCD_HandleTypeDef *idle_pcd;
+static __IO uint8_t idle_kick;
+static uint32_t idle_tick_rest;                /* time slept not yet in the HAL tick */
+static uint32_t idle_report_time;
+static uint32_t idle_report_asleep;
+static Idle_StatsTypeDef idle_stats;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Idle_Sleep(uint32_t sleep_ms);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Idle_Sleep
+  *         Sleeps until an interrupt, at most sleep_ms. With interrupts
+  *         disabled, the one that wakes the CPU runs once they are enabled
+  *         again.
+  * @param  sleep_ms: longest sleep, 0 for no deadline besides the interrupts
+  * @retval time slept, LATENCY_CLOCK_HZ ticks
+  */
+static uint32_t Idle_Sleep(uint32_t sleep_ms)
+{
+  uint32_t start = Latency_Now();
+  uint32_t slept;
+
+  if (sleep_ms != 0U)
+  {
+    if (sleep_ms > IDLE_MAX_SLEEP)
+    {
+      sleep_ms = IDLE_MAX_SLEEP;
+    }
+    __HAL_TIM_SET_COMPARE(idle_tim, TIM_CHANNEL_1, start + (sleep_ms * IDLE_TICKS_PER_MS));
+    __HAL_TIM_CLEAR_IT(idle_tim, TIM_IT_CC1);
+    __HAL_TIM_ENABLE_IT(idle_tim, TIM_IT_CC1);
+  }
+  __DSB();
+  __WFI();
+  if (sleep_ms != 0U)
+  {
+    __HAL_TIM_DISABLE_IT(idle_tim, TIM_IT_CC1);
+    __HAL_TIM_CLEAR_IT(idle_tim, TIM_IT_CC1);
+    HAL_NVIC_ClearPendingIRQ(TIM2_IRQn);
+  }
+  slept = Latency_Now() - start;
+  idle_stats.sleeps++;
+  idle_stats.asleep_us += slept;
+  return slept;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Idle_Init
+  *         After Clock_Init().
+  * @param  htim: TIM2, free running at LATENCY_CLOCK_HZ (Latency_Init())
+  * @param  hpcd: OTG FS handle, its SOF interrupt is masked while idle
+  * @retval None
+  */
+void Idle_Init(TIM_HandleTypeDef *htim, PCD_HandleTypeDef *hpcd)
+{
+  idle_tim = htim;
+  idle_pcd = hpcd;
+  idle_report_time = Latency_Now();
+}
+
+/**
+  * @brief  Idle_Process
+  *         Picks the clock profile and the SOF interrupt. Main loop only.
+  * @param  active: functions with alternate setting 1, one bit each
+  * @retval None
+  */
+void Idle_Process(uint8_t active)
+{
+  uint32_t primask;
+
+  if ((idle_tim == NULL) || (idle_pcd == NULL))
+  {
+    return;
+  }
+  Clock_Process(active);
+
+  /* the USB interrupt changes GINTMSK as well */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (active != 0U)
+  {
+    /* the SOF starts the stream of a function at alt 1 */
+    USB_UNMASK_INTERRUPT(idle_pcd->Instance, USB_OTG_GINTMSK_SOFM);
+  }
+  else
+  {
+    USB_MASK_INTERRUPT(idle_pcd->Instance, USB_OTG_GINTMSK_SOFM);
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Idle_Enter
+  *         Sleeps until the next interrupt, without the SysTick at the
+  *         economy clock. Main loop only.
+  * @param  sleep_ms: time to the next deadline of the main loop, 0 when
+  *         it is due
+  * @retval None
+  */
+void Idle_Enter(uint32_t sleep_ms)
+{
+  uint32_t slept;
+
+  if ((idle_tim == NULL) || (sleep_ms == 0U))
+  {
+    return;
+  }
+  __disable_irq();
+  if (idle_kick != 0U)
+  {
+    idle_kick = 0U;
+    __enable_irq();
+    return;
+  }
+  if (Clock_GetProfile() == CLOCK_PROFILE_ECONOMY)
+  {
+    HAL_SuspendTick();
+    slept = Idle_Sleep(sleep_ms);
+    idle_tick_rest += slept;
+    uwTick += idle_tick_rest / IDLE_TICKS_PER_MS;
+    idle_tick_rest %= IDLE_TICKS_PER_MS;
+    HAL_ResumeTick();
+  }
+  else
+  {
+    Idle_Sleep(0U);
+  }
+  __enable_irq();
+}
+
+/**
+  * @brief  Idle_Kick
+  *         Work is waiting for the main loop. Interrupt safe.
+  * @retval None
+  */
+void Idle_Kick(void)
+{
+  idle_kick = 1U;
+}
+
+/**
+  * @brief  Idle_GetStats
+  * @param  stats: copy of the counters
+  * @retval None
+  */
+void Idle_GetStats(Idle_StatsTypeDef *stats)
+{
+  *stats = idle_stats;
+}
+
+/**
+  * @brief  Idle_Report
+  *         Prints the share of time asleep since the last report.
+  * @retval None
+  */
+void Idle_Report(void)
+{
+  uint32_t now = Latency_Now();
+  uint32_t window = now - idle_report_time;
+  uint32_t asleep = idle_stats.asleep_us - idle_report_asleep;
+
+  printf("Idle: asleep %lu%%, %lu sleeps\r\n",
+         (unsigned long)((window != 0U) ? (uint32_t)(((uint64_t)asleep * 100U) / window) : 0U),
+         (unsigned long)idle_stats.sleeps);
+  idle_report_time = now;
+  idle_report_asleep = idle_stats.asleep_us;
+}
+
+#if PIPELINE_USE_RTOS
+/**
+  * @brief  RTX idle thread: sleeps with the kernel tick and the HAL tick
+  *         stopped for as long as no timeout is due, then advances both.
+  *         Interrupts stay enabled, osKernelSuspend() is a supervisor call.
+  * @retval None
+  */
+__NO_RETURN void osRtxIdleThread(void *argument)
+{
+  uint32_t ticks;
+  uint32_t slept;
+
+  (void)argument;
+  for (;;)
+  {
+    ticks = osKernelSuspend();
+    slept = 0U;
+    if (ticks != 0U)
+    {
+      /* the HAL tick on TIM6 would end the sleep every millisecond */
+      HAL_SuspendTick();
+      slept = Idle_Sleep((ticks == osWaitForever) ? IDLE_MAX_SLEEP : ticks);
+      HAL_ResumeTick();
+      idle_tick_rest += slept;
+      uwTick += idle_tick_rest / IDLE_TICKS_PER_MS;
+      idle_tick_rest %= IDLE_TICKS_PER_MS;
+      slept = (slept * osKernelGetTickFreq()) / LATENCY_CLOCK_HZ;
+    }
+    osKernelResume(slept);
+  }
+}
+#endif
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,524 @@
+/**
+  ******************************************************************************
+  * @file    image_convert.c
+  * @brief   Image conversion stage.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Image conversion
+  *          ===================================================================
+  *           Pixel format conversion (RGB565, RGB888, ARGB8888), rectangle
+  *           copy and fill, and alpha blended overlays.
+  *           With a DMA2D handle the operations are only started: the CPU is
+  *           free (e.g. to encode the previous frame) until Image_Wait(). Every
+  *           operation waits for the previous one before it starts.
+  *           Without DMA2D the software path produces the same pixels:
+  *             - 5/6-bit channels are expanded by copying their MSBs into the
+  *               LSBs, and reduced by truncation,
+  *             - blending follows the DMA2D formula of RM0090:
+  *               a = aFG.aBG/255, aOUT = aFG + aBG - a,
+  *               COUT = (CFG.aFG + CBG.aBG - CBG.a) / aOUT
+  *           The DMA2D cannot scale, see the resampler for resizing.
+  *           On a host only the software path is built; Utilities/image_host
+  *           checks it against a reference of the formulas above.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "image_convert.h"
+#include "mem_region.h"
+#include <string.h>
+#include <stdio.h>
+
+/* Private define ------------------------------------------------------------*/
+#define IMAGE_LAYER_BACKGROUND          0U
+#define IMAGE_LAYER_FOREGROUND          1U
+
+/* The DMA2D has no path to the CCM RAM, such images take the software path */
+#define IMAGE_DMA2D_REACHABLE(img)      ((((uint32_t)(img)->data) & 0xFFFF0000U) != MEM_CCM_BASE)
+
+/* Private variables ---------------------------------------------------------*/
+static const uint8_t image_bpp[] =
+{
+  [IMAGE_FORMAT_ARGB8888] = 4U,
+  [IMAGE_FORMAT_RGB888]   = 3U,
+  [IMAGE_FORMAT_RGB565]   = 2U,
+};
+
+#if IMAGE_USE_DMA2D
+static const uint32_t image_dma2d_output[] =
+{
+  [IMAGE_FORMAT_ARGB8888] = DMA2D_OUTPUT_ARGB8888,
+  [IMAGE_FORMAT_RGB888]   = DMA2D_OUTPUT_RGB888,
+  [IMAGE_FORMAT_RGB565]   = DMA2D_OUTPUT_RGB565,
+};
+
+static const uint32_t image_dma2d_input[] =
+{
+  [IMAGE_FORMAT_ARGB8888] = DMA2D_INPUT_ARGB8888,
+  [IMAGE_FORMAT_RGB888]   = DMA2D_INPUT_RGB888,
+  [IMAGE_FORMAT_RGB565]   = DMA2D_INPUT_RGB565,
+};
+
+static DMA2D_HandleTypeDef *image_dma2d;
+static uint8_t image_busy;
+#endif
+static uint8_t image_accelerated;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Image_ReadPixel(const Image_TypeDef *img, uint32_t x, uint32_t y);
+static void Image_WritePixel(const Image_TypeDef *img, uint32_t x, uint32_t y, uint32_t argb);
+#if IMAGE_USE_DMA2D
+static HAL_StatusTypeDef Image_Dma2dSetup(uint32_t mode, const Image_TypeDef *dst);
+static HAL_StatusTypeDef Image_Dma2dLayer(uint32_t layer, const Image_TypeDef *src,
+                                          uint32_t alpha_mode, uint8_t alpha);
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Image_ReadPixel
+  * @param  img: image
+  * @param  x, y: pixel position
+  * @retval pixel in ARGB8888
+  */
+static uint32_t Image_ReadPixel(const Image_TypeDef *img, uint32_t x, uint32_t y)
+{
+  const uint8_t *p = (const uint8_t *)img->data + ((y * img->pitch) + x) * image_bpp[img->format];
+  uint32_t c, r, g, b;
+
+  switch (img->format)
+  {
+  case IMAGE_FORMAT_ARGB8888:
+    return *(const uint32_t *)p;
+
+  case IMAGE_FORMAT_RGB888:
+    return 0xFF000000UL | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+
+  default:
+    c = *(const uint16_t *)p;
+    r = (c >> 11) & 0x1FU;
+    g = (c >> 5) & 0x3FU;
+    b = c & 0x1FU;
+    r = (r << 3) | (r >> 2);
+    g = (g << 2) | (g >> 4);
+    b = (b << 3) | (b >> 2);
+    return 0xFF000000UL | (r << 16) | (g << 8) | b;
+  }
+}
+
+/**
+  * @brief  Image_WritePixel
+  * @param  img: image
+  * @param  x, y: pixel position
+  * @param  argb: pixel in ARGB8888
+  * @retval None
+  */
+static void Image_WritePixel(const Image_TypeDef *img, uint32_t x, uint32_t y, uint32_t argb)
+{
+  uint8_t *p = (uint8_t *)img->data + ((y * img->pitch) + x) * image_bpp[img->format];
+
+  switch (img->format)
+  {
+  case IMAGE_FORMAT_ARGB8888:
+    *(uint32_t *)p = argb;
+    break;
+
+  case IMAGE_FORMAT_RGB888:
+    p[0] = (uint8_t)argb;
+    p[1] = (uint8_t)(argb >> 8);
+    p[2] = (uint8_t)(argb >> 16);
+    break;
+
+  default:
+    *(uint16_t *)p = (uint16_t)(((argb >> 8) & 0xF800U) | ((argb >> 5) & 0x07E0U) | ((argb >> 3) & 0x001FU));
+    break;
+  }
+}
+
+#if IMAGE_USE_DMA2D
+/**
+  * @brief  Image_Dma2dSetup
+  *         Programs the transfer mode and the output image.
+  * @param  mode: DMA2D_M2M, DMA2D_M2M_PFC, DMA2D_M2M_BLEND or DMA2D_R2M
+  * @param  dst: output image
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Image_Dma2dSetup(uint32_t mode, const Image_TypeDef *dst)
+{
+  image_dma2d->Init.Mode = mode;
+  image_dma2d->Init.ColorMode = image_dma2d_output[dst->format];
+  image_dma2d->Init.OutputOffset = (uint32_t)dst->pitch - dst->width;
+  return HAL_DMA2D_Init(image_dma2d);
+}
+
+/**
+  * @brief  Image_Dma2dLayer
+  *         Programs an input layer.
+  * @param  layer: IMAGE_LAYER_BACKGROUND or IMAGE_LAYER_FOREGROUND
+  * @param  src: input image
+  * @param  alpha_mode: DMA2D_NO_MODIF_ALPHA, DMA2D_REPLACE_ALPHA or DMA2D_COMBINE_ALPHA
+  * @param  alpha: constant alpha
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Image_Dma2dLayer(uint32_t layer, const Image_TypeDef *src,
+                                          uint32_t alpha_mode, uint8_t alpha)
+{
+  image_dma2d->LayerCfg[layer].InputOffset = (uint32_t)src->pitch - src->width;
+  image_dma2d->LayerCfg[layer].InputColorMode = image_dma2d_input[src->format];
+  image_dma2d->LayerCfg[layer].AlphaMode = alpha_mode;
+  image_dma2d->LayerCfg[layer].InputAlpha = alpha;
+  return HAL_DMA2D_ConfigLayer(image_dma2d, layer);
+}
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Image_Init
+  * @param  hdma2d: DMA2D handle, NULL to use the software path only
+  * @retval HAL status
+  */
+#if !IMAGE_HOST
+HAL_StatusTypeDef Image_Init(DMA2D_HandleTypeDef *hdma2d)
+#else
+HAL_StatusTypeDef Image_Init(void)
+#endif
+{
+#if IMAGE_USE_DMA2D
+  image_dma2d = hdma2d;
+  image_busy = 0U;
+  image_accelerated = (hdma2d != NULL) ? 1U : 0U;
+#else
+  image_accelerated = 0U;
+#endif
+  return HAL_OK;
+}
+
+/**
+  * @brief  Image_SetAccelerated
+  *         Selects the DMA2D or the software path for the next operations.
+  * @param  enable: 1 to use the DMA2D when it is available
+  * @retval None
+  */
+void Image_SetAccelerated(uint8_t enable)
+{
+  Image_Wait();
+#if IMAGE_USE_DMA2D
+  image_accelerated = ((enable != 0U) && (image_dma2d != NULL)) ? 1U : 0U;
+#else
+  (void)enable;
+#endif
+}
+
+/**
+  * @brief  Image_View
+  *         Describes a rectangle of an image as an image.
+  * @param  img: image
+  * @param  x, y: top left corner of the rectangle
+  * @param  width, height: size of the rectangle
+  * @param  view: resulting image, shares the pixels of img
+  * @retval None
+  */
+void Image_View(const Image_TypeDef *img, uint16_t x, uint16_t y,
+                uint16_t width, uint16_t height, Image_TypeDef *view)
+{
+  view->data = (uint8_t *)img->data + (((uint32_t)y * img->pitch) + x) * image_bpp[img->format];
+  view->width = width;
+  view->height = height;
+  view->pitch = img->pitch;
+  view->format = img->format;
+}
+
+/**
+  * @brief  Image_Copy
+  *         Copies src into dst, converting the pixel format if needed.
+  * @param  src: source image, its size is the size of the transfer
+  * @param  dst: destination image
+  * @retval HAL status
+  */
+HAL_StatusTypeDef Image_Copy(const Image_TypeDef *src, const Image_TypeDef *dst)
+{
+  uint32_t x, y;
+
+  if (Image_Wait() != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+#if IMAGE_USE_DMA2D
+  if ((image_accelerated != 0U) && IMAGE_DMA2D_REACHABLE(src) && IMAGE_DMA2D_REACHABLE(dst))
+  {
+    Image_TypeDef out = *dst;
+
+    out.width = src->width;
+    if ((Image_Dma2dSetup((src->format == dst->format) ? DMA2D_M2M : DMA2D_M2M_PFC, &out) != HAL_OK) ||
+        (Image_Dma2dLayer(IMAGE_LAYER_FOREGROUND, src, DMA2D_NO_MODIF_ALPHA, 0xFFU) != HAL_OK) ||
+        (HAL_DMA2D_Start(image_dma2d, (uint32_t)src->data, (uint32_t)dst->data, src->width, src->height) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+    image_busy = 1U;
+    return HAL_OK;
+  }
+#endif
+
+  for (y = 0U; y < src->height; y++)
+  {
+    if (src->format == dst->format)
+    {
+      memcpy((uint8_t *)dst->data + (y * dst->pitch * image_bpp[dst->format]),
+             (const uint8_t *)src->data + (y * src->pitch * image_bpp[src->format]),
+             (uint32_t)src->width * image_bpp[src->format]);
+      continue;
+    }
+    for (x = 0U; x < src->width; x++)
+    {
+      Image_WritePixel(dst, x, y, Image_ReadPixel(src, x, y));
+    }
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Image_Fill
+  *         Fills an image (or a view of it) with a constant color.
+  * @param  dst: image
+  * @param  argb: color in ARGB8888
+  * @retval HAL status
+  */
+HAL_StatusTypeDef Image_Fill(const Image_TypeDef *dst, uint32_t argb)
+{
+  uint32_t x, y;
+
+  if (Image_Wait() != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+#if IMAGE_USE_DMA2D
+  if ((image_accelerated != 0U) && IMAGE_DMA2D_REACHABLE(dst))
+  {
+    if ((Image_Dma2dSetup(DMA2D_R2M, dst) != HAL_OK) ||
+        (HAL_DMA2D_Start(image_dma2d, argb, (uint32_t)dst->data, dst->width, dst->height) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+    image_busy = 1U;
+    return HAL_OK;
+  }
+#endif
+
+  for (y = 0U; y < dst->height; y++)
+  {
+    for (x = 0U; x < dst->width; x++)
+    {
+      Image_WritePixel(dst, x, y, argb);
+    }
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Image_Blend
+  *         Blends the overlay fg over bg into dst (dst may be bg).
+  * @param  fg: overlay, its size is the size of the transfer
+  * @param  bg: background
+  * @param  dst: destination image
+  * @param  alpha: overlay opacity, multiplied with the per-pixel alpha of fg
+  * @retval HAL status
+  */
+HAL_StatusTypeDef Image_Blend(const Image_TypeDef *fg, const Image_TypeDef *bg,
+                              const Image_TypeDef *dst, uint8_t alpha)
+{
+  uint32_t x, y, cf, cb, af, ab, am, ao, out, shift;
+
+  if (Image_Wait() != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+#if IMAGE_USE_DMA2D
+  if ((image_accelerated != 0U) && IMAGE_DMA2D_REACHABLE(fg) && IMAGE_DMA2D_REACHABLE(bg) &&
+      IMAGE_DMA2D_REACHABLE(dst))
+  {
+    Image_TypeDef out_img = *dst;
+
+    out_img.width = fg->width;
+    if ((Image_Dma2dSetup(DMA2D_M2M_BLEND, &out_img) != HAL_OK) ||
+        (Image_Dma2dLayer(IMAGE_LAYER_FOREGROUND, fg, DMA2D_COMBINE_ALPHA, alpha) != HAL_OK) ||
+        (Image_Dma2dLayer(IMAGE_LAYER_BACKGROUND, bg, DMA2D_NO_MODIF_ALPHA, 0xFFU) != HAL_OK) ||
+        (HAL_DMA2D_BlendingStart(image_dma2d, (uint32_t)fg->data, (uint32_t)bg->data,
+                                 (uint32_t)dst->data, fg->width, fg->height) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+    image_busy = 1U;
+    return HAL_OK;
+  }
+#endif
+
+  for (y = 0U; y < fg->height; y++)
+  {
+    for (x = 0U; x < fg->width; x++)
+    {
+      cf = Image_ReadPixel(fg, x, y);
+      cb = Image_ReadPixel(bg, x, y);
+      af = ((cf >> 24) * alpha) / 255U;
+      ab = cb >> 24;
+      am = (af * ab) / 255U;
+      ao = af + ab - am;
+      out = ao << 24;
+      if (ao != 0U)
+      {
+        for (shift = 0U; shift < 24U; shift += 8U)
+        {
+          out |= ((((cf >> shift) & 0xFFU) * af + ((cb >> shift) & 0xFFU) * (ab - am)) / ao) << shift;
+        }
+      }
+      Image_WritePixel(dst, x, y, out);
+    }
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Image_Wait
+  *         Waits for the end of the running DMA2D operation.
+  * @retval HAL status of the operation
+  */
+HAL_StatusTypeDef Image_Wait(void)
+{
+#if IMAGE_USE_DMA2D
+  if (image_busy != 0U)
+  {
+    image_busy = 0U;
+    return HAL_DMA2D_PollForTransfer(image_dma2d, IMAGE_DMA2D_TIMEOUT);
+  }
+#endif
+  return HAL_OK;
+}
+
+#ifdef IMAGE_BENCHMARK
+#define IMAGE_BENCH_WIDTH               80U
+#define IMAGE_BENCH_HEIGHT              60U
+#define IMAGE_BENCH_FRAME_PIXELS        (640UL * 480UL)
+
+static uint32_t bench_argb[2][IMAGE_BENCH_WIDTH * IMAGE_BENCH_HEIGHT];
+static uint16_t bench_rgb565[2][IMAGE_BENCH_WIDTH * IMAGE_BENCH_HEIGHT];
+
+/**
+  * @brief  Image_BenchRun
+  *         Runs one operation on the software path and on the DMA2D, prints
+  *         the cycles per VGA frame and checks both outputs are identical.
+  * @param  name: operation name
+  * @param  op: operation, index 0 or 1 selects the output buffers
+  * @param  out: output buffers
+  * @param  size: output size in bytes
+  * @retval None
+  */
+static void Image_BenchRun(const char *name, void (*op)(uint32_t idx), void *out[2], uint32_t size)
+{
+  uint32_t cycles[2];
+  uint32_t idx;
+
+  for (idx = 0U; idx < 2U; idx++)
+  {
+    Image_SetAccelerated((uint8_t)idx);
+    DWT->CYCCNT = 0U;
+    op(idx);
+    Image_Wait();
+    cycles[idx] = DWT->CYCCNT;
+  }
+  printf("%-12s cpu %8lu dma2d %8lu cycles/frame %s\r\n", name,
+         (unsigned long)(((uint64_t)cycles[0] * IMAGE_BENCH_FRAME_PIXELS) / (IMAGE_BENCH_WIDTH * IMAGE_BENCH_HEIGHT)),
+         (unsigned long)(((uint64_t)cycles[1] * IMAGE_BENCH_FRAME_PIXELS) / (IMAGE_BENCH_WIDTH * IMAGE_BENCH_HEIGHT)),
+         (memcmp(out[0], out[1], size) == 0) ? "match" : "MISMATCH");
+}
+
+static void Image_BenchImage(void *data, uint8_t format, Image_TypeDef *img)
+{
+  img->data = data;
+  img->width = IMAGE_BENCH_WIDTH;
+  img->height = IMAGE_BENCH_HEIGHT;
+  img->pitch = IMAGE_BENCH_WIDTH;
+  img->format = format;
+}
+
+static void Image_BenchToArgb(uint32_t idx)
+{
+  Image_TypeDef src, dst;
+
+  Image_BenchImage(bench_rgb565[0], IMAGE_FORMAT_RGB565, &src);
+  Image_BenchImage(bench_argb[idx], IMAGE_FORMAT_ARGB8888, &dst);
+  Image_Copy(&src, &dst);
+}
+
+static void Image_BenchToRgb565(uint32_t idx)
+{
+  Image_TypeDef src, dst;
+
+  Image_BenchImage(bench_argb[0], IMAGE_FORMAT_ARGB8888, &src);
+  Image_BenchImage(bench_rgb565[idx], IMAGE_FORMAT_RGB565, &dst);
+  Image_Copy(&src, &dst);
+}
+
+static void Image_BenchFill(uint32_t idx)
+{
+  Image_TypeDef dst;
+
+  Image_BenchImage(bench_rgb565[idx], IMAGE_FORMAT_RGB565, &dst);
+  Image_Fill(&dst, 0xFF3366CCUL);
+}
+
+static void Image_BenchBlend(uint32_t idx)
+{
+  Image_TypeDef fg, bg;
+
+  Image_BenchImage(bench_argb[0], IMAGE_FORMAT_ARGB8888, &fg);
+  Image_BenchImage(bench_rgb565[idx], IMAGE_FORMAT_RGB565, &bg);
+  Image_Blend(&fg, &bg, &bg, 0x80U);
+}
+
+/**
+  * @brief  Image_Benchmark
+  *         Compares the software and DMA2D throughput of every operation.
+  * @retval None
+  */
+void Image_Benchmark(void)
+{
+  void *argb[2] = {bench_argb[0], bench_argb[1]};
+  void *rgb565[2] = {bench_rgb565[0], bench_rgb565[1]};
+  uint32_t i;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for (i = 0U; i < (IMAGE_BENCH_WIDTH * IMAGE_BENCH_HEIGHT); i++)
+  {
+    bench_rgb565[0][i] = (uint16_t)(i * 2654435761UL >> 16);
+  }
+
+  /* bench_argb[0] is the reference input of the next operations, keep the software result */
+  Image_BenchRun("565->8888", Image_BenchToArgb, argb, sizeof(bench_argb[0]));
+  for (i = 0U; i < (IMAGE_BENCH_WIDTH * IMAGE_BENCH_HEIGHT); i++)
+  {
+    bench_argb[0][i] = (bench_argb[0][i] & 0x00FFFFFFUL) | ((i & 0xFFU) << 24);
+  }
+  Image_BenchRun("8888->565", Image_BenchToRgb565, rgb565, sizeof(bench_rgb565[0]));
+  Image_BenchRun("fill", Image_BenchFill, rgb565, sizeof(bench_rgb565[0]));
+  memcpy(bench_rgb565[1], bench_rgb565[0], sizeof(bench_rgb565[0]));
+  Image_BenchRun("blend", Image_BenchBlend, rgb565, sizeof(bench_rgb565[0]));
+  Image_SetAccelerated(1U);
+}
+#endif /* IMAGE_BENCHMARK */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file    latency.c
+  * @brief   Latency probe: capture timestamps and marker LED.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Latency probe
+  *          ===================================================================
+  *           TIM2 runs free at LATENCY_CLOCK_HZ on its full 32 bits, about
+  *           71 minutes per wrap. It is the source clock of the UVC payload
+  *           headers: the capture time of a frame is its PTS, and every
+  *           payload carries the clock sampled with the USB frame number
+  *           (SCR). The host compares both with its own USB frame number
+  *           and gets the age of each frame when it arrives.
+  *           In probe mode, set through XU_ROI_LATENCY_PROBE_CONTROL:
+  *             - the headers carry the PTS and the SCR,
+  *             - LD2 lights while one frame of LATENCY_MARK_PERIOD is
+  *               captured, the heartbeat stops. A camera filming both the
+  *               LED and the host screen measures the glass to glass delay,
+  *             - the test patterns burn the frame number in, the one read
+  *               back with XU_ROI_LATENCY_INFO_CONTROL.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "latency.h"
+
+/* Private variables ---------------------------------------------------------*/
+static TIM_HandleTypeDef *latency_tim;
+static __IO uint8_t latency_probe;
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Latency_Init
+  *         Starts the free running timer at LATENCY_CLOCK_HZ.
+  * @param  htim: 32-bit timer, base initialized
+  * @retval None
+  */
+void Latency_Init(TIM_HandleTypeDef *htim)
+{
+  latency_tim = htim;
+  Latency_ClockUpdate();
+  HAL_TIM_Base_Start(htim);
+}
+
+/**
+  * @brief  Latency_ClockUpdate
+  *         Sets the prescaler for the APB1 timer clock of the current clock
+  *         tree, after each change of the bus dividers. The count goes on
+  *         where it was.
+  * @retval None
+  */
+void Latency_ClockUpdate(void)
+{
+  uint32_t clock = HAL_RCC_GetPCLK1Freq();
+  uint32_t count;
+
+  if (latency_tim == NULL)
+  {
+    return;
+  }
+  /* the APB1 timers run at twice PCLK1 when APB1 is divided */
+  if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_HCLK_DIV1)
+  {
+    clock *= 2U;
+  }
+  /* the update event loads the prescaler and clears the count */
+  count = latency_tim->Instance->CNT;
+  __HAL_TIM_SET_PRESCALER(latency_tim, (clock / LATENCY_CLOCK_HZ) - 1U);
+  latency_tim->Instance->EGR = TIM_EGR_UG;
+  latency_tim->Instance->CNT = count;
+}
+
+/**
+  * @brief  Latency_Now
+  *         Interrupt safe.
+  * @retval source clock, LATENCY_CLOCK_HZ ticks
+  */
+uint32_t Latency_Now(void)
+{
+  return (latency_tim != NULL) ? latency_tim->Instance->CNT : 0U;
+}
+
+/**
+  * @brief  Latency_SetProbe
+  *         Interrupt safe.
+  * @param  enable: 1 to drive the marker LED
+  * @retval None
+  */
+void Latency_SetProbe(uint8_t enable)
+{
+  latency_probe = (enable != 0U) ? 1U : 0U;
+  if (latency_probe == 0U)
+  {
+    HAL_GPIO_WritePin(LD2_GPIO_Port, LD2_Pin, GPIO_PIN_RESET);
+  }
+}
+
+/**
+  * @brief  Latency_GetProbe
+  * @retval 1 while the probe mode is on, the marker LED is then taken
+  */
+uint8_t Latency_GetProbe(void)
+{
+  return latency_probe;
+}
+
+/**
+  * @brief  Latency_Capture
+  *         Stamps the capture of a frame and drives the marker LED.
+  * @param  frame: frame number
+  * @retval capture time, the PTS of the frame
+  */
+uint32_t Latency_Capture(uint32_t frame)
+{
+  uint32_t now = Latency_Now();
+
+  if (latency_probe != 0U)
+  {
+    HAL_GPIO_WritePin(LD2_GPIO_Port, LD2_Pin,
+                      ((frame % LATENCY_MARK_PERIOD) == 0U) ? GPIO_PIN_SET : GPIO_PIN_RESET);
+  }
+  return now;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -25,6 +25,25 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include <stdio.h>
+#include "sensor.h"
+#include "image_convert.h"
+#include "color_convert.h"
+#include "capture.h"
+#include "resample.h"
+#include "motion.h"
+#include "tile_delta.h"
+#include "mem_region.h"
+#include "latency.h"
+#include "usbd_uvc.h"
+#include "usbd_uvc_if.h"
+#include "pipeline.h"
+#include "defer.h"
+#include "idle.h"
+#include "clock.h"
+#include "boot.h"
+#include "frame_crc.h"
+#include "stats.h"
+#include "dfu.h"
 
 /* USER CODE END Includes */
 
@@ -46,6 +65,15 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+/* Control task: sensor writes, capture reprogramming, motion policy, LED */
+#define CONTROL_PRIO                    osPriorityBelowNormal
+#define CONTROL_PERIOD                  2U      /* ms */
+
+/* LD2 blink half period */
+#define LED_PERIOD                      500U    /* ms */
+
+/* Period of the reports with DEFER_BENCHMARK or IDLE_BENCHMARK */
+#define REPORT_PERIOD                   5000U   /* ms */
 
 /* USER CODE END PD */
 
@@ -55,11 +83,35 @@
 /* USER CODE END PM */
 
 /* Private variables ---------------------------------------------------------*/
+CRC_HandleTypeDef hcrc;
+
 DCMI_HandleTypeDef hdcmi;
 
+DMA2D_HandleTypeDef hdma2d;
+
+I2C_HandleTypeDef hi2c1;
+DMA_HandleTypeDef hdma_i2c1_tx;
+
+TIM_HandleTypeDef htim2;
+
 UART_HandleTypeDef huart3;
 
+#if MEM_USE_SDRAM
+SDRAM_HandleTypeDef hsdram1;
+
+#endif
 /* USER CODE BEGIN PV */
+extern USBD_HandleTypeDef hUsbDeviceFS;
+extern PCD_HandleTypeDef hpcd_USB_OTG_FS;
+static uint32_t led_tick;
+static uint8_t media_ready;
+static uint8_t boot_reported;
+static uint32_t stats_wait;
+static uint32_t dfu_wait;
+static uint32_t sensor_wait = 0xFFFFFFFFU;
+#if defined(DEFER_BENCHMARK) || defined(IDLE_BENCHMARK)
+static uint32_t report_tick;
+#endif
 
 /* USER CODE END PV */
 
@@ -68,6 +120,14 @@ void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
 static void MX_DCMI_Init(void);
 static void MX_USART3_UART_Init(void);
+static void MX_DMA_Init(void);
+static void MX_I2C1_Init(void);
+static void MX_DMA2D_Init(void);
+static void MX_TIM2_Init(void);
+static void MX_CRC_Init(void);
+#if MEM_USE_SDRAM
+static void MX_FMC_Init(void);
+#endif
 /* USER CODE BEGIN PFP */
 
 PUTCHAR_PROTOTYPE
@@ -82,6 +142,164 @@ PUTCHAR_PROTOTYPE
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
 
+/**
+  * @brief  Sets up what only a stream needs: sensor, capture, DMA2D, SDRAM
+  *         and the frame sources. First stream start, or boot without
+  *         BOOT_LAZY_INIT.
+  * @retval None
+  */
+static void App_InitMedia(void)
+{
+	MX_DCMI_Init();
+	MX_DMA_Init();
+	MX_I2C1_Init();
+	MX_DMA2D_Init();
+#if MEM_USE_SDRAM
+	MX_FMC_Init();
+#endif
+	MemRegion_Init();
+	Sensor_Init(&hi2c1);
+	Capture_Init(&hdcmi);
+	/* the detector sees the luma planes of the test pattern source */
+	Motion_Init(WIDTH, HEIGHT);
+	Image_Init(&hdma2d);
+	UVC_Pattern_Init();
+#ifdef IMAGE_BENCHMARK
+	Image_Benchmark();
+#endif
+#ifdef COLOR_BENCHMARK
+	Color_Benchmark();
+#endif
+#ifdef RESAMPLE_BENCHMARK
+	Resample_Benchmark();
+#endif
+#ifdef TILE_BENCHMARK
+	TileDelta_Benchmark();
+#endif
+	MemRegion_Report();
+	USBD_Pool_Report();
+#ifdef MEM_BENCHMARK
+	MemRegion_Benchmark();
+#endif
+	media_ready = 1U;
+	Boot_Mark(BOOT_STAGE_MEDIA);
+}
+
+/**
+  * @brief  Applies the settings latched by the USB interrupt and blinks LD2.
+  *         Main loop, or control task with PIPELINE_USE_RTOS.
+  * @retval None
+  */
+static void App_Process(void)
+{
+	uint8_t active = USBD_UVC_GetActive(&hUsbDeviceFS);
+	
+	/* full or performance clock and SOF while a function streams */
+	Idle_Process(active);
+	if (active != 0U)
+	{
+		Boot_Mark(BOOT_STAGE_STREAM);
+		if (media_ready == 0U)
+		{
+			App_InitMedia();
+		}
+	}
+	
+	/* sensor writes are issued from here, never from the USB interrupt;
+	   settings latched before the media are set up wait for them */
+	if (media_ready != 0U)
+	{
+		sensor_wait = Sensor_Process();
+		Capture_Process();
+		Motion_Process();
+	}
+	UVC_Pattern_Process();
+	
+	stats_wait = Stats_Process();
+	dfu_wait = Dfu_Process();
+	
+	if ((boot_reported == 0U) && (Boot_GetTime(BOOT_STAGE_FIRST_FRAME) != 0U))
+	{
+		boot_reported = 1U;
+		Boot_Report();
+	}
+	
+	/* the probe mode takes LD2 as its capture marker */
+	if ((Latency_GetProbe() == 0U) && ((HAL_GetTick() - led_tick) >= LED_PERIOD))
+	{
+		led_tick = HAL_GetTick();
+		HAL_GPIO_TogglePin(LD2_GPIO_Port, LD2_Pin);
+	}
+#if defined(DEFER_BENCHMARK) || defined(IDLE_BENCHMARK)
+	if ((HAL_GetTick() - report_tick) >= REPORT_PERIOD)
+	{
+		report_tick = HAL_GetTick();
+#ifdef DEFER_BENCHMARK
+		Defer_Report();
+#endif
+#ifdef IDLE_BENCHMARK
+		Idle_Report();
+		Clock_Report();
+#endif
+	}
+#endif
+}
+
+/**
+  * @brief  Shortest of sleep and the time left in a period.
+  * @retval milliseconds
+  */
+static uint32_t App_Remaining(uint32_t elapsed, uint32_t period, uint32_t sleep)
+{
+	if (elapsed >= period)
+	{
+		return 0U;
+	}
+	return ((period - elapsed) < sleep) ? (period - elapsed) : sleep;
+}
+
+/**
+  * @brief  Time the main loop may sleep: up to the next LD2 toggle, rate
+  *         window, firmware update step, sensor batch or report.
+  * @retval milliseconds
+  */
+static uint32_t App_NextDeadline(void)
+{
+	uint32_t now = HAL_GetTick();
+	uint32_t sleep = (stats_wait < IDLE_MAX_SLEEP) ? stats_wait : IDLE_MAX_SLEEP;
+	
+	/* an image being checked, or the reset after DFU_DETACH */
+	sleep = (dfu_wait < sleep) ? dfu_wait : sleep;
+	/* a delay of a sensor batch, or a control batch waiting for its frame */
+	sleep = (sensor_wait < sleep) ? sensor_wait : sleep;
+	
+	if (Latency_GetProbe() == 0U)
+	{
+		sleep = App_Remaining(now - led_tick, LED_PERIOD, sleep);
+	}
+#if defined(DEFER_BENCHMARK) || defined(IDLE_BENCHMARK)
+	sleep = App_Remaining(now - report_tick, REPORT_PERIOD, sleep);
+#endif
+	return sleep;
+}
+
+#if PIPELINE_USE_RTOS
+/**
+  * @brief  Control task, below the pipeline tasks: the sensor and the DCMI
+  *         are reprogrammed between frames, with no deadline of their own.
+  * @retval None
+  */
+static void App_ControlTask(void *argument)
+{
+	(void)argument;
+	for (;;)
+	{
+		App_Process();
+		osDelay(CONTROL_PERIOD);
+	}
+}
+#endif
+
 /* USER CODE END 0 */
 
 /**
@@ -91,6 +309,9 @@ PUTCHAR_PROTOTYPE
 int main(void)
 {
   /* USER CODE BEGIN 1 */
+#if PIPELINE_USE_RTOS
+	osThreadAttr_t control_attr = { .name = "control", .stack_size = 1024U, .priority = CONTROL_PRIO };
+#endif
 
   /* USER CODE END 1 */
   
@@ -101,6 +322,7 @@ int main(void)
   HAL_Init();
 
   /* USER CODE BEGIN Init */
+	Boot_Init();
 
   /* USER CODE END Init */
 
@@ -108,17 +330,41 @@ int main(void)
   SystemClock_Config();
 
   /* USER CODE BEGIN SysInit */
+	Clock_Init();
+	Boot_Mark(BOOT_STAGE_CLOCK);
 
   /* USER CODE END SysInit */
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
-  MX_DCMI_Init();
   MX_USART3_UART_Init();
+  MX_TIM2_Init();
+  MX_CRC_Init();
   /* USER CODE BEGIN 2 */
 	
-	printf("\r\n\r\nUVC Camera Application Firmware v%s\r\n", FIRMWARE_VER);
+	/* USB first: DCMI, I2C, DMA2D and FMC are set up by App_InitMedia() */
+	Latency_Init(&htim2);
+	FrameCrc_Init(&hcrc);
+	Stats_Init();
+	Dfu_Init();
+	Boot_Mark(BOOT_STAGE_PERIPH);
+#if PIPELINE_USE_RTOS
+	/* the pipeline tasks are created by UVC_Pattern_Init() */
+	osKernelInitialize();
+#endif
+	Defer_Init();
   MX_USB_DEVICE_Init();
+	Boot_Mark(BOOT_STAGE_USB);
+	Idle_Init(&htim2, &hpcd_USB_OTG_FS);
+	
+	printf("\r\n\r\nUVC Camera Application Firmware v%s\r\n", FIRMWARE_VER);
+#if !BOOT_LAZY_INIT
+	App_InitMedia();
+#endif
+#if PIPELINE_USE_RTOS
+	osThreadNew(App_ControlTask, NULL, &control_attr);
+	osKernelStart();
+#endif
 	
   /* USER CODE END 2 */
 
@@ -129,8 +375,8 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
-		HAL_GPIO_TogglePin(LD2_GPIO_Port, LD2_Pin);
-		HAL_Delay(500);
+		App_Process();
+		Idle_Enter(App_NextDeadline());
   }
   /* USER CODE END 3 */
 }
@@ -177,6 +423,32 @@ void SystemClock_Config(void)
   }
 }
 
+/**
+  * @brief CRC Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_CRC_Init(void)
+{
+
+  /* USER CODE BEGIN CRC_Init 0 */
+
+  /* USER CODE END CRC_Init 0 */
+
+  /* USER CODE BEGIN CRC_Init 1 */
+
+  /* USER CODE END CRC_Init 1 */
+  hcrc.Instance = CRC;
+  if (HAL_CRC_Init(&hcrc) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN CRC_Init 2 */
+  /* frame CRC of the payloads, FrameCrc_Init() */
+  /* USER CODE END CRC_Init 2 */
+
+}
+
 /**
   * @brief DCMI Initialization Function
   * @param None
@@ -210,6 +482,137 @@ static void MX_DCMI_Init(void)
 
 }
 
+/**
+  * @brief DMA2D Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_DMA2D_Init(void)
+{
+
+  /* USER CODE BEGIN DMA2D_Init 0 */
+
+  /* USER CODE END DMA2D_Init 0 */
+
+  /* USER CODE BEGIN DMA2D_Init 1 */
+
+  /* USER CODE END DMA2D_Init 1 */
+  hdma2d.Instance = DMA2D;
+  hdma2d.Init.Mode = DMA2D_M2M;
+  hdma2d.Init.ColorMode = DMA2D_OUTPUT_ARGB8888;
+  hdma2d.Init.OutputOffset = 0;
+  hdma2d.LayerCfg[1].InputOffset = 0;
+  hdma2d.LayerCfg[1].InputColorMode = DMA2D_INPUT_ARGB8888;
+  hdma2d.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  hdma2d.LayerCfg[1].InputAlpha = 0;
+  if (HAL_DMA2D_Init(&hdma2d) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if (HAL_DMA2D_ConfigLayer(&hdma2d, 1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN DMA2D_Init 2 */
+
+  /* USER CODE END DMA2D_Init 2 */
+
+}
+
+/** 
+  * Enable DMA controller clock
+  */
+static void MX_DMA_Init(void) 
+{
+  /* DMA controller clock enable */
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /* DMA interrupt init */
+  /* DMA1_Stream6_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Stream6_IRQn, 13, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+
+}
+
+/**
+  * @brief I2C1 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_I2C1_Init(void)
+{
+
+  /* USER CODE BEGIN I2C1_Init 0 */
+
+  /* USER CODE END I2C1_Init 0 */
+
+  /* USER CODE BEGIN I2C1_Init 1 */
+
+  /* USER CODE END I2C1_Init 1 */
+  hi2c1.Instance = I2C1;
+  hi2c1.Init.ClockSpeed = 100000;
+  hi2c1.Init.DutyCycle = I2C_DUTYCYCLE_2;
+  hi2c1.Init.OwnAddress1 = 0;
+  hi2c1.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
+  hi2c1.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+  hi2c1.Init.OwnAddress2 = 0;
+  hi2c1.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+  hi2c1.Init.NoStretchMode = I2C_NOSTRETCH_DISABLE;
+  if (HAL_I2C_Init(&hi2c1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN I2C1_Init 2 */
+
+  /* USER CODE END I2C1_Init 2 */
+
+}
+
+/**
+  * @brief TIM2 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_TIM2_Init(void)
+{
+
+  /* USER CODE BEGIN TIM2_Init 0 */
+
+  /* USER CODE END TIM2_Init 0 */
+
+  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+
+  /* USER CODE BEGIN TIM2_Init 1 */
+
+  /* USER CODE END TIM2_Init 1 */
+  htim2.Instance = TIM2;
+  htim2.Init.Prescaler = 83;
+  htim2.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim2.Init.Period = 0xFFFFFFFF;
+  htim2.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim2.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&htim2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+  if (HAL_TIM_ConfigClockSource(&htim2, &sClockSourceConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim2, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN TIM2_Init 2 */
+  /* 1 MHz free running, the prescaler is set again by Latency_Init() */
+  /* USER CODE END TIM2_Init 2 */
+
+}
+
 /**
   * @brief USART3 Initialization Function
   * @param None
@@ -243,6 +646,56 @@ static void MX_USART3_UART_Init(void)
 
 }
 
+#if MEM_USE_SDRAM
+/* FMC initialization function */
+static void MX_FMC_Init(void)
+{
+
+  /* USER CODE BEGIN FMC_Init 0 */
+
+  /* USER CODE END FMC_Init 0 */
+
+  FMC_SDRAM_TimingTypeDef SdramTiming = {0};
+
+  /* USER CODE BEGIN FMC_Init 1 */
+
+  /* USER CODE END FMC_Init 1 */
+
+  /** Perform the SDRAM1 memory initialization sequence
+  */
+  hsdram1.Instance = FMC_SDRAM_DEVICE;
+  /* hsdram1.Init */
+  hsdram1.Init.SDBank = FMC_SDRAM_BANK2;
+  hsdram1.Init.ColumnBitsNumber = FMC_SDRAM_COLUMN_BITS_NUM_8;
+  hsdram1.Init.RowBitsNumber = FMC_SDRAM_ROW_BITS_NUM_12;
+  hsdram1.Init.MemoryDataWidth = FMC_SDRAM_MEM_BUS_WIDTH_16;
+  hsdram1.Init.InternalBankNumber = FMC_SDRAM_INTERN_BANKS_NUM_4;
+  hsdram1.Init.CASLatency = FMC_SDRAM_CAS_LATENCY_3;
+  hsdram1.Init.WriteProtection = FMC_SDRAM_WRITE_PROTECTION_DISABLE;
+  hsdram1.Init.SDClockPeriod = FMC_SDRAM_CLOCK_PERIOD_2;
+  hsdram1.Init.ReadBurst = FMC_SDRAM_RBURST_ENABLE;
+  hsdram1.Init.ReadPipeDelay = FMC_SDRAM_RPIPE_DELAY_1;
+  /* SdramTiming */
+  SdramTiming.LoadToActiveDelay = 2;
+  SdramTiming.ExitSelfRefreshDelay = 7;
+  SdramTiming.SelfRefreshTime = 4;
+  SdramTiming.RowCycleDelay = 7;
+  SdramTiming.WriteRecoveryTime = 3;
+  SdramTiming.RPDelay = 2;
+  SdramTiming.RCDDelay = 2;
+
+  if (HAL_SDRAM_Init(&hsdram1, &SdramTiming) != HAL_OK)
+  {
+    Error_Handler( );
+  }
+
+  /* USER CODE BEGIN FMC_Init 2 */
+  /* an absent SDRAM is reported by MemRegion_Report(), the frame buffers are not allocated */
+  MemRegion_SdramInit(&hsdram1);
+  /* USER CODE END FMC_Init 2 */
+}
+#endif
+
 /**
   * @brief GPIO Initialization Function
   * @param None
@@ -293,10 +746,77 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   HAL_GPIO_Init(USB_OverCurrent_GPIO_Port, &GPIO_InitStruct);
 
+  /* EXTI interrupt init*/
+  HAL_NVIC_SetPriority(EXTI15_10_IRQn, 1, 0);
+  HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+
 }
 
 /* USER CODE BEGIN 4 */
 
+/**
+  * @brief  Bottom half of the user button: the still trigger runs with the
+  *         USB class, which owns the still state.
+  * @param  arg: USB device
+  * @param  data: UVC function
+  * @retval None
+  */
+static void App_StillTrigger(void *arg, const uint8_t *data)
+{
+	USBD_UVC_StillTrigger((USBD_HandleTypeDef *)arg, data[0]);
+}
+
+/**
+  * @brief  EXTI line detection callback: the user button triggers a still
+  *         image on the first camera. The EXTI preempts the bottom halves
+  *         of the USB class, so the trigger is posted behind them; it has
+  *         the preemption priority of the USB interrupt, the other producer
+  *         of the defer queue.
+  * @param  GPIO_Pin: pin of the EXTI line
+  * @retval None
+  */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+	uint8_t n = 0U;
+
+	if (GPIO_Pin == USER_Btn_Pin)
+	{
+		Defer_Post(App_StillTrigger, &hUsbDeviceFS, &n, sizeof(n));
+		Idle_Kick();
+	}
+}
+
+/**
+  * @brief  The bus clocks changed: the baud rate and the I2C timing follow
+  *         PCLK1.
+  * @param  profile: CLOCK_PROFILE_xxx
+  * @retval None
+  */
+void Clock_ChangedCallback(uint8_t profile)
+{
+	(void)profile;
+	MX_USART3_UART_Init();
+	Sensor_BusClockChanged();
+}
+
+#if PIPELINE_USE_RTOS
+/**
+  * @brief  Period elapsed callback in non blocking mode
+  * @note   This function is called  when TIM6 interrupt took place, inside
+  * HAL_TIM_IRQHandler(). It makes a direct call to HAL_IncTick() to increment
+  * a global variable "uwTick" used as application time base.
+  * @param  htim : TIM handle
+  * @retval None
+  */
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+	if (htim->Instance == TIM6)
+	{
+		HAL_IncTick();
+	}
+}
+#endif
+
 /* USER CODE END 4 */
 
 /**
@@ -0,0 +1,415 @@
+/**
+  ******************************************************************************
+  * @file    mem_region.c
+  * @brief   Memory region manager: SRAM1, CCM RAM and FMC SDRAM.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Memory regions
+  *          ===================================================================
+  *           The scatter file gives each region its own execution region:
+  *             - RW_SRAM1   SRAM1, objects marked MEM_SRAM1 then the default
+  *                          data, SRAM2 and SRAM3 take the rest,
+  *             - RW_STACK   the main stack of the startup file, which every
+  *                          interrupt runs on, at the bottom of the CCM RAM,
+  *             - RW_CCMRAM  objects marked MEM_CCMRAM: packetizer and
+  *                          encoder state the DMAs never touch,
+  *             - RW_SDRAM   objects marked MEM_SDRAM, UNINIT since the SDRAM
+  *                          is not running when the C library clears memory.
+  *           What the linker left free in a region is handed out by
+  *           MemRegion_Alloc(), once at startup and never freed: frame
+  *           buffers whose size is only known at run time.
+  *           MemRegion_Report() prints the usage of every region.
+  *           On a host the regions are plain arrays, nothing is placed by the
+  *           linker and the SDRAM is always present.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mem_region.h"
+#include <stddef.h>
+#include <stdio.h>
+#if defined(MEM_BENCHMARK) && !MEM_REGION_HOST
+#include "image_convert.h"
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define MEM_SDRAM_TIMEOUT               0xFFFFU
+
+/* SDRAM mode register: burst length 1, sequential, CAS latency 3, single write burst */
+#define MEM_SDRAM_MODE                  0x0230U
+
+/* Rows refreshed within 64 ms */
+#define MEM_SDRAM_ROWS                  4096U
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t   *next;       /* first free byte */
+  uint8_t   *limit;      /* end of the region */
+} MemRegion_ArenaTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+#if MEM_REGION_HOST
+
+static uint32_t mem_host_sram1[MEM_SRAM1_SIZE / 4U];
+static uint32_t mem_host_ccm[MEM_CCM_SIZE / 4U];
+static uint32_t mem_host_sdram[MEM_SDRAM_SIZE / 4U];
+
+#else
+
+/* Execution regions of MDK-ARM/ST-NUCLEO-F429ZI-CAM.sct */
+extern uint8_t Image$$RW_SRAM1$$Base[];
+extern uint8_t Image$$RW_SRAM1$$ZI$$Limit[];
+extern uint8_t Image$$RW_STACK$$Base[];
+extern uint8_t Image$$RW_STACK$$ZI$$Length[];
+extern uint8_t Image$$RW_CCMRAM$$Base[];
+extern uint8_t Image$$RW_CCMRAM$$ZI$$Limit[];
+extern uint8_t Image$$RW_SDRAM$$Base[];
+extern uint8_t Image$$RW_SDRAM$$ZI$$Limit[];
+
+#endif
+
+static const char * const mem_region_name[MEM_REGION_NUM] = { "SRAM1", "CCM", "SDRAM" };
+static MemRegion_ArenaTypeDef mem_arena[MEM_REGION_NUM];
+static uint8_t mem_sdram_ready = MEM_REGION_HOST;
+#if !MEM_REGION_HOST && MEM_USE_SDRAM
+static SDRAM_HandleTypeDef *mem_sdram;
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static void MemRegion_Bounds(uint8_t region, uint8_t **base, uint8_t **placed_end, uint32_t *size);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  MemRegion_Bounds
+  *         Returns the region and the end of what the linker placed in it.
+  * @retval None
+  */
+static void MemRegion_Bounds(uint8_t region, uint8_t **base, uint8_t **placed_end, uint32_t *size)
+{
+#if MEM_REGION_HOST
+  static uint8_t * const host_base[MEM_REGION_NUM] =
+  {
+    (uint8_t *)mem_host_sram1, (uint8_t *)mem_host_ccm, (uint8_t *)mem_host_sdram
+  };
+  static const uint32_t host_size[MEM_REGION_NUM] = { MEM_SRAM1_SIZE, MEM_CCM_SIZE, MEM_SDRAM_SIZE };
+
+  *base = host_base[region];
+  *placed_end = host_base[region];
+  *size = host_size[region];
+#else
+  switch (region)
+  {
+    case MEM_REGION_SRAM1:
+      *base = Image$$RW_SRAM1$$Base;
+      *placed_end = Image$$RW_SRAM1$$ZI$$Limit;
+      *size = MEM_SRAM1_SIZE;
+      break;
+
+    case MEM_REGION_CCM:
+      /* the stack takes the bottom of the CCM RAM */
+      *base = Image$$RW_CCMRAM$$Base;
+      *placed_end = Image$$RW_CCMRAM$$ZI$$Limit;
+      *size = (MEM_CCM_BASE + MEM_CCM_SIZE) - (uint32_t)Image$$RW_CCMRAM$$Base;
+      break;
+
+    default:
+      *base = Image$$RW_SDRAM$$Base;
+      *placed_end = Image$$RW_SDRAM$$ZI$$Limit;
+      *size = MEM_SDRAM_SIZE;
+      break;
+  }
+#endif
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+#if !MEM_REGION_HOST && MEM_USE_SDRAM
+/**
+  * @brief  MemRegion_SdramInit
+  *         Runs the SDRAM power up sequence once the FMC is configured and
+  *         checks that the memory answers. Called from MX_FMC_Init().
+  * @param  hsdram: FMC SDRAM handle, bank 2
+  * @retval HAL_ERROR if no SDRAM answers
+  */
+HAL_StatusTypeDef MemRegion_SdramInit(SDRAM_HandleTypeDef *hsdram)
+{
+  FMC_SDRAM_CommandTypeDef cmd;
+  __IO uint32_t *first = (__IO uint32_t *)MEM_SDRAM_BASE;
+  __IO uint32_t *last = (__IO uint32_t *)(MEM_SDRAM_BASE + MEM_SDRAM_SIZE - 4U);
+
+  cmd.CommandTarget = FMC_SDRAM_CMD_TARGET_BANK2;
+  cmd.AutoRefreshNumber = 1U;
+  cmd.ModeRegisterDefinition = 0U;
+
+  /* clock on, at least 100 us before the first command */
+  cmd.CommandMode = FMC_SDRAM_CMD_CLK_ENABLE;
+  if (HAL_SDRAM_SendCommand(hsdram, &cmd, MEM_SDRAM_TIMEOUT) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  HAL_Delay(1);
+
+  cmd.CommandMode = FMC_SDRAM_CMD_PALL;
+  HAL_SDRAM_SendCommand(hsdram, &cmd, MEM_SDRAM_TIMEOUT);
+
+  cmd.CommandMode = FMC_SDRAM_CMD_AUTOREFRESH_MODE;
+  cmd.AutoRefreshNumber = 8U;
+  HAL_SDRAM_SendCommand(hsdram, &cmd, MEM_SDRAM_TIMEOUT);
+
+  cmd.CommandMode = FMC_SDRAM_CMD_LOAD_MODE;
+  cmd.AutoRefreshNumber = 1U;
+  cmd.ModeRegisterDefinition = MEM_SDRAM_MODE;
+  HAL_SDRAM_SendCommand(hsdram, &cmd, MEM_SDRAM_TIMEOUT);
+
+  mem_sdram = hsdram;
+  MemRegion_SdramClock(HAL_RCC_GetHCLKFreq());
+
+  *first = 0x55AA55AAU;
+  *last = 0xAA55AA55U;
+  mem_sdram_ready = ((*first == 0x55AA55AAU) && (*last == 0xAA55AA55U)) ? 1U : 0U;
+  return (mem_sdram_ready != 0U) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  MemRegion_SdramClock
+  *         Programs the refresh timer for an HCLK, SDCLK is HCLK / 2. The
+  *         count is in SDCLK cycles: the clock manager programs the lower of
+  *         two clocks before a switch and the new one after it.
+  * @param  hclk: HCLK in Hz
+  * @retval None
+  */
+void MemRegion_SdramClock(uint32_t hclk)
+{
+  uint32_t sdclk = hclk / 2U;
+
+  if (mem_sdram == NULL)
+  {
+    return;
+  }
+  /* one row every 64 ms / MEM_SDRAM_ROWS, less the 20 cycles margin of RM0090 */
+  HAL_SDRAM_ProgramRefreshRate(mem_sdram, ((sdclk / 1000U) * 64U) / MEM_SDRAM_ROWS - 20U);
+}
+#endif
+
+/**
+  * @brief  MemRegion_Init
+  *         Makes the space the linker left free in each region available to
+  *         MemRegion_Alloc(). Objects allocated before are lost.
+  * @retval None
+  */
+void MemRegion_Init(void)
+{
+  uint8_t *base, *placed_end;
+  uint32_t size;
+  uint8_t region;
+
+  for (region = 0U; region < MEM_REGION_NUM; region++)
+  {
+    MemRegion_Bounds(region, &base, &placed_end, &size);
+    mem_arena[region].next = placed_end;
+    mem_arena[region].limit = base + size;
+    if ((region == MEM_REGION_SDRAM) && (mem_sdram_ready == 0U))
+    {
+      mem_arena[region].limit = placed_end;
+    }
+  }
+}
+
+/**
+  * @brief  MemRegion_Alloc
+  *         Takes size bytes from a region for the lifetime of the firmware.
+  *         Startup only, not interrupt safe.
+  * @param  region: MEM_REGION_xxx
+  * @param  size: bytes
+  * @param  align: power of two, 0 or 1 for none
+  * @retval The object, NULL if the region is absent or full
+  */
+void *MemRegion_Alloc(uint8_t region, uint32_t size, uint32_t align)
+{
+  MemRegion_ArenaTypeDef *arena;
+  uintptr_t start;
+
+  if ((region >= MEM_REGION_NUM) || (mem_arena[region].next == NULL))
+  {
+    return NULL;
+  }
+  arena = &mem_arena[region];
+  align = (align > 1U) ? align : 1U;
+  start = ((uintptr_t)arena->next + (align - 1U)) & ~(uintptr_t)(align - 1U);
+  if ((start > (uintptr_t)arena->limit) || (size > (uint32_t)((uintptr_t)arena->limit - start)))
+  {
+    return NULL;
+  }
+  arena->next = (uint8_t *)(start + size);
+  return (void *)start;
+}
+
+/**
+  * @brief  MemRegion_GetInfo
+  * @param  region: MEM_REGION_xxx
+  * @param  info: filled with the usage of the region
+  * @retval 0, -1 for an unknown region
+  */
+int32_t MemRegion_GetInfo(uint8_t region, MemRegion_InfoTypeDef *info)
+{
+  uint8_t *base, *placed_end;
+  uint32_t size;
+
+  if (region >= MEM_REGION_NUM)
+  {
+    return -1;
+  }
+  MemRegion_Bounds(region, &base, &placed_end, &size);
+  info->name = mem_region_name[region];
+  info->base = base;
+  info->size = size;
+  info->placed = (uint32_t)(placed_end - base);
+  info->allocated = (mem_arena[region].next != NULL) ? (uint32_t)(mem_arena[region].next - placed_end) : 0U;
+  info->present = ((region != MEM_REGION_SDRAM) || (mem_sdram_ready != 0U)) ? 1U : 0U;
+  return 0;
+}
+
+/**
+  * @brief  MemRegion_Report
+  *         Prints the usage of every region.
+  * @retval None
+  */
+void MemRegion_Report(void)
+{
+  MemRegion_InfoTypeDef info;
+  uint8_t region;
+
+  printf("Memory regions:\r\n");
+  for (region = 0U; region < MEM_REGION_NUM; region++)
+  {
+    MemRegion_GetInfo(region, &info);
+    if (info.present == 0U)
+    {
+      printf("  %-5s 0x%08lX  not present (%lu bytes placed)\r\n", info.name,
+             (unsigned long)(uintptr_t)info.base, (unsigned long)info.placed);
+      continue;
+    }
+    printf("  %-5s 0x%08lX  %7lu placed %7lu allocated %7lu free of %7lu\r\n", info.name,
+           (unsigned long)(uintptr_t)info.base, (unsigned long)info.placed, (unsigned long)info.allocated,
+           (unsigned long)(info.size - info.placed - info.allocated), (unsigned long)info.size);
+  }
+#if !MEM_REGION_HOST
+  printf("  stack 0x%08lX  %7lu bytes\r\n", (unsigned long)(uint32_t)Image$$RW_STACK$$Base,
+         (unsigned long)(uint32_t)Image$$RW_STACK$$ZI$$Length);
+#endif
+}
+
+#if defined(MEM_BENCHMARK) && !MEM_REGION_HOST
+#define MEM_BENCH_PACKET_SIZE           1022U   /* full speed isochronous payload */
+#define MEM_BENCH_ROUNDS                2000U
+#define MEM_BENCH_LOAD_WIDTH            128U    /* DMA2D fill keeping SRAM1 busy */
+#define MEM_BENCH_LOAD_HEIGHT           64U
+
+/* Packetizer state as kept by the UVC class */
+typedef struct
+{
+  const uint8_t *frame_ptr;
+  uint8_t        header[2];
+} MemRegion_BenchStateTypeDef;
+
+static MemRegion_BenchStateTypeDef bench_state_sram MEM_SRAM1;
+static uint8_t bench_packet_sram[MEM_BENCH_PACKET_SIZE] MEM_SRAM1;
+static MemRegion_BenchStateTypeDef bench_state_ccm MEM_CCMRAM;
+static uint8_t bench_packet_ccm[MEM_BENCH_PACKET_SIZE] MEM_CCMRAM;
+static uint32_t bench_load[MEM_BENCH_LOAD_WIDTH * MEM_BENCH_LOAD_HEIGHT] MEM_SRAM1;
+
+/**
+  * @brief  MemRegion_BenchPacket
+  *         The work of USBD_UVC_DataIn() for one packet: header and byte copy
+  *         of the frame.
+  * @retval Cycles
+  */
+static uint32_t MemRegion_BenchPacket(MemRegion_BenchStateTypeDef *st, uint8_t *packet)
+{
+  uint32_t start = DWT->CYCCNT;
+  uint32_t i;
+
+  packet[0] = st->header[0];
+  packet[1] = st->header[1];
+  for (i = 2U; i < MEM_BENCH_PACKET_SIZE; i++)
+  {
+    packet[i] = *st->frame_ptr++;
+  }
+  st->frame_ptr -= MEM_BENCH_PACKET_SIZE - 2U;
+  st->header[1] ^= 0x01U;
+  return DWT->CYCCNT - start;
+}
+
+/**
+  * @brief  MemRegion_BenchRun
+  *         Times the packet work with its state in one region, DMA2D idle or
+  *         filling SRAM1 back to back, and prints the spread.
+  * @retval None
+  */
+static void MemRegion_BenchRun(const char *name, MemRegion_BenchStateTypeDef *st, uint8_t *packet, uint8_t load)
+{
+  Image_TypeDef img = { bench_load, MEM_BENCH_LOAD_WIDTH, MEM_BENCH_LOAD_HEIGHT, MEM_BENCH_LOAD_WIDTH,
+                        IMAGE_FORMAT_ARGB8888 };
+  uint32_t i, cycles, min = 0xFFFFFFFFU, max = 0U;
+  uint64_t sum = 0U;
+
+  st->frame_ptr = (const uint8_t *)FLASH_BASE;
+  st->header[0] = 2U;
+  st->header[1] = 0x80U;
+  if (load != 0U)
+  {
+    Image_Fill(&img, 0xFF000000U);
+  }
+  __disable_irq();
+  for (i = 0U; i < MEM_BENCH_ROUNDS; i++)
+  {
+    if ((load != 0U) && ((DMA2D->CR & DMA2D_CR_START) == 0U))
+    {
+      DMA2D->CR |= DMA2D_CR_START;
+    }
+    cycles = MemRegion_BenchPacket(st, packet);
+    min = (cycles < min) ? cycles : min;
+    max = (cycles > max) ? cycles : max;
+    sum += cycles;
+  }
+  __enable_irq();
+  Image_Wait();
+  printf("packet %-5s %-10s min %5lu mean %5lu max %5lu jitter %5lu cycles\r\n", name,
+         (load != 0U) ? "DMA2D load" : "idle", (unsigned long)min,
+         (unsigned long)(sum / MEM_BENCH_ROUNDS), (unsigned long)max, (unsigned long)(max - min));
+}
+
+/**
+  * @brief  MemRegion_Benchmark
+  *         Compares the packetizer with its state and buffer in SRAM1 and in
+  *         CCM RAM while the DMA2D competes for SRAM1 on the bus matrix.
+  * @retval None
+  */
+void MemRegion_Benchmark(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  Image_SetAccelerated(1U);
+  MemRegion_BenchRun("SRAM1", &bench_state_sram, bench_packet_sram, 0U);
+  MemRegion_BenchRun("SRAM1", &bench_state_sram, bench_packet_sram, 1U);
+  MemRegion_BenchRun("CCM", &bench_state_ccm, bench_packet_ccm, 0U);
+  MemRegion_BenchRun("CCM", &bench_state_ccm, bench_packet_ccm, 1U);
+}
+#endif
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
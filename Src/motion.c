@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file    motion.c
+  * @brief   Motion detector and static scene policy.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Motion detector
+  *          ===================================================================
+  *           The luma plane of every captured frame is reduced to a grid of
+  *           block means by the box resampler while its lines arrive. At the
+  *           end of the frame the grid is compared to the previous one:
+  *             - the blocks are halved to Q7 and differenced with
+  *               arm_sub_q7() and arm_abs_q7(),
+  *             - arm_mean_q7() averages each grid row, the score is the
+  *               busiest row in luma steps, 0 to 254, so a small moving
+  *               object is not diluted by the whole frame.
+  *           After MOTION_STATIC_FRAMES frames under the threshold the scene
+  *           is static:
+  *             - MOTION_MODE_SKIP leaves the frame intervals empty on the bus
+  *               but one in MOTION_KEEPALIVE_FRAMES,
+  *             - MOTION_MODE_RATE throttles the capture to 1 of 4 frames.
+  *           The first frame over the threshold streams again.
+  *           The frames are those of the test pattern source, fed by
+  *           UVC_Pattern_Capture() in the main loop or the capture task.
+  *           Motion_Process() runs in the main loop, the setters and
+  *           Motion_SkipFrame() in the USB interrupt. On a host
+  *           (MOTION_HOST) Utilities/motion_host feeds the patterns itself.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "motion.h"
+#include "resample.h"
+#include "mem_region.h"
+#if !MOTION_HOST
+#include "capture.h"
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+#if MOTION_HOST
+#define MOTION_THROTTLE(enable)         Motion_HostThrottle(enable)
+#else
+#define MOTION_THROTTLE(enable)         Capture_SetThrottle(enable)
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define MOTION_GRID_SIZE                (MOTION_GRID_WIDTH * MOTION_GRID_HEIGHT)
+
+/* Private variables ---------------------------------------------------------*/
+static Resample_TypeDef motion_rs;
+static uint32_t motion_work[RESAMPLE_WORK_WORDS(MOTION_GRID_WIDTH)] MEM_CCMRAM;
+static uint8_t motion_grid[MOTION_GRID_HEIGHT][MOTION_GRID_WIDTH] MEM_CCMRAM;
+static q7_t motion_blocks[2][MOTION_GRID_SIZE] MEM_CCMRAM;
+static q7_t *motion_cur = motion_blocks[0];
+static q7_t *motion_prev = motion_blocks[1];
+static uint16_t motion_width;                  /* luma plane size */
+static uint16_t motion_height;
+static uint8_t motion_ready;                   /* the plane size fits the grid */
+static uint8_t motion_valid;                   /* motion_prev holds a frame */
+static uint8_t motion_throttle;                /* capture throttled by MOTION_MODE_RATE */
+static volatile uint8_t motion_mode = MOTION_MODE_OFF;
+static volatile uint8_t motion_threshold = MOTION_THRESHOLD_DEFAULT;
+static volatile uint8_t motion_score;
+static volatile uint8_t motion_static;         /* frames under the threshold, saturated */
+static uint8_t motion_keepalive[MOTION_MAX_STREAMS]; /* frame intervals since the last frame sent while static */
+
+/* Private function prototypes -----------------------------------------------*/
+static void Motion_Analyse(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Motion_Analyse
+  *         Scores the grid of the frame just completed against the previous one.
+  * @retval None
+  */
+static void Motion_Analyse(void)
+{
+  const uint8_t *grid = &motion_grid[0][0];
+  q7_t *swap;
+  q7_t mean, peak = 0;
+  uint32_t i;
+
+  for (i = 0U; i < MOTION_GRID_SIZE; i++)
+  {
+    motion_cur[i] = (q7_t)(grid[i] >> 1);
+  }
+
+  if (motion_valid != 0U)
+  {
+    /* the previous blocks are no longer needed, the differences go in their place */
+    arm_sub_q7(motion_cur, motion_prev, motion_prev, MOTION_GRID_SIZE);
+    arm_abs_q7(motion_prev, motion_prev, MOTION_GRID_SIZE);
+    for (i = 0U; i < MOTION_GRID_HEIGHT; i++)
+    {
+      arm_mean_q7(&motion_prev[i * MOTION_GRID_WIDTH], MOTION_GRID_WIDTH, &mean);
+      peak = (mean > peak) ? mean : peak;
+    }
+  }
+  motion_valid = 1U;
+  swap = motion_prev;
+  motion_prev = motion_cur;
+  motion_cur = swap;
+
+  motion_score = (uint8_t)(peak * 2);
+  if (motion_score >= motion_threshold)
+  {
+    motion_static = 0U;
+  }
+  else if (motion_static < MOTION_STATIC_FRAMES)
+  {
+    motion_static++;
+  }
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Motion_Init
+  *         Sets the size of the luma planes and restarts the detection.
+  * @param  width, height: luma plane size, at most 16 times the grid
+  * @retval HAL_ERROR if the plane cannot be reduced to the grid
+  */
+HAL_StatusTypeDef Motion_Init(uint16_t width, uint16_t height)
+{
+  motion_width = width;
+  motion_height = height;
+  motion_valid = 0U;
+  motion_static = 0U;
+  motion_score = 0U;
+  motion_ready = (Resample_Init(&motion_rs, RESAMPLE_BOX, width, height,
+                                MOTION_GRID_WIDTH, MOTION_GRID_HEIGHT, motion_work) == HAL_OK) ? 1U : 0U;
+  return (motion_ready != 0U) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  Motion_PushLines
+  *         Feeds consecutive lines of the captured luma planes, a frame is
+  *         scored when its last line arrives.
+  * @param  y: first line
+  * @param  pitch: bytes from one line to the next
+  * @param  lines: number of lines
+  * @retval None
+  */
+void Motion_PushLines(const uint8_t *y, uint32_t pitch, uint32_t lines)
+{
+  while ((motion_ready != 0U) && (lines-- > 0U))
+  {
+    Resample_PushLine(&motion_rs, y, motion_grid[motion_rs.out_line]);
+    y += pitch;
+    if (motion_rs.in_line == motion_height)
+    {
+      Motion_Analyse();
+      Resample_Init(&motion_rs, RESAMPLE_BOX, motion_width, motion_height,
+                    MOTION_GRID_WIDTH, MOTION_GRID_HEIGHT, motion_work);
+    }
+  }
+}
+
+/**
+  * @brief  Motion_SetMode
+  *         Interrupt safe.
+  * @param  mode: MOTION_MODE_xxx
+  * @retval None
+  */
+void Motion_SetMode(uint8_t mode)
+{
+  if (mode <= MOTION_MODE_RATE)
+  {
+    motion_mode = mode;
+  }
+}
+
+/**
+  * @brief  Motion_SetThreshold
+  *         Interrupt safe.
+  * @param  threshold: lowest score of a moving scene, 1 to 255
+  * @retval None
+  */
+void Motion_SetThreshold(uint8_t threshold)
+{
+  if (threshold != 0U)
+  {
+    motion_threshold = threshold;
+  }
+}
+
+/**
+  * @brief  Motion_GetScore
+  * @retval Score of the last frame: the mean absolute luma change of its
+  *         busiest block row, 0 to 254
+  */
+uint8_t Motion_GetScore(void)
+{
+  return motion_score;
+}
+
+/**
+  * @brief  Motion_SkipFrame
+  *         Called by the USB interrupt before it starts sending a frame.
+  * @param  stream: UVC function, below MOTION_MAX_STREAMS
+  * @retval 1 to leave the frame interval empty
+  */
+uint8_t Motion_SkipFrame(uint8_t stream)
+{
+  if ((stream >= MOTION_MAX_STREAMS) ||
+      (motion_mode != MOTION_MODE_SKIP) || (motion_static < MOTION_STATIC_FRAMES))
+  {
+    if (stream < MOTION_MAX_STREAMS)
+    {
+      motion_keepalive[stream] = 0U;
+    }
+    return 0U;
+  }
+  if (++motion_keepalive[stream] >= MOTION_KEEPALIVE_FRAMES)
+  {
+    motion_keepalive[stream] = 0U;
+    return 0U;
+  }
+  return 1U;
+}
+
+/**
+  * @brief  Motion_Process
+  *         Throttles the capture of a static scene in MOTION_MODE_RATE.
+  *         Main loop only.
+  * @retval None
+  */
+void Motion_Process(void)
+{
+  uint8_t throttle;
+
+  throttle = ((motion_mode == MOTION_MODE_RATE) && (motion_static >= MOTION_STATIC_FRAMES)) ? 1U : 0U;
+  if (throttle != motion_throttle)
+  {
+    motion_throttle = throttle;
+    MOTION_THROTTLE(throttle);
+  }
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
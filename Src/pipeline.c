@@ -0,0 +1,264 @@
+/**
+  ******************************************************************************
+  * @file    pipeline.c
+  * @brief   Capture, encode and USB tasks on CMSIS-RTOS2.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Frame pipeline
+  *          ===================================================================
+  *           Three tasks pass frame buffers by reference through message
+  *           queues, each buffer is owned by one task at a time:
+  *
+  *             raw_free -> capture -> raw_full -> encode -> out_full -> usb
+  *                ^                                  |                  |
+  *                +----------------------------------+   out_free <-----+
+  *
+  *             - the capture task fills a raw buffer (PIPELINE_PRIO_CAPTURE),
+  *             - the encode task turns it into a payload and gives the raw
+  *               buffer back at once (PIPELINE_PRIO_ENCODE, the longest job,
+  *               preempted by the two others),
+  *             - the USB task hands the payload to the class as soon as the
+  *               previous one is sent, and only then frees the previous one
+  *               (PIPELINE_PRIO_USB).
+  *           With PIPELINE_BUFFERS buffers per stage frame n is sent while
+  *           frame n+1 is encoded and frame n+2 captured. The USB interrupt
+  *           only calls Pipeline_FrameSent(), which sets a thread flag.
+  *           A full stage blocks the one before: frames are never dropped
+  *           between stages, the capture slows down to the USB rate.
+  *           The file only uses the CMSIS-RTOS2 API and builds on a host with
+  *           the shim of Utilities/rtos2_posix.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "pipeline.h"
+
+#if PIPELINE_USE_RTOS
+#include <string.h>
+#include "mem_region.h"
+
+/* Private define ------------------------------------------------------------*/
+#define PIPELINE_SIGNAL_SENT            0x0001U
+
+/* Private variables ---------------------------------------------------------*/
+static const Pipeline_OpsTypeDef *pipeline_ops;
+static osMessageQueueId_t raw_free;
+static osMessageQueueId_t raw_full;
+static osMessageQueueId_t out_free;
+static osMessageQueueId_t out_full;
+static osThreadId_t usb_thread;
+static Pipeline_StatsTypeDef pipeline_stats;
+
+/* Task stacks are only touched by the CPU */
+static uint64_t capture_stack[PIPELINE_STACK_SIZE / 8U] MEM_CCMRAM;
+static uint64_t encode_stack[PIPELINE_STACK_SIZE / 8U] MEM_CCMRAM;
+static uint64_t usb_stack[PIPELINE_STACK_SIZE / 8U] MEM_CCMRAM;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Pipeline_CaptureTask(void *argument);
+static void Pipeline_EncodeTask(void *argument);
+static void Pipeline_UsbTask(void *argument);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Pipeline_CaptureTask
+  *         Fills the free raw buffers.
+  * @retval None
+  */
+static void Pipeline_CaptureTask(void *argument)
+{
+  Pipeline_BufferTypeDef *raw;
+
+  (void)argument;
+  for (;;)
+  {
+    if (osMessageQueueGet(raw_free, &raw, NULL, osWaitForever) != osOK)
+    {
+      continue;
+    }
+    while (pipeline_ops->Capture(raw) != 0)
+    {
+      osDelay(PIPELINE_IDLE_DELAY);
+    }
+    pipeline_stats.captured++;
+    osMessageQueuePut(raw_full, &raw, 0U, osWaitForever);
+  }
+}
+
+/**
+  * @brief  Pipeline_EncodeTask
+  *         Encodes the captured frames into free payload buffers.
+  * @retval None
+  */
+static void Pipeline_EncodeTask(void *argument)
+{
+  Pipeline_BufferTypeDef *raw;
+  Pipeline_BufferTypeDef *out;
+  uint32_t start, ticks;
+
+  (void)argument;
+  for (;;)
+  {
+    if (osMessageQueueGet(raw_full, &raw, NULL, osWaitForever) != osOK)
+    {
+      continue;
+    }
+    osMessageQueueGet(out_free, &out, NULL, osWaitForever);
+
+    start = osKernelGetTickCount();
+    out->frame = raw->frame;
+    out->capture = raw->capture;
+    out->streams = raw->streams;
+    out->flags = raw->flags;
+    out->len = pipeline_ops->Encode(raw, out);
+    ticks = osKernelGetTickCount() - start;
+    if (ticks > pipeline_stats.encode_max)
+    {
+      pipeline_stats.encode_max = ticks;
+    }
+    osMessageQueuePut(raw_free, &raw, 0U, osWaitForever);
+
+    if (out->len == 0U)
+    {
+      pipeline_stats.dropped++;
+      osMessageQueuePut(out_free, &out, 0U, osWaitForever);
+      continue;
+    }
+    pipeline_stats.encoded++;
+    osMessageQueuePut(out_full, &out, 0U, osWaitForever);
+  }
+}
+
+/**
+  * @brief  Pipeline_UsbTask
+  *         Hands the payloads to the class, one at a time.
+  * @retval None
+  */
+static void Pipeline_UsbTask(void *argument)
+{
+  Pipeline_BufferTypeDef *out;
+  Pipeline_BufferTypeDef *inflight = NULL;
+
+  (void)argument;
+  for (;;)
+  {
+    if (osMessageQueueGet(out_full, &out, NULL, osWaitForever) != osOK)
+    {
+      continue;
+    }
+    if (inflight != NULL)
+    {
+      while (pipeline_ops->Busy(inflight) != 0U)
+      {
+        osThreadFlagsWait(PIPELINE_SIGNAL_SENT, osFlagsWaitAny, PIPELINE_SEND_POLL);
+      }
+      pipeline_stats.sent++;
+      osMessageQueuePut(out_free, &inflight, 0U, osWaitForever);
+    }
+    pipeline_ops->Send(out);
+    inflight = out;
+  }
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Pipeline_Init
+  *         Creates the queues and the tasks, before or after osKernelStart().
+  * @param  ops: stages
+  * @param  raw: PIPELINE_BUFFERS capture buffers, data and size set
+  * @param  out: PIPELINE_BUFFERS payload buffers, data and size set
+  * @retval 0 on success
+  */
+int32_t Pipeline_Init(const Pipeline_OpsTypeDef *ops, Pipeline_BufferTypeDef *raw,
+                      Pipeline_BufferTypeDef *out)
+{
+  osThreadAttr_t attr;
+  Pipeline_BufferTypeDef *buf;
+  uint32_t i;
+
+  if ((ops == NULL) || (raw == NULL) || (out == NULL))
+  {
+    return -1;
+  }
+  pipeline_ops = ops;
+  memset(&pipeline_stats, 0, sizeof(pipeline_stats));
+
+  raw_free = osMessageQueueNew(PIPELINE_BUFFERS, sizeof(Pipeline_BufferTypeDef *), NULL);
+  raw_full = osMessageQueueNew(PIPELINE_BUFFERS, sizeof(Pipeline_BufferTypeDef *), NULL);
+  out_free = osMessageQueueNew(PIPELINE_BUFFERS, sizeof(Pipeline_BufferTypeDef *), NULL);
+  out_full = osMessageQueueNew(PIPELINE_BUFFERS, sizeof(Pipeline_BufferTypeDef *), NULL);
+  if ((raw_free == NULL) || (raw_full == NULL) || (out_free == NULL) || (out_full == NULL))
+  {
+    return -1;
+  }
+  for (i = 0U; i < PIPELINE_BUFFERS; i++)
+  {
+    buf = &raw[i];
+    osMessageQueuePut(raw_free, &buf, 0U, 0U);
+    buf = &out[i];
+    osMessageQueuePut(out_free, &buf, 0U, 0U);
+  }
+
+  memset(&attr, 0, sizeof(attr));
+  attr.stack_size = PIPELINE_STACK_SIZE;
+
+  attr.name = "usb";
+  attr.stack_mem = usb_stack;
+  attr.priority = PIPELINE_PRIO_USB;
+  usb_thread = osThreadNew(Pipeline_UsbTask, NULL, &attr);
+
+  attr.name = "encode";
+  attr.stack_mem = encode_stack;
+  attr.priority = PIPELINE_PRIO_ENCODE;
+  if ((usb_thread == NULL) || (osThreadNew(Pipeline_EncodeTask, NULL, &attr) == NULL))
+  {
+    return -1;
+  }
+
+  attr.name = "capture";
+  attr.stack_mem = capture_stack;
+  attr.priority = PIPELINE_PRIO_CAPTURE;
+  return (osThreadNew(Pipeline_CaptureTask, NULL, &attr) != NULL) ? 0 : -1;
+}
+
+/**
+  * @brief  Pipeline_FrameSent
+  *         A function sent the last payload of a frame. Interrupt safe.
+  * @retval None
+  */
+void Pipeline_FrameSent(void)
+{
+  if (usb_thread != NULL)
+  {
+    osThreadFlagsSet(usb_thread, PIPELINE_SIGNAL_SENT);
+  }
+}
+
+/**
+  * @brief  Pipeline_GetStats
+  *         Frame counters of the stages.
+  * @param  stats: copy of the counters
+  * @retval None
+  */
+void Pipeline_GetStats(Pipeline_StatsTypeDef *stats)
+{
+  *stats = pipeline_stats;
+}
+
+#endif /* PIPELINE_USE_RTOS */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,367 @@
+/**
+  ******************************************************************************
+  * @file    resample.c
+  * @brief   Line streaming image resampler for the lower stream resolutions.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Resampler
+  *          ===================================================================
+  *           Scales one 8-bit plane down by up to 16 on each axis while the
+  *           input lines arrive, so no full size frame is ever held:
+  *             - bilinear: pixel centers are aligned, every input line that
+  *               an output line needs is resampled horizontally once into a
+  *               Q15 line (pixel x 128) kept in one of two slots, then the
+  *               two slots are blended with the CMSIS-DSP Q15 vector
+  *               functions; lines no output line needs are skipped,
+  *             - box: the input pixels covered by an output pixel are summed
+  *               in a 16-bit line and divided when the last input line of
+  *               the span arrives.
+  *           All tables are built by Resample_Init() in a work area supplied
+  *           by the caller, RESAMPLE_WORK_WORDS(out_width) words.
+  *           On a host (RESAMPLE_HOST) the same code runs on the portable C
+  *           of the CMSIS-DSP functions; Utilities/resample_host compares it
+  *           with a floating point model there.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "resample.h"
+
+#ifdef RESAMPLE_BENCHMARK
+#include <stdio.h>
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define RESAMPLE_HALF                   0x8000UL    /* 0.5 in Q16 */
+#define RESAMPLE_WEIGHT_MAX             0x7FFF      /* right or bottom pixel only */
+
+/* Private function prototypes -----------------------------------------------*/
+static void Resample_Position(uint32_t index, uint32_t step, uint16_t size, uint16_t *first, q15_t *weight);
+static void Resample_BilinearRow(const Resample_TypeDef *rs, const uint8_t *in, q15_t *dst);
+static uint32_t Resample_BilinearLine(Resample_TypeDef *rs, const uint8_t *in, uint8_t *out);
+static uint32_t Resample_BoxLine(Resample_TypeDef *rs, const uint8_t *in, uint8_t *out);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Resample_Position
+  *         Bilinear source of output pixel index: the two input pixels
+  *         around its center and the weight of the second one.
+  * @param  index: output pixel or line
+  * @param  step: input pixels per output pixel, Q16
+  * @param  size: input size, at least 2
+  * @param  first: first input pixel, the second is first + 1
+  * @param  weight: weight of the second input pixel, Q15
+  * @retval None
+  */
+static void Resample_Position(uint32_t index, uint32_t step, uint16_t size, uint16_t *first, q15_t *weight)
+{
+  uint32_t pos = (((2U * index) + 1U) * step) >> 1;
+
+  pos = (pos > RESAMPLE_HALF) ? (pos - RESAMPLE_HALF) : 0U;
+  if ((pos >> 16) >= (uint32_t)(size - 1U))
+  {
+    /* On the last pixel: keep first + 1 inside the line */
+    *first = (uint16_t)(size - 2U);
+    *weight = RESAMPLE_WEIGHT_MAX;
+  }
+  else
+  {
+    *first = (uint16_t)(pos >> 16);
+    *weight = (q15_t)((pos & 0xFFFFU) >> 1);
+  }
+}
+
+/**
+  * @brief  Resample_BilinearRow
+  *         Horizontal pass of one input line.
+  * @param  rs: resampler
+  * @param  in: input line
+  * @param  dst: out_width pixels x 128
+  * @retval None
+  */
+static void Resample_BilinearRow(const Resample_TypeDef *rs, const uint8_t *in, q15_t *dst)
+{
+  uint32_t x;
+  int32_t a, b;
+
+  for (x = 0U; x < rs->out_width; x++)
+  {
+    a = in[rs->x0[x]];
+    b = in[rs->x0[x] + 1U];
+    dst[x] = (q15_t)((a << 7) + (((b - a) * rs->fx[x]) >> 8));
+  }
+}
+
+/**
+  * @brief  Resample_BilinearLine
+  * @param  rs: resampler
+  * @param  in: input line in_line
+  * @param  out: output line
+  * @retval Number of output lines written, 0 or 1
+  */
+static uint32_t Resample_BilinearLine(Resample_TypeDef *rs, const uint8_t *in, uint8_t *out)
+{
+  uint16_t y0;
+  q15_t fy;
+  const q15_t *src;
+  uint32_t x, last, row = rs->in_line;
+  int32_t v;
+
+  /* An output line on an input line only needs that one */
+  Resample_Position(rs->out_line, rs->step_y, rs->in_height, &y0, &fy);
+  last = (fy == 0) ? y0 : (y0 + 1U);
+  if ((row < y0) || (row > last))
+  {
+    return 0U;
+  }
+
+  Resample_BilinearRow(rs, in, rs->line[row & 1U]);
+  if (row != last)
+  {
+    return 0U;
+  }
+
+  src = rs->line[y0 & 1U];
+  if (fy != 0)
+  {
+    /* top + (bottom - top) x fy, rows y0 and y0 + 1 sit in opposite slots */
+    arm_sub_q15(rs->line[row & 1U], rs->line[y0 & 1U], rs->tmp, rs->out_width);
+    arm_scale_q15(rs->tmp, fy, 0, rs->tmp, rs->out_width);
+    arm_add_q15(rs->line[y0 & 1U], rs->tmp, rs->tmp, rs->out_width);
+    src = rs->tmp;
+  }
+  for (x = 0U; x < rs->out_width; x++)
+  {
+    v = (src[x] + 64) >> 7;
+    out[x] = (uint8_t)((v < 0) ? 0 : ((v > 255) ? 255 : v));
+  }
+  return 1U;
+}
+
+/**
+  * @brief  Resample_BoxLine
+  * @param  rs: resampler
+  * @param  in: input line in_line
+  * @param  out: output line
+  * @retval Number of output lines written, 0 or 1
+  */
+static uint32_t Resample_BoxLine(Resample_TypeDef *rs, const uint8_t *in, uint8_t *out)
+{
+  uint32_t x, i, s, n, rows;
+  uint32_t first = ((uint32_t)rs->out_line * rs->in_height) / rs->out_height;
+  uint32_t last = (((uint32_t)rs->out_line + 1U) * rs->in_height) / rs->out_height;
+
+  for (x = 0U; x < rs->out_width; x++)
+  {
+    for (s = 0U, i = rs->x0[x]; i < rs->x0[x + 1U]; i++)
+    {
+      s += in[i];
+    }
+    rs->sum[x] += (uint16_t)s;
+  }
+
+  if ((rs->in_line + 1U) != last)
+  {
+    return 0U;
+  }
+
+  rows = last - first;
+  for (x = 0U; x < rs->out_width; x++)
+  {
+    n = rows * (uint32_t)(rs->x0[x + 1U] - rs->x0[x]);
+    out[x] = (uint8_t)((rs->sum[x] + (n >> 1)) / n);
+    rs->sum[x] = 0U;
+  }
+  return 1U;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Resample_Init
+  *         Builds the tables of a resampler and rewinds it to the first line.
+  * @param  rs: resampler
+  * @param  mode: RESAMPLE_BOX or RESAMPLE_BILINEAR
+  * @param  in_width, in_height: input plane size, at least 2 x 2
+  * @param  out_width, out_height: output size, 1 to RESAMPLE_MAX_RATIO
+  *         times smaller than the input on each axis
+  * @param  work: RESAMPLE_WORK_WORDS(out_width) words, kept while rs is used
+  * @retval HAL_ERROR if the sizes are out of range
+  */
+HAL_StatusTypeDef Resample_Init(Resample_TypeDef *rs, uint8_t mode,
+                                uint16_t in_width, uint16_t in_height,
+                                uint16_t out_width, uint16_t out_height, uint32_t *work)
+{
+  uint16_t *table = (uint16_t *)work;
+  uint32_t x;
+
+  if ((mode > RESAMPLE_BILINEAR) || (work == NULL) ||
+      (in_width < 2U) || (in_height < 2U) || (out_width == 0U) || (out_height == 0U) ||
+      (out_width > in_width) || (out_height > in_height) ||
+      (in_width > (out_width * RESAMPLE_MAX_RATIO)) || (in_height > (out_height * RESAMPLE_MAX_RATIO)))
+  {
+    return HAL_ERROR;
+  }
+
+  rs->in_width = in_width;
+  rs->in_height = in_height;
+  rs->out_width = out_width;
+  rs->out_height = out_height;
+  rs->mode = mode;
+  rs->step_x = ((uint32_t)in_width << 16) / out_width;
+  rs->step_y = ((uint32_t)in_height << 16) / out_height;
+  rs->in_line = 0U;
+  rs->out_line = 0U;
+
+  /* x0[out_width + 1] | fx or sum[out_width] | line[0] | line[1] | tmp */
+  rs->x0 = table;
+  rs->fx = (q15_t *)(table + out_width + 1U);
+  rs->sum = (uint16_t *)rs->fx;
+  rs->line[0] = rs->fx + out_width;
+  rs->line[1] = rs->line[0] + out_width;
+  rs->tmp = rs->line[1] + out_width;
+
+  if (mode == RESAMPLE_BILINEAR)
+  {
+    for (x = 0U; x < out_width; x++)
+    {
+      Resample_Position(x, rs->step_x, in_width, &rs->x0[x], &rs->fx[x]);
+    }
+  }
+  else
+  {
+    for (x = 0U; x <= out_width; x++)
+    {
+      rs->x0[x] = (uint16_t)((x * in_width) / out_width);
+    }
+    for (x = 0U; x < out_width; x++)
+    {
+      rs->sum[x] = 0U;
+    }
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Resample_PushLine
+  *         Feeds the next input line.
+  * @param  rs: resampler
+  * @param  in: in_width pixels
+  * @param  out: out_width pixels, written when an output line completes
+  * @retval Number of output lines written, 0 or 1
+  */
+uint32_t Resample_PushLine(Resample_TypeDef *rs, const uint8_t *in, uint8_t *out)
+{
+  uint32_t done;
+
+  if ((rs->in_line >= rs->in_height) || (rs->out_line >= rs->out_height))
+  {
+    return 0U;
+  }
+
+  if (rs->mode == RESAMPLE_BILINEAR)
+  {
+    done = Resample_BilinearLine(rs, in, out);
+  }
+  else
+  {
+    done = Resample_BoxLine(rs, in, out);
+  }
+  rs->in_line++;
+  rs->out_line += (uint16_t)done;
+  return done;
+}
+
+/**
+  * @brief  Resample_PushStrip
+  *         Feeds a strip of consecutive input lines, for example the lines
+  *         one DCMI half transfer or one DMA2D conversion delivers.
+  * @param  rs: resampler
+  * @param  in: first input line
+  * @param  in_pitch: bytes from one input line to the next
+  * @param  lines: number of input lines
+  * @param  out: where the next output line goes
+  * @param  out_pitch: bytes from one output line to the next
+  * @retval Number of output lines written
+  */
+uint32_t Resample_PushStrip(Resample_TypeDef *rs, const uint8_t *in, uint32_t in_pitch, uint32_t lines,
+                            uint8_t *out, uint32_t out_pitch)
+{
+  uint32_t count = 0U;
+
+  while (lines-- > 0U)
+  {
+    if (Resample_PushLine(rs, in, out) != 0U)
+    {
+      out += out_pitch;
+      count++;
+    }
+    in += in_pitch;
+  }
+  return count;
+}
+
+#ifdef RESAMPLE_BENCHMARK
+#define RESAMPLE_BENCH_WIDTH            640U
+#define RESAMPLE_BENCH_HEIGHT           480U
+
+static uint8_t bench_in[RESAMPLE_BENCH_WIDTH];
+static uint8_t bench_out[RESAMPLE_BENCH_WIDTH / 2U];
+static uint32_t bench_work[RESAMPLE_WORK_WORDS(RESAMPLE_BENCH_WIDTH / 2U)];
+
+/**
+  * @brief  Resample_Benchmark
+  *         Scales a 640x480 plane to 320x240 and 160x120 with both filters
+  *         and prints the cycles per input frame. The quality against a
+  *         floating point model is measured on a host, Utilities/resample_host.
+  * @retval None
+  */
+void Resample_Benchmark(void)
+{
+  static const uint16_t sizes[][2] = { {320U, 240U}, {160U, 120U} };
+  static const char *const names[] = { "box", "bilinear" };
+  Resample_TypeDef rs;
+  uint32_t s, mode, x, y, start, cycles, lines;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for (mode = RESAMPLE_BOX; mode <= RESAMPLE_BILINEAR; mode++)
+  {
+    for (s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+    {
+      Resample_Init(&rs, (uint8_t)mode, RESAMPLE_BENCH_WIDTH, RESAMPLE_BENCH_HEIGHT,
+                    sizes[s][0], sizes[s][1], bench_work);
+      cycles = 0U;
+      lines = 0U;
+      for (y = 0U; y < RESAMPLE_BENCH_HEIGHT; y++)
+      {
+        for (x = 0U; x < RESAMPLE_BENCH_WIDTH; x++)
+        {
+          bench_in[x] = (uint8_t)((x * 3U) + y);
+        }
+        start = DWT->CYCCNT;
+        lines += Resample_PushLine(&rs, bench_in, bench_out);
+        cycles += DWT->CYCCNT - start;
+      }
+      printf("resample %-8s 640x480 -> %ux%u: %lu cycles/frame, %lu lines\r\n",
+             names[mode], sizes[s][0], sizes[s][1], (unsigned long)cycles, (unsigned long)lines);
+    }
+  }
+}
+#endif /* RESAMPLE_BENCHMARK */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,716 @@
+/**
+  ******************************************************************************
+  * @file    sensor.c
+  * @brief   Image sensor control layer: backend probe, register batches over
+  *          I2C with DMA, image controls.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Sensor control
+  *          ===================================================================
+  *           Sensor_Init() reads the product ID of each backend in turn
+  *           (OV7670, OV2640, OV5640, the mock sensor on a host) and starts
+  *           the register table of the one that answers: reset, then VGA
+  *           RGB565 output, the format of capture.c.
+  *           Register writes go out as batches. A batch is an array of
+  *           register, value pairs that stays valid until it completes:
+  *           a table in flash, or the control batch of this file. Each
+  *           write is one SCCB transfer started with DMA; its completion
+  *           interrupt starts the next one, so a batch costs the CPU one
+  *           interrupt per register. A SENSOR_REG_DELAY pair holds the batch
+  *           for value ms, resumed by Sensor_Process(). On a banked sensor
+  *           the bank select write is inserted whenever the bank of the
+  *           next register differs from the last one selected. A write the
+  *           bus did not acknowledge is sent again, up to
+  *           SENSOR_WRITE_TRIES times; then the batch is given up. The
+  *           completion callback of the batch gets the outcome.
+  *           Image controls (exposure, gain, brightness...) are requested
+  *           from the USB interrupt through Sensor_SetControl(). The request
+  *           only latches the value; nothing is sent on the bus from that
+  *           context. Sensor_Process(), called from the main loop, takes
+  *           the pending controls as one batch once a frame boundary has
+  *           been signalled by Sensor_FrameBoundary(). The backend turns
+  *           them into register values. Only the registers that changed
+  *           are written: a shadow copy of every control register is kept,
+  *           so that shared registers (COM8, VREF...) take a single write
+  *           per batch. Registers are never read back. The shadow copy
+  *           starts from the reset values, updated by the register table.
+  *           After the table, and after a control batch that failed, every
+  *           control register is written again.
+  *           On a host the bus is a model: the tool answers the reads and
+  *           the writes, and completes each write with
+  *           Sensor_HostComplete() as the I2C interrupt would.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sensor.h"
+#include <stddef.h>
+#include <stdio.h>
+#if !SENSOR_HOST
+#include "mem_region.h"
+#include "idle.h"
+#endif
+
+/* Private define ------------------------------------------------------------*/
+
+/* State of the bus */
+#define SENSOR_BUS_IDLE                 0U
+#define SENSOR_BUS_WRITE                1U   /* a write in flight */
+#define SENSOR_BUS_DELAY                2U   /* SENSOR_REG_DELAY of the batch */
+
+/* No bank selected since the last reset or bus error */
+#define SENSOR_BANK_NONE                0xFFFFU
+
+#if SENSOR_HOST
+#define SENSOR_NOW()                    Sensor_HostTime()
+#define SENSOR_LOCK(primask)            ((void)(primask))
+#define SENSOR_UNLOCK(primask)          ((void)(primask))
+#else
+#define SENSOR_NOW()                    HAL_GetTick()
+#define SENSOR_LOCK(primask)            do { (primask) = __get_PRIMASK(); __disable_irq(); } while (0)
+#define SENSOR_UNLOCK(primask)          __set_PRIMASK(primask)
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Probed in this order */
+static const Sensor_DriverTypeDef * const sensor_drivers[] =
+{
+  &Sensor_OV7670,
+  &Sensor_OV2640,
+  &Sensor_OV5640,
+#if SENSOR_HOST
+  &Sensor_Mock,
+#endif
+};
+
+static const Sensor_DriverTypeDef *sensor_drv;  /* NULL until a sensor answered */
+#if !SENSOR_HOST
+static I2C_HandleTypeDef *sensor_i2c;
+static uint8_t sensor_tx MEM_SRAM1;             /* DMA1 does not reach the CCM RAM */
+static volatile uint8_t sensor_bus_stale;       /* PCLK1 changed during a write */
+#else
+static uint16_t sensor_host_reg;                /* write in flight */
+static uint8_t sensor_host_value;
+#endif
+static uint8_t sensor_ready;                    /* register table written */
+
+/* Batch in progress */
+static const Sensor_RegTypeDef *sensor_batch;
+static uint32_t sensor_batch_len;
+static uint32_t sensor_index;
+static Sensor_DoneTypeDef sensor_done;
+static volatile uint8_t sensor_bus;             /* SENSOR_BUS_xxx */
+static uint8_t sensor_tries;
+static uint8_t sensor_bank_write;               /* the write in flight selects a bank */
+static uint16_t sensor_bank;
+static uint32_t sensor_time;                    /* ms: start of the write, end of the delay */
+static Sensor_StatsTypeDef sensor_stats;
+
+/* Written from interrupt context */
+static volatile uint32_t sensor_pending;
+static volatile int32_t  sensor_value[SENSOR_CTRL_NUM];
+static volatile uint8_t  sensor_frame_end;
+static volatile uint32_t sensor_pending_tick;
+static volatile uint8_t  sensor_force;          /* write every control register */
+
+/* Controls applied by the last batch, sensor power-on values */
+static int32_t sensor_state[SENSOR_CTRL_NUM] =
+{
+  [SENSOR_CTRL_AUTO_EXPOSURE]  = 1,
+  [SENSOR_CTRL_EXPOSURE]       = 333,
+  [SENSOR_CTRL_BRIGHTNESS]     = 0,
+  [SENSOR_CTRL_CONTRAST]       = 0x40,
+  [SENSOR_CTRL_GAIN]           = 0,
+  [SENSOR_CTRL_POWER_LINE]     = 0,
+  [SENSOR_CTRL_WB_TEMPERATURE] = 4600,
+  [SENSOR_CTRL_WB_AUTO]        = 1,
+};
+
+/* Last value written to each control register of the backend */
+static uint8_t sensor_shadow[SENSOR_CTRL_REGS_MAX];
+static Sensor_RegTypeDef sensor_ctrl_batch[SENSOR_CTRL_REGS_MAX];
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t Sensor_ReadReg(const Sensor_DriverTypeDef *drv, uint16_t reg, uint8_t *value);
+static int32_t Sensor_Send(uint16_t reg, uint8_t value);
+static void Sensor_Issue(void);
+static void Sensor_Complete(int32_t status);
+static void Sensor_Finish(int32_t status);
+static void Sensor_TableDone(int32_t status);
+static void Sensor_ControlsDone(int32_t status);
+static uint32_t Sensor_BuildControls(uint8_t force);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Sensor_ReadReg
+  *         Blocking read, to probe. SCCB read: register address write and
+  *         data read are two transfers, the sensors do not support a
+  *         repeated start.
+  * @param  drv: backend
+  * @param  reg: register address, with its bank on a banked sensor
+  * @param  value: read value
+  * @retval 0, -1 if the sensor did not answer
+  */
+static int32_t Sensor_ReadReg(const Sensor_DriverTypeDef *drv, uint16_t reg, uint8_t *value)
+{
+#if SENSOR_HOST
+  return Sensor_HostRead(drv->address, reg, value);
+#else
+  uint8_t addr[2];
+  uint8_t bank;
+  uint16_t len = 0U;
+
+  if (drv->banked != 0U)
+  {
+    bank = (uint8_t)(reg >> 8);
+    if (HAL_I2C_Mem_Write(sensor_i2c, drv->address, SENSOR_BANK_REG, I2C_MEMADD_SIZE_8BIT,
+                          &bank, 1U, SENSOR_I2C_TIMEOUT) != HAL_OK)
+    {
+      return -1;
+    }
+    reg &= 0xFFU;
+  }
+  if (drv->reg_size == 2U)
+  {
+    addr[len++] = (uint8_t)(reg >> 8);
+  }
+  addr[len++] = (uint8_t)reg;
+  if ((HAL_I2C_Master_Transmit(sensor_i2c, drv->address, addr, len, SENSOR_I2C_TIMEOUT) != HAL_OK) ||
+      (HAL_I2C_Master_Receive(sensor_i2c, drv->address, value, 1U, SENSOR_I2C_TIMEOUT) != HAL_OK))
+  {
+    return -1;
+  }
+  return 0;
+#endif
+}
+
+/**
+  * @brief  Sensor_Send
+  *         Starts one register write, completed by Sensor_Complete().
+  * @param  reg: register address, without the bank
+  * @param  value: value to write
+  * @retval 0, -1 if the transfer did not start
+  */
+static int32_t Sensor_Send(uint16_t reg, uint8_t value)
+{
+#if SENSOR_HOST
+  sensor_host_reg = reg;
+  sensor_host_value = value;
+  return 0;
+#else
+  if (sensor_bus_stale != 0U)
+  {
+    /* timing of the new PCLK1, deferred while a write was in flight */
+    sensor_bus_stale = 0U;
+    HAL_I2C_Init(sensor_i2c);
+  }
+  sensor_tx = value;
+  return (HAL_I2C_Mem_Write_DMA(sensor_i2c, sensor_drv->address, reg,
+                                (sensor_drv->reg_size == 2U) ? I2C_MEMADD_SIZE_16BIT : I2C_MEMADD_SIZE_8BIT,
+                                &sensor_tx, 1U) == HAL_OK) ? 0 : -1;
+#endif
+}
+
+/**
+  * @brief  Sensor_Issue
+  *         Starts the next write of the batch, a bank select first if
+  *         needed, or holds it on a delay. Interrupt context, or main loop
+  *         while no write is in flight.
+  * @retval None
+  */
+static void Sensor_Issue(void)
+{
+  const Sensor_RegTypeDef *entry;
+  uint16_t reg;
+  uint8_t value;
+
+  if (sensor_index >= sensor_batch_len)
+  {
+    Sensor_Finish(0);
+    return;
+  }
+  entry = &sensor_batch[sensor_index];
+  if (entry->reg == SENSOR_REG_DELAY)
+  {
+    /* a reset before the delay may have changed the bank */
+    sensor_bank = SENSOR_BANK_NONE;
+    sensor_time = SENSOR_NOW() + entry->value;
+    sensor_index++;
+    sensor_bus = SENSOR_BUS_DELAY;
+    return;
+  }
+
+  reg = entry->reg;
+  value = entry->value;
+  sensor_bank_write = 0U;
+  if (sensor_drv->banked != 0U)
+  {
+    if ((reg >> 8) != sensor_bank)
+    {
+      value = (uint8_t)(reg >> 8);
+      reg = SENSOR_BANK_REG;
+      sensor_bank_write = 1U;
+    }
+    else
+    {
+      reg &= 0xFFU;
+    }
+  }
+  sensor_bus = SENSOR_BUS_WRITE;
+  sensor_time = SENSOR_NOW();
+  if (Sensor_Send(reg, value) != 0)
+  {
+    Sensor_Complete(-1);
+  }
+}
+
+/**
+  * @brief  Sensor_Complete
+  *         End of a write: the next one, the same again after a bus error,
+  *         or the end of the batch. Interrupt context.
+  * @param  status: 0 if the write was acknowledged
+  * @retval None
+  */
+static void Sensor_Complete(int32_t status)
+{
+  if (sensor_bus != SENSOR_BUS_WRITE)
+  {
+    return;
+  }
+  if (status != 0)
+  {
+    sensor_bank = SENSOR_BANK_NONE;
+    sensor_tries++;
+    if (sensor_tries < SENSOR_WRITE_TRIES)
+    {
+      sensor_stats.retries++;
+      Sensor_Issue();
+    }
+    else
+    {
+      Sensor_Finish(-1);
+    }
+    return;
+  }
+
+  sensor_tries = 0U;
+  if (sensor_bank_write != 0U)
+  {
+    sensor_bank = (uint16_t)(sensor_batch[sensor_index].reg >> 8);
+  }
+  else
+  {
+    sensor_index++;
+    sensor_stats.writes++;
+  }
+  Sensor_Issue();
+}
+
+/**
+  * @brief  Sensor_Finish
+  *         Frees the bus and calls the completion callback of the batch.
+  * @param  status: 0 if every write was acknowledged
+  * @retval None
+  */
+static void Sensor_Finish(int32_t status)
+{
+  Sensor_DoneTypeDef done = sensor_done;
+
+  sensor_done = NULL;
+  sensor_bus = SENSOR_BUS_IDLE;
+  if (status == 0)
+  {
+    sensor_stats.batches++;
+  }
+  else
+  {
+    sensor_stats.errors++;
+  }
+  if (done != NULL)
+  {
+    done(status);
+  }
+#if !SENSOR_HOST
+  /* the next control batch waits for the main loop */
+  Idle_Kick();
+#endif
+}
+
+/**
+  * @brief  Sensor_TableDone
+  *         The register table of the backend is written: the controls
+  *         follow, all of them.
+  * @param  status: batch outcome
+  * @retval None
+  */
+static void Sensor_TableDone(int32_t status)
+{
+  sensor_ready = (status == 0) ? 1U : 0U;
+  sensor_force = 1U;
+  sensor_pending_tick = SENSOR_NOW();
+}
+
+/**
+  * @brief  Sensor_ControlsDone
+  *         A control batch that failed leaves the shadow copy unsure: the
+  *         next batch writes every control register.
+  * @param  status: batch outcome
+  * @retval None
+  */
+static void Sensor_ControlsDone(int32_t status)
+{
+  if (status != 0)
+  {
+    sensor_force = 1U;
+    sensor_pending_tick = SENSOR_NOW();
+  }
+}
+
+/**
+  * @brief  Sensor_BuildControls
+  *         Fills the control batch with the registers whose value differs
+  *         from the shadow copy, and updates the copy.
+  * @param  force: 1 to take every control register
+  * @retval writes in the batch
+  */
+static uint32_t Sensor_BuildControls(uint8_t force)
+{
+  uint8_t regs[SENSOR_CTRL_REGS_MAX];
+  uint32_t len = 0U;
+  uint32_t n;
+
+  for (n = 0U; n < sensor_drv->ctrl_len; n++)
+  {
+    regs[n] = sensor_shadow[n];
+  }
+  sensor_drv->Build(sensor_state, regs);
+  for (n = 0U; n < sensor_drv->ctrl_len; n++)
+  {
+    if ((force == 0U) && (regs[n] == sensor_shadow[n]))
+    {
+      continue;
+    }
+    sensor_ctrl_batch[len].reg = sensor_drv->ctrl[n].reg;
+    sensor_ctrl_batch[len].value = regs[n];
+    sensor_shadow[n] = regs[n];
+    len++;
+  }
+  return len;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Sensor_Init
+  *         Probes the backends and starts the register table of the sensor
+  *         found. The controls are written once the table is.
+  * @param  hi2c: I2C bus the sensor is connected to, its TX DMA linked
+  * @retval 0 if a sensor answered
+  */
+#if !SENSOR_HOST
+int32_t Sensor_Init(I2C_HandleTypeDef *hi2c)
+#else
+int32_t Sensor_Init(void)
+#endif
+{
+  const Sensor_DriverTypeDef *drv;
+  uint8_t id = 0U;
+  uint32_t n, k;
+
+#if !SENSOR_HOST
+  sensor_i2c = hi2c;
+#endif
+  sensor_drv = NULL;
+  sensor_ready = 0U;
+  sensor_bus = SENSOR_BUS_IDLE;
+  sensor_bank = SENSOR_BANK_NONE;
+
+  for (n = 0U; n < (sizeof(sensor_drivers) / sizeof(sensor_drivers[0])); n++)
+  {
+    drv = sensor_drivers[n];
+    if ((Sensor_ReadReg(drv, drv->id_reg, &id) == 0) && (id == drv->id))
+    {
+      sensor_drv = drv;
+      break;
+    }
+  }
+  if ((sensor_drv == NULL) || (sensor_drv->ctrl_len > SENSOR_CTRL_REGS_MAX))
+  {
+    sensor_drv = NULL;
+    printf("Sensor not found\r\n");
+    return -1;
+  }
+
+  /* control registers as the register table leaves them */
+  for (n = 0U; n < sensor_drv->ctrl_len; n++)
+  {
+    sensor_shadow[n] = sensor_drv->ctrl[n].value;
+    for (k = 0U; k < sensor_drv->init_len; k++)
+    {
+      if (sensor_drv->init[k].reg == sensor_drv->ctrl[n].reg)
+      {
+        sensor_shadow[n] = sensor_drv->init[k].value;
+      }
+    }
+  }
+  printf("Sensor %s found\r\n", sensor_drv->name);
+  return Sensor_Write(sensor_drv->init, sensor_drv->init_len, Sensor_TableDone);
+}
+
+/**
+  * @brief  Sensor_Write
+  *         Starts a batch of register writes. Main loop only.
+  * @param  regs: len pairs, valid until done is called
+  * @param  len: pairs in the batch
+  * @param  done: completion callback, NULL for none
+  * @retval 0, -1 if no sensor answered or a batch is in progress
+  */
+int32_t Sensor_Write(const Sensor_RegTypeDef *regs, uint32_t len, Sensor_DoneTypeDef done)
+{
+  if ((sensor_drv == NULL) || (sensor_bus != SENSOR_BUS_IDLE))
+  {
+    return -1;
+  }
+  sensor_batch = regs;
+  sensor_batch_len = len;
+  sensor_index = 0U;
+  sensor_tries = 0U;
+  sensor_done = done;
+  Sensor_Issue();
+  return 0;
+}
+
+/**
+  * @brief  Sensor_Busy
+  * @retval 1 while a batch is in progress
+  */
+uint8_t Sensor_Busy(void)
+{
+  return (sensor_bus != SENSOR_BUS_IDLE) ? 1U : 0U;
+}
+
+/**
+  * @brief  Sensor_SetControl
+  *         Latches a new control value, applied with the next batch.
+  *         Safe to call from interrupt context, does not access the bus.
+  * @param  ctrl: control
+  * @param  value: new value, already range checked
+  * @retval None
+  */
+void Sensor_SetControl(Sensor_ControlTypeDef ctrl, int32_t value)
+{
+  if ((uint32_t)ctrl >= SENSOR_CTRL_NUM)
+  {
+    return;
+  }
+
+  sensor_value[ctrl] = value;
+  if (sensor_pending == 0U)
+  {
+    /* first control of a new batch */
+    sensor_pending_tick = SENSOR_NOW();
+    sensor_frame_end = 0U;
+  }
+  sensor_pending |= (1UL << ctrl);
+}
+
+/**
+  * @brief  Sensor_FrameBoundary
+  *         Signals the end of a frame, the pending batch may be applied.
+  *         Safe to call from interrupt context.
+  * @retval None
+  */
+void Sensor_FrameBoundary(void)
+{
+  sensor_frame_end = 1U;
+}
+
+/**
+  * @brief  Sensor_Process
+  *         Resumes a batch after its delay, gives up a write the bus lost,
+  *         and starts the pending control batch once a frame has ended.
+  *         Main loop only, never waits on the bus.
+  * @retval ms until it needs a call, 0xFFFFFFFF for none
+  */
+uint32_t Sensor_Process(void)
+{
+  uint32_t now = SENSOR_NOW();
+  uint32_t pending;
+  uint32_t primask;
+  uint32_t elapsed;
+  uint32_t len;
+  uint32_t n;
+
+  if (sensor_drv == NULL)
+  {
+    return 0xFFFFFFFFU;
+  }
+
+  SENSOR_LOCK(primask);
+  if ((sensor_bus == SENSOR_BUS_WRITE) && ((now - sensor_time) > SENSOR_I2C_TIMEOUT))
+  {
+#if !SENSOR_HOST
+    /* no completion: the peripheral and its DMA start over */
+    HAL_I2C_DeInit(sensor_i2c);
+    HAL_I2C_Init(sensor_i2c);
+#endif
+    sensor_bank = SENSOR_BANK_NONE;
+    Sensor_Finish(-1);
+  }
+  SENSOR_UNLOCK(primask);
+
+  if (sensor_bus == SENSOR_BUS_DELAY)
+  {
+    if ((int32_t)(sensor_time - now) > 0)
+    {
+      return sensor_time - now;
+    }
+    Sensor_Issue();
+  }
+  if (sensor_bus != SENSOR_BUS_IDLE)
+  {
+    return SENSOR_I2C_TIMEOUT;
+  }
+  if ((sensor_ready == 0U) || ((sensor_pending == 0U) && (sensor_force == 0U)))
+  {
+    return 0xFFFFFFFFU;
+  }
+  elapsed = now - sensor_pending_tick;
+  if ((sensor_frame_end == 0U) && (elapsed < SENSOR_BATCH_TIMEOUT_MS))
+  {
+    return SENSOR_BATCH_TIMEOUT_MS - elapsed;
+  }
+
+  /* take the batch atomically, controls set from now on go to the next one */
+  SENSOR_LOCK(primask);
+  pending = sensor_pending;
+  sensor_pending = 0U;
+  sensor_frame_end = 0U;
+  for (n = 0U; n < SENSOR_CTRL_NUM; n++)
+  {
+    if ((pending & (1UL << n)) != 0U)
+    {
+      sensor_state[n] = sensor_value[n];
+    }
+  }
+  SENSOR_UNLOCK(primask);
+
+  len = Sensor_BuildControls(sensor_force);
+  sensor_force = 0U;
+  if (len != 0U)
+  {
+    Sensor_Write(sensor_ctrl_batch, len, Sensor_ControlsDone);
+  }
+  return (sensor_bus != SENSOR_BUS_IDLE) ? SENSOR_I2C_TIMEOUT : 0xFFFFFFFFU;
+}
+
+/**
+  * @brief  Sensor_BusClockChanged
+  *         PCLK1 changed: the I2C timing is computed again, after the write
+  *         in flight if there is one. Main loop.
+  * @retval None
+  */
+void Sensor_BusClockChanged(void)
+{
+#if !SENSOR_HOST
+  uint32_t primask;
+
+  if (sensor_i2c == NULL)
+  {
+    return;
+  }
+  SENSOR_LOCK(primask);
+  if (sensor_bus == SENSOR_BUS_WRITE)
+  {
+    sensor_bus_stale = 1U;
+  }
+  else
+  {
+    HAL_I2C_Init(sensor_i2c);
+  }
+  SENSOR_UNLOCK(primask);
+#endif
+}
+
+/**
+  * @brief  Sensor_GetName
+  * @retval name of the backend found, "none" before
+  */
+const char *Sensor_GetName(void)
+{
+  return (sensor_drv != NULL) ? sensor_drv->name : "none";
+}
+
+/**
+  * @brief  Sensor_GetStats
+  * @param  stats: copy of the counters
+  * @retval None
+  */
+void Sensor_GetStats(Sensor_StatsTypeDef *stats)
+{
+  *stats = sensor_stats;
+}
+
+#if SENSOR_HOST
+/**
+  * @brief  Sensor_HostComplete
+  *         End of the write in flight on the bus model, as the I2C
+  *         interrupt. Ignored while no write is in flight.
+  * @param  status: 0 to let the model answer, -1 for a bus error
+  * @retval None
+  */
+void Sensor_HostComplete(int32_t status)
+{
+  if (sensor_bus != SENSOR_BUS_WRITE)
+  {
+    return;
+  }
+  if (status == 0)
+  {
+    status = Sensor_HostWrite(sensor_drv->address, sensor_host_reg, sensor_host_value);
+  }
+  Sensor_Complete(status);
+}
+#else
+/**
+  * @brief  Memory write with DMA complete: next write of the batch.
+  * @param  hi2c: I2C handle
+  * @retval None
+  */
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == sensor_i2c)
+  {
+    Sensor_Complete(0);
+  }
+}
+
+/**
+  * @brief  No acknowledge or bus error: the write is sent again.
+  * @param  hi2c: I2C handle
+  * @retval None
+  */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == sensor_i2c)
+  {
+    Sensor_Complete(-1);
+  }
+}
+#endif
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
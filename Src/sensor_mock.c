@@ -0,0 +1,138 @@
+/**
+  ******************************************************************************
+  * @file    sensor_mock.c
+  * @brief   Mock sensor backend, for the bus model of a host build.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Mock sensor
+  *          ===================================================================
+  *           A banked sensor with one register per control, in bank 1,
+  *           holding the control value itself: a host tool checks what the
+  *           batch engine wrote without the conversions of a real sensor.
+  *           Bank 0 holds the reset and the output format.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sensor.h"
+
+#if SENSOR_HOST
+
+/* Private typedef -----------------------------------------------------------*/
+
+/* Registers driven by the controls, in the order they are written */
+typedef enum
+{
+  MOCK_CTRL_FLAGS = 0,
+  MOCK_CTRL_EXPOSURE_HI,
+  MOCK_CTRL_EXPOSURE_LO,
+  MOCK_CTRL_BRIGHTNESS,
+  MOCK_CTRL_CONTRAST,
+  MOCK_CTRL_GAIN_HI,
+  MOCK_CTRL_GAIN_LO,
+  MOCK_CTRL_WB_HI,
+  MOCK_CTRL_WB_LO,
+  MOCK_CTRL_NUM
+} Mock_CtrlTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Reset, then VGA RGB565 */
+static const Sensor_RegTypeDef mock_init[] =
+{
+  { SENSOR_MOCK_REG_RESET,    0x80U },
+  { SENSOR_REG_DELAY,         SENSOR_MOCK_RESET_MS },
+  { SENSOR_MOCK_REG_FORMAT,   0x01U },       /* RGB565 */
+  { SENSOR_MOCK_REG_WIDTH8,   640U / 8U },
+  { SENSOR_MOCK_REG_HEIGHT8,  480U / 8U },
+  { SENSOR_MOCK_REG_FLAGS,    SENSOR_MOCK_FLAG_AE | SENSOR_MOCK_FLAG_AWB },
+};
+
+/* Registers driven by the controls, power-on values */
+static const Sensor_RegTypeDef mock_ctrl[MOCK_CTRL_NUM] =
+{
+  [MOCK_CTRL_FLAGS]       = { SENSOR_MOCK_REG_FLAGS,       0x00U },
+  [MOCK_CTRL_EXPOSURE_HI] = { SENSOR_MOCK_REG_EXPOSURE_HI, 0x00U },
+  [MOCK_CTRL_EXPOSURE_LO] = { SENSOR_MOCK_REG_EXPOSURE_LO, 0x00U },
+  [MOCK_CTRL_BRIGHTNESS]  = { SENSOR_MOCK_REG_BRIGHTNESS,  0x00U },
+  [MOCK_CTRL_CONTRAST]    = { SENSOR_MOCK_REG_CONTRAST,    0x00U },
+  [MOCK_CTRL_GAIN_HI]     = { SENSOR_MOCK_REG_GAIN_HI,     0x00U },
+  [MOCK_CTRL_GAIN_LO]     = { SENSOR_MOCK_REG_GAIN_LO,     0x00U },
+  [MOCK_CTRL_WB_HI]       = { SENSOR_MOCK_REG_WB_HI,       0x00U },
+  [MOCK_CTRL_WB_LO]       = { SENSOR_MOCK_REG_WB_LO,       0x00U },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void Mock_Build(const int32_t *state, uint8_t *regs);
+
+/* Exported variables --------------------------------------------------------*/
+const Sensor_DriverTypeDef Sensor_Mock =
+{
+  .name     = "mock",
+  .address  = SENSOR_MOCK_ADDRESS,
+  .reg_size = 1U,
+  .banked   = 1U,
+  .id_reg   = SENSOR_MOCK_REG_ID,
+  .id       = SENSOR_MOCK_ID,
+  .init     = mock_init,
+  .init_len = sizeof(mock_init) / sizeof(mock_init[0]),
+  .ctrl     = mock_ctrl,
+  .ctrl_len = MOCK_CTRL_NUM,
+  .Build    = Mock_Build,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Mock_Build
+  *         Copies the controls into their registers.
+  * @param  state: SENSOR_CTRL_NUM control values
+  * @param  regs: MOCK_CTRL_NUM register values
+  * @retval None
+  */
+static void Mock_Build(const int32_t *state, uint8_t *regs)
+{
+  uint8_t flags = 0U;
+
+  if (state[SENSOR_CTRL_AUTO_EXPOSURE] != 0)
+  {
+    flags |= SENSOR_MOCK_FLAG_AE;
+  }
+  if (state[SENSOR_CTRL_WB_AUTO] != 0)
+  {
+    flags |= SENSOR_MOCK_FLAG_AWB;
+  }
+  if (state[SENSOR_CTRL_POWER_LINE] != 0)
+  {
+    flags |= SENSOR_MOCK_FLAG_BAND;
+  }
+  if (state[SENSOR_CTRL_POWER_LINE] == 1)
+  {
+    flags |= SENSOR_MOCK_FLAG_HZ50;
+  }
+  regs[MOCK_CTRL_FLAGS]       = flags;
+  regs[MOCK_CTRL_EXPOSURE_HI] = (uint8_t)(state[SENSOR_CTRL_EXPOSURE] >> 8);
+  regs[MOCK_CTRL_EXPOSURE_LO] = (uint8_t)state[SENSOR_CTRL_EXPOSURE];
+  regs[MOCK_CTRL_BRIGHTNESS]  = (uint8_t)state[SENSOR_CTRL_BRIGHTNESS];
+  regs[MOCK_CTRL_CONTRAST]    = (uint8_t)state[SENSOR_CTRL_CONTRAST];
+  regs[MOCK_CTRL_GAIN_HI]     = (uint8_t)(state[SENSOR_CTRL_GAIN] >> 8);
+  regs[MOCK_CTRL_GAIN_LO]     = (uint8_t)state[SENSOR_CTRL_GAIN];
+  regs[MOCK_CTRL_WB_HI]       = (uint8_t)(state[SENSOR_CTRL_WB_TEMPERATURE] >> 8);
+  regs[MOCK_CTRL_WB_LO]       = (uint8_t)state[SENSOR_CTRL_WB_TEMPERATURE];
+}
+
+#endif /* SENSOR_HOST */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
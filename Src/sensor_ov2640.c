@@ -0,0 +1,225 @@
+/**
+  ******************************************************************************
+  * @file    sensor_ov2640.c
+  * @brief   OV2640 backend of the sensor layer.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sensor.h"
+
+/* Private define ------------------------------------------------------------*/
+
+/* OV2640 registers, bank in [15:8]: 0 DSP, 1 sensor */
+#define OV2640_REG_CTRL1                0x00C3U  /* DSP: [3] AWB */
+#define OV2640_REG_R_DVP_SP             0x00D3U
+#define OV2640_REG_IMAGE_MODE           0x00DAU
+#define OV2640_REG_RESET                0x00E0U
+#define OV2640_REG_HSIZE8               0x00C0U
+#define OV2640_REG_VSIZE8               0x00C1U
+#define OV2640_REG_GAIN                 0x0100U  /* [7:4] x2 stages, [3:0] 1/16 steps */
+#define OV2640_REG_REG04                0x0104U  /* [1:0] exposure [1:0] */
+#define OV2640_REG_COM3                 0x010CU  /* [2] 50 Hz banding */
+#define OV2640_REG_PIDH                 0x010AU
+#define OV2640_REG_AEC                  0x0110U  /* exposure [9:2] */
+#define OV2640_REG_CLKRC                0x0111U
+#define OV2640_REG_COM7                 0x0112U
+#define OV2640_REG_COM8                 0x0113U
+#define OV2640_REG_REG45                0x0145U  /* [5:0] exposure [15:10] */
+
+#define OV2640_PIDH                     0x26U
+
+#define OV2640_COM7_RESET               0x80U
+#define OV2640_COM7_SVGA                0x40U
+#define OV2640_COM8_AEC                 0x01U
+#define OV2640_COM8_AGC                 0x04U
+#define OV2640_COM8_BNDF                0x20U
+#define OV2640_COM3_HZ50                0x04U
+#define OV2640_CTRL1_AWB                0x08U
+#define OV2640_REG04_AEC_MASK           0x03U
+#define OV2640_REG45_AEC_MASK           0x3FU
+#define OV2640_IMAGE_MODE_RGB565        0x08U
+
+/* Duration of one sensor row at 15 fps, SVGA (672 rows per frame) */
+#define OV2640_ROW_TIME_US              99U
+
+/* Private typedef -----------------------------------------------------------*/
+
+/* Registers driven by the controls, in the order they are written */
+typedef enum
+{
+  OV2640_CTRL_COM8 = 0,
+  OV2640_CTRL_COM3,
+  OV2640_CTRL_GAIN,
+  OV2640_CTRL_REG04,
+  OV2640_CTRL_AEC,
+  OV2640_CTRL_REG45,
+  OV2640_CTRL_CTRL1,
+  OV2640_CTRL_NUM
+} OV2640_CtrlTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Reset, SVGA sensor readout scaled to VGA RGB565 by the DSP. Abridged:
+   the sensor analog settings are left at their reset values. */
+static const Sensor_RegTypeDef ov2640_init[] =
+{
+  { OV2640_REG_COM7,       OV2640_COM7_RESET },
+  { SENSOR_REG_DELAY,      5U },
+  /* sensor: SVGA readout */
+  { OV2640_REG_COM7,       OV2640_COM7_SVGA },
+  { OV2640_REG_CLKRC,      0x01U },          /* XCLK / 2 */
+  { 0x0117U,               0x11U },          /* HREFST */
+  { 0x0118U,               0x43U },          /* HREFEND */
+  { 0x0119U,               0x00U },          /* VSTRT */
+  { 0x011AU,               0x4BU },          /* VEND */
+  { 0x0132U,               0x09U },          /* REG32 */
+  { 0x0137U,               0xC0U },
+  { 0x014FU,               0xCAU },          /* BD50 */
+  { 0x0150U,               0xA8U },          /* BD60 */
+  { 0x015AU,               0x23U },
+  { 0x016DU,               0x00U },
+  { 0x013DU,               0x38U },
+  { 0x0139U,               0x92U },
+  { 0x0135U,               0xDAU },
+  { 0x0122U,               0x1AU },
+  { 0x0123U,               0x00U },
+  { 0x0134U,               0xC0U },
+  { 0x0106U,               0x88U },
+  { 0x0107U,               0xC0U },
+  { 0x010DU,               0x87U },
+  { 0x010EU,               0x41U },
+  { 0x0142U,               0x03U },
+  { 0x014CU,               0x00U },
+  /* DSP: 800x600 in, 640x480 out */
+  { OV2640_REG_RESET,      0x04U },          /* DVP held in reset */
+  { OV2640_REG_HSIZE8,     0x64U },
+  { OV2640_REG_VSIZE8,     0x4BU },
+  { 0x008CU,               0x00U },
+  { 0x0086U,               0x3DU },
+  { 0x0050U,               0x00U },          /* CTRLI */
+  { 0x0051U,               0xC8U },          /* HSIZE */
+  { 0x0052U,               0x96U },          /* VSIZE */
+  { 0x0053U,               0x00U },
+  { 0x0054U,               0x00U },
+  { 0x0055U,               0x00U },
+  { 0x005AU,               0xA0U },          /* ZMOW */
+  { 0x005BU,               0x78U },          /* ZMOH */
+  { 0x005CU,               0x00U },
+  { OV2640_REG_R_DVP_SP,   0x04U },
+  { OV2640_REG_IMAGE_MODE, OV2640_IMAGE_MODE_RGB565 },
+  { 0x00D7U,               0x03U },
+  { OV2640_REG_RESET,      0x00U },
+};
+
+/* Registers driven by the controls, power-on values */
+static const Sensor_RegTypeDef ov2640_ctrl[OV2640_CTRL_NUM] =
+{
+  [OV2640_CTRL_COM8]  = { OV2640_REG_COM8,  0xC7U },
+  [OV2640_CTRL_COM3]  = { OV2640_REG_COM3,  0x38U },
+  [OV2640_CTRL_GAIN]  = { OV2640_REG_GAIN,  0x00U },
+  [OV2640_CTRL_REG04] = { OV2640_REG_REG04, 0x20U },
+  [OV2640_CTRL_AEC]   = { OV2640_REG_AEC,   0x33U },
+  [OV2640_CTRL_REG45] = { OV2640_REG_REG45, 0x00U },
+  [OV2640_CTRL_CTRL1] = { OV2640_REG_CTRL1, 0xFFU },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void OV2640_Build(const int32_t *state, uint8_t *regs);
+
+/* Exported variables --------------------------------------------------------*/
+const Sensor_DriverTypeDef Sensor_OV2640 =
+{
+  .name     = "OV2640",
+  .address  = 0x60U,
+  .reg_size = 1U,
+  .banked   = 1U,
+  .id_reg   = OV2640_REG_PIDH,
+  .id       = OV2640_PIDH,
+  .init     = ov2640_init,
+  .init_len = sizeof(ov2640_init) / sizeof(ov2640_init[0]),
+  .ctrl     = ov2640_ctrl,
+  .ctrl_len = OV2640_CTRL_NUM,
+  .Build    = OV2640_Build,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  OV2640_Build
+  *         Computes the register values of the controls. Bits not owned by
+  *         a control are kept. Brightness and contrast are indirect DSP
+  *         registers, and the white balance gains are not documented: only
+  *         automatic white balance on or off is driven.
+  * @param  state: SENSOR_CTRL_NUM control values
+  * @param  regs: OV2640_CTRL_NUM register values
+  * @retval None
+  */
+static void OV2640_Build(const int32_t *state, uint8_t *regs)
+{
+  uint32_t exposure;
+  uint32_t gain;
+  uint32_t stages = 0U;
+
+  regs[OV2640_CTRL_COM8] &= (uint8_t)~(OV2640_COM8_AEC | OV2640_COM8_AGC | OV2640_COM8_BNDF);
+  if (state[SENSOR_CTRL_AUTO_EXPOSURE] != 0)
+  {
+    regs[OV2640_CTRL_COM8] |= OV2640_COM8_AEC | OV2640_COM8_AGC;
+  }
+  if (state[SENSOR_CTRL_POWER_LINE] != 0)
+  {
+    regs[OV2640_CTRL_COM8] |= OV2640_COM8_BNDF;
+  }
+
+  regs[OV2640_CTRL_COM3] &= (uint8_t)~OV2640_COM3_HZ50;
+  if (state[SENSOR_CTRL_POWER_LINE] == 1)
+  {
+    regs[OV2640_CTRL_COM3] |= OV2640_COM3_HZ50;
+  }
+
+  /* exposure in rows, 16 bits split over REG45, AEC and REG04 */
+  exposure = ((uint32_t)state[SENSOR_CTRL_EXPOSURE] * 100U) / OV2640_ROW_TIME_US;
+  if (exposure == 0U)
+  {
+    exposure = 1U;
+  }
+  if (exposure > 0xFFFFU)
+  {
+    exposure = 0xFFFFU;
+  }
+  regs[OV2640_CTRL_REG45] = (uint8_t)((regs[OV2640_CTRL_REG45] & ~OV2640_REG45_AEC_MASK) | ((exposure >> 10) & OV2640_REG45_AEC_MASK));
+  regs[OV2640_CTRL_AEC]   = (uint8_t)(exposure >> 2);
+  regs[OV2640_CTRL_REG04] = (uint8_t)((regs[OV2640_CTRL_REG04] & ~OV2640_REG04_AEC_MASK) | (exposure & OV2640_REG04_AEC_MASK));
+
+  /* gain x16 from 1x: doubling stages in [7:4], the rest in 1/16 steps */
+  gain = (uint32_t)state[SENSOR_CTRL_GAIN];
+  if (gain < 16U)
+  {
+    gain = 16U;
+  }
+  while ((gain >= 32U) && (stages < 4U))
+  {
+    gain >>= 1;
+    stages++;
+  }
+  if (gain > 31U)
+  {
+    gain = 31U;
+  }
+  regs[OV2640_CTRL_GAIN] = (uint8_t)((((1U << stages) - 1U) << 4) | (gain - 16U));
+
+  regs[OV2640_CTRL_CTRL1] &= (uint8_t)~OV2640_CTRL1_AWB;
+  if (state[SENSOR_CTRL_WB_AUTO] != 0)
+  {
+    regs[OV2640_CTRL_CTRL1] |= OV2640_CTRL1_AWB;
+  }
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,295 @@
+/**
+  ******************************************************************************
+  * @file    sensor_ov5640.c
+  * @brief   OV5640 backend of the sensor layer.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sensor.h"
+
+/* Private define ------------------------------------------------------------*/
+
+/* OV5640 registers */
+#define OV5640_REG_SYSTEM_CTRL0         0x3008U
+#define OV5640_REG_CHIP_ID_H            0x300AU
+#define OV5640_REG_SCCB_SYS_CTRL1       0x3103U
+#define OV5640_REG_AWB_R_GAIN_H         0x3400U  /* [3:0] red gain [11:8] */
+#define OV5640_REG_AWB_R_GAIN_L         0x3401U
+#define OV5640_REG_AWB_B_GAIN_H         0x3404U  /* [3:0] blue gain [11:8] */
+#define OV5640_REG_AWB_B_GAIN_L         0x3405U
+#define OV5640_REG_AWB_MANUAL           0x3406U  /* [0] manual gains */
+#define OV5640_REG_AEC_PK_EXPOSURE_HI   0x3500U  /* [3:0] exposure [19:16], 1/16 row */
+#define OV5640_REG_AEC_PK_EXPOSURE_MED  0x3501U
+#define OV5640_REG_AEC_PK_EXPOSURE_LO   0x3502U
+#define OV5640_REG_AEC_PK_MANUAL        0x3503U  /* [0] manual exposure, [1] manual gain */
+#define OV5640_REG_AEC_PK_REAL_GAIN_HI  0x350AU  /* [1:0] gain [9:8], x16 */
+#define OV5640_REG_AEC_PK_REAL_GAIN_LO  0x350BU
+#define OV5640_REG_AEC_CTRL00           0x3A00U  /* [5] banding filter */
+#define OV5640_REG_HZ5060_CTRL00        0x3C00U  /* [2] 50 Hz */
+#define OV5640_REG_HZ5060_CTRL01        0x3C01U  /* [7] manual banding */
+#define OV5640_REG_FORMAT_CTRL00        0x4300U
+#define OV5640_REG_ISP_CTRL00           0x5000U
+#define OV5640_REG_ISP_CTRL01           0x5001U
+#define OV5640_REG_ISP_FORMAT_MUX       0x501FU
+#define OV5640_REG_SDE_CTRL0            0x5580U
+#define OV5640_REG_SDE_CTRL6            0x5586U  /* contrast */
+#define OV5640_REG_SDE_CTRL7            0x5587U  /* brightness magnitude */
+#define OV5640_REG_SDE_CTRL8            0x5588U  /* [3] brightness negative */
+
+#define OV5640_CHIP_ID_H                0x56U
+
+#define OV5640_MANUAL_AEC               0x01U
+#define OV5640_MANUAL_AGC               0x02U
+#define OV5640_MANUAL_AWB               0x01U
+#define OV5640_AEC_CTRL00_BAND          0x20U
+#define OV5640_HZ5060_50                0x04U
+#define OV5640_SDE_CTRL8_NEGATIVE       0x08U
+#define OV5640_EXPOSURE_MAX             0xFFFFFU
+
+/* Duration of one sensor row at 15 fps, VGA (984 rows per frame) */
+#define OV5640_ROW_TIME_US              68U
+
+/* Channel gains the white balance temperature range maps onto, 0x400 = 1x */
+#define OV5640_WB_GAIN_LOW              0x400
+#define OV5640_WB_GAIN_HIGH             0x800
+
+/* Private typedef -----------------------------------------------------------*/
+
+/* Registers driven by the controls, in the order they are written */
+typedef enum
+{
+  OV5640_CTRL_MANUAL = 0,
+  OV5640_CTRL_EXPOSURE_HI,
+  OV5640_CTRL_EXPOSURE_MED,
+  OV5640_CTRL_EXPOSURE_LO,
+  OV5640_CTRL_GAIN_HI,
+  OV5640_CTRL_GAIN_LO,
+  OV5640_CTRL_AWB_MANUAL,
+  OV5640_CTRL_RED_HI,
+  OV5640_CTRL_RED_LO,
+  OV5640_CTRL_BLUE_HI,
+  OV5640_CTRL_BLUE_LO,
+  OV5640_CTRL_BRIGHT,
+  OV5640_CTRL_BRIGHT_SIGN,
+  OV5640_CTRL_CONTRAST,
+  OV5640_CTRL_HZ50,
+  OV5640_CTRL_BAND,
+  OV5640_CTRL_NUM
+} OV5640_CtrlTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Reset, then VGA RGB565 at 15 fps from the 24 MHz XCLK. Abridged: lens
+   correction, gamma and color matrix are left at their reset values. */
+static const Sensor_RegTypeDef ov5640_init[] =
+{
+  { OV5640_REG_SCCB_SYS_CTRL1, 0x11U },
+  { OV5640_REG_SYSTEM_CTRL0,   0x82U },      /* software reset */
+  { SENSOR_REG_DELAY,          5U },
+  { OV5640_REG_SYSTEM_CTRL0,   0x42U },      /* power down while configured */
+  { OV5640_REG_SCCB_SYS_CTRL1, 0x03U },      /* system clock from the PLL */
+  { 0x3017U,                   0xFFU },      /* VSYNC, HREF, PCLK, D[9:6] out */
+  { 0x3018U,                   0xFFU },      /* D[5:0] out */
+  /* PLL */
+  { 0x3034U,                   0x18U },
+  { 0x3035U,                   0x14U },
+  { 0x3036U,                   0x38U },
+  { 0x3037U,                   0x13U },
+  { 0x3108U,                   0x01U },
+  /* analog */
+  { 0x3630U,                   0x36U },
+  { 0x3631U,                   0x0EU },
+  { 0x3632U,                   0xE2U },
+  { 0x3633U,                   0x12U },
+  { 0x3621U,                   0xE0U },
+  { 0x3704U,                   0xA0U },
+  { 0x3703U,                   0x5AU },
+  { 0x3715U,                   0x78U },
+  { 0x3717U,                   0x01U },
+  { 0x370BU,                   0x60U },
+  { 0x3705U,                   0x1AU },
+  { 0x3905U,                   0x02U },
+  { 0x3906U,                   0x10U },
+  { 0x3901U,                   0x0AU },
+  { 0x3731U,                   0x12U },
+  { 0x3600U,                   0x08U },
+  { 0x3601U,                   0x33U },
+  { 0x302DU,                   0x60U },
+  { 0x3620U,                   0x52U },
+  { 0x371BU,                   0x20U },
+  { 0x471CU,                   0x50U },
+  /* timing: subsampled readout, 640x480 out, HTS 1896, VTS 984 */
+  { 0x3820U,                   0x41U },
+  { 0x3821U,                   0x07U },
+  { 0x3814U,                   0x31U },
+  { 0x3815U,                   0x31U },
+  { 0x3800U,                   0x00U },
+  { 0x3801U,                   0x00U },
+  { 0x3802U,                   0x00U },
+  { 0x3803U,                   0x04U },
+  { 0x3804U,                   0x0AU },
+  { 0x3805U,                   0x3FU },
+  { 0x3806U,                   0x07U },
+  { 0x3807U,                   0x9BU },
+  { 0x3808U,                   0x02U },
+  { 0x3809U,                   0x80U },
+  { 0x380AU,                   0x01U },
+  { 0x380BU,                   0xE0U },
+  { 0x380CU,                   0x07U },
+  { 0x380DU,                   0x68U },
+  { 0x380EU,                   0x03U },
+  { 0x380FU,                   0xD8U },
+  { 0x3810U,                   0x00U },
+  { 0x3811U,                   0x10U },
+  { 0x3812U,                   0x00U },
+  { 0x3813U,                   0x06U },
+  { 0x3618U,                   0x00U },
+  { 0x3612U,                   0x29U },
+  { 0x3708U,                   0x64U },
+  { 0x3709U,                   0x52U },
+  { 0x370CU,                   0x03U },
+  /* RGB565 on the DVP port */
+  { OV5640_REG_FORMAT_CTRL00,  0x6FU },
+  { OV5640_REG_ISP_FORMAT_MUX, 0x01U },
+  { 0x4713U,                   0x03U },
+  { 0x4407U,                   0x04U },
+  { 0x440EU,                   0x00U },
+  { 0x460BU,                   0x35U },
+  { 0x460CU,                   0x22U },
+  { 0x3824U,                   0x02U },
+  /* ISP: scaling, color interpolation, special digital effects */
+  { OV5640_REG_ISP_CTRL00,     0xA7U },
+  { OV5640_REG_ISP_CTRL01,     0xA3U },
+  { OV5640_REG_SDE_CTRL0,      0x06U },      /* brightness and contrast */
+  { OV5640_REG_HZ5060_CTRL01,  0x80U },      /* banding from HZ5060_CTRL00 */
+  { OV5640_REG_SYSTEM_CTRL0,   0x02U },      /* wake up */
+};
+
+/* Registers driven by the controls, power-on values */
+static const Sensor_RegTypeDef ov5640_ctrl[OV5640_CTRL_NUM] =
+{
+  [OV5640_CTRL_MANUAL]       = { OV5640_REG_AEC_PK_MANUAL,       0x00U },
+  [OV5640_CTRL_EXPOSURE_HI]  = { OV5640_REG_AEC_PK_EXPOSURE_HI,  0x00U },
+  [OV5640_CTRL_EXPOSURE_MED] = { OV5640_REG_AEC_PK_EXPOSURE_MED, 0x00U },
+  [OV5640_CTRL_EXPOSURE_LO]  = { OV5640_REG_AEC_PK_EXPOSURE_LO,  0x00U },
+  [OV5640_CTRL_GAIN_HI]      = { OV5640_REG_AEC_PK_REAL_GAIN_HI, 0x00U },
+  [OV5640_CTRL_GAIN_LO]      = { OV5640_REG_AEC_PK_REAL_GAIN_LO, 0x00U },
+  [OV5640_CTRL_AWB_MANUAL]   = { OV5640_REG_AWB_MANUAL,          0x00U },
+  [OV5640_CTRL_RED_HI]       = { OV5640_REG_AWB_R_GAIN_H,        0x04U },
+  [OV5640_CTRL_RED_LO]       = { OV5640_REG_AWB_R_GAIN_L,        0x00U },
+  [OV5640_CTRL_BLUE_HI]      = { OV5640_REG_AWB_B_GAIN_H,        0x04U },
+  [OV5640_CTRL_BLUE_LO]      = { OV5640_REG_AWB_B_GAIN_L,        0x00U },
+  [OV5640_CTRL_BRIGHT]       = { OV5640_REG_SDE_CTRL7,           0x00U },
+  [OV5640_CTRL_BRIGHT_SIGN]  = { OV5640_REG_SDE_CTRL8,           0x01U },
+  [OV5640_CTRL_CONTRAST]     = { OV5640_REG_SDE_CTRL6,           0x20U },
+  [OV5640_CTRL_HZ50]         = { OV5640_REG_HZ5060_CTRL00,       0x00U },
+  [OV5640_CTRL_BAND]         = { OV5640_REG_AEC_CTRL00,          0x78U },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void OV5640_Build(const int32_t *state, uint8_t *regs);
+
+/* Exported variables --------------------------------------------------------*/
+const Sensor_DriverTypeDef Sensor_OV5640 =
+{
+  .name     = "OV5640",
+  .address  = 0x78U,
+  .reg_size = 2U,
+  .banked   = 0U,
+  .id_reg   = OV5640_REG_CHIP_ID_H,
+  .id       = OV5640_CHIP_ID_H,
+  .init     = ov5640_init,
+  .init_len = sizeof(ov5640_init) / sizeof(ov5640_init[0]),
+  .ctrl     = ov5640_ctrl,
+  .ctrl_len = OV5640_CTRL_NUM,
+  .Build    = OV5640_Build,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  OV5640_Build
+  *         Computes the register values of the controls. Bits not owned by
+  *         a control are kept.
+  * @param  state: SENSOR_CTRL_NUM control values
+  * @param  regs: OV5640_CTRL_NUM register values
+  * @retval None
+  */
+static void OV5640_Build(const int32_t *state, uint8_t *regs)
+{
+  uint32_t exposure;
+  int32_t brightness = state[SENSOR_CTRL_BRIGHTNESS];
+  int32_t temperature = state[SENSOR_CTRL_WB_TEMPERATURE];
+  int32_t red;
+  int32_t blue;
+
+  regs[OV5640_CTRL_MANUAL] &= (uint8_t)~(OV5640_MANUAL_AEC | OV5640_MANUAL_AGC);
+  if (state[SENSOR_CTRL_AUTO_EXPOSURE] == 0)
+  {
+    regs[OV5640_CTRL_MANUAL] |= OV5640_MANUAL_AEC | OV5640_MANUAL_AGC;
+  }
+
+  /* exposure in 1/16 rows, 20 bits */
+  exposure = ((uint32_t)state[SENSOR_CTRL_EXPOSURE] * 100U * 16U) / OV5640_ROW_TIME_US;
+  if (exposure < 16U)
+  {
+    exposure = 16U;
+  }
+  if (exposure > OV5640_EXPOSURE_MAX)
+  {
+    exposure = OV5640_EXPOSURE_MAX;
+  }
+  regs[OV5640_CTRL_EXPOSURE_HI]  = (uint8_t)((exposure >> 16) & 0x0FU);
+  regs[OV5640_CTRL_EXPOSURE_MED] = (uint8_t)(exposure >> 8);
+  regs[OV5640_CTRL_EXPOSURE_LO]  = (uint8_t)exposure;
+
+  /* 10-bit gain, x16 as the control */
+  regs[OV5640_CTRL_GAIN_HI] = (uint8_t)((state[SENSOR_CTRL_GAIN] >> 8) & 0x03);
+  regs[OV5640_CTRL_GAIN_LO] = (uint8_t)state[SENSOR_CTRL_GAIN];
+
+  regs[OV5640_CTRL_AWB_MANUAL] &= (uint8_t)~OV5640_MANUAL_AWB;
+  if (state[SENSOR_CTRL_WB_AUTO] == 0)
+  {
+    regs[OV5640_CTRL_AWB_MANUAL] |= OV5640_MANUAL_AWB;
+  }
+
+  /* the warmer the light, the lower the red gain and the higher the blue gain */
+  red = OV5640_WB_GAIN_LOW + ((temperature - SENSOR_WB_TEMPERATURE_MIN) * (OV5640_WB_GAIN_HIGH - OV5640_WB_GAIN_LOW)) /
+                             (SENSOR_WB_TEMPERATURE_MAX - SENSOR_WB_TEMPERATURE_MIN);
+  blue = OV5640_WB_GAIN_LOW + OV5640_WB_GAIN_HIGH - red;
+  regs[OV5640_CTRL_RED_HI]  = (uint8_t)((red >> 8) & 0x0F);
+  regs[OV5640_CTRL_RED_LO]  = (uint8_t)red;
+  regs[OV5640_CTRL_BLUE_HI] = (uint8_t)((blue >> 8) & 0x0F);
+  regs[OV5640_CTRL_BLUE_LO] = (uint8_t)blue;
+
+  /* brightness as magnitude and sign */
+  regs[OV5640_CTRL_BRIGHT] = (uint8_t)((brightness < 0) ? -brightness : brightness);
+  regs[OV5640_CTRL_BRIGHT_SIGN] &= (uint8_t)~OV5640_SDE_CTRL8_NEGATIVE;
+  if (brightness < 0)
+  {
+    regs[OV5640_CTRL_BRIGHT_SIGN] |= OV5640_SDE_CTRL8_NEGATIVE;
+  }
+  /* Y gain, 0x20 is 1x */
+  regs[OV5640_CTRL_CONTRAST] = (uint8_t)(state[SENSOR_CTRL_CONTRAST] >> 1);
+
+  regs[OV5640_CTRL_HZ50] &= (uint8_t)~OV5640_HZ5060_50;
+  if (state[SENSOR_CTRL_POWER_LINE] == 1)
+  {
+    regs[OV5640_CTRL_HZ50] |= OV5640_HZ5060_50;
+  }
+  regs[OV5640_CTRL_BAND] &= (uint8_t)~OV5640_AEC_CTRL00_BAND;
+  if (state[SENSOR_CTRL_POWER_LINE] != 0)
+  {
+    regs[OV5640_CTRL_BAND] |= OV5640_AEC_CTRL00_BAND;
+  }
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,226 @@
+/**
+  ******************************************************************************
+  * @file    sensor_ov7670.c
+  * @brief   OV7670 backend of the sensor layer.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sensor.h"
+
+/* Private define ------------------------------------------------------------*/
+
+/* OV7670 registers */
+#define OV7670_REG_GAIN                 0x00U   /* AGC gain [7:0] */
+#define OV7670_REG_BLUE                 0x01U   /* AWB blue channel gain */
+#define OV7670_REG_RED                  0x02U   /* AWB red channel gain */
+#define OV7670_REG_VREF                 0x03U   /* [7:6] AGC gain [9:8] */
+#define OV7670_REG_COM1                 0x04U   /* [1:0] exposure [1:0] */
+#define OV7670_REG_AECHH                0x07U   /* [5:0] exposure [15:10] */
+#define OV7670_REG_PID                  0x0AU
+#define OV7670_REG_AECH                 0x10U   /* exposure [9:2] */
+#define OV7670_REG_CLKRC                0x11U
+#define OV7670_REG_COM7                 0x12U
+#define OV7670_REG_COM8                 0x13U
+#define OV7670_REG_COM9                 0x14U
+#define OV7670_REG_COM3                 0x0CU
+#define OV7670_REG_COM14                0x3EU
+#define OV7670_REG_COM15                0x40U
+#define OV7670_REG_TSLB                 0x3AU
+#define OV7670_REG_COM11                0x3BU
+#define OV7670_REG_COM13                0x3DU
+#define OV7670_REG_BRIGHT               0x55U   /* sign-magnitude */
+#define OV7670_REG_CONTRAS              0x56U
+#define OV7670_REG_RGB444               0x8CU
+
+#define OV7670_PID                      0x76U
+
+#define OV7670_COM7_RESET               0x80U
+#define OV7670_COM7_RGB                 0x04U
+#define OV7670_COM8_AEC                 0x01U
+#define OV7670_COM8_AWB                 0x02U
+#define OV7670_COM8_AGC                 0x04U
+#define OV7670_COM8_BFILT               0x20U
+#define OV7670_COM11_HZ50               0x08U
+#define OV7670_COM15_RGB565             0xD0U   /* full output range, RGB565 */
+#define OV7670_VREF_GAIN_MASK           0xC0U
+#define OV7670_COM1_AEC_MASK            0x03U
+#define OV7670_AECHH_MASK               0x3FU
+
+/* Duration of one sensor row at 15 fps, VGA (510 rows per frame) */
+#define OV7670_ROW_TIME_US              131U
+
+/* Channel gains the white balance temperature range maps onto */
+#define OV7670_WB_GAIN_LOW              0x40
+#define OV7670_WB_GAIN_HIGH             0xC0
+
+/* Private typedef -----------------------------------------------------------*/
+
+/* Registers driven by the controls, in the order they are written */
+typedef enum
+{
+  OV7670_CTRL_COM8 = 0,
+  OV7670_CTRL_COM11,
+  OV7670_CTRL_AECHH,
+  OV7670_CTRL_AECH,
+  OV7670_CTRL_COM1,
+  OV7670_CTRL_GAIN,
+  OV7670_CTRL_VREF,
+  OV7670_CTRL_BRIGHT,
+  OV7670_CTRL_CONTRAS,
+  OV7670_CTRL_RED,
+  OV7670_CTRL_BLUE,
+  OV7670_CTRL_NUM
+} OV7670_CtrlTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Reset, then VGA RGB565 at 15 fps from the 24 MHz XCLK */
+static const Sensor_RegTypeDef ov7670_init[] =
+{
+  { OV7670_REG_COM7,   OV7670_COM7_RESET },
+  { SENSOR_REG_DELAY,  10U },
+  { OV7670_REG_CLKRC,  0x01U },              /* internal clock XCLK / 2 */
+  { OV7670_REG_TSLB,   0x04U },
+  { OV7670_REG_COM7,   OV7670_COM7_RGB },
+  { OV7670_REG_RGB444, 0x00U },
+  { OV7670_REG_COM1,   0x00U },
+  { OV7670_REG_COM15,  OV7670_COM15_RGB565 },
+  { OV7670_REG_COM9,   0x38U },              /* AGC ceiling x128 */
+  /* RGB conversion matrix */
+  { 0x4FU,             0xB3U },
+  { 0x50U,             0xB3U },
+  { 0x51U,             0x00U },
+  { 0x52U,             0x3DU },
+  { 0x53U,             0xA7U },
+  { 0x54U,             0xE4U },
+  { OV7670_REG_COM13,  0xC0U },              /* gamma, UV saturation */
+  /* VGA window */
+  { 0x17U,             0x13U },              /* HSTART */
+  { 0x18U,             0x01U },              /* HSTOP */
+  { 0x32U,             0xB6U },              /* HREF */
+  { 0x19U,             0x02U },              /* VSTART */
+  { 0x1AU,             0x7AU },              /* VSTOP */
+  { OV7670_REG_VREF,   0x0AU },
+  { OV7670_REG_COM3,   0x00U },
+  { OV7670_REG_COM14,  0x00U },
+  /* no scaling */
+  { 0x70U,             0x3AU },
+  { 0x71U,             0x35U },
+  { 0x72U,             0x11U },
+  { 0x73U,             0xF0U },
+  { 0xA2U,             0x02U },
+  { OV7670_REG_COM8,   0xE7U },              /* fast AEC, AGC, AWB, AEC */
+};
+
+/* Registers driven by the controls, power-on values */
+static const Sensor_RegTypeDef ov7670_ctrl[OV7670_CTRL_NUM] =
+{
+  [OV7670_CTRL_COM8]    = { OV7670_REG_COM8,    0x8FU },
+  [OV7670_CTRL_COM11]   = { OV7670_REG_COM11,   0x00U },
+  [OV7670_CTRL_AECHH]   = { OV7670_REG_AECHH,   0x00U },
+  [OV7670_CTRL_AECH]    = { OV7670_REG_AECH,    0x40U },
+  [OV7670_CTRL_COM1]    = { OV7670_REG_COM1,    0x00U },
+  [OV7670_CTRL_GAIN]    = { OV7670_REG_GAIN,    0x00U },
+  [OV7670_CTRL_VREF]    = { OV7670_REG_VREF,    0x00U },
+  [OV7670_CTRL_BRIGHT]  = { OV7670_REG_BRIGHT,  0x00U },
+  [OV7670_CTRL_CONTRAS] = { OV7670_REG_CONTRAS, 0x40U },
+  [OV7670_CTRL_RED]     = { OV7670_REG_RED,     0x80U },
+  [OV7670_CTRL_BLUE]    = { OV7670_REG_BLUE,    0x80U },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void OV7670_Build(const int32_t *state, uint8_t *regs);
+
+/* Exported variables --------------------------------------------------------*/
+const Sensor_DriverTypeDef Sensor_OV7670 =
+{
+  .name     = "OV7670",
+  .address  = 0x42U,
+  .reg_size = 1U,
+  .banked   = 0U,
+  .id_reg   = OV7670_REG_PID,
+  .id       = OV7670_PID,
+  .init     = ov7670_init,
+  .init_len = sizeof(ov7670_init) / sizeof(ov7670_init[0]),
+  .ctrl     = ov7670_ctrl,
+  .ctrl_len = OV7670_CTRL_NUM,
+  .Build    = OV7670_Build,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  OV7670_Build
+  *         Computes the register values of the controls. Bits not owned by
+  *         a control are kept.
+  * @param  state: SENSOR_CTRL_NUM control values
+  * @param  regs: OV7670_CTRL_NUM register values
+  * @retval None
+  */
+static void OV7670_Build(const int32_t *state, uint8_t *regs)
+{
+  uint32_t exposure;
+  int32_t brightness = state[SENSOR_CTRL_BRIGHTNESS];
+  int32_t temperature = state[SENSOR_CTRL_WB_TEMPERATURE];
+  int32_t red;
+
+  /* automatic exposure drives both AEC and AGC, the banding filter follows the power line setting */
+  regs[OV7670_CTRL_COM8] &= (uint8_t)~(OV7670_COM8_AEC | OV7670_COM8_AGC | OV7670_COM8_AWB | OV7670_COM8_BFILT);
+  if (state[SENSOR_CTRL_AUTO_EXPOSURE] != 0)
+  {
+    regs[OV7670_CTRL_COM8] |= OV7670_COM8_AEC | OV7670_COM8_AGC;
+  }
+  if (state[SENSOR_CTRL_WB_AUTO] != 0)
+  {
+    regs[OV7670_CTRL_COM8] |= OV7670_COM8_AWB;
+  }
+  if (state[SENSOR_CTRL_POWER_LINE] != 0)
+  {
+    regs[OV7670_CTRL_COM8] |= OV7670_COM8_BFILT;
+  }
+
+  regs[OV7670_CTRL_COM11] &= (uint8_t)~OV7670_COM11_HZ50;
+  if (state[SENSOR_CTRL_POWER_LINE] == 1)
+  {
+    regs[OV7670_CTRL_COM11] |= OV7670_COM11_HZ50;
+  }
+
+  /* exposure in rows, 16 bits split over AECHH, AECH and COM1 */
+  exposure = ((uint32_t)state[SENSOR_CTRL_EXPOSURE] * 100U) / OV7670_ROW_TIME_US;
+  if (exposure == 0U)
+  {
+    exposure = 1U;
+  }
+  if (exposure > 0xFFFFU)
+  {
+    exposure = 0xFFFFU;
+  }
+  regs[OV7670_CTRL_AECHH] = (uint8_t)((regs[OV7670_CTRL_AECHH] & ~OV7670_AECHH_MASK) | ((exposure >> 10) & OV7670_AECHH_MASK));
+  regs[OV7670_CTRL_AECH]  = (uint8_t)(exposure >> 2);
+  regs[OV7670_CTRL_COM1]  = (uint8_t)((regs[OV7670_CTRL_COM1] & ~OV7670_COM1_AEC_MASK) | (exposure & OV7670_COM1_AEC_MASK));
+
+  /* 10-bit gain, [9:8] in VREF */
+  regs[OV7670_CTRL_GAIN] = (uint8_t)state[SENSOR_CTRL_GAIN];
+  regs[OV7670_CTRL_VREF] = (uint8_t)((regs[OV7670_CTRL_VREF] & ~OV7670_VREF_GAIN_MASK) |
+                                     ((state[SENSOR_CTRL_GAIN] >> 2) & OV7670_VREF_GAIN_MASK));
+
+  /* BRIGHT is sign-magnitude */
+  regs[OV7670_CTRL_BRIGHT] = (brightness < 0) ? (uint8_t)(0x80 | -brightness) : (uint8_t)brightness;
+  regs[OV7670_CTRL_CONTRAS] = (uint8_t)state[SENSOR_CTRL_CONTRAST];
+
+  /* the warmer the light, the lower the red gain and the higher the blue gain */
+  red = OV7670_WB_GAIN_LOW + ((temperature - SENSOR_WB_TEMPERATURE_MIN) * (OV7670_WB_GAIN_HIGH - OV7670_WB_GAIN_LOW)) /
+                             (SENSOR_WB_TEMPERATURE_MAX - SENSOR_WB_TEMPERATURE_MIN);
+  regs[OV7670_CTRL_RED]  = (uint8_t)red;
+  regs[OV7670_CTRL_BLUE] = (uint8_t)(OV7670_WB_GAIN_LOW + OV7670_WB_GAIN_HIGH - red);
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
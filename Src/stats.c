@@ -0,0 +1,326 @@
+/**
+  ******************************************************************************
+  * @file    stats.c
+  * @brief   Streaming statistics: counters and per second rates.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                              Streaming statistics
+  *          ===================================================================
+  *           The USB class, the frame sources and the encoder count what
+  *           they do with Stats_Add(): a row of counters per UVC function
+  *           and a row for the device. Counters are 32-bit and wrap, a host
+  *           takes differences. They take no lock:
+  *             - an add is a load/store exclusive loop, so the USB bottom
+  *               half and the main loop or the pipeline tasks may count into
+  *               the same word, Stats_Max() keeps a maximum the same way,
+  *             - a reader takes each word as it is, a row read while it is
+  *               being counted mixes two instants by a few events at most.
+  *           Stats_Process() closes a window once STATS_WINDOW_US of the
+  *           TIM2 clock have elapsed: the counters are differenced against
+  *           the start of the window and scaled to a second. The rates are
+  *           written to the buffer readers do not use, then published with
+  *           a single store. Readers only preempt the writer, they always
+  *           see a complete window. Maxima in the rates are the largest
+  *           value of the window. The host reads the totals with
+  *           XU_STATS_COUNTERS_CONTROL and the rates with
+  *           XU_STATS_RATES_CONTROL, the console gets a line every
+  *           STATS_REPORT_WINDOWS windows. The file builds on a host with a
+  *           time hook instead of the timer.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stats.h"
+#include <stdio.h>
+#include <string.h>
+#if !STATS_HOST
+#include "latency.h"
+#include "usbd_conf.h"
+#endif
+
+#if !STATS_HOST && (USBD_UVC_NUM_INSTANCES > STATS_NUM_STREAMS)
+#error "STATS_NUM_STREAMS must cover USBD_UVC_NUM_INSTANCES"
+#endif
+
+/* Private define ------------------------------------------------------------*/
+/* Counters of the device row that hold a maximum */
+#define STATS_DEVICE_MAX_MASK           (1U << STATS_ENCODE_MAX)
+
+/* Private macro -------------------------------------------------------------*/
+#if STATS_HOST
+#define STATS_NOW()                     Stats_HostTime()
+#define STATS_BARRIER()                 __sync_synchronize()
+#else
+#define STATS_NOW()                     Latency_Now()
+#define STATS_BARRIER()                 __DMB()
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+static volatile uint32_t stats_count[STATS_ROWS][STATS_COUNTERS];
+static volatile uint32_t stats_peak[STATS_ROWS][STATS_COUNTERS];   /* maxima of the window */
+static uint32_t stats_base[STATS_ROWS][STATS_COUNTERS];            /* counters at its start */
+static uint32_t stats_rate[2][STATS_ROWS][STATS_COUNTERS];
+static uint32_t stats_window_ms[2];
+static volatile uint32_t stats_published;  /* stats_rate buffer of the readers */
+static uint32_t stats_window_start;        /* TIM2 time of the window start */
+static uint32_t stats_uptime;              /* s */
+static uint32_t stats_uptime_us;           /* and the rest */
+static uint32_t stats_windows;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Stats_Swap(volatile uint32_t *p, uint32_t value);
+static uint32_t Stats_IsMax(uint32_t row, uint32_t counter);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Stats_Swap
+  *         Replaces a word written by other contexts.
+  * @param  p: word
+  * @param  value: new value
+  * @retval previous value
+  */
+static uint32_t Stats_Swap(volatile uint32_t *p, uint32_t value)
+{
+#if STATS_HOST
+  return __atomic_exchange_n(p, value, __ATOMIC_RELAXED);
+#else
+  uint32_t old;
+
+  do
+  {
+    old = __LDREXW(p);
+  } while (__STREXW(value, p) != 0U);
+  return old;
+#endif
+}
+
+/**
+  * @brief  Stats_IsMax
+  * @param  row: STATS_DEVICE or a UVC function
+  * @param  counter: STATS_xxx of the row
+  * @retval 1 if the counter holds a maximum rather than a sum
+  */
+static uint32_t Stats_IsMax(uint32_t row, uint32_t counter)
+{
+  return ((row == STATS_DEVICE) && (((STATS_DEVICE_MAX_MASK >> counter) & 1U) != 0U)) ? 1U : 0U;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  Stats_Init
+  *         Clears the counters and starts the first window, after
+  *         Latency_Init().
+  * @retval None
+  */
+void Stats_Init(void)
+{
+  memset((void *)stats_count, 0, sizeof(stats_count));
+  memset((void *)stats_peak, 0, sizeof(stats_peak));
+  memset(stats_base, 0, sizeof(stats_base));
+  memset(stats_rate, 0, sizeof(stats_rate));
+  stats_window_ms[0] = 0U;
+  stats_window_ms[1] = 0U;
+  stats_published = 0U;
+  stats_uptime = 0U;
+  stats_uptime_us = 0U;
+  stats_windows = 0U;
+  stats_window_start = STATS_NOW();
+}
+
+/**
+  * @brief  Stats_Add
+  *         Counts events. Any context, no lock.
+  * @param  row: UVC function, or STATS_DEVICE
+  * @param  counter: STATS_xxx of the row
+  * @param  value: events or bytes to add
+  * @retval None
+  */
+void Stats_Add(uint32_t row, uint32_t counter, uint32_t value)
+{
+  volatile uint32_t *p;
+
+  if ((row >= STATS_ROWS) || (counter >= STATS_COUNTERS))
+  {
+    return;
+  }
+  p = &stats_count[row][counter];
+#if STATS_HOST
+  __atomic_fetch_add(p, value, __ATOMIC_RELAXED);
+#else
+  while (__STREXW(__LDREXW(p) + value, p) != 0U)
+  {
+  }
+#endif
+}
+
+/**
+  * @brief  Stats_Max
+  *         Raises a maximum, since boot and for the window. Any context, no
+  *         lock.
+  * @param  row: UVC function, or STATS_DEVICE
+  * @param  counter: STATS_xxx of the row holding a maximum
+  * @param  value: new sample
+  * @retval None
+  */
+void Stats_Max(uint32_t row, uint32_t counter, uint32_t value)
+{
+  volatile uint32_t *p;
+  uint32_t n;
+
+  if ((row >= STATS_ROWS) || (counter >= STATS_COUNTERS))
+  {
+    return;
+  }
+  for (n = 0U; n < 2U; n++)
+  {
+    p = (n == 0U) ? &stats_count[row][counter] : &stats_peak[row][counter];
+#if STATS_HOST
+    {
+      uint32_t old = *p;
+
+      while ((value > old) &&
+             !__atomic_compare_exchange_n(p, &old, value, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+      {
+      }
+    }
+#else
+    while (value > __LDREXW(p))
+    {
+      if (__STREXW(value, p) == 0U)
+      {
+        break;
+      }
+    }
+    __CLREX();
+#endif
+  }
+}
+
+/**
+  * @brief  Stats_Process
+  *         Closes the rate window once it is over, prints a report every
+  *         STATS_REPORT_WINDOWS windows. Main loop, or control task.
+  * @retval milliseconds to the end of the window
+  */
+uint32_t Stats_Process(void)
+{
+  uint32_t now = STATS_NOW();
+  uint32_t elapsed = now - stats_window_start;
+  uint32_t next, row, counter, count;
+
+  if (elapsed < STATS_WINDOW_US)
+  {
+    return ((STATS_WINDOW_US - elapsed) + 999U) / 1000U;
+  }
+
+  next = stats_published ^ 1U;
+  for (row = 0U; row < STATS_ROWS; row++)
+  {
+    for (counter = 0U; counter < STATS_COUNTERS; counter++)
+    {
+      if (Stats_IsMax(row, counter) != 0U)
+      {
+        stats_rate[next][row][counter] = Stats_Swap(&stats_peak[row][counter], 0U);
+        continue;
+      }
+      count = stats_count[row][counter];
+      stats_rate[next][row][counter] =
+        (uint32_t)((((uint64_t)(count - stats_base[row][counter])) * 1000000U) / elapsed);
+      stats_base[row][counter] = count;
+    }
+  }
+  stats_window_ms[next] = elapsed / 1000U;
+  STATS_BARRIER();
+  stats_published = next;
+
+  stats_window_start = now;
+  stats_uptime_us += elapsed;
+  stats_uptime += stats_uptime_us / 1000000U;
+  stats_uptime_us %= 1000000U;
+
+  stats_windows++;
+  if ((STATS_REPORT_WINDOWS != 0U) && ((stats_windows % STATS_REPORT_WINDOWS) == 0U))
+  {
+    Stats_Report();
+  }
+  return STATS_WINDOW_US / 1000U;
+}
+
+/**
+  * @brief  Stats_GetInfo
+  *         Data of XU_STATS_COUNTERS_CONTROL and XU_STATS_RATES_CONTROL.
+  *         Interrupt safe.
+  * @param  stream: UVC function
+  * @param  rates: 0 for the totals, 1 for the rates of the last window
+  * @param  data: STATS_INFO_LEN bytes: uptime in s or window length in ms,
+  *         the stream row, the device row, as little endian dwords
+  * @retval None
+  */
+void Stats_GetInfo(uint8_t stream, uint8_t rates, uint8_t *data)
+{
+  uint32_t buf = stats_published;
+  uint32_t v[1U + STATS_STREAM_COUNTERS + STATS_DEVICE_COUNTERS];
+  uint32_t n;
+
+  memset(v, 0, sizeof(v));
+  v[0] = (rates != 0U) ? stats_window_ms[buf] : stats_uptime;
+  for (n = 0U; (stream < STATS_NUM_STREAMS) && (n < STATS_STREAM_COUNTERS); n++)
+  {
+    v[1U + n] = (rates != 0U) ? stats_rate[buf][stream][n] : stats_count[stream][n];
+  }
+  for (n = 0U; n < STATS_DEVICE_COUNTERS; n++)
+  {
+    v[1U + STATS_STREAM_COUNTERS + n] =
+      (rates != 0U) ? stats_rate[buf][STATS_DEVICE][n] : stats_count[STATS_DEVICE][n];
+  }
+  for (n = 0U; n < (sizeof(v) / sizeof(v[0])); n++)
+  {
+    data[(n * 4U) + 0U] = (uint8_t)v[n];
+    data[(n * 4U) + 1U] = (uint8_t)(v[n] >> 8);
+    data[(n * 4U) + 2U] = (uint8_t)(v[n] >> 16);
+    data[(n * 4U) + 3U] = (uint8_t)(v[n] >> 24);
+  }
+}
+
+/**
+  * @brief  Stats_Report
+  *         Prints the rates of the last window and the totals, one line
+  *         per function and one for the encoder.
+  * @retval None
+  */
+void Stats_Report(void)
+{
+  uint32_t (*rate)[STATS_COUNTERS] = stats_rate[stats_published];
+  uint32_t n;
+
+  for (n = 0U; n < STATS_NUM_STREAMS; n++)
+  {
+    printf("Stats: uvc%lu %lu fps %lu B/s, %lu frames %lu underruns %lu skipped "
+           "%lu dropped %lu incomplete\r\n", (unsigned long)n,
+           (unsigned long)rate[n][STATS_FRAMES], (unsigned long)rate[n][STATS_BYTES],
+           (unsigned long)stats_count[n][STATS_FRAMES], (unsigned long)stats_count[n][STATS_UNDERRUNS],
+           (unsigned long)stats_count[n][STATS_SKIPPED], (unsigned long)stats_count[n][STATS_DROPPED],
+           (unsigned long)stats_count[n][STATS_ISO_INCOMPLETE]);
+  }
+  printf("Stats: up %lu s, encode %lu fps load %lu%% max %lu us, %lu frames\r\n",
+         (unsigned long)stats_uptime, (unsigned long)rate[STATS_DEVICE][STATS_ENCODED],
+         (unsigned long)(rate[STATS_DEVICE][STATS_ENCODE_TIME] / 10000U),
+         (unsigned long)stats_count[STATS_DEVICE][STATS_ENCODE_MAX],
+         (unsigned long)stats_count[STATS_DEVICE][STATS_ENCODED]);
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
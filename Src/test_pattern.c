@@ -0,0 +1,344 @@
+/**
+  ******************************************************************************
+  * @file    test_pattern.c
+  * @brief   Test pattern source for boards without a sensor.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Test patterns
+  *          ===================================================================
+  *           Frames are rendered in planar YCbCr 4:2:0, one strip of
+  *           TEST_PATTERN_STRIP_LINES lines at a time, so a full frame never
+  *           has to exist for the source itself:
+  *             - the generated patterns are spans computed from the frame
+  *               number: color bars and a box bouncing over them,
+  *             - the clips of test_clips.h are 80x60 palette frames, run
+  *               length coded line by line; a strip only decodes the few
+  *               clip lines it covers and scales them up,
+  *             - the frame number can be burned in at the top left corner so
+  *               that the host sees every frame, for frame rate and latency
+  *               tests with motion.
+  *           Nothing depends on the frame before: any frame of any pattern
+  *           renders on its own. The file builds on a host.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "test_pattern.h"
+#include <string.h>
+#include "test_clips.h"
+
+/* Private define ------------------------------------------------------------*/
+#define TEST_PATTERN_BARS_NUM           8U
+#define TEST_PATTERN_DIGIT_ROWS         7U
+#define TEST_PATTERN_DIGIT_COLS         5U
+#define TEST_PATTERN_DIGIT_PITCH        ((TEST_PATTERN_DIGIT_COLS + 1U) * TEST_PATTERN_DIGIT_SCALE)
+#define TEST_PATTERN_COUNTER_X          16U
+#define TEST_PATTERN_COUNTER_Y          16U
+#define TEST_PATTERN_COUNTER_BORDER     4U
+#define TEST_PATTERN_BOX_STEP_X         6U   /* pixels per frame */
+#define TEST_PATTERN_BOX_STEP_Y         4U
+
+/* Private typedef -----------------------------------------------------------*/
+
+/* Clip stored in flash */
+typedef struct
+{
+  const unsigned char  *data;
+  const unsigned short *lines;   /* offset of every line, frame by frame */
+  uint16_t              frames;
+} TestPattern_ClipTypeDef;
+
+/* One line being rendered: luma, and chroma on even lines */
+typedef struct
+{
+  uint8_t   *y;
+  uint8_t   *cb;
+  uint8_t   *cr;
+} TestPattern_LineTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+
+/* 75% bars, white to black, Y Cb Cr */
+static const uint8_t test_pattern_bars[TEST_PATTERN_BARS_NUM][3] =
+{
+  { 180, 128, 128 }, { 162,  44, 142 }, { 131, 156,  44 }, { 112,  72,  58 },
+  {  84, 184, 198 }, {  65, 100, 212 }, {  35, 212, 114 }, {  16, 128, 128 },
+};
+
+static const uint8_t test_pattern_white[3] = { 235, 128, 128 };
+static const uint8_t test_pattern_black[3] = { 16, 128, 128 };
+
+/* 5x7 digits, bit 4 is the left column */
+static const uint8_t test_pattern_font[10][TEST_PATTERN_DIGIT_ROWS] =
+{
+  { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E },
+  { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E },
+  { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F },
+  { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E },
+  { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 },
+  { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E },
+  { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E },
+  { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 },
+  { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E },
+  { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C },
+};
+
+static const TestPattern_ClipTypeDef test_pattern_clips[] =
+{
+  { _acCLIP_BALL,  _acCLIP_BALL_LINES,  TEST_CLIP_BALL_FRAMES },
+  { _acCLIP_ORBIT, _acCLIP_ORBIT_LINES, TEST_CLIP_ORBIT_FRAMES },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void TestPattern_Span(const TestPattern_LineTypeDef *line, uint32_t x0, uint32_t x1, const uint8_t *color);
+static uint32_t TestPattern_Bounce(uint32_t t, uint32_t range);
+static void TestPattern_Line(const TestPattern_TypeDef *tp, uint32_t frame, uint32_t y,
+                             const TestPattern_LineTypeDef *line);
+static void TestPattern_Counter(const TestPattern_TypeDef *tp, uint32_t frame, uint32_t y,
+                                const TestPattern_LineTypeDef *line);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  TestPattern_Span
+  *         Fills pixels x0 to x1 - 1 of a line with one color.
+  * @retval None
+  */
+static void TestPattern_Span(const TestPattern_LineTypeDef *line, uint32_t x0, uint32_t x1, const uint8_t *color)
+{
+  if (x1 <= x0)
+  {
+    return;
+  }
+  memset(&line->y[x0], color[0], x1 - x0);
+  if (line->cb != NULL)
+  {
+    memset(&line->cb[x0 / 2U], color[1], ((x1 + 1U) / 2U) - (x0 / 2U));
+    memset(&line->cr[x0 / 2U], color[2], ((x1 + 1U) / 2U) - (x0 / 2U));
+  }
+}
+
+/**
+  * @brief  TestPattern_Bounce
+  * @retval t folded back and forth over 0 to range
+  */
+static uint32_t TestPattern_Bounce(uint32_t t, uint32_t range)
+{
+  if (range == 0U)
+  {
+    return 0U;
+  }
+  t %= 2U * range;
+  return (t > range) ? ((2U * range) - t) : t;
+}
+
+/**
+  * @brief  TestPattern_Counter
+  *         Burns the frame number into line y.
+  * @retval None
+  */
+static void TestPattern_Counter(const TestPattern_TypeDef *tp, uint32_t frame, uint32_t y,
+                                const TestPattern_LineTypeDef *line)
+{
+  const uint32_t x0 = TEST_PATTERN_COUNTER_X - TEST_PATTERN_COUNTER_BORDER;
+  const uint32_t x1 = TEST_PATTERN_COUNTER_X + (TEST_PATTERN_DIGITS * TEST_PATTERN_DIGIT_PITCH);
+  const uint32_t y0 = TEST_PATTERN_COUNTER_Y - TEST_PATTERN_COUNTER_BORDER;
+  const uint32_t y1 = TEST_PATTERN_COUNTER_Y + (TEST_PATTERN_DIGIT_ROWS * TEST_PATTERN_DIGIT_SCALE) +
+                      TEST_PATTERN_COUNTER_BORDER;
+  uint32_t row, digit, col, value, x;
+  uint8_t bits;
+
+  if ((y < y0) || (y >= y1) || (x1 > tp->width))
+  {
+    return;
+  }
+  TestPattern_Span(line, x0, x1, test_pattern_black);
+  if ((y < TEST_PATTERN_COUNTER_Y) || (y >= (y1 - TEST_PATTERN_COUNTER_BORDER)))
+  {
+    return;
+  }
+  row = (y - TEST_PATTERN_COUNTER_Y) / TEST_PATTERN_DIGIT_SCALE;
+  value = frame;
+  for (digit = TEST_PATTERN_DIGITS; digit-- > 0U; )
+  {
+    bits = test_pattern_font[value % 10U][row];
+    value /= 10U;
+    x = TEST_PATTERN_COUNTER_X + (digit * TEST_PATTERN_DIGIT_PITCH);
+    for (col = 0U; col < TEST_PATTERN_DIGIT_COLS; col++)
+    {
+      if ((bits & (0x10U >> col)) != 0U)
+      {
+        TestPattern_Span(line, x + (col * TEST_PATTERN_DIGIT_SCALE),
+                         x + ((col + 1U) * TEST_PATTERN_DIGIT_SCALE), test_pattern_white);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  TestPattern_Line
+  *         Renders line y of a frame.
+  * @retval None
+  */
+static void TestPattern_Line(const TestPattern_TypeDef *tp, uint32_t frame, uint32_t y,
+                             const TestPattern_LineTypeDef *line)
+{
+  const TestPattern_ClipTypeDef *clip;
+  const unsigned char *run, *end;
+  uint32_t i, xs, n, box, bx, by;
+
+  if (tp->pattern >= TEST_PATTERN_CLIP_BALL)
+  {
+    /* only the clip line under y is decoded */
+    clip = &test_pattern_clips[tp->pattern - TEST_PATTERN_CLIP_BALL];
+    i = ((frame % clip->frames) * TEST_CLIP_HEIGHT) + ((y * TEST_CLIP_HEIGHT) / tp->height);
+    run = &clip->data[clip->lines[i]];
+    end = &clip->data[clip->lines[i + 1U]];
+    for (xs = 0U; run < end; run++)
+    {
+      n = ((uint32_t)*run >> 4) + 1U;
+      TestPattern_Span(line, (xs * tp->width) / TEST_CLIP_WIDTH, ((xs + n) * tp->width) / TEST_CLIP_WIDTH,
+                       _acCLIP_PALETTE[*run & 0x0FU]);
+      xs += n;
+    }
+  }
+  else
+  {
+    for (i = 0U; i < TEST_PATTERN_BARS_NUM; i++)
+    {
+      TestPattern_Span(line, (i * tp->width) / TEST_PATTERN_BARS_NUM,
+                       ((i + 1U) * tp->width) / TEST_PATTERN_BARS_NUM, test_pattern_bars[i]);
+    }
+    if (tp->pattern == TEST_PATTERN_BOX)
+    {
+      box = (tp->height / 8U) & ~1U;
+      bx = TestPattern_Bounce(frame * TEST_PATTERN_BOX_STEP_X, tp->width - box) & ~1U;
+      by = TestPattern_Bounce(frame * TEST_PATTERN_BOX_STEP_Y, tp->height - box);
+      if ((y >= by) && (y < (by + box)))
+      {
+        TestPattern_Span(line, bx, bx + box, test_pattern_white);
+      }
+    }
+  }
+
+  if (tp->counter != 0U)
+  {
+    TestPattern_Counter(tp, frame, y, line);
+  }
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  TestPattern_Init
+  * @param  tp: source
+  * @param  pattern: TEST_PATTERN_xxx
+  * @param  width: multiple of 16
+  * @param  height: multiple of TEST_PATTERN_STRIP_LINES
+  * @retval 0, -1 for a bad pattern or size
+  */
+int32_t TestPattern_Init(TestPattern_TypeDef *tp, uint8_t pattern, uint16_t width, uint16_t height)
+{
+  if ((width == 0U) || ((width % 16U) != 0U) ||
+      (height == 0U) || ((height % TEST_PATTERN_STRIP_LINES) != 0U))
+  {
+    return -1;
+  }
+  tp->width = width;
+  tp->height = height;
+  tp->counter = 1U;
+  tp->pattern = TEST_PATTERN_BARS;
+  return TestPattern_Select(tp, pattern);
+}
+
+/**
+  * @brief  TestPattern_Select
+  * @param  tp: source
+  * @param  pattern: TEST_PATTERN_xxx
+  * @retval 0, -1 for a bad pattern
+  */
+int32_t TestPattern_Select(TestPattern_TypeDef *tp, uint8_t pattern)
+{
+  if (pattern >= TEST_PATTERN_NUM)
+  {
+    return -1;
+  }
+  tp->pattern = pattern;
+  return 0;
+}
+
+/**
+  * @brief  TestPattern_SetCounter
+  * @param  tp: source
+  * @param  enable: 1 to burn the frame number in
+  * @retval None
+  */
+void TestPattern_SetCounter(TestPattern_TypeDef *tp, uint8_t enable)
+{
+  tp->counter = (enable != 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  TestPattern_RenderStrip
+  *         Renders lines strip * TEST_PATTERN_STRIP_LINES onwards of a frame.
+  * @param  tp: source
+  * @param  frame: frame number
+  * @param  strip: strip index, below height / TEST_PATTERN_STRIP_LINES
+  * @param  dst: first line of the strip
+  * @retval None
+  */
+void TestPattern_RenderStrip(const TestPattern_TypeDef *tp, uint32_t frame, uint16_t strip,
+                             const TestPattern_PlanesTypeDef *dst)
+{
+  TestPattern_LineTypeDef line;
+  uint32_t l;
+
+  for (l = 0U; l < TEST_PATTERN_STRIP_LINES; l++)
+  {
+    line.y = dst->y + (l * dst->pitch);
+    line.cb = NULL;
+    line.cr = NULL;
+    if ((l & 1U) == 0U)
+    {
+      line.cb = dst->cb + ((l / 2U) * (dst->pitch / 2U));
+      line.cr = dst->cr + ((l / 2U) * (dst->pitch / 2U));
+    }
+    TestPattern_Line(tp, frame, ((uint32_t)strip * TEST_PATTERN_STRIP_LINES) + l, &line);
+  }
+}
+
+/**
+  * @brief  TestPattern_Render
+  *         Renders a whole frame, strip by strip.
+  * @param  tp: source
+  * @param  frame: frame number
+  * @param  dst: frame
+  * @retval None
+  */
+void TestPattern_Render(const TestPattern_TypeDef *tp, uint32_t frame, const TestPattern_PlanesTypeDef *dst)
+{
+  TestPattern_PlanesTypeDef strip = *dst;
+  uint16_t s;
+
+  for (s = 0U; s < (tp->height / TEST_PATTERN_STRIP_LINES); s++)
+  {
+    TestPattern_RenderStrip(tp, frame, s, &strip);
+    strip.y += TEST_PATTERN_STRIP_LINES * dst->pitch;
+    strip.cb += (TEST_PATTERN_STRIP_LINES / 2U) * (dst->pitch / 2U);
+    strip.cr += (TEST_PATTERN_STRIP_LINES / 2U) * (dst->pitch / 2U);
+  }
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
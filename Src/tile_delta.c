@@ -0,0 +1,392 @@
+/**
+  ******************************************************************************
+  * @file    tile_delta.c
+  * @brief   Tile based conditional replenishment codec for static views.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Tile delta codec
+  *          ===================================================================
+  *           A frame is cut into 16x16 tiles (with their 8x8 chroma blocks).
+  *           A tile is sent only when its mean absolute difference to the
+  *           reference exceeds the threshold; the tiles sent are copied into
+  *           the reference, so the reference always equals the decoded frame
+  *           and errors never accumulate. A key frame sends every tile: the
+  *           first frame, every key_interval frames and on request.
+  *           The payload layout is described in tile_delta.h, it is sent as
+  *           the frame based format of the UVC function.
+  *           The file builds on a host with the portable C version only, the
+  *           decoder is the reference for host applications.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "tile_delta.h"
+#include <string.h>
+#if TILE_USE_SIMD
+#include "stm32f4xx.h"
+#endif
+
+#ifdef TILE_BENCHMARK
+#include <stdio.h>
+#include <math.h>
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define TILE_CHROMA                     (TILE_SIZE / 2U)
+
+/* Private macro -------------------------------------------------------------*/
+#define TILE_PUT16(p, v)                do { (p)[0] = (uint8_t)(v); (p)[1] = (uint8_t)((v) >> 8); } while (0)
+#define TILE_GET16(p)                   ((uint32_t)(p)[0] | ((uint32_t)(p)[1] << 8))
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t TileDelta_Sad(const uint8_t *a, const uint8_t *b, uint32_t pitch, uint32_t size);
+static void TileDelta_CopyBlock(uint8_t *dst, uint32_t dst_pitch, const uint8_t *src, uint32_t src_pitch,
+                                uint32_t size);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  TileDelta_Sad
+  *         Sum of absolute differences of two square blocks.
+  * @param  a, b: top left pixels
+  * @param  pitch: bytes from one line to the next, both blocks
+  * @param  size: block side, multiple of 4
+  * @retval Sum
+  */
+static uint32_t TileDelta_Sad(const uint8_t *a, const uint8_t *b, uint32_t pitch, uint32_t size)
+{
+  uint32_t sad = 0U, row, col;
+
+#if TILE_USE_SIMD
+  if ((((uint32_t)a | (uint32_t)b | pitch) & 3U) == 0U)
+  {
+    for (row = 0U; row < size; row++)
+    {
+      for (col = 0U; col < size; col += 4U)
+      {
+        sad = __USADA8(*(const uint32_t *)&a[col], *(const uint32_t *)&b[col], sad);
+      }
+      a += pitch;
+      b += pitch;
+    }
+    return sad;
+  }
+#endif
+  for (row = 0U; row < size; row++)
+  {
+    for (col = 0U; col < size; col++)
+    {
+      sad += (a[col] > b[col]) ? (uint32_t)(a[col] - b[col]) : (uint32_t)(b[col] - a[col]);
+    }
+    a += pitch;
+    b += pitch;
+  }
+  return sad;
+}
+
+/**
+  * @brief  TileDelta_CopyBlock
+  * @param  dst, dst_pitch: destination block and its line pitch
+  * @param  src, src_pitch: source block and its line pitch
+  * @param  size: block side
+  * @retval None
+  */
+static void TileDelta_CopyBlock(uint8_t *dst, uint32_t dst_pitch, const uint8_t *src, uint32_t src_pitch,
+                                uint32_t size)
+{
+  uint32_t row;
+
+  for (row = 0U; row < size; row++)
+  {
+    memcpy(dst, src, size);
+    dst += dst_pitch;
+    src += src_pitch;
+  }
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+  * @brief  TileDelta_Init
+  *         Sets up an encoder, its first frame is a key frame.
+  * @param  enc: encoder
+  * @param  width, height: frame size, multiples of TILE_SIZE
+  * @param  ref: width x height x 3 / 2 bytes for the reference frame
+  * @retval 0, -1 if the size is not a multiple of TILE_SIZE
+  */
+int32_t TileDelta_Init(TileDelta_EncoderTypeDef *enc, uint16_t width, uint16_t height, uint8_t *ref)
+{
+  if ((width == 0U) || (height == 0U) || ((width % TILE_SIZE) != 0U) || ((height % TILE_SIZE) != 0U) ||
+      (ref == NULL))
+  {
+    return -1;
+  }
+  enc->width = width;
+  enc->height = height;
+  enc->threshold = TILE_DELTA_THRESHOLD_DEFAULT;
+  enc->key_interval = TILE_DELTA_KEY_INTERVAL_DEFAULT;
+  enc->force_key = 1U;
+  enc->frame = 0U;
+  enc->ref.y = ref;
+  enc->ref.cb = ref + ((uint32_t)width * height);
+  enc->ref.cr = enc->ref.cb + (((uint32_t)width * height) / 4U);
+  return 0;
+}
+
+/**
+  * @brief  TileDelta_ForceKey
+  *         Makes the next frame a key frame, for a host that starts streaming.
+  * @param  enc: encoder
+  * @retval None
+  */
+void TileDelta_ForceKey(TileDelta_EncoderTypeDef *enc)
+{
+  enc->force_key = 1U;
+}
+
+/**
+  * @brief  TileDelta_Encode
+  *         Encodes the tiles of src that changed since the reference.
+  * @param  enc: encoder
+  * @param  src: frame to send, planes of width x height and width/2 x height/2
+  * @param  out: payload
+  * @param  size: bytes available at out, at least TILE_DELTA_MAX_SIZE(width, height)
+  * @retval Payload length, 0 if out is too small
+  */
+uint32_t TileDelta_Encode(TileDelta_EncoderTypeDef *enc, const TileDelta_FrameTypeDef *src,
+                          uint8_t *out, uint32_t size)
+{
+  const uint32_t tiles_x = enc->width / TILE_SIZE;
+  const uint32_t tiles = tiles_x * (enc->height / TILE_SIZE);
+  const uint32_t pitch = enc->width;
+  const uint32_t cpitch = enc->width / 2U;
+  uint8_t *bitmap = out + TILE_DELTA_HEADER_SIZE;
+  uint8_t *p = bitmap + ((tiles + 7U) / 8U);
+  uint32_t t, offset, coffset, count = 0U, sad;
+  uint8_t key;
+
+  if (size < TILE_DELTA_MAX_SIZE(enc->width, enc->height))
+  {
+    return 0U;
+  }
+
+  key = ((enc->force_key != 0U) ||
+         ((enc->key_interval != 0U) && ((enc->frame % enc->key_interval) == 0U))) ? 1U : 0U;
+  enc->force_key = 0U;
+  memset(bitmap, 0, (tiles + 7U) / 8U);
+
+  for (t = 0U; t < tiles; t++)
+  {
+    offset = ((t / tiles_x) * TILE_SIZE * pitch) + ((t % tiles_x) * TILE_SIZE);
+    coffset = ((t / tiles_x) * TILE_CHROMA * cpitch) + ((t % tiles_x) * TILE_CHROMA);
+    if (key == 0U)
+    {
+      sad = TileDelta_Sad(src->y + offset, enc->ref.y + offset, pitch, TILE_SIZE);
+      if (sad <= ((uint32_t)enc->threshold * TILE_BYTES))
+      {
+        sad += TileDelta_Sad(src->cb + coffset, enc->ref.cb + coffset, cpitch, TILE_CHROMA);
+        sad += TileDelta_Sad(src->cr + coffset, enc->ref.cr + coffset, cpitch, TILE_CHROMA);
+        if (sad <= ((uint32_t)enc->threshold * TILE_BYTES))
+        {
+          continue;
+        }
+      }
+    }
+
+    bitmap[t / 8U] |= (uint8_t)(1U << (t % 8U));
+    count++;
+    TileDelta_CopyBlock(p, TILE_SIZE, src->y + offset, pitch, TILE_SIZE);
+    TileDelta_CopyBlock(enc->ref.y + offset, pitch, src->y + offset, pitch, TILE_SIZE);
+    p += TILE_SIZE * TILE_SIZE;
+    TileDelta_CopyBlock(p, TILE_CHROMA, src->cb + coffset, cpitch, TILE_CHROMA);
+    TileDelta_CopyBlock(enc->ref.cb + coffset, cpitch, src->cb + coffset, cpitch, TILE_CHROMA);
+    p += TILE_CHROMA * TILE_CHROMA;
+    TileDelta_CopyBlock(p, TILE_CHROMA, src->cr + coffset, cpitch, TILE_CHROMA);
+    TileDelta_CopyBlock(enc->ref.cr + coffset, cpitch, src->cr + coffset, cpitch, TILE_CHROMA);
+    p += TILE_CHROMA * TILE_CHROMA;
+  }
+
+  out[0] = 'T';
+  out[1] = 'D';
+  out[2] = TILE_DELTA_VERSION;
+  out[3] = (key != 0U) ? TILE_DELTA_FLAG_KEY : 0U;
+  TILE_PUT16(&out[4], enc->width);
+  TILE_PUT16(&out[6], enc->height);
+  TILE_PUT16(&out[8], enc->frame);
+  TILE_PUT16(&out[10], enc->frame >> 16);
+  TILE_PUT16(&out[12], count);
+  TILE_PUT16(&out[14], 0U);
+  enc->frame++;
+  return (uint32_t)(p - out);
+}
+
+/**
+  * @brief  TileDelta_Decode
+  *         Applies a payload to the frame shown, which keeps the tiles that
+  *         were not sent.
+  * @param  payload, len: one complete payload
+  * @param  dst: frame shown, planes of width x height and width/2 x height/2
+  * @param  width, height: frame size
+  * @retval 0, -1 if the payload is malformed or of another size
+  */
+int32_t TileDelta_Decode(const uint8_t *payload, uint32_t len, const TileDelta_FrameTypeDef *dst,
+                         uint16_t width, uint16_t height)
+{
+  const uint32_t tiles_x = width / TILE_SIZE;
+  const uint32_t tiles = tiles_x * (height / TILE_SIZE);
+  const uint32_t pitch = width;
+  const uint32_t cpitch = width / 2U;
+  const uint8_t *bitmap = payload + TILE_DELTA_HEADER_SIZE;
+  const uint8_t *p = bitmap + ((tiles + 7U) / 8U);
+  uint32_t t, offset, coffset;
+
+  if ((len < (TILE_DELTA_HEADER_SIZE + ((tiles + 7U) / 8U))) ||
+      (payload[0] != 'T') || (payload[1] != 'D') || (payload[2] != TILE_DELTA_VERSION) ||
+      (TILE_GET16(&payload[4]) != width) || (TILE_GET16(&payload[6]) != height) ||
+      (len != ((uint32_t)(p - payload) + (TILE_GET16(&payload[12]) * TILE_BYTES))))
+  {
+    return -1;
+  }
+
+  for (t = 0U; t < tiles; t++)
+  {
+    if ((bitmap[t / 8U] & (1U << (t % 8U))) == 0U)
+    {
+      continue;
+    }
+    if ((uint32_t)(p - payload) + TILE_BYTES > len)
+    {
+      return -1;
+    }
+    offset = ((t / tiles_x) * TILE_SIZE * pitch) + ((t % tiles_x) * TILE_SIZE);
+    coffset = ((t / tiles_x) * TILE_CHROMA * cpitch) + ((t % tiles_x) * TILE_CHROMA);
+    TileDelta_CopyBlock(dst->y + offset, pitch, p, TILE_SIZE, TILE_SIZE);
+    p += TILE_SIZE * TILE_SIZE;
+    TileDelta_CopyBlock(dst->cb + coffset, cpitch, p, TILE_CHROMA, TILE_CHROMA);
+    p += TILE_CHROMA * TILE_CHROMA;
+    TileDelta_CopyBlock(dst->cr + coffset, cpitch, p, TILE_CHROMA, TILE_CHROMA);
+    p += TILE_CHROMA * TILE_CHROMA;
+  }
+  return 0;
+}
+
+#ifdef TILE_BENCHMARK
+#define TILE_BENCH_WIDTH                128U
+#define TILE_BENCH_HEIGHT               96U
+#define TILE_BENCH_PIXELS               (TILE_BENCH_WIDTH * TILE_BENCH_HEIGHT)
+#define TILE_BENCH_FRAME_BYTES          ((TILE_BENCH_PIXELS * 3U) / 2U)
+#define TILE_BENCH_FRAMES               60U
+#define TILE_BENCH_OBJECT               24U
+
+static uint8_t bench_src[TILE_BENCH_FRAME_BYTES];
+static uint8_t bench_ref[TILE_BENCH_FRAME_BYTES];
+static uint8_t bench_dec[TILE_BENCH_FRAME_BYTES];
+static uint8_t bench_out[TILE_DELTA_MAX_SIZE(TILE_BENCH_WIDTH, TILE_BENCH_HEIGHT)];
+
+/**
+  * @brief  TileDelta_BenchFrame
+  *         Fixed surveillance view: textured background, sensor noise of
+  *         +-1 and an object crossing the scene.
+  * @param  n: frame number
+  * @param  seed: noise generator state
+  * @retval None
+  */
+static void TileDelta_BenchFrame(uint32_t n, uint32_t *seed)
+{
+  uint32_t x, y, v, ox = (n * 3U) % (TILE_BENCH_WIDTH - TILE_BENCH_OBJECT), oy = 30U;
+  uint8_t *cb = bench_src + TILE_BENCH_PIXELS;
+  uint8_t *cr = cb + (TILE_BENCH_PIXELS / 4U);
+
+  for (y = 0U; y < TILE_BENCH_HEIGHT; y++)
+  {
+    for (x = 0U; x < TILE_BENCH_WIDTH; x++)
+    {
+      v = 60U + ((x * 5U + y * 3U) & 0x3FU) + (((x >> 3) ^ (y >> 3)) & 1U) * 40U;
+      if ((x >= ox) && (x < (ox + TILE_BENCH_OBJECT)) && (y >= oy) && (y < (oy + TILE_BENCH_OBJECT)))
+      {
+        v = 220U - ((x - ox) * 2U);
+      }
+      *seed = (*seed * 1103515245U) + 12345U;
+      v = v + ((*seed >> 16) % 3U) - 1U;
+      bench_src[(y * TILE_BENCH_WIDTH) + x] = (uint8_t)v;
+    }
+  }
+  for (y = 0U; y < (TILE_BENCH_HEIGHT / 2U); y++)
+  {
+    for (x = 0U; x < (TILE_BENCH_WIDTH / 2U); x++)
+    {
+      v = ((2U * x) >= ox) && ((2U * x) < (ox + TILE_BENCH_OBJECT)) &&
+          ((2U * y) >= oy) && ((2U * y) < (oy + TILE_BENCH_OBJECT));
+      cb[(y * (TILE_BENCH_WIDTH / 2U)) + x] = (uint8_t)((v != 0U) ? 90U : (128U + (x & 7U)));
+      cr[(y * (TILE_BENCH_WIDTH / 2U)) + x] = (uint8_t)((v != 0U) ? 200U : (128U - (y & 7U)));
+    }
+  }
+}
+
+/**
+  * @brief  TileDelta_Benchmark
+  *         Encodes and decodes a synthetic fixed view at several thresholds,
+  *         prints the compression against raw 4:2:0 and the luma PSNR of the
+  *         decoded frames, and checks that the decoder tracks the encoder.
+  * @retval None
+  */
+void TileDelta_Benchmark(void)
+{
+  static const uint8_t thresholds[] = {0U, 1U, 2U, 4U, 8U};
+  TileDelta_EncoderTypeDef enc;
+  TileDelta_FrameTypeDef src = {bench_src, bench_src + TILE_BENCH_PIXELS,
+                                bench_src + TILE_BENCH_PIXELS + (TILE_BENCH_PIXELS / 4U)};
+  TileDelta_FrameTypeDef dec = {bench_dec, bench_dec + TILE_BENCH_PIXELS,
+                                bench_dec + TILE_BENCH_PIXELS + (TILE_BENCH_PIXELS / 4U)};
+  uint32_t t, n, i, bytes, seed, errors;
+  int32_t d;
+  double sse, psnr;
+
+  for (t = 0U; t < (sizeof(thresholds) / sizeof(thresholds[0])); t++)
+  {
+    TileDelta_Init(&enc, TILE_BENCH_WIDTH, TILE_BENCH_HEIGHT, bench_ref);
+    enc.threshold = thresholds[t];
+    bytes = 0U;
+    errors = 0U;
+    sse = 0.0;
+    seed = 1U;
+    for (n = 0U; n < TILE_BENCH_FRAMES; n++)
+    {
+      TileDelta_BenchFrame(n, &seed);
+      i = TileDelta_Encode(&enc, &src, bench_out, sizeof(bench_out));
+      bytes += i;
+      if ((TileDelta_Decode(bench_out, i, &dec, TILE_BENCH_WIDTH, TILE_BENCH_HEIGHT) != 0) ||
+          (memcmp(bench_dec, bench_ref, TILE_BENCH_FRAME_BYTES) != 0))
+      {
+        errors++;
+      }
+      for (i = 0U; i < TILE_BENCH_PIXELS; i++)
+      {
+        d = (int32_t)bench_src[i] - (int32_t)bench_dec[i];
+        sse += (double)(d * d);
+      }
+    }
+    sse /= (double)TILE_BENCH_PIXELS * TILE_BENCH_FRAMES;
+    psnr = (sse > 0.0) ? (10.0 * log10(65025.0 / sse)) : 99.0;
+    printf("tile threshold %2u: %5lu bytes/frame, %3lu.%lu:1 against raw 4:2:0, PSNR %2d.%02d dB, %s\r\n",
+           thresholds[t], (unsigned long)(bytes / TILE_BENCH_FRAMES),
+           (unsigned long)(((uint64_t)TILE_BENCH_FRAME_BYTES * TILE_BENCH_FRAMES) / bytes),
+           (unsigned long)((((uint64_t)TILE_BENCH_FRAME_BYTES * TILE_BENCH_FRAMES * 10U) / bytes) % 10U),
+           (int)psnr, (int)(psnr * 100.0) % 100, (errors == 0U) ? "decoder in sync" : "DECODER MISMATCH");
+  }
+}
+#endif /* TILE_BENCHMARK */
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -25,9 +25,10 @@
 #include "usbd_core.h"
 #include "usbd_desc.h"
 #include "usbd_uvc.h"
+#include "usbd_uvc_if.h"
 
 /* USER CODE BEGIN Includes */
-
+#include "mem_region.h"
 /* USER CODE END Includes */
 
 /* USER CODE BEGIN PV */
@@ -41,7 +42,7 @@
 /* USER CODE END PFP */
 
 /* USB Device Core handle declaration. */
-USBD_HandleTypeDef hUsbDeviceFS;
+USBD_HandleTypeDef hUsbDeviceFS MEM_CCMRAM;
 
 /*
  * -- Insert your variables declaration here --
@@ -79,6 +80,11 @@ void MX_USB_DEVICE_Init(void)
   {
     Error_Handler();
   }
+
+  if (USBD_UVC_RegisterInterface(&hUsbDeviceFS, &USBD_UVC_fops_FS) != USBD_OK)
+  {
+    Error_Handler();
+  }
 	
   printf("Start USB\r\n");
   if (USBD_Start(&hUsbDeviceFS) != USBD_OK)
@@ -26,7 +26,8 @@
 #include "usbd_core.h"
 
 /* USER CODE BEGIN Includes */
-
+#include "mem_region.h"
+#include "defer.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -36,9 +37,43 @@
 /* USER CODE BEGIN PV */
 /* Private variables ---------------------------------------------------------*/
 
+#if (USBD_POOL_HANDLE_BLOCK_COUNT > 32U) || (USBD_POOL_STREAM_BLOCK_COUNT > 32U)
+#error "USBD pools are tracked with a 32-bit mask, reduce the block count"
+#endif
+
+/* Backing storage of the USBD_malloc pools, reserved at link time so that
+   no heap is touched when the host configures or resets the device. The
+   OTG_FS core has no DMA, the CPU copies the packets to its FIFO: the class
+   state and the packet buffers live in CCM RAM. */
+static uint32_t usbd_pool_handle_mem[USBD_POOL_HANDLE_BLOCK_COUNT][USBD_POOL_HANDLE_BLOCK_SIZE / 4U] MEM_CCMRAM;
+static uint32_t usbd_pool_stream_mem[USBD_POOL_STREAM_BLOCK_COUNT][USBD_POOL_STREAM_BLOCK_SIZE / 4U] MEM_CCMRAM;
+
+typedef struct
+{
+  uint8_t               *base;
+  uint32_t               used_mask;
+  USBD_PoolStatsTypeDef  stats;
+} USBD_PoolTypeDef;
+
+static USBD_PoolTypeDef usbd_pools[USBD_POOL_NUM] =
+{
+  { (uint8_t *)usbd_pool_handle_mem, 0U, { USBD_POOL_HANDLE_BLOCK_SIZE, USBD_POOL_HANDLE_BLOCK_COUNT, 0U, 0U, 0U } },
+  { (uint8_t *)usbd_pool_stream_mem, 0U, { USBD_POOL_STREAM_BLOCK_SIZE, USBD_POOL_STREAM_BLOCK_COUNT, 0U, 0U, 0U } },
+};
+
+/* Endpoint event handed to a bottom half: the transfer buffer is read in
+   the interrupt, the HAL moves it on with the next transfer */
+typedef struct
+{
+  uint8_t   *buff;
+  uint8_t    epnum;
+} USBD_DeferEpTypeDef;
+
+static __IO uint8_t usbd_sof_pending;
+
 /* USER CODE END PV */
 
-PCD_HandleTypeDef hpcd_USB_OTG_FS;
+PCD_HandleTypeDef hpcd_USB_OTG_FS MEM_CCMRAM;
 void Error_Handler(void);
 
 /* External functions --------------------------------------------------------*/
@@ -49,6 +84,17 @@ void SystemClock_Config(void);
 /* USER CODE END 0 */
 
 /* USER CODE BEGIN PFP */
+static void USBD_Defer_Setup(void *arg, const uint8_t *data);
+static void USBD_Defer_DataOut(void *arg, const uint8_t *data);
+static void USBD_Defer_DataIn(void *arg, const uint8_t *data);
+static void USBD_Defer_SOF(void *arg, const uint8_t *data);
+static void USBD_Defer_Reset(void *arg, const uint8_t *data);
+static void USBD_Defer_Suspend(void *arg, const uint8_t *data);
+static void USBD_Defer_Resume(void *arg, const uint8_t *data);
+static void USBD_Defer_IsoOUTIncomplete(void *arg, const uint8_t *data);
+static void USBD_Defer_IsoINIncomplete(void *arg, const uint8_t *data);
+static void USBD_Defer_Connected(void *arg, const uint8_t *data);
+static void USBD_Defer_Disconnected(void *arg, const uint8_t *data);
 /* Private function prototypes -----------------------------------------------*/
 USBD_StatusTypeDef USBD_Get_USB_Status(HAL_StatusTypeDef hal_status);
 
@@ -58,6 +104,71 @@ USBD_StatusTypeDef USBD_Get_USB_Status(HAL_StatusTypeDef hal_status);
 
 /* USER CODE BEGIN 1 */
 
+/* Bottom halves of the PCD callbacks: the USB interrupt only posts them, the
+   device library and the class run from Defer_Run(), in the order of the
+   events. */
+
+static void USBD_Defer_Setup(void *arg, const uint8_t *data)
+{
+  USBD_LL_SetupStage((USBD_HandleTypeDef*)arg, (uint8_t *)data);
+}
+
+static void USBD_Defer_DataOut(void *arg, const uint8_t *data)
+{
+  const USBD_DeferEpTypeDef *ep = (const USBD_DeferEpTypeDef *)data;
+
+  USBD_LL_DataOutStage((USBD_HandleTypeDef*)arg, ep->epnum, ep->buff);
+}
+
+static void USBD_Defer_DataIn(void *arg, const uint8_t *data)
+{
+  const USBD_DeferEpTypeDef *ep = (const USBD_DeferEpTypeDef *)data;
+
+  USBD_LL_DataInStage((USBD_HandleTypeDef*)arg, ep->epnum, ep->buff);
+}
+
+static void USBD_Defer_SOF(void *arg, const uint8_t *data)
+{
+  usbd_sof_pending = 0U;
+  USBD_LL_SOF((USBD_HandleTypeDef*)arg);
+}
+
+static void USBD_Defer_Reset(void *arg, const uint8_t *data)
+{
+  USBD_LL_SetSpeed((USBD_HandleTypeDef*)arg, *(const USBD_SpeedTypeDef *)data);
+  USBD_LL_Reset((USBD_HandleTypeDef*)arg);
+}
+
+static void USBD_Defer_Suspend(void *arg, const uint8_t *data)
+{
+  USBD_LL_Suspend((USBD_HandleTypeDef*)arg);
+}
+
+static void USBD_Defer_Resume(void *arg, const uint8_t *data)
+{
+  USBD_LL_Resume((USBD_HandleTypeDef*)arg);
+}
+
+static void USBD_Defer_IsoOUTIncomplete(void *arg, const uint8_t *data)
+{
+  USBD_LL_IsoOUTIncomplete((USBD_HandleTypeDef*)arg, data[0]);
+}
+
+static void USBD_Defer_IsoINIncomplete(void *arg, const uint8_t *data)
+{
+  USBD_LL_IsoINIncomplete((USBD_HandleTypeDef*)arg, data[0]);
+}
+
+static void USBD_Defer_Connected(void *arg, const uint8_t *data)
+{
+  USBD_LL_DevConnected((USBD_HandleTypeDef*)arg);
+}
+
+static void USBD_Defer_Disconnected(void *arg, const uint8_t *data)
+{
+  USBD_LL_DevDisconnected((USBD_HandleTypeDef*)arg);
+}
+
 /* USER CODE END 1 */
 
 /*******************************************************************************
@@ -139,7 +250,7 @@ static void PCD_SetupStageCallback(PCD_HandleTypeDef *hpcd)
 void HAL_PCD_SetupStageCallback(PCD_HandleTypeDef *hpcd)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 {
-  USBD_LL_SetupStage((USBD_HandleTypeDef*)hpcd->pData, (uint8_t *)hpcd->Setup);
+  Defer_Post(USBD_Defer_Setup, hpcd->pData, hpcd->Setup, 8U);
 }
 
 /**
@@ -154,7 +265,9 @@ static void PCD_DataOutStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 void HAL_PCD_DataOutStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 {
-  USBD_LL_DataOutStage((USBD_HandleTypeDef*)hpcd->pData, epnum, hpcd->OUT_ep[epnum].xfer_buff);
+  USBD_DeferEpTypeDef ep = { hpcd->OUT_ep[epnum].xfer_buff, epnum };
+
+  Defer_Post(USBD_Defer_DataOut, hpcd->pData, &ep, sizeof(ep));
 }
 
 /**
@@ -169,7 +282,9 @@ static void PCD_DataInStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 void HAL_PCD_DataInStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 {
-  USBD_LL_DataInStage((USBD_HandleTypeDef*)hpcd->pData, epnum, hpcd->IN_ep[epnum].xfer_buff);
+  USBD_DeferEpTypeDef ep = { hpcd->IN_ep[epnum].xfer_buff, epnum };
+
+  Defer_Post(USBD_Defer_DataIn, hpcd->pData, &ep, sizeof(ep));
 }
 
 /**
@@ -183,7 +298,12 @@ static void PCD_SOFCallback(PCD_HandleTypeDef *hpcd)
 void HAL_PCD_SOFCallback(PCD_HandleTypeDef *hpcd)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 {
-  USBD_LL_SOF((USBD_HandleTypeDef*)hpcd->pData);
+  /* one SOF waiting is enough, the class reads the frame number itself */
+  if (usbd_sof_pending == 0U)
+  {
+    usbd_sof_pending = 1U;
+    Defer_Post(USBD_Defer_SOF, hpcd->pData, NULL, 0U);
+  }
 }
 
 /**
@@ -211,11 +331,8 @@ void HAL_PCD_ResetCallback(PCD_HandleTypeDef *hpcd)
   {
     Error_Handler();
   }
-    /* Set Speed. */
-  USBD_LL_SetSpeed((USBD_HandleTypeDef*)hpcd->pData, speed);
-
-  /* Reset Device. */
-  USBD_LL_Reset((USBD_HandleTypeDef*)hpcd->pData);
+  /* Set Speed and reset the device in the bottom half. */
+  Defer_Post(USBD_Defer_Reset, hpcd->pData, &speed, sizeof(speed));
 }
 
 /**
@@ -231,7 +348,7 @@ void HAL_PCD_SuspendCallback(PCD_HandleTypeDef *hpcd)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 {
   /* Inform USB library that core enters in suspend Mode. */
-  USBD_LL_Suspend((USBD_HandleTypeDef*)hpcd->pData);
+  Defer_Post(USBD_Defer_Suspend, hpcd->pData, NULL, 0U);
   __HAL_PCD_GATE_PHYCLOCK(hpcd);
   /* Enter in STOP mode. */
   /* USER CODE BEGIN 2 */
@@ -258,7 +375,7 @@ void HAL_PCD_ResumeCallback(PCD_HandleTypeDef *hpcd)
   /* USER CODE BEGIN 3 */
 
   /* USER CODE END 3 */
-  USBD_LL_Resume((USBD_HandleTypeDef*)hpcd->pData);
+  Defer_Post(USBD_Defer_Resume, hpcd->pData, NULL, 0U);
 }
 
 /**
@@ -273,7 +390,7 @@ static void PCD_ISOOUTIncompleteCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 void HAL_PCD_ISOOUTIncompleteCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 {
-  USBD_LL_IsoOUTIncomplete((USBD_HandleTypeDef*)hpcd->pData, epnum);
+  Defer_Post(USBD_Defer_IsoOUTIncomplete, hpcd->pData, &epnum, 1U);
 }
 
 /**
@@ -288,7 +405,7 @@ static void PCD_ISOINIncompleteCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 void HAL_PCD_ISOINIncompleteCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 {
-  USBD_LL_IsoINIncomplete((USBD_HandleTypeDef*)hpcd->pData, epnum);
+  Defer_Post(USBD_Defer_IsoINIncomplete, hpcd->pData, &epnum, 1U);
 }
 
 /**
@@ -302,7 +419,7 @@ static void PCD_ConnectCallback(PCD_HandleTypeDef *hpcd)
 void HAL_PCD_ConnectCallback(PCD_HandleTypeDef *hpcd)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 {
-  USBD_LL_DevConnected((USBD_HandleTypeDef*)hpcd->pData);
+  Defer_Post(USBD_Defer_Connected, hpcd->pData, NULL, 0U);
 }
 
 /**
@@ -316,7 +433,7 @@ static void PCD_DisconnectCallback(PCD_HandleTypeDef *hpcd)
 void HAL_PCD_DisconnectCallback(PCD_HandleTypeDef *hpcd)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 {
-  USBD_LL_DevDisconnected((USBD_HandleTypeDef*)hpcd->pData);
+  Defer_Post(USBD_Defer_Disconnected, hpcd->pData, NULL, 0U);
 }
 
 /*******************************************************************************
@@ -366,9 +483,18 @@ USBD_StatusTypeDef USBD_LL_Init(USBD_HandleTypeDef *pdev)
   HAL_PCD_RegisterIsoOutIncpltCallback(&hpcd_USB_OTG_FS, PCD_ISOOUTIncompleteCallback);
   HAL_PCD_RegisterIsoInIncpltCallback(&hpcd_USB_OTG_FS, PCD_ISOINIncompleteCallback);
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
+#if (USBD_UVC_NUM_INSTANCES > 1)
+  /* The 320 words of FS FIFO RAM are split between the UVC functions:
+     64 words Rx, 16 words EP0 and one VIDEO_PACKET_SIZE FIFO per function. */
+  HAL_PCDEx_SetRxFiFo(&hpcd_USB_OTG_FS, 0x40);
+  HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 0, 0x10);
+  HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 1, 0x70);
+  HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 2, 0x70);
+#else
   HAL_PCDEx_SetRxFiFo(&hpcd_USB_OTG_FS, 0x200);
   HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 0, 0x40);
   HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 1, 0x3FF);
+#endif
   }
   return USBD_OK;
 }
@@ -615,6 +741,167 @@ void USBD_LL_Delay(uint32_t Delay)
   HAL_Delay(Delay);
 }
 
+/**
+  * @brief  Static memory allocation for the USB Device Library.
+  *         Serves the request from the smallest pool whose blocks fit it.
+  *         Safe to call from the USB interrupt.
+  * @param  size: Size of the allocation in bytes
+  * @retval Pointer to a 32-bit aligned block, NULL if the pools are exhausted
+  */
+void *USBD_static_malloc(uint32_t size)
+{
+  uint32_t primask;
+  uint32_t pool;
+  uint32_t block;
+  uint32_t full = 0U;   /* pools that fit the request but had no free block */
+  void *p = NULL;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  for (pool = 0U; (pool < USBD_POOL_NUM) && (p == NULL); pool++)
+  {
+    USBD_PoolTypeDef *pp = &usbd_pools[pool];
+
+    if (size > pp->stats.block_size)
+    {
+      continue;
+    }
+    for (block = 0U; block < pp->stats.block_count; block++)
+    {
+      if ((pp->used_mask & (1UL << block)) == 0U)
+      {
+        pp->used_mask |= (1UL << block);
+        pp->stats.in_use++;
+        if (pp->stats.in_use > pp->stats.high_water)
+        {
+          pp->stats.high_water = pp->stats.in_use;
+        }
+        p = pp->base + (block * pp->stats.block_size);
+        break;
+      }
+    }
+    if (p == NULL)
+    {
+      full |= (1UL << pool);
+    }
+  }
+
+  /* a failure is a request no pool served, charged to the smallest that
+     fits it; a full pool passed over for a larger one is a spill */
+  for (pool = 0U; (pool < USBD_POOL_NUM) && (full != 0U); pool++)
+  {
+    if ((full & (1UL << pool)) == 0U)
+    {
+      continue;
+    }
+    if (p == NULL)
+    {
+      usbd_pools[pool].stats.failures++;
+      break;
+    }
+    usbd_pools[pool].stats.spills++;
+  }
+
+  __set_PRIMASK(primask);
+  return p;
+}
+
+/**
+  * @brief  Releases a block obtained from USBD_static_malloc.
+  * @param  p: Pointer to the block, NULL is ignored
+  * @retval None
+  */
+void USBD_static_free(void *p)
+{
+  uint32_t primask;
+  uint32_t pool;
+
+  if (p == NULL)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  for (pool = 0U; pool < USBD_POOL_NUM; pool++)
+  {
+    USBD_PoolTypeDef *pp = &usbd_pools[pool];
+    uint32_t offset = (uint32_t)((uint8_t *)p - pp->base);
+
+    if (((uint8_t *)p >= pp->base) &&
+        (offset < (pp->stats.block_size * pp->stats.block_count)))
+    {
+      uint32_t block = offset / pp->stats.block_size;
+
+      if ((pp->used_mask & (1UL << block)) != 0U)
+      {
+        pp->used_mask &= ~(1UL << block);
+        pp->stats.in_use--;
+      }
+      break;
+    }
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Returns a snapshot of the usage counters of a pool.
+  * @param  pool: USBD_POOL_HANDLE or USBD_POOL_STREAM
+  * @param  stats: Destination of the snapshot
+  * @retval None
+  */
+void USBD_Pool_GetStats(uint32_t pool, USBD_PoolStatsTypeDef *stats)
+{
+  uint32_t primask;
+
+  if (pool >= USBD_POOL_NUM)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *stats = usbd_pools[pool].stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Prints the high-water mark of every pool on the console.
+  * @retval None
+  */
+void USBD_Pool_Report(void)
+{
+  static const char * const pool_name[USBD_POOL_NUM] = { "handle", "stream" };
+  USBD_PoolStatsTypeDef stats;
+  uint32_t pool;
+
+  for (pool = 0U; pool < USBD_POOL_NUM; pool++)
+  {
+    USBD_Pool_GetStats(pool, &stats);
+    printf("USBD pool %-6s: %lu x %lu bytes, in use %lu, high water %lu, spills %lu, failures %lu\r\n",
+           pool_name[pool],
+           (unsigned long)stats.block_count, (unsigned long)stats.block_size,
+           (unsigned long)stats.in_use, (unsigned long)stats.high_water,
+           (unsigned long)stats.spills, (unsigned long)stats.failures);
+  }
+}
+
+/**
+  * @brief  Returns the number of the current USB frame, from the last SOF
+  *         received. Interrupt safe.
+  * @retval 11-bit frame number
+  */
+uint16_t USBD_LL_GetSofNumber(void)
+{
+  USB_OTG_DeviceTypeDef *device =
+    (USB_OTG_DeviceTypeDef *)((uint32_t)hpcd_USB_OTG_FS.Instance + USB_OTG_DEVICE_BASE);
+
+  return (uint16_t)((device->DSTS & USB_OTG_DSTS_FNSOF) >> USB_OTG_DSTS_FNSOF_Pos);
+}
+
 /**
   * @brief  Retuns the USB status depending on the HAL status:
   * @param  hal_status: HAL status
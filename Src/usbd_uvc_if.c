@@ -0,0 +1,649 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : usbd_uvc_if.c
+  * @version        : v1.0_Cube
+  * @brief          : Generic media access layer.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+ /* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_uvc_if.h"
+
+/* USER CODE BEGIN INCLUDE */
+#include <stdio.h>
+#include "sensor.h"
+#include "capture.h"
+#include "motion.h"
+#include "mem_region.h"
+#include "test_pattern.h"
+#include "tile_delta.h"
+#include "latency.h"
+#include "pipeline.h"
+#include "clock.h"
+#include "boot.h"
+#include "stats.h"
+/* USER CODE END INCLUDE */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+
+/* USER CODE BEGIN PV */
+/* Private variables ---------------------------------------------------------*/
+
+/* USER CODE END PV */
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @brief Usb device library.
+  * @{
+  */
+
+/** @addtogroup USBD_UVC_IF
+  * @{
+  */
+
+/** @defgroup USBD_UVC_IF_Private_TypesDefinitions USBD_UVC_IF_Private_TypesDefinitions
+  * @brief Private types.
+  * @{
+  */
+
+/* USER CODE BEGIN PRIVATE_TYPES */
+
+/* USER CODE END PRIVATE_TYPES */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_UVC_IF_Private_Defines USBD_UVC_IF_Private_Defines
+  * @brief Private defines.
+  * @{
+  */
+
+/* USER CODE BEGIN PRIVATE_DEFINES */
+
+/* Pattern shown by the frame based format until UVC_Pattern_Select() */
+#ifndef UVC_PATTERN_DEFAULT
+#define UVC_PATTERN_DEFAULT             TEST_PATTERN_BOX
+#endif
+
+/* USER CODE END PRIVATE_DEFINES */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_UVC_IF_Private_Macros USBD_UVC_IF_Private_Macros
+  * @brief Private macros.
+  * @{
+  */
+
+/* USER CODE BEGIN PRIVATE_MACRO */
+
+/* USER CODE END PRIVATE_MACRO */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_UVC_IF_Private_Variables USBD_UVC_IF_Private_Variables
+  * @brief Private variables.
+  * @{
+  */
+
+/* USER CODE BEGIN PRIVATE_VARIABLES */
+
+/* Test pattern source of the tile delta format: frames are rendered into a
+   raw buffer, encoded against pattern_enc.ref into a payload buffer and
+   shared by every function that streams the format. All buffers live in
+   SDRAM, one of each in the main loop, PIPELINE_BUFFERS with the tasks. */
+#if PIPELINE_USE_RTOS
+#define PATTERN_BUFFERS                 PIPELINE_BUFFERS
+#else
+#define PATTERN_BUFFERS                 1U
+#endif
+static TestPattern_TypeDef       pattern;
+static TileDelta_EncoderTypeDef  pattern_enc;
+static Pipeline_BufferTypeDef    pattern_raw[PATTERN_BUFFERS];
+static Pipeline_BufferTypeDef    pattern_out[PATTERN_BUFFERS];
+static uint32_t                  pattern_frame;
+static uint8_t                   pattern_streams;   /* functions fed with the last frame */
+static __IO uint8_t              pattern_rekey;     /* pattern switched, send a key frame */
+static __IO uint8_t              pattern_resync;    /* payload dropped, send a key frame */
+static uint8_t                   pattern_ready;
+
+/* USER CODE END PRIVATE_VARIABLES */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_UVC_IF_Exported_Variables USBD_UVC_IF_Exported_Variables
+  * @brief Public variables.
+  * @{
+  */
+
+extern USBD_HandleTypeDef hUsbDeviceFS;
+
+/* USER CODE BEGIN EXPORTED_VARIABLES */
+
+/* USER CODE END EXPORTED_VARIABLES */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_UVC_IF_Private_FunctionPrototypes USBD_UVC_IF_Private_FunctionPrototypes
+  * @brief Private functions declaration.
+  * @{
+  */
+
+static int8_t UVC_Init_FS(void);
+static int8_t UVC_DeInit_FS(void);
+static int8_t UVC_Control_FS(uint8_t n, uint8_t entity, uint8_t selector, int32_t value);
+static int8_t UVC_Window_FS(uint8_t n, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+static int8_t UVC_FrameDone_FS(uint8_t n);
+static int8_t UVC_SkipFrame_FS(uint8_t n);
+static int8_t UVC_StillCapture_FS(uint8_t n);
+
+/* USER CODE BEGIN PRIVATE_FUNCTIONS_DECLARATION */
+static void UVC_Pattern_Planes(const Pipeline_BufferTypeDef *raw, TestPattern_PlanesTypeDef *planes);
+static int32_t UVC_Pattern_Capture(Pipeline_BufferTypeDef *raw);
+static uint32_t UVC_Pattern_Encode(const Pipeline_BufferTypeDef *raw, Pipeline_BufferTypeDef *out);
+static void UVC_Pattern_Send(const Pipeline_BufferTypeDef *out);
+static uint8_t UVC_Pattern_Busy(const Pipeline_BufferTypeDef *out);
+
+#if PIPELINE_USE_RTOS
+static const Pipeline_OpsTypeDef pattern_ops =
+{
+  UVC_Pattern_Capture,
+  UVC_Pattern_Encode,
+  UVC_Pattern_Send,
+  UVC_Pattern_Busy
+};
+#endif
+
+/* USER CODE END PRIVATE_FUNCTIONS_DECLARATION */
+
+/**
+  * @}
+  */
+
+USBD_UVC_ItfTypeDef USBD_UVC_fops_FS =
+{
+  UVC_Init_FS,
+  UVC_DeInit_FS,
+  UVC_Control_FS,
+  UVC_Window_FS,
+  UVC_FrameDone_FS,
+  UVC_SkipFrame_FS,
+  UVC_StillCapture_FS
+};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initializes the video media low layer over USB FS IP
+  * @retval USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t UVC_Init_FS(void)
+{
+  /* USER CODE BEGIN 0 */
+  Boot_Mark(BOOT_STAGE_CONFIGURED);
+  return (USBD_OK);
+  /* USER CODE END 0 */
+}
+
+/**
+  * @brief  De-Initializes the video media low layer
+  * @retval USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t UVC_DeInit_FS(void)
+{
+  /* USER CODE BEGIN 1 */
+  return (USBD_OK);
+  /* USER CODE END 1 */
+}
+
+/**
+  * @brief  Forwards a camera terminal or processing unit control to the sensor,
+  *         and an extension unit control to the capture layer or to the
+  *         motion detector.
+  *         Called from the USB interrupt, the value is only latched here and
+  *         written to the sensor at the next frame boundary.
+  * @param  n: UVC function, all functions share the sensor
+  * @param  entity: UVC_ID_CAMERA_TERMINAL, UVC_ID_PROCESSING_UNIT, UVC_ID_EXTENSION_UNIT
+  *         or UVC_ID_MOTION_UNIT
+  * @param  selector: CT_xxx, PU_xxx, XU_ROI_xxx or XU_MOTION_xxx control selector
+  * @param  value: new value, already range checked
+  * @retval USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t UVC_Control_FS(uint8_t n, uint8_t entity, uint8_t selector, int32_t value)
+{
+  /* USER CODE BEGIN 2 */
+  if (entity == UVC_ID_CAMERA_TERMINAL)
+  {
+    switch (selector)
+    {
+    case CT_AE_MODE_CONTROL:
+      Sensor_SetControl(SENSOR_CTRL_AUTO_EXPOSURE, (value != UVC_AE_MODE_MANUAL) ? 1 : 0);
+      return (USBD_OK);
+    case CT_EXPOSURE_TIME_ABSOLUTE_CONTROL:
+      Sensor_SetControl(SENSOR_CTRL_EXPOSURE, value);
+      return (USBD_OK);
+    default:
+      break;
+    }
+  }
+  else if (entity == UVC_ID_PROCESSING_UNIT)
+  {
+    switch (selector)
+    {
+    case PU_BRIGHTNESS_CONTROL:
+      Sensor_SetControl(SENSOR_CTRL_BRIGHTNESS, value);
+      return (USBD_OK);
+    case PU_CONTRAST_CONTROL:
+      Sensor_SetControl(SENSOR_CTRL_CONTRAST, value);
+      return (USBD_OK);
+    case PU_GAIN_CONTROL:
+      Sensor_SetControl(SENSOR_CTRL_GAIN, value);
+      return (USBD_OK);
+    case PU_POWER_LINE_FREQUENCY_CONTROL:
+      Sensor_SetControl(SENSOR_CTRL_POWER_LINE, value);
+      return (USBD_OK);
+    case PU_WHITE_BALANCE_TEMPERATURE_CONTROL:
+      Sensor_SetControl(SENSOR_CTRL_WB_TEMPERATURE, value);
+      return (USBD_OK);
+    case PU_WHITE_BALANCE_TEMPERATURE_AUTO_CONTROL:
+      Sensor_SetControl(SENSOR_CTRL_WB_AUTO, value);
+      return (USBD_OK);
+    default:
+      break;
+    }
+  }
+  else if (entity == UVC_ID_EXTENSION_UNIT)
+  {
+    switch (selector)
+    {
+    case XU_ROI_BINNING_CONTROL:
+      Capture_SetBinning((uint8_t)value);
+      return (USBD_OK);
+    case XU_ROI_CAPTURE_RATE_CONTROL:
+      Capture_SetRate((uint8_t)value);
+      return (USBD_OK);
+    case XU_ROI_LATENCY_PROBE_CONTROL:
+      Latency_SetProbe((uint8_t)value);
+      return (USBD_OK);
+    default:
+      break;
+    }
+  }
+  else if (entity == UVC_ID_MOTION_UNIT)
+  {
+    switch (selector)
+    {
+    case XU_MOTION_MODE_CONTROL:
+      Motion_SetMode((uint8_t)value);
+      return (USBD_OK);
+    case XU_MOTION_THRESHOLD_CONTROL:
+      Motion_SetThreshold((uint8_t)value);
+      return (USBD_OK);
+    default:
+      break;
+    }
+  }
+  return (USBD_FAIL);
+  /* USER CODE END 2 */
+}
+
+/**
+  * @brief  Selects the region of interest of the capture.
+  *         Called from the USB interrupt, the DCMI is reprogrammed from the
+  *         main loop.
+  * @param  n: UVC function, all functions share the capture
+  * @param  x, y: top left corner in the sensor frame
+  * @param  width, height: window size, already range checked
+  * @retval USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t UVC_Window_FS(uint8_t n, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  /* USER CODE BEGIN 5 */
+  return (Capture_SetWindow(x, y, width, height) == HAL_OK) ? USBD_OK : USBD_FAIL;
+  /* USER CODE END 5 */
+}
+
+/**
+  * @brief  Signals that function n sent the last payload of a frame.
+  * @param  n: UVC function
+  * @retval USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t UVC_FrameDone_FS(uint8_t n)
+{
+  /* USER CODE BEGIN 3 */
+  Boot_Mark(BOOT_STAGE_FIRST_FRAME);
+  Sensor_FrameBoundary();
+#if PIPELINE_USE_RTOS
+  Pipeline_FrameSent();
+#endif
+  return (USBD_OK);
+  /* USER CODE END 3 */
+}
+
+/**
+  * @brief  Asks whether function n sends its next frame, a static scene may
+  *         leave the frame interval empty. The motion score read by the host
+  *         is refreshed here.
+  * @param  n: UVC function
+  * @retval USBD_OK to send the frame, USBD_BUSY to skip it
+  */
+static int8_t UVC_SkipFrame_FS(uint8_t n)
+{
+  /* USER CODE BEGIN 6 */
+  USBD_UVC_SetMotionScore(&hUsbDeviceFS, n, Motion_GetScore());
+  return (Motion_SkipFrame(n) != 0U) ? USBD_BUSY : USBD_OK;
+  /* USER CODE END 6 */
+}
+
+/**
+  * @brief  Starts the capture of a still image for function n.
+  *         When the frame is encoded, hand it over with USBD_UVC_StillReady().
+  * @param  n: UVC function
+  * @retval USBD_OK if a still was captured or is being captured, USBD_FAIL
+  *         to refuse the trigger
+  */
+static int8_t UVC_StillCapture_FS(uint8_t n)
+{
+  /* USER CODE BEGIN 4 */
+  /* no still pipeline yet: the MJPEG stream sends a fixed JPEG image from
+     flash, and the still is that image again, at the same size */
+  return (int8_t)USBD_UVC_StillReady(&hUsbDeviceFS, n, USBD_UVC_GetStreamImage());
+  /* USER CODE END 4 */
+}
+
+/* USER CODE BEGIN PRIVATE_FUNCTIONS_IMPLEMENTATION */
+
+/**
+  * @brief  Allocates the buffers of the test pattern source, after
+  *         MemRegion_Init(). With PIPELINE_USE_RTOS the capture, encode and
+  *         USB tasks are created here, after osKernelInitialize(). Without
+  *         SDRAM the frame based format only sends empty frame intervals.
+  * @retval USBD_OK if all operations are OK else USBD_FAIL
+  */
+int8_t UVC_Pattern_Init(void)
+{
+  uint32_t frame = ((uint32_t)WIDTH * HEIGHT * 3U) / 2U;
+  uint8_t *ref;
+  uint32_t i;
+
+  pattern_ready = 0U;
+  ref = MEM_REGION_NEW(MEM_REGION_SDRAM, uint8_t, frame);
+  for (i = 0U; i < PATTERN_BUFFERS; i++)
+  {
+    pattern_raw[i].data = MEM_REGION_NEW(MEM_REGION_SDRAM, uint8_t, frame);
+    pattern_raw[i].size = frame;
+    pattern_out[i].data = MEM_REGION_NEW(MEM_REGION_SDRAM, uint8_t, MAX_TILE_FRAME_SIZE);
+    pattern_out[i].size = MAX_TILE_FRAME_SIZE;
+    if ((pattern_raw[i].data == NULL) || (pattern_out[i].data == NULL))
+    {
+      ref = NULL;
+    }
+  }
+  if (ref == NULL)
+  {
+    printf("Test pattern: no frame buffers, tile delta format idle\r\n");
+    return (USBD_FAIL);
+  }
+
+  if ((TestPattern_Init(&pattern, UVC_PATTERN_DEFAULT, WIDTH, HEIGHT) != 0) ||
+      (TileDelta_Init(&pattern_enc, WIDTH, HEIGHT, ref) != 0))
+  {
+    return (USBD_FAIL);
+  }
+  /* synthetic pictures carry no noise: every changed tile is sent, the
+     decoded frame and its burned in counter are exact */
+  pattern_enc.threshold = 0U;
+  pattern_frame = 0U;
+  pattern_streams = 0U;
+  pattern_rekey = 0U;
+  pattern_resync = 0U;
+#if PIPELINE_USE_RTOS
+  if (Pipeline_Init(&pattern_ops, pattern_raw, pattern_out) != 0)
+  {
+    return (USBD_FAIL);
+  }
+#endif
+  pattern_ready = 1U;
+  return (USBD_OK);
+}
+
+/**
+  * @brief  Switches the test pattern, from the next frame captured on,
+  *         which is a key frame.
+  * @param  id: TEST_PATTERN_xxx
+  * @retval USBD_OK if all operations are OK else USBD_FAIL
+  */
+int8_t UVC_Pattern_Select(uint8_t id)
+{
+  if (TestPattern_Select(&pattern, id) != 0)
+  {
+    return (USBD_FAIL);
+  }
+  pattern_rekey = 1U;
+  return (USBD_OK);
+}
+
+/**
+  * @brief  Planes of a raw pattern buffer.
+  * @param  raw: buffer of a 4:2:0 frame
+  * @param  planes: luma and chroma planes in raw
+  * @retval None
+  */
+static void UVC_Pattern_Planes(const Pipeline_BufferTypeDef *raw, TestPattern_PlanesTypeDef *planes)
+{
+  uint32_t luma = (uint32_t)WIDTH * HEIGHT;
+
+  planes->y = raw->data;
+  planes->cb = raw->data + luma;
+  planes->cr = planes->cb + (luma / 4U);
+  planes->pitch = WIDTH;
+}
+
+/**
+  * @brief  Renders the next pattern frame for the functions streaming the
+  *         tile delta format.
+  * @param  raw: frame buffer
+  * @retval 0 if a frame was rendered, -1 if no function streams the format
+  */
+static int32_t UVC_Pattern_Capture(Pipeline_BufferTypeDef *raw)
+{
+  TestPattern_PlanesTypeDef planes;
+  uint8_t streams = 0U;
+  uint8_t n;
+
+  for (n = 0U; n < USBD_UVC_NUM_INSTANCES; n++)
+  {
+    if (USBD_UVC_GetFormat(&hUsbDeviceFS, n) == UVC_FORMAT_INDEX_TILE)
+    {
+      streams |= (uint8_t)(1U << n);
+    }
+  }
+  if (streams == 0U)
+  {
+    pattern_streams = 0U;
+    return -1;
+  }
+
+  raw->flags = 0U;
+  /* a function joining the stream has no reference yet, one that dropped
+     a payload has lost it: the encoder reference holds the dropped tiles */
+  if (((streams & (uint8_t)~pattern_streams) != 0U) || (pattern_rekey != 0U) || (pattern_resync != 0U))
+  {
+    if (pattern_rekey != 0U)
+    {
+      pattern_rekey = 0U;
+      pattern_frame = 0U;
+    }
+    pattern_resync = 0U;
+    raw->flags = PIPELINE_FLAG_KEY;
+  }
+  pattern_streams = streams;
+
+  raw->streams = streams;
+  raw->frame = pattern_frame;
+  raw->capture = Latency_Capture(pattern_frame);
+  UVC_Pattern_Planes(raw, &planes);
+  TestPattern_Render(&pattern, pattern_frame, &planes);
+  Motion_PushLines(planes.y, planes.pitch, HEIGHT);
+  raw->len = raw->size;
+  pattern_frame++;
+  return 0;
+}
+
+/**
+  * @brief  Encodes a pattern frame against the decoder's picture, and
+  *         counts its time, or a drop for each function it was for. A
+  *         slow encode claims the performance clock, a fast one gives it
+  *         back.
+  * @param  raw: rendered frame
+  * @param  out: payload buffer
+  * @retval payload length, 0 if it does not fit
+  */
+static uint32_t UVC_Pattern_Encode(const Pipeline_BufferTypeDef *raw, Pipeline_BufferTypeDef *out)
+{
+  TestPattern_PlanesTypeDef planes;
+  TileDelta_FrameTypeDef src;
+  uint32_t start = Latency_Now();
+  uint32_t len;
+  uint8_t n;
+
+  if ((raw->flags & PIPELINE_FLAG_KEY) != 0U)
+  {
+    TileDelta_ForceKey(&pattern_enc);
+  }
+  UVC_Pattern_Planes(raw, &planes);
+  src.y = planes.y;
+  src.cb = planes.cb;
+  src.cr = planes.cr;
+  len = TileDelta_Encode(&pattern_enc, &src, out->data, out->size);
+
+  start = Latency_Now() - start;
+  Stats_Add(STATS_DEVICE, STATS_ENCODED, 1U);
+  Stats_Add(STATS_DEVICE, STATS_ENCODE_TIME, start);
+  Stats_Max(STATS_DEVICE, STATS_ENCODE_MAX, start);
+  if (start > CLOCK_ENCODER_CLAIM_US)
+  {
+    Clock_Claim(CLOCK_CLAIM_ENCODER, 1U);
+  }
+  else if (start < CLOCK_ENCODER_RELEASE_US)
+  {
+    Clock_Claim(CLOCK_CLAIM_ENCODER, 0U);
+  }
+  for (n = 0U; (len == 0U) && (n < USBD_UVC_NUM_INSTANCES); n++)
+  {
+    if ((raw->streams & (1U << n)) != 0U)
+    {
+      Stats_Add(n, STATS_DROPPED, 1U);
+    }
+  }
+  return len;
+}
+
+/**
+  * @brief  Hands a payload to the functions it was captured for that still
+  *         stream the tile delta format. A function still holding the
+  *         previous payload drops it, and the next frame captured is a key
+  *         frame so that its decoder catches up.
+  * @param  out: payload
+  * @retval None
+  */
+static void UVC_Pattern_Send(const Pipeline_BufferTypeDef *out)
+{
+  uint8_t n;
+
+  for (n = 0U; n < USBD_UVC_NUM_INSTANCES; n++)
+  {
+    if (((out->streams & (1U << n)) != 0U) &&
+        (USBD_UVC_GetFormat(&hUsbDeviceFS, n) == UVC_FORMAT_INDEX_TILE) &&
+        (USBD_UVC_FrameReady(&hUsbDeviceFS, n, out->data, out->len, out->frame, out->capture) != USBD_OK))
+    {
+      Stats_Add(n, STATS_DROPPED, 1U);
+      pattern_resync = 1U;
+    }
+  }
+}
+
+/**
+  * @brief  Tells whether a function still reads a payload.
+  * @param  out: payload handed over with UVC_Pattern_Send()
+  * @retval 1 while the buffer must stay untouched
+  */
+static uint8_t UVC_Pattern_Busy(const Pipeline_BufferTypeDef *out)
+{
+  uint8_t n;
+
+  for (n = 0U; n < USBD_UVC_NUM_INSTANCES; n++)
+  {
+    if (((out->streams & (1U << n)) != 0U) && (USBD_UVC_FrameBusy(&hUsbDeviceFS, n) != 0U))
+    {
+      return 1U;
+    }
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Produces the next test pattern frame once every function
+  *         streaming the tile delta format has sent the previous one, so
+  *         the frame rate follows the USB bandwidth. Called from the main
+  *         loop, with PIPELINE_USE_RTOS the pipeline tasks do this instead.
+  * @retval None
+  */
+void UVC_Pattern_Process(void)
+{
+#if !PIPELINE_USE_RTOS
+  Pipeline_BufferTypeDef *raw = &pattern_raw[0];
+  Pipeline_BufferTypeDef *out = &pattern_out[0];
+
+  if ((pattern_ready == 0U) || (UVC_Pattern_Busy(out) != 0U))
+  {
+    return;
+  }
+  if (UVC_Pattern_Capture(raw) != 0)
+  {
+    return;
+  }
+  out->frame = raw->frame;
+  out->capture = raw->capture;
+  out->streams = raw->streams;
+  out->flags = raw->flags;
+  out->len = UVC_Pattern_Encode(raw, out);
+  if (out->len != 0U)
+  {
+    UVC_Pattern_Send(out);
+  }
+#endif
+}
+
+/* USER CODE END PRIVATE_FUNCTIONS_IMPLEMENTATION */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,514 @@
+/**
+  ******************************************************************************
+  * @file    codec_tables_gen.c
+  * @brief   Generator and host check of the codec tables in flash.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                              Codec table generator
+  *          ===================================================================
+  *           Src/codec_tables.c holds the tables of the JPEG baseline coder
+  *           and of the frame CRC as const arrays, so that the firmware
+  *           neither builds them at startup nor keeps them in RAM. They all
+  *           come from this program:
+  *             - zigzag order, walked along the anti-diagonals of the block,
+  *             - quantization tables of ITU T.81 Annex K and their Q16
+  *               reciprocals, the divisions of the quantizer become a
+  *               multiply and a shift,
+  *             - Huffman code and length per symbol, built from the BITS
+  *               and HUFFVAL lists of Annex K (Annex C procedure),
+  *             - the MSB first CRC table of the polynomial 0x04C11DB7 of
+  *               the STM32 CRC unit, and the index of its entries by their
+  *               low byte, which runs the CRC backwards (frame_crc.c).
+  *           Without argument the program writes Src/codec_tables.c to its
+  *           output. With -c it builds the tables again at run time and
+  *           compares them with the ones linked from Src/codec_tables.c,
+  *           along with reference values: Huffman codes of T.81 Table K.5,
+  *           the CRC-32/MPEG-2 check value of "123456789".
+  *
+  *           Build, from the repository root:
+  *             cc -O2 -IInc -o codec_tables_gen
+  *                Utilities/codec_tables/codec_tables_gen.c Src/codec_tables.c
+  *           Usage: codec_tables_gen > Src/codec_tables.c
+  *                  codec_tables_gen -c
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include "codec_tables.h"
+
+/* ITU T.81 Annex K.1, natural order */
+static const uint8_t gen_quant_luma[64] =
+{
+  16, 11, 10, 16,  24,  40,  51,  61,
+  12, 12, 14, 19,  26,  58,  60,  55,
+  14, 13, 16, 24,  40,  57,  69,  56,
+  14, 17, 22, 29,  51,  87,  80,  62,
+  18, 22, 37, 56,  68, 109, 103,  77,
+  24, 35, 55, 64,  81, 104, 113,  92,
+  49, 64, 78, 87, 103, 121, 120, 101,
+  72, 92, 95, 98, 112, 100, 103,  99
+};
+
+static const uint8_t gen_quant_chroma[64] =
+{
+  17, 18, 24, 47, 99, 99, 99, 99,
+  18, 21, 26, 66, 99, 99, 99, 99,
+  24, 26, 56, 99, 99, 99, 99, 99,
+  47, 66, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99
+};
+
+/* ITU T.81 Annex K.3: BITS (codes of each length 1 to 16) and HUFFVAL */
+static const uint8_t gen_dc_luma_bits[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+static const uint8_t gen_dc_chroma_bits[16] = { 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+static const uint8_t gen_dc_vals[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+static const uint8_t gen_ac_luma_bits[16] = { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7D };
+static const uint8_t gen_ac_luma_vals[162] =
+{
+  0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+  0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0,
+  0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+  0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+  0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7,
+  0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5,
+  0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2,
+  0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+  0xF9, 0xFA
+};
+
+static const uint8_t gen_ac_chroma_bits[16] = { 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+static const uint8_t gen_ac_chroma_vals[162] =
+{
+  0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+  0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0,
+  0x15, 0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+  0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+  0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+  0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5,
+  0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3,
+  0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA,
+  0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+  0xF9, 0xFA
+};
+
+/* Tables built at run time */
+static uint8_t gen_zigzag[64];
+static uint16_t gen_recip_luma[64];
+static uint16_t gen_recip_chroma[64];
+static uint32_t gen_dc_luma[CODEC_HUFF_DC_SYMBOLS];
+static uint32_t gen_dc_chroma[CODEC_HUFF_DC_SYMBOLS];
+static uint32_t gen_ac_luma[CODEC_HUFF_AC_SYMBOLS];
+static uint32_t gen_ac_chroma[CODEC_HUFF_AC_SYMBOLS];
+static uint32_t gen_crc[256];
+static uint8_t gen_crc_inverse[256];
+
+static int gen_errors;
+
+/* Zigzag scan: position k of the scan -> index in the natural order */
+static void gen_build_zigzag(void)
+{
+  int k = 0, s, i, j;
+
+  for (s = 0; s < 15; s++)
+  {
+    for (i = 0; i < 8; i++)
+    {
+      /* even anti-diagonals go up and right, odd ones down and left */
+      int row = ((s & 1) != 0) ? i : (s - i);
+      int col = s - row;
+
+      j = row * 8 + col;
+      if ((row >= 0) && (row < 8) && (col >= 0) && (col < 8) && (row + col == s))
+      {
+        gen_zigzag[k++] = (uint8_t)j;
+      }
+    }
+  }
+}
+
+/* Q16 reciprocal, rounded: q * recip >> 16 divides by q */
+static void gen_build_recip(const uint8_t *quant, uint16_t *recip)
+{
+  int i;
+
+  for (i = 0; i < 64; i++)
+  {
+    if (quant[i] < 2U)
+    {
+      fprintf(stderr, "quantizer %u has no 16-bit reciprocal\n", quant[i]);
+      gen_errors++;
+    }
+    recip[i] = (uint16_t)((65536U + quant[i] / 2U) / quant[i]);
+  }
+}
+
+/* T.81 Annex C: canonical codes, then one entry per symbol value */
+static void gen_build_huff(const uint8_t *bits, const uint8_t *vals, uint32_t *table, uint32_t size)
+{
+  uint32_t code = 0U, len, n, k = 0U;
+
+  memset(table, 0, size * sizeof(uint32_t));
+  for (len = 1U; len <= 16U; len++)
+  {
+    for (n = 0U; n < bits[len - 1U]; n++)
+    {
+      if (vals[k] >= size)
+      {
+        fprintf(stderr, "symbol 0x%02X out of the table\n", vals[k]);
+        gen_errors++;
+      }
+      else
+      {
+        table[vals[k]] = CODEC_HUFF_ENTRY(code, len);
+      }
+      code++;
+      k++;
+    }
+    code <<= 1;
+  }
+}
+
+static void gen_build_crc(void)
+{
+  uint8_t seen[256];
+  uint32_t i, c, b;
+
+  for (i = 0U; i < 256U; i++)
+  {
+    c = i << 24;
+    for (b = 0U; b < 8U; b++)
+    {
+      c = ((c & 0x80000000U) != 0U) ? ((c << 1) ^ CODEC_CRC_POLY) : (c << 1);
+    }
+    gen_crc[i] = c;
+  }
+  /* the polynomial has its x^0 term, so the low bytes of the entries are
+     all different */
+  memset(seen, 0, sizeof(seen));
+  for (i = 0U; i < 256U; i++)
+  {
+    if (seen[gen_crc[i] & 0xFFU]++ != 0U)
+    {
+      fprintf(stderr, "CRC table low bytes are not unique\n");
+      gen_errors++;
+    }
+    gen_crc_inverse[gen_crc[i] & 0xFFU] = (uint8_t)i;
+  }
+}
+
+static void gen_build(void)
+{
+  gen_build_zigzag();
+  gen_build_recip(gen_quant_luma, gen_recip_luma);
+  gen_build_recip(gen_quant_chroma, gen_recip_chroma);
+  gen_build_huff(gen_dc_luma_bits, gen_dc_vals, gen_dc_luma, CODEC_HUFF_DC_SYMBOLS);
+  gen_build_huff(gen_dc_chroma_bits, gen_dc_vals, gen_dc_chroma, CODEC_HUFF_DC_SYMBOLS);
+  gen_build_huff(gen_ac_luma_bits, gen_ac_luma_vals, gen_ac_luma, CODEC_HUFF_AC_SYMBOLS);
+  gen_build_huff(gen_ac_chroma_bits, gen_ac_chroma_vals, gen_ac_chroma, CODEC_HUFF_AC_SYMBOLS);
+  gen_build_crc();
+}
+
+/* ---------------------------------------------------------------- output */
+
+static void gen_print_u8(const char *decl, const uint8_t *v, int n, int line)
+{
+  int i;
+
+  printf("%s =\n{", decl);
+  for (i = 0; i < n; i++)
+  {
+    printf("%s%s%3u", (i == 0) ? "" : ",", ((i % line) == 0) ? "\n  " : " ", v[i]);
+  }
+  printf("\n};\n\n");
+}
+
+static void gen_print_hex8(const char *decl, const uint8_t *v, int n)
+{
+  int i;
+
+  printf("%s =\n{", decl);
+  for (i = 0; i < n; i++)
+  {
+    printf("%s%s0x%02X", (i == 0) ? "" : ",", ((i % 16) == 0) ? "\n  " : " ", v[i]);
+  }
+  printf("\n};\n\n");
+}
+
+static void gen_print_u16(const char *decl, const uint16_t *v, int n)
+{
+  int i;
+
+  printf("%s =\n{", decl);
+  for (i = 0; i < n; i++)
+  {
+    printf("%s%s%5u", (i == 0) ? "" : ",", ((i % 8) == 0) ? "\n  " : " ", v[i]);
+  }
+  printf("\n};\n\n");
+}
+
+static void gen_print_hex32(const char *decl, const uint32_t *v, int n)
+{
+  int i;
+
+  printf("%s =\n{", decl);
+  for (i = 0; i < n; i++)
+  {
+    printf("%s%s0x%08X", (i == 0) ? "" : ",", ((i % 8) == 0) ? "\n  " : " ", v[i]);
+  }
+  printf("\n};\n\n");
+}
+
+static void gen_print(void)
+{
+  printf("/**\n"
+         "  ******************************************************************************\n"
+         "  * @file    codec_tables.c\n"
+         "  * @brief   Precomputed tables of the JPEG baseline coder and of the frame\n"
+         "  *          CRC, in flash.\n"
+         "  *\n"
+         "  * @verbatim\n"
+         "  *\n"
+         "  *          Generated by Utilities/codec_tables/codec_tables_gen.c, do not\n"
+         "  *          edit: change the generator, then\n"
+         "  *            codec_tables_gen > Src/codec_tables.c\n"
+         "  *            codec_tables_gen -c\n"
+         "  *\n"
+         "  *  @endverbatim\n"
+         "  *\n"
+         "  ******************************************************************************\n"
+         "  * @attention\n"
+         "  *\n"
+         "  * <h2><center>&copy; Copyright (c) 2019 Duvitech.\n"
+         "  * All rights reserved.</center></h2>\n"
+         "  *\n"
+         "  *\n"
+         "  ******************************************************************************\n"
+         "  */\n\n"
+         "/* Includes ------------------------------------------------------------------*/\n"
+         "#include \"codec_tables.h\"\n\n");
+
+  printf("/*\n * Zigzag scan: position k of the scan -> index of the coefficient in\n"
+         " * the natural (row major) order of the block.\n"
+         " * <pre>for (s = 0; s < 15; s++)  anti-diagonal row + col == s\n"
+         " *   walked up and right when s is even, down and left when s is odd</pre>\n */\n");
+  gen_print_u8("const uint8_t codecZigzagTable[64]", gen_zigzag, 64, 8);
+
+  printf("/*\n * Quantization tables of ITU T.81 Annex K.1, natural order, and their\n"
+         " * Q16 reciprocals: (c * recip[i]) >> 16 is c / quant[i].\n"
+         " * <pre>recip[i] = (65536 + quant[i] / 2) / quant[i]</pre>\n */\n");
+  gen_print_u8("const uint8_t codecQuantLumaTable[64]", gen_quant_luma, 64, 8);
+  gen_print_u8("const uint8_t codecQuantChromaTable[64]", gen_quant_chroma, 64, 8);
+  gen_print_u16("const uint16_t codecQuantRecipLumaTable[64]", gen_recip_luma, 64);
+  gen_print_u16("const uint16_t codecQuantRecipChromaTable[64]", gen_recip_chroma, 64);
+
+  printf("/*\n * Huffman tables of ITU T.81 Annex K.3, as written to the DHT segment:\n"
+         " * BITS, the number of codes of each length 1 to 16, and HUFFVAL.\n */\n");
+  gen_print_u8("const uint8_t codecHuffDcLumaBits[16]", gen_dc_luma_bits, 16, 16);
+  gen_print_u8("const uint8_t codecHuffDcChromaBits[16]", gen_dc_chroma_bits, 16, 16);
+  gen_print_u8("const uint8_t codecHuffDcVals[12]", gen_dc_vals, 12, 16);
+  gen_print_u8("const uint8_t codecHuffAcLumaBits[16]", gen_ac_luma_bits, 16, 16);
+  gen_print_hex8("const uint8_t codecHuffAcLumaVals[162]", gen_ac_luma_vals, 162);
+  gen_print_u8("const uint8_t codecHuffAcChromaBits[16]", gen_ac_chroma_bits, 16, 16);
+  gen_print_hex8("const uint8_t codecHuffAcChromaVals[162]", gen_ac_chroma_vals, 162);
+
+  printf("/*\n * Huffman code of each symbol: CODEC_HUFF_ENTRY(code, length), 0 for a\n"
+         " * symbol without code. DC symbols are the sizes 0 to 11, AC symbols the\n"
+         " * run/size bytes.\n"
+         " * <pre>code = 0\n"
+         " * for (len = 1; len <= 16; len++, code <<= 1)\n"
+         " *   for (n = 0; n < BITS[len - 1]; n++)\n"
+         " *     table[HUFFVAL[k++]] = CODEC_HUFF_ENTRY(code++, len)</pre>\n */\n");
+  gen_print_hex32("const uint32_t codecHuffDcLumaTable[CODEC_HUFF_DC_SYMBOLS]", gen_dc_luma, CODEC_HUFF_DC_SYMBOLS);
+  gen_print_hex32("const uint32_t codecHuffDcChromaTable[CODEC_HUFF_DC_SYMBOLS]", gen_dc_chroma, CODEC_HUFF_DC_SYMBOLS);
+  gen_print_hex32("const uint32_t codecHuffAcLumaTable[CODEC_HUFF_AC_SYMBOLS]", gen_ac_luma, CODEC_HUFF_AC_SYMBOLS);
+  gen_print_hex32("const uint32_t codecHuffAcChromaTable[CODEC_HUFF_AC_SYMBOLS]", gen_ac_chroma, CODEC_HUFF_AC_SYMBOLS);
+
+  printf("/*\n * CRC of the polynomial CODEC_CRC_POLY, MSB first like the STM32 CRC unit.\n"
+         " * <pre>c = i << 24\n"
+         " * repeat 8 times: c = (c & 0x80000000) ? (c << 1) ^ CODEC_CRC_POLY : c << 1</pre>\n */\n");
+  gen_print_hex32("const uint32_t codecCrcTable[256]", gen_crc, 256);
+
+  printf("/*\n * Index of the CRC table entry with a given low byte. A step of the CRC\n"
+         " * over a zero byte, c' = (c << 8) ^ T[c >> 24], is undone by\n"
+         " * <pre>i = codecCrcInverseTable[c' & 0xFF]\n"
+         " * c = ((c' ^ T[i]) >> 8) | (i << 24)</pre>\n */\n");
+  gen_print_u8("const uint8_t codecCrcInverseTable[256]", gen_crc_inverse, 256, 16);
+
+  printf("/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/\n");
+}
+
+/* ----------------------------------------------------------------- check */
+
+static void gen_compare(const char *name, const void *linked, const void *built, size_t size)
+{
+  if (memcmp(linked, built, size) != 0)
+  {
+    printf("%s differs from the generator\n", name);
+    gen_errors++;
+  }
+}
+
+static void gen_expect(const char *name, uint32_t value, uint32_t expected)
+{
+  if (value != expected)
+  {
+    printf("%s: 0x%08X, 0x%08X expected\n", name, value, expected);
+    gen_errors++;
+  }
+}
+
+static uint32_t gen_crc_bytes(const uint8_t *data, uint32_t len)
+{
+  uint32_t crc = CODEC_CRC_INIT;
+
+  while (len-- != 0U)
+  {
+    crc = (crc << 8) ^ codecCrcTable[(crc >> 24) ^ *data++];
+  }
+  return crc;
+}
+
+static int gen_check(void)
+{
+  uint8_t seen[64];
+  uint32_t i, dc_bits = 0U, ac_bits = 0U;
+
+  gen_compare("codecZigzagTable", codecZigzagTable, gen_zigzag, sizeof(gen_zigzag));
+  gen_compare("codecQuantLumaTable", codecQuantLumaTable, gen_quant_luma, sizeof(gen_quant_luma));
+  gen_compare("codecQuantChromaTable", codecQuantChromaTable, gen_quant_chroma, sizeof(gen_quant_chroma));
+  gen_compare("codecQuantRecipLumaTable", codecQuantRecipLumaTable, gen_recip_luma, sizeof(gen_recip_luma));
+  gen_compare("codecQuantRecipChromaTable", codecQuantRecipChromaTable, gen_recip_chroma, sizeof(gen_recip_chroma));
+  gen_compare("codecHuffDcLumaBits", codecHuffDcLumaBits, gen_dc_luma_bits, sizeof(gen_dc_luma_bits));
+  gen_compare("codecHuffDcChromaBits", codecHuffDcChromaBits, gen_dc_chroma_bits, sizeof(gen_dc_chroma_bits));
+  gen_compare("codecHuffDcVals", codecHuffDcVals, gen_dc_vals, sizeof(gen_dc_vals));
+  gen_compare("codecHuffAcLumaBits", codecHuffAcLumaBits, gen_ac_luma_bits, sizeof(gen_ac_luma_bits));
+  gen_compare("codecHuffAcLumaVals", codecHuffAcLumaVals, gen_ac_luma_vals, sizeof(gen_ac_luma_vals));
+  gen_compare("codecHuffAcChromaBits", codecHuffAcChromaBits, gen_ac_chroma_bits, sizeof(gen_ac_chroma_bits));
+  gen_compare("codecHuffAcChromaVals", codecHuffAcChromaVals, gen_ac_chroma_vals, sizeof(gen_ac_chroma_vals));
+  gen_compare("codecHuffDcLumaTable", codecHuffDcLumaTable, gen_dc_luma, sizeof(gen_dc_luma));
+  gen_compare("codecHuffDcChromaTable", codecHuffDcChromaTable, gen_dc_chroma, sizeof(gen_dc_chroma));
+  gen_compare("codecHuffAcLumaTable", codecHuffAcLumaTable, gen_ac_luma, sizeof(gen_ac_luma));
+  gen_compare("codecHuffAcChromaTable", codecHuffAcChromaTable, gen_ac_chroma, sizeof(gen_ac_chroma));
+  gen_compare("codecCrcTable", codecCrcTable, gen_crc, sizeof(gen_crc));
+  gen_compare("codecCrcInverseTable", codecCrcInverseTable, gen_crc_inverse, sizeof(gen_crc_inverse));
+
+  /* the scan is a permutation starting 0, 1, 8, 16, 9, 2 and ending at 63 */
+  memset(seen, 0, sizeof(seen));
+  for (i = 0U; i < 64U; i++)
+  {
+    seen[codecZigzagTable[i] & 63U]++;
+  }
+  for (i = 0U; i < 64U; i++)
+  {
+    if (seen[i] != 1U)
+    {
+      printf("codecZigzagTable is not a permutation\n");
+      gen_errors++;
+      break;
+    }
+  }
+  gen_expect("zigzag[2]", codecZigzagTable[2], 8U);
+  gen_expect("zigzag[5]", codecZigzagTable[5], 2U);
+  gen_expect("zigzag[63]", codecZigzagTable[63], 63U);
+
+  /* every HUFFVAL symbol is counted once by BITS */
+  for (i = 0U; i < 16U; i++)
+  {
+    dc_bits += codecHuffDcLumaBits[i];
+    ac_bits += codecHuffAcLumaBits[i];
+  }
+  gen_expect("DC luma codes", dc_bits, 12U);
+  gen_expect("AC luma codes", ac_bits, 162U);
+
+  /* T.81 Tables K.3 and K.5 */
+  gen_expect("DC luma size 0", codecHuffDcLumaTable[0], CODEC_HUFF_ENTRY(0x000U, 2U));
+  gen_expect("DC luma size 11", codecHuffDcLumaTable[11], CODEC_HUFF_ENTRY(0x1FEU, 9U));
+  gen_expect("AC luma EOB", codecHuffAcLumaTable[0x00], CODEC_HUFF_ENTRY(0x00AU, 4U));
+  gen_expect("AC luma 0/1", codecHuffAcLumaTable[0x01], CODEC_HUFF_ENTRY(0x000U, 2U));
+  gen_expect("AC luma ZRL", codecHuffAcLumaTable[0xF0], CODEC_HUFF_ENTRY(0x7F9U, 11U));
+  gen_expect("AC luma F/A", codecHuffAcLumaTable[0xFA], CODEC_HUFF_ENTRY(0xFFFEU, 16U));
+  gen_expect("AC chroma EOB", codecHuffAcChromaTable[0x00], CODEC_HUFF_ENTRY(0x000U, 2U));
+
+  /* reciprocals divide every coefficient of an 11-bit DCT within 1 */
+  for (i = 0U; i < 64U; i++)
+  {
+    int32_t c = 2047, q = codecQuantLumaTable[i];
+    int32_t d = (int32_t)(((uint32_t)c * codecQuantRecipLumaTable[i]) >> 16) - ((q != 0) ? (c / q) : 0);
+
+    if ((q == 0) || (d < -1) || (d > 1))
+    {
+      printf("codecQuantRecipLumaTable[%u] is off\n", i);
+      gen_errors++;
+    }
+  }
+
+  /* four steps back from the state after a zero word give the state before */
+  for (i = 0U; i < 256U; i++)
+  {
+    uint32_t c = (i * 0x9E3779B9U) ^ (i << 3), r = c, k, t;
+
+    for (k = 0U; k < 4U; k++)
+    {
+      r = (r << 8) ^ codecCrcTable[r >> 24];
+    }
+    for (k = 0U; k < 4U; k++)
+    {
+      t = codecCrcInverseTable[r & 0xFFU];
+      r = ((r ^ codecCrcTable[t]) >> 8) | (t << 24);
+    }
+    if (r != c)
+    {
+      printf("codecCrcInverseTable does not undo 0x%08X\n", c);
+      gen_errors++;
+      break;
+    }
+  }
+
+  /* CRC-32/MPEG-2 check value */
+  gen_expect("CRC of \"123456789\"", gen_crc_bytes((const uint8_t *)"123456789", 9U), 0x0376E6E7U);
+
+  printf("%s\n", (gen_errors != 0) ? "FAIL" : "PASS");
+  return (gen_errors != 0) ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+  gen_build();
+  if ((argc > 1) && (strcmp(argv[1], "-c") == 0))
+  {
+    return gen_check();
+  }
+  if (argc > 1)
+  {
+    printf("usage: codec_tables_gen [-c]\n");
+    return 2;
+  }
+  if (gen_errors != 0)
+  {
+    return 1;
+  }
+  gen_print();
+  return 0;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,217 @@
+/**
+  ******************************************************************************
+  * @file    defer_host.c
+  * @brief   Host test of the deferred work queue: ordering, loss and the
+  *          worst case top half time.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                              Deferred work on a host
+  *          ===================================================================
+  *           One thread plays the USB interrupt: every 125 us it posts the
+  *           busiest USB frame of the firmware (SETUP, OUT and IN stages of
+  *           both isochronous endpoints, SOF) and times the whole handler
+  *           with Defer_IsrTime(). Another thread plays PendSV and runs
+  *           Defer_Run() whenever the trigger hook sets its pending flag,
+  *           with a bottom half as slow as a packet copy. Between two
+  *           interrupts the first thread sleeps, so the test also runs on a
+  *           single CPU. The test fails when:
+  *             - a work item runs out of order, twice or with the wrong
+  *               data, or is lost while the queue was not full,
+  *             - the 99.9th percentile of the top half time is over the
+  *               budget (host times, in ns: the scheduler makes the maximum
+  *               meaningless, it is printed anyway).
+  *
+  *           Build, from the repository root:
+  *             cc -O2 -pthread -IInc -o defer_host
+  *                Utilities/defer_host/defer_host.c Src/defer.c
+  *           Usage: defer_host [interrupts] [budget_ns]
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "defer.h"
+
+/* Work items of the busiest USB frame */
+#define HOST_BURST                      6U
+
+/* PendSV pending bit: set by the top half, polled by the PendSV thread */
+static volatile int host_pending;
+static volatile int host_done;
+
+static uint32_t host_interrupts = 200000U;
+static uint32_t host_budget = 10000U;  /* DEFER_ISR_BUDGET of the target */
+static uint32_t *host_isr_ns;
+
+static uint32_t host_next;       /* sequence number expected by the bottom half */
+static uint32_t host_errors;
+static uint32_t host_lost;       /* posts refused by a full queue */
+
+void Defer_HostTrigger(void)
+{
+  __atomic_store_n(&host_pending, 1, __ATOMIC_RELEASE);
+}
+
+uint32_t Defer_HostCycles(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+static void spin_ns(uint32_t ns)
+{
+  uint32_t start = Defer_HostCycles();
+
+  while ((Defer_HostCycles() - start) < ns)
+  {
+  }
+}
+
+/* Bottom half: checks the sequence number and the data copied with it */
+static void host_work(void *arg, const uint8_t *data)
+{
+  uint32_t seq;
+  uint32_t i;
+
+  memcpy(&seq, data, sizeof(seq));
+  if ((seq != host_next) || (arg != (void *)&host_next))
+  {
+    if (host_errors++ < 10U)
+    {
+      printf("work %u ran, %u expected\n", seq, host_next);
+    }
+  }
+  for (i = 4U; i < DEFER_DATA_SIZE; i++)
+  {
+    if (data[i] != (uint8_t)(seq + i))
+    {
+      host_errors++;
+      break;
+    }
+  }
+  host_next = seq + 1U;
+  /* a packet copy to the FIFO */
+  spin_ns(2000U);
+}
+
+static void *host_pendsv(void *arg)
+{
+  (void)arg;
+  for (;;)
+  {
+    while ((__atomic_exchange_n(&host_pending, 0, __ATOMIC_ACQUIRE) == 0) && (host_done == 0))
+    {
+      sched_yield();
+    }
+    Defer_Run();
+    if (host_done != 0)
+    {
+      return NULL;
+    }
+  }
+}
+
+static void *host_isr(void *arg)
+{
+  uint8_t data[DEFER_DATA_SIZE];
+  uint32_t seq = 0U;
+  uint32_t n, k, i, start;
+  struct timespec gap = { 0, 125000L };
+
+  (void)arg;
+  for (n = 0U; n < host_interrupts; n++)
+  {
+    start = Defer_HostCycles();
+    for (k = 0U; k < HOST_BURST; k++)
+    {
+      memcpy(data, &seq, sizeof(seq));
+      for (i = 4U; i < DEFER_DATA_SIZE; i++)
+      {
+        data[i] = (uint8_t)(seq + i);
+      }
+      if (Defer_Post(host_work, &host_next, data, sizeof(data)) == 0)
+      {
+        seq++;
+      }
+      else
+      {
+        host_lost++;
+      }
+    }
+    host_isr_ns[n] = Defer_HostCycles() - start;
+    Defer_IsrTime(host_isr_ns[n]);
+    nanosleep(&gap, NULL);
+  }
+  return NULL;
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+  uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+  return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv)
+{
+  pthread_t isr, pendsv;
+  Defer_StatsTypeDef stats;
+  uint32_t p50, p999;
+  int fail;
+
+  if (argc > 1)
+  {
+    host_interrupts = (uint32_t)strtoul(argv[1], NULL, 0);
+  }
+  if (argc > 2)
+  {
+    host_budget = (uint32_t)strtoul(argv[2], NULL, 0);
+  }
+  host_isr_ns = calloc(host_interrupts + 1U, sizeof(uint32_t));
+  if ((host_isr_ns == NULL) || (host_interrupts == 0U))
+  {
+    printf("usage: defer_host [interrupts] [budget_ns]\n");
+    return 2;
+  }
+
+  Defer_Init();
+  pthread_create(&pendsv, NULL, host_pendsv, NULL);
+  pthread_create(&isr, NULL, host_isr, NULL);
+  pthread_join(isr, NULL);
+  host_done = 1;
+  pthread_join(pendsv, NULL);
+
+  Defer_GetStats(&stats);
+  qsort(host_isr_ns, host_interrupts, sizeof(uint32_t), cmp_u32);
+  p50 = host_isr_ns[host_interrupts / 2U];
+  p999 = host_isr_ns[(host_interrupts * 999U) / 1000U];
+  printf("%u interrupts of %u work items: %u posted, %u run, %u lost, depth max %u\n",
+         host_interrupts, HOST_BURST, stats.posted, stats.run, stats.overflow, stats.depth_max);
+  printf("top half: median %u ns, 99.9%% %u ns, max %u ns, budget %u ns\n",
+         p50, p999, stats.isr_max, host_budget);
+  printf("bottom half max %u ns\n", stats.work_max);
+
+  fail = (host_errors != 0U) || (stats.run != stats.posted) ||
+         (stats.overflow != host_lost) || (p999 > host_budget);
+  printf("%s\n", fail ? "FAIL" : "PASS");
+  return fail ? 1 : 0;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,430 @@
+/**
+  ******************************************************************************
+  * @file    image_host.c
+  * @brief   Host test of the software path of the image conversion stage:
+  *          format conversion, copy, fill and blend.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                             Image conversion on a host
+  *          ===================================================================
+  *           Src/image_convert.c builds without the DMA2D on a host, and its
+  *           software path is the reference the target benchmark compares
+  *           the DMA2D with. This test checks that path against the rules
+  *           of RM0090, written out again here pixel by pixel:
+  *             - every RGB565 value converted to ARGB8888 and RGB888, 5/6-bit
+  *               channels expanded by copying their MSBs, and back to
+  *               RGB565 unchanged,
+  *             - ARGB8888 to RGB565 and RGB888 by truncation, alpha dropped,
+  *             - copies and fills of a view only touch the view, whatever
+  *               the pitch of the image around it,
+  *             - blends of every format pair, at several layer alphas, in
+  *               place as well, follow the DMA2D formula: an opaque overlay
+  *               replaces the background, a transparent one leaves it.
+  *           The test fails on the first pixel that differs, and prints it.
+  *
+  *           Build, from the repository root:
+  *             cc -O2 -IInc -o image_host Utilities/image_host/image_host.c
+  *                Src/image_convert.c
+  *           Usage: image_host
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "image_convert.h"
+
+#if !IMAGE_HOST
+#error "image_host builds the host variant of the image conversion stage"
+#endif
+
+/* Test images: a view of HOST_W x HOST_H inside images of HOST_PITCH pixels */
+#define HOST_W                          37U
+#define HOST_H                          23U
+#define HOST_PITCH                      48U
+#define HOST_LINES                      30U
+#define HOST_X                          5U
+#define HOST_Y                          4U
+#define HOST_GUARD                      0xA5U
+
+static const uint8_t host_bpp[] = { 4U, 3U, 2U };
+static const char * const host_name[] = { "ARGB8888", "RGB888", "RGB565" };
+
+static uint8_t host_buf[3][HOST_PITCH * HOST_LINES * 4U];
+
+static uint32_t host_seed = 12345U;
+
+static uint32_t host_rand(void)
+{
+  host_seed = (host_seed * 1103515245U) + 12345U;
+  return (host_seed >> 8) ^ (host_seed << 13);
+}
+
+/**
+  * @brief  Reference pixel read, ARGB8888 out.
+  */
+static uint32_t ref_read(const Image_TypeDef *img, uint32_t x, uint32_t y)
+{
+  const uint8_t *p = (const uint8_t *)img->data + ((y * img->pitch) + x) * host_bpp[img->format];
+  uint32_t v, r, g, b;
+
+  if (img->format == IMAGE_FORMAT_ARGB8888)
+  {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+  }
+  if (img->format == IMAGE_FORMAT_RGB888)
+  {
+    return 0xFF000000U | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+  }
+  v = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+  r = v >> 11;
+  g = (v >> 5) & 63U;
+  b = v & 31U;
+  return 0xFF000000U | (((r * 8U) + (r / 4U)) << 16) | (((g * 4U) + (g / 16U)) << 8) | ((b * 8U) + (b / 4U));
+}
+
+/**
+  * @brief  Reference conversion of an ARGB8888 pixel to the stored value of
+  *         a format, as the bytes of the format.
+  */
+static uint32_t ref_store(uint8_t format, uint32_t argb)
+{
+  uint32_t r = (argb >> 16) & 0xFFU, g = (argb >> 8) & 0xFFU, b = argb & 0xFFU;
+
+  if (format == IMAGE_FORMAT_ARGB8888)
+  {
+    return argb;
+  }
+  if (format == IMAGE_FORMAT_RGB888)
+  {
+    return argb & 0x00FFFFFFU;
+  }
+  return ((r / 8U) << 11) | ((g / 4U) << 5) | (b / 8U);
+}
+
+/**
+  * @brief  Stored value of a pixel, as the bytes of the format.
+  */
+static uint32_t raw_read(const Image_TypeDef *img, uint32_t x, uint32_t y)
+{
+  const uint8_t *p = (const uint8_t *)img->data + ((y * img->pitch) + x) * host_bpp[img->format];
+  uint32_t v = 0U, i;
+
+  for (i = 0U; i < host_bpp[img->format]; i++)
+  {
+    v |= (uint32_t)p[i] << (8U * i);
+  }
+  return v;
+}
+
+/**
+  * @brief  Blend of one pixel, RM0090 DMA2D formula, layer alpha combined
+  *         with the foreground alpha.
+  */
+static uint32_t ref_blend(uint32_t cf, uint32_t cb, uint8_t alpha)
+{
+  uint32_t af = ((cf >> 24) * alpha) / 255U;
+  uint32_t ab = cb >> 24;
+  uint32_t a = (af * ab) / 255U;
+  uint32_t ao = af + ab - a;
+  uint32_t out = ao << 24;
+  uint32_t c;
+
+  if (ao == 0U)
+  {
+    return out;
+  }
+  for (c = 0U; c < 3U; c++)
+  {
+    uint32_t f = (cf >> (8U * c)) & 0xFFU;
+    uint32_t k = (cb >> (8U * c)) & 0xFFU;
+
+    out |= (((f * af) + (k * ab) - (k * a)) / ao) << (8U * c);
+  }
+  return out;
+}
+
+/**
+  * @brief  Fills a whole test buffer with noise, alpha included.
+  */
+static void noise(uint32_t buf)
+{
+  uint32_t i;
+
+  for (i = 0U; i < sizeof(host_buf[buf]); i++)
+  {
+    host_buf[buf][i] = (uint8_t)host_rand();
+  }
+}
+
+static void image(uint32_t buf, uint8_t format, Image_TypeDef *img)
+{
+  img->data = host_buf[buf];
+  img->width = HOST_PITCH;
+  img->height = HOST_LINES;
+  img->pitch = HOST_PITCH;
+  img->format = format;
+}
+
+/**
+  * @brief  Checks the pixels outside the view kept their guard value.
+  */
+static int guard_ok(const Image_TypeDef *img, const Image_TypeDef *view)
+{
+  const uint8_t *start = (const uint8_t *)view->data;
+  uint32_t bpp = host_bpp[img->format];
+  uint32_t i, off, line, col;
+
+  for (i = 0U; i < (uint32_t)img->pitch * img->height * bpp; i++)
+  {
+    off = (uint32_t)(&((const uint8_t *)img->data)[i] - start);
+    line = off / (img->pitch * bpp);
+    col = (off % (img->pitch * bpp)) / bpp;
+    if ((&((const uint8_t *)img->data)[i] >= start) && (line < view->height) && (col < view->width))
+    {
+      continue;
+    }
+    if (((const uint8_t *)img->data)[i] != HOST_GUARD)
+    {
+      printf("  byte %u outside the view changed\n", i);
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static uint32_t check(const char *name, int ok)
+{
+  printf("%-44s %s\n", name, ok ? "ok" : "FAIL");
+  return ok ? 0U : 1U;
+}
+
+/**
+  * @brief  Every RGB565 value to ARGB8888 and RGB888, and back.
+  */
+static int test_565_all(void)
+{
+  static uint16_t in[65536], back[65536];
+  static uint32_t argb[65536];
+  static uint8_t rgb[65536 * 3];
+  Image_TypeDef src = { in, 256U, 256U, 256U, IMAGE_FORMAT_RGB565 };
+  Image_TypeDef a = { argb, 256U, 256U, 256U, IMAGE_FORMAT_ARGB8888 };
+  Image_TypeDef r = { rgb, 256U, 256U, 256U, IMAGE_FORMAT_RGB888 };
+  Image_TypeDef out = { back, 256U, 256U, 256U, IMAGE_FORMAT_RGB565 };
+  uint32_t i;
+
+  for (i = 0U; i < 65536U; i++)
+  {
+    in[i] = (uint16_t)i;
+  }
+  Image_Copy(&src, &a);
+  Image_Copy(&src, &r);
+  for (i = 0U; i < 65536U; i++)
+  {
+    uint32_t expect = ref_read(&src, i % 256U, i / 256U);
+
+    if ((argb[i] != expect) || (ref_read(&r, i % 256U, i / 256U) != expect))
+    {
+      printf("  565 %04X: %08X, expected %08X\n", i, argb[i], expect);
+      return 0;
+    }
+  }
+  Image_Copy(&a, &out);
+  if (memcmp(in, back, sizeof(in)) != 0)
+  {
+    printf("  RGB565 to ARGB8888 and back differs\n");
+    return 0;
+  }
+  Image_Copy(&r, &out);
+  return memcmp(in, back, sizeof(in)) == 0;
+}
+
+/**
+  * @brief  Copy of a view between every format pair.
+  */
+static int test_copy(uint8_t from, uint8_t to)
+{
+  Image_TypeDef src, dst, vs, vd;
+  uint32_t x, y;
+
+  image(0U, from, &src);
+  image(1U, to, &dst);
+  noise(0U);
+  memset(host_buf[1], HOST_GUARD, sizeof(host_buf[1]));
+  Image_View(&src, HOST_X + 3U, HOST_Y + 1U, HOST_W, HOST_H, &vs);
+  Image_View(&dst, HOST_X, HOST_Y, HOST_W, HOST_H, &vd);
+  if (Image_Copy(&vs, &vd) != HAL_OK)
+  {
+    return 0;
+  }
+  for (y = 0U; y < HOST_H; y++)
+  {
+    for (x = 0U; x < HOST_W; x++)
+    {
+      uint32_t expect = (from == to) ? raw_read(&vs, x, y) : ref_store(to, ref_read(&vs, x, y));
+
+      if (raw_read(&vd, x, y) != expect)
+      {
+        printf("  %s to %s at %u,%u: %X, expected %X\n", host_name[from], host_name[to],
+               x, y, raw_read(&vd, x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return guard_ok(&dst, &vd);
+}
+
+/**
+  * @brief  Fill of a view, every format.
+  */
+static int test_fill(uint8_t format, uint32_t argb)
+{
+  Image_TypeDef dst, vd;
+  uint32_t x, y;
+
+  image(1U, format, &dst);
+  memset(host_buf[1], HOST_GUARD, sizeof(host_buf[1]));
+  Image_View(&dst, HOST_X, HOST_Y, HOST_W, HOST_H, &vd);
+  if (Image_Fill(&vd, argb) != HAL_OK)
+  {
+    return 0;
+  }
+  for (y = 0U; y < HOST_H; y++)
+  {
+    for (x = 0U; x < HOST_W; x++)
+    {
+      if (raw_read(&vd, x, y) != ref_store(format, argb))
+      {
+        printf("  fill %s at %u,%u: %X\n", host_name[format], x, y, raw_read(&vd, x, y));
+        return 0;
+      }
+    }
+  }
+  return guard_ok(&dst, &vd);
+}
+
+/**
+  * @brief  Blend of a foreground format over a background format, into a
+  *         third buffer or in place.
+  */
+static int test_blend(uint8_t ffg, uint8_t fbg, uint8_t alpha, uint8_t in_place)
+{
+  static uint8_t bg_copy[sizeof(host_buf[0])];
+  Image_TypeDef fg, bg, dst, vf, vb, vd, vcopy, copy;
+  uint32_t x, y;
+
+  image(0U, ffg, &fg);
+  image(1U, fbg, &bg);
+  image(in_place ? 1U : 2U, fbg, &dst);
+  noise(0U);
+  noise(1U);
+  memcpy(bg_copy, host_buf[1], sizeof(bg_copy));
+  copy = bg;
+  copy.data = bg_copy;
+  if (in_place == 0U)
+  {
+    memset(host_buf[2], HOST_GUARD, sizeof(host_buf[2]));
+  }
+  Image_View(&fg, HOST_X + 2U, HOST_Y, HOST_W, HOST_H, &vf);
+  Image_View(&bg, HOST_X, HOST_Y + 2U, HOST_W, HOST_H, &vb);
+  Image_View(&copy, HOST_X, HOST_Y + 2U, HOST_W, HOST_H, &vcopy);
+  if (in_place != 0U)
+  {
+    vd = vb;
+  }
+  else
+  {
+    Image_View(&dst, HOST_X, HOST_Y, HOST_W, HOST_H, &vd);
+  }
+  if (Image_Blend(&vf, &vb, &vd, alpha) != HAL_OK)
+  {
+    return 0;
+  }
+  for (y = 0U; y < HOST_H; y++)
+  {
+    for (x = 0U; x < HOST_W; x++)
+    {
+      uint32_t cf = ref_read(&vf, x, y);
+      uint32_t cb = ref_read(&vcopy, x, y);
+      uint32_t expect = ref_store(fbg, ref_blend(cf, cb, alpha));
+
+      /* the extremes need no formula: an opaque overlay replaces the
+         background, a transparent one leaves it, unless it is transparent too */
+      if ((ffg != IMAGE_FORMAT_ARGB8888) && (alpha == 0xFFU))
+      {
+        expect = ref_store(fbg, cf);
+      }
+      if ((alpha == 0U) && ((cb >> 24) != 0U))
+      {
+        expect = ref_store(fbg, cb);
+      }
+      if (raw_read(&vd, x, y) != expect)
+      {
+        printf("  blend %s over %s, alpha %u, at %u,%u: %X, expected %X\n", host_name[ffg],
+               host_name[fbg], alpha, x, y, raw_read(&vd, x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return (in_place != 0U) || guard_ok(&dst, &vd);
+}
+
+int main(void)
+{
+  static const uint8_t alphas[] = { 0x00U, 0x01U, 0x80U, 0xC3U, 0xFEU, 0xFFU };
+  char name[64];
+  uint32_t fails = 0U;
+  uint8_t from, to, a;
+  int ok;
+
+  Image_Init();
+
+  fails += check("RGB565 expanded and reduced back, all values", test_565_all());
+
+  for (from = 0U; from < 3U; from++)
+  {
+    for (to = 0U; to < 3U; to++)
+    {
+      snprintf(name, sizeof(name), "copy %s to %s", host_name[from], host_name[to]);
+      fails += check(name, test_copy(from, to));
+    }
+  }
+
+  for (to = 0U; to < 3U; to++)
+  {
+    snprintf(name, sizeof(name), "fill %s", host_name[to]);
+    ok = test_fill(to, 0xFF3366CCU) && test_fill(to, 0x00FFFFFFU) && test_fill(to, 0x80070809U);
+    fails += check(name, ok);
+  }
+
+  for (from = 0U; from < 3U; from++)
+  {
+    for (to = 0U; to < 3U; to++)
+    {
+      ok = 1;
+      for (a = 0U; ok && (a < sizeof(alphas)); a++)
+      {
+        ok = test_blend(from, to, alphas[a], 0U) && test_blend(from, to, alphas[a], 1U);
+      }
+      snprintf(name, sizeof(name), "blend %s over %s", host_name[from], host_name[to]);
+      fails += check(name, ok);
+    }
+  }
+
+  printf("%s\n", (fails != 0U) ? "FAIL" : "PASS");
+  return (fails != 0U) ? 1 : 0;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,171 @@
+/**
+  ******************************************************************************
+  * @file    motion_host.c
+  * @brief   Host test of the motion detector on the frames of the test
+  *          pattern source.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                               Motion on a host
+  *          ===================================================================
+  *           The frames are rendered as UVC_Pattern_Capture() renders them,
+  *           640x480 with the frame counter burned in, and their luma plane
+  *           is fed to Motion_PushLines() in strips of
+  *           TEST_PATTERN_STRIP_LINES lines; Motion_Process() runs after each
+  *           frame as the main loop does. The test fails when:
+  *             - the color bars, which only change in the counter, do not
+  *               turn static after MOTION_STATIC_FRAMES frames, the first
+  *               frame after Motion_Init() counting as it has no reference,
+  *             - MOTION_MODE_SKIP does not leave the frame intervals of a
+  *               static scene empty but one in MOTION_KEEPALIVE_FRAMES, per
+  *               stream,
+  *             - MOTION_MODE_RATE does not throttle a static scene, or does
+  *               not release the throttle when it moves,
+  *             - the bouncing box scores under the threshold or does not
+  *               reset the static count at its first frame,
+  *             - the bars do not turn static again once the box is gone.
+  *
+  *           Build, from the repository root:
+  *             cc -O2 -DARM_MATH_CM0 -IInc -IDrivers/CMSIS/Include
+  *                -IDrivers/CMSIS/DSP/Include -Wno-pointer-to-int-cast
+  *                -Wno-int-to-pointer-cast -o motion_host
+  *                Utilities/motion_host/motion_host.c Src/motion.c
+  *                Src/resample.c Src/test_pattern.c
+  *                Drivers/CMSIS/DSP/Source/BasicMathFunctions/arm_add_q15.c
+  *                Drivers/CMSIS/DSP/Source/BasicMathFunctions/arm_sub_q15.c
+  *                Drivers/CMSIS/DSP/Source/BasicMathFunctions/arm_scale_q15.c
+  *                Drivers/CMSIS/DSP/Source/BasicMathFunctions/arm_sub_q7.c
+  *                Drivers/CMSIS/DSP/Source/BasicMathFunctions/arm_abs_q7.c
+  *                Drivers/CMSIS/DSP/Source/StatisticsFunctions/arm_mean_q7.c
+  *           Usage: motion_host
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include "motion.h"
+#include "test_pattern.h"
+
+#if !MOTION_HOST
+#error "motion_host builds the host variant of the motion detector"
+#endif
+
+#define HOST_WIDTH                      640U
+#define HOST_HEIGHT                     480U
+
+static uint8_t host_y[HOST_WIDTH * HOST_HEIGHT];
+static uint8_t host_cb[(HOST_WIDTH * HOST_HEIGHT) / 4U];
+static uint8_t host_cr[(HOST_WIDTH * HOST_HEIGHT) / 4U];
+static TestPattern_TypeDef host_pattern;
+static uint32_t host_frame;
+static uint8_t host_throttle;
+
+/**
+  * @brief  Capture throttle hook of the motion detector.
+  */
+void Motion_HostThrottle(uint8_t enable)
+{
+  host_throttle = enable;
+}
+
+/**
+  * @brief  Renders the next frame and feeds its luma plane strip by strip.
+  */
+static void frame(void)
+{
+  const TestPattern_PlanesTypeDef planes = {host_y, host_cb, host_cr, HOST_WIDTH};
+  uint32_t y;
+
+  TestPattern_Render(&host_pattern, host_frame++, &planes);
+  for (y = 0U; y < HOST_HEIGHT; y += TEST_PATTERN_STRIP_LINES)
+  {
+    Motion_PushLines(&host_y[y * HOST_WIDTH], HOST_WIDTH, TEST_PATTERN_STRIP_LINES);
+  }
+  Motion_Process();
+}
+
+/**
+  * @brief  Frames until Motion_SkipFrame() leaves one empty, at most max.
+  * @retval frames rendered, max if none was skipped
+  */
+static uint32_t frames_to_static(uint32_t max)
+{
+  uint32_t n;
+
+  for (n = 1U; n <= max; n++)
+  {
+    frame();
+    if (Motion_SkipFrame(0U) != 0U)
+    {
+      return n;
+    }
+  }
+  return max;
+}
+
+static uint32_t check(const char *name, int ok)
+{
+  printf("%-44s %s\n", name, ok ? "ok" : "FAIL");
+  return ok ? 0U : 1U;
+}
+
+int main(void)
+{
+  uint32_t fails = 0U, n, sent0, sent1;
+  int ok;
+
+  ok = (Motion_Init(HOST_WIDTH, HOST_HEIGHT) == HAL_OK) &&
+       (TestPattern_Init(&host_pattern, TEST_PATTERN_BARS, HOST_WIDTH, HOST_HEIGHT) == 0);
+  fails += check("detector sized from the pattern plane", ok);
+
+  /* color bars: only the counter changes, the first frame has no reference */
+  Motion_SetMode(MOTION_MODE_SKIP);
+  n = frames_to_static(3U * MOTION_STATIC_FRAMES);
+  printf("bars: score %u, static after %u frames\n", Motion_GetScore(), n);
+  fails += check("bars turn static", n == MOTION_STATIC_FRAMES);
+
+  /* one frame sent in MOTION_KEEPALIVE_FRAMES, on each stream */
+  for (n = 0U, sent0 = 0U, sent1 = 0U; n < (3U * MOTION_KEEPALIVE_FRAMES); n++)
+  {
+    frame();
+    sent0 += (Motion_SkipFrame(0U) == 0U) ? 1U : 0U;
+    sent1 += (Motion_SkipFrame(1U) == 0U) ? 1U : 0U;
+  }
+  printf("keepalive: %u and %u frames sent\n", sent0, sent1);
+  fails += check("static scene keeps one frame alive per stream", (sent0 == 3U) && (sent1 == 3U));
+
+  Motion_SetMode(MOTION_MODE_RATE);
+  frame();
+  fails += check("rate mode throttles a static scene",
+                 (host_throttle == 1U) && (Motion_SkipFrame(0U) == 0U));
+
+  /* the bouncing box appears: moving, the throttle is released */
+  TestPattern_Select(&host_pattern, TEST_PATTERN_BOX);
+  frame();
+  printf("box: score %u\n", Motion_GetScore());
+  ok = (Motion_GetScore() >= MOTION_THRESHOLD_DEFAULT) && (host_throttle == 0U) &&
+       (Motion_SkipFrame(0U) == 0U);
+  fails += check("box resets the static count", ok);
+
+  /* back to the bars: the box leaving is motion, then MOTION_STATIC_FRAMES */
+  Motion_SetMode(MOTION_MODE_SKIP);
+  TestPattern_Select(&host_pattern, TEST_PATTERN_BARS);
+  n = frames_to_static(3U * MOTION_STATIC_FRAMES);
+  fails += check("bars turn static again", n == (MOTION_STATIC_FRAMES + 1U));
+
+  printf("%s\n", (fails != 0U) ? "FAIL" : "PASS");
+  return (fails != 0U) ? 1 : 0;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,449 @@
+/**
+  ******************************************************************************
+  * @file    resample_host.c
+  * @brief   Host test of the line streaming resampler: quality against a
+  *          floating point model, and speed.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                               Resampler on a host
+  *          ===================================================================
+  *           Src/resample.c builds on a host with the portable C of the
+  *           CMSIS-DSP Q15 functions, which computes what the Cortex-M4 DSP
+  *           instructions do. Each plane is fed line by line as the camera
+  *           delivers it, and every output pixel is compared with a floating
+  *           point model of the filter:
+  *             - box: mean of the input pixels the output pixel covers,
+  *             - bilinear: pixel centers aligned, clamped at the edges.
+  *           The PSNR (peak 255) and the largest error are printed per
+  *           filter, with the time per input frame on this host; the cycles
+  *           on the target come from RESAMPLE_BENCHMARK.
+  *           -s runs a 640x480 test plane of gradients, noise, fine stripes
+  *           and sharp edges down to 320x240, 213x160, 160x120 and 40x30 and
+  *           fails when:
+  *             - a filter is further than its bound from the model (PSNR or
+  *               largest error),
+  *             - a plane of one value does not come out unchanged,
+  *             - feeding strips gives other pixels than feeding lines,
+  *             - Resample_Init() accepts sizes out of range.
+  *           -i measures raw 8-bit planes instead, width x height bytes each,
+  *           for example the Y planes of a recorded sequence:
+  *             ffmpeg -i clip.mp4 -f rawvideo -pix_fmt gray clip.y
+  *
+  *           Build, from the repository root:
+  *             cc -O2 -DARM_MATH_CM0 -IInc -IDrivers/CMSIS/Include
+  *                -IDrivers/CMSIS/DSP/Include -Wno-pointer-to-int-cast
+  *                -Wno-int-to-pointer-cast -o resample_host
+  *                Utilities/resample_host/resample_host.c Src/resample.c
+  *                Drivers/CMSIS/DSP/Source/BasicMathFunctions/arm_add_q15.c
+  *                Drivers/CMSIS/DSP/Source/BasicMathFunctions/arm_sub_q15.c
+  *                Drivers/CMSIS/DSP/Source/BasicMathFunctions/arm_scale_q15.c
+  *                -lm
+  *           The -Wno flags silence the 32-bit pointer casts of arm_math.h.
+  *           Usage: resample_host -s
+  *                  resample_host -i planes.y -w width -h height -o WxH
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include "resample.h"
+
+#if !RESAMPLE_HOST
+#error "resample_host builds the host variant of the resampler"
+#endif
+
+#define HOST_WIDTH                      640U
+#define HOST_HEIGHT                     480U
+
+/* Bounds of -s: the box filter only rounds, bilinear also rounds its Q15 weights */
+#define HOST_BOX_PSNR_MIN               55.0
+#define HOST_BOX_ERR_MAX                0.5
+#define HOST_BILINEAR_PSNR_MIN          55.0
+#define HOST_BILINEAR_ERR_MAX           1.25
+
+typedef struct
+{
+  double     mse;        /* per pixel, summed over the planes */
+  double     err_max;
+  double     seconds;
+  uint32_t   planes;
+} Host_ResultTypeDef;
+
+static const char *const names[] = { "box", "bilinear" };
+
+/**
+  * @brief  Test plane: gradients, noise, fine stripes and sharp edges.
+  */
+static uint8_t test_pixel(uint32_t x, uint32_t y)
+{
+  uint32_t v = ((x * 3U) + (y >> 1) + ((x * y * 2654435761U) >> 28)) & 0xFFU;
+
+  if (((x >> 5) & 1U) != ((y >> 5) & 1U))
+  {
+    v ^= 0x80U;
+  }
+  if (((x + y) & 3U) == 0U)
+  {
+    v = (v + 40U) & 0xFFU;
+  }
+  return (uint8_t)v;
+}
+
+/**
+  * @brief  Floating point model of the resampler for one output pixel.
+  * @retval Exact output value, not rounded
+  */
+static double reference(const uint8_t *plane, uint32_t w, uint32_t h, uint8_t mode,
+                        uint32_t x, uint32_t y, uint32_t out_w, uint32_t out_h)
+{
+  double px, py, fx, fy, s = 0.0;
+  uint32_t i, j, x0, y0, x1, y1;
+
+  if (mode == RESAMPLE_BOX)
+  {
+    x0 = (x * w) / out_w;
+    x1 = ((x + 1U) * w) / out_w;
+    y0 = (y * h) / out_h;
+    y1 = ((y + 1U) * h) / out_h;
+    for (j = y0; j < y1; j++)
+    {
+      for (i = x0; i < x1; i++)
+      {
+        s += plane[(j * w) + i];
+      }
+    }
+    return s / (double)((x1 - x0) * (y1 - y0));
+  }
+
+  px = (((double)x + 0.5) * w / out_w) - 0.5;
+  py = (((double)y + 0.5) * h / out_h) - 0.5;
+  px = (px < 0.0) ? 0.0 : ((px > (double)(w - 1U)) ? (double)(w - 1U) : px);
+  py = (py < 0.0) ? 0.0 : ((py > (double)(h - 1U)) ? (double)(h - 1U) : py);
+  x0 = (uint32_t)px;
+  y0 = (uint32_t)py;
+  x1 = (x0 + 1U < w) ? (x0 + 1U) : x0;
+  y1 = (y0 + 1U < h) ? (y0 + 1U) : y0;
+  fx = px - (double)x0;
+  fy = py - (double)y0;
+  return ((1.0 - fy) * (((1.0 - fx) * plane[(y0 * w) + x0]) + (fx * plane[(y0 * w) + x1]))) +
+         (fy * (((1.0 - fx) * plane[(y1 * w) + x0]) + (fx * plane[(y1 * w) + x1])));
+}
+
+static double now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + ((double)ts.tv_nsec * 1.0e-9);
+}
+
+/**
+  * @brief  Resamples a plane line by line, as the camera delivers it.
+  * @retval Output lines, 0 if the sizes were refused
+  */
+static uint32_t resample(const uint8_t *plane, uint32_t w, uint32_t h, uint8_t mode,
+                         uint8_t *out, uint32_t out_w, uint32_t out_h, double *seconds)
+{
+  Resample_TypeDef rs;
+  uint32_t *work = malloc(RESAMPLE_WORK_WORDS(out_w) * sizeof(uint32_t));
+  uint32_t y, lines = 0U;
+  double start;
+
+  if (Resample_Init(&rs, mode, (uint16_t)w, (uint16_t)h, (uint16_t)out_w, (uint16_t)out_h, work) != HAL_OK)
+  {
+    free(work);
+    return 0U;
+  }
+  start = now();
+  for (y = 0U; y < h; y++)
+  {
+    lines += Resample_PushLine(&rs, plane + (y * w), out + (lines * out_w));
+  }
+  *seconds += now() - start;
+  free(work);
+  return lines;
+}
+
+/**
+  * @brief  Resamples a plane and adds its error against the model.
+  * @retval 0, -1 if the resampler did not produce every output line
+  */
+static int measure(const uint8_t *plane, uint32_t w, uint32_t h, uint8_t mode,
+                   uint32_t out_w, uint32_t out_h, Host_ResultTypeDef *result)
+{
+  uint8_t *out = malloc(out_w * out_h);
+  uint32_t x, y;
+  double err, mse = 0.0;
+
+  if (resample(plane, w, h, mode, out, out_w, out_h, &result->seconds) != out_h)
+  {
+    free(out);
+    return -1;
+  }
+  for (y = 0U; y < out_h; y++)
+  {
+    for (x = 0U; x < out_w; x++)
+    {
+      err = (double)out[(y * out_w) + x] - reference(plane, w, h, mode, x, y, out_w, out_h);
+      mse += err * err;
+      if (fabs(err) > result->err_max)
+      {
+        result->err_max = fabs(err);
+      }
+    }
+  }
+  result->mse += mse / ((double)out_w * (double)out_h);
+  result->planes++;
+  free(out);
+  return 0;
+}
+
+static double psnr(const Host_ResultTypeDef *result)
+{
+  double mse = result->mse / (double)result->planes;
+
+  return 10.0 * log10(65025.0 / ((mse < 1.0e-9) ? 1.0e-9 : mse));
+}
+
+static void print_result(uint8_t mode, uint32_t w, uint32_t h, uint32_t out_w, uint32_t out_h,
+                         const Host_ResultTypeDef *result)
+{
+  printf("resample %-8s %ux%u -> %ux%u: PSNR %.2f dB, max error %.3f, %.1f us/frame\n",
+         names[mode], w, h, out_w, out_h, psnr(result), result->err_max,
+         1.0e6 * result->seconds / (double)result->planes);
+}
+
+static uint32_t check(const char *name, int ok)
+{
+  printf("%-44s %s\n", name, ok ? "ok" : "FAIL");
+  return ok ? 0U : 1U;
+}
+
+/**
+  * @brief  Self-test on the test plane.
+  * @retval 0 if it passed
+  */
+static int self_test(void)
+{
+  static const uint16_t sizes[][2] = { {320U, 240U}, {213U, 160U}, {160U, 120U}, {40U, 30U} };
+  static const uint16_t refused[][4] = {
+    {640U, 480U, 641U, 480U},     /* upscaling */
+    {640U, 480U, 39U, 30U},       /* more than RESAMPLE_MAX_RATIO */
+    {1U, 480U, 1U, 240U},         /* input narrower than 2 */
+    {640U, 480U, 320U, 0U}
+  };
+  static uint8_t plane[HOST_WIDTH * HOST_HEIGHT];
+  static uint8_t out[HOST_WIDTH * HOST_HEIGHT], strip[HOST_WIDTH * HOST_HEIGHT];
+  static uint32_t work[RESAMPLE_WORK_WORDS(HOST_WIDTH)];
+  Host_ResultTypeDef result;
+  Resample_TypeDef rs;
+  uint32_t fails = 0U, s, x, y, i, lines;
+  uint8_t mode;
+  double seconds = 0.0;
+  int ok;
+
+  for (y = 0U; y < HOST_HEIGHT; y++)
+  {
+    for (x = 0U; x < HOST_WIDTH; x++)
+    {
+      plane[(y * HOST_WIDTH) + x] = test_pixel(x, y);
+    }
+  }
+
+  for (mode = RESAMPLE_BOX; mode <= RESAMPLE_BILINEAR; mode++)
+  {
+    ok = 1;
+    for (s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+    {
+      memset(&result, 0, sizeof(result));
+      if (measure(plane, HOST_WIDTH, HOST_HEIGHT, mode, sizes[s][0], sizes[s][1], &result) != 0)
+      {
+        ok = 0;
+        continue;
+      }
+      print_result(mode, HOST_WIDTH, HOST_HEIGHT, sizes[s][0], sizes[s][1], &result);
+      if (mode == RESAMPLE_BOX)
+      {
+        ok = ok && (psnr(&result) >= HOST_BOX_PSNR_MIN) && (result.err_max <= HOST_BOX_ERR_MAX);
+      }
+      else
+      {
+        ok = ok && (psnr(&result) >= HOST_BILINEAR_PSNR_MIN) && (result.err_max <= HOST_BILINEAR_ERR_MAX);
+      }
+    }
+    fails += check((mode == RESAMPLE_BOX) ? "box within bounds of the model" :
+                                            "bilinear within bounds of the model", ok);
+  }
+
+  /* a flat plane stays flat, at every size and with both filters */
+  ok = 1;
+  for (i = 0U; i < 256U; i += 51U)
+  {
+    memset(plane, (int)i, sizeof(plane));
+    for (mode = RESAMPLE_BOX; mode <= RESAMPLE_BILINEAR; mode++)
+    {
+      for (s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+      {
+        lines = resample(plane, HOST_WIDTH, HOST_HEIGHT, mode, out, sizes[s][0], sizes[s][1], &seconds);
+        ok = ok && (lines == sizes[s][1]);
+        for (x = 0U; x < ((uint32_t)sizes[s][0] * sizes[s][1]); x++)
+        {
+          ok = ok && (out[x] == i);
+        }
+      }
+    }
+  }
+  fails += check("flat plane unchanged", ok);
+
+  /* strips of 7 lines, as a DMA half transfer delivers them */
+  for (y = 0U; y < HOST_HEIGHT; y++)
+  {
+    for (x = 0U; x < HOST_WIDTH; x++)
+    {
+      plane[(y * HOST_WIDTH) + x] = test_pixel(x, y);
+    }
+  }
+  ok = 1;
+  for (mode = RESAMPLE_BOX; mode <= RESAMPLE_BILINEAR; mode++)
+  {
+    for (s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+    {
+      resample(plane, HOST_WIDTH, HOST_HEIGHT, mode, out, sizes[s][0], sizes[s][1], &seconds);
+      Resample_Init(&rs, mode, HOST_WIDTH, HOST_HEIGHT, sizes[s][0], sizes[s][1], work);
+      lines = 0U;
+      for (y = 0U; y < HOST_HEIGHT; y += 7U)
+      {
+        lines += Resample_PushStrip(&rs, plane + (y * HOST_WIDTH), HOST_WIDTH,
+                                    ((HOST_HEIGHT - y) < 7U) ? (HOST_HEIGHT - y) : 7U,
+                                    strip + (lines * sizes[s][0]), sizes[s][0]);
+      }
+      ok = ok && (lines == sizes[s][1]) &&
+           (memcmp(out, strip, (size_t)sizes[s][0] * sizes[s][1]) == 0);
+    }
+  }
+  fails += check("strips give the pixels of lines", ok);
+
+  ok = 1;
+  for (s = 0U; s < (sizeof(refused) / sizeof(refused[0])); s++)
+  {
+    for (mode = RESAMPLE_BOX; mode <= RESAMPLE_BILINEAR; mode++)
+    {
+      ok = ok && (Resample_Init(&rs, mode, refused[s][0], refused[s][1],
+                                refused[s][2], refused[s][3], work) == HAL_ERROR);
+    }
+  }
+  ok = ok && (Resample_Init(&rs, 2U, HOST_WIDTH, HOST_HEIGHT, 320U, 240U, work) == HAL_ERROR);
+  fails += check("sizes out of range refused", ok);
+
+  printf("%s\n", (fails != 0U) ? "FAIL" : "PASS");
+  return (fails != 0U) ? -1 : 0;
+}
+
+/**
+  * @brief  Measures both filters on the raw planes of a file.
+  * @retval 0, -1 on error
+  */
+static int measure_file(const char *path, uint32_t w, uint32_t h, uint32_t out_w, uint32_t out_h)
+{
+  Host_ResultTypeDef results[2];
+  uint8_t *plane = malloc(w * h);
+  FILE *f = fopen(path, "rb");
+  uint8_t mode;
+
+  if ((f == NULL) || (plane == NULL))
+  {
+    perror(path);
+    free(plane);
+    return -1;
+  }
+  memset(results, 0, sizeof(results));
+  while (fread(plane, 1, w * h, f) == (w * h))
+  {
+    for (mode = RESAMPLE_BOX; mode <= RESAMPLE_BILINEAR; mode++)
+    {
+      if (measure(plane, w, h, mode, out_w, out_h, &results[mode]) != 0)
+      {
+        fprintf(stderr, "%ux%u -> %ux%u: sizes out of range\n", w, h, out_w, out_h);
+        fclose(f);
+        free(plane);
+        return -1;
+      }
+    }
+  }
+  fclose(f);
+  free(plane);
+  if (results[0].planes == 0U)
+  {
+    fprintf(stderr, "%s: no %ux%u plane\n", path, w, h);
+    return -1;
+  }
+  printf("%u planes\n", results[0].planes);
+  for (mode = RESAMPLE_BOX; mode <= RESAMPLE_BILINEAR; mode++)
+  {
+    print_result(mode, w, h, out_w, out_h, &results[mode]);
+  }
+  return 0;
+}
+
+static void usage(void)
+{
+  fprintf(stderr,
+          "usage: resample_host -s\n"
+          "       resample_host -i planes.y -w width -h height -o WxH\n");
+}
+
+int main(int argc, char **argv)
+{
+  const char *path = NULL;
+  uint32_t w = 0U, h = 0U, out_w = 0U, out_h = 0U;
+  int opt, simulated = 0;
+
+  while ((opt = getopt(argc, argv, "si:w:h:o:")) != -1)
+  {
+    switch (opt)
+    {
+    case 's': simulated = 1; break;
+    case 'i': path = optarg; break;
+    case 'w': w = (uint32_t)strtoul(optarg, NULL, 0); break;
+    case 'h': h = (uint32_t)strtoul(optarg, NULL, 0); break;
+    case 'o':
+      if (sscanf(optarg, "%ux%u", &out_w, &out_h) != 2)
+      {
+        usage();
+        return 2;
+      }
+      break;
+    default: usage(); return 2;
+    }
+  }
+
+  if (simulated != 0)
+  {
+    return (self_test() == 0) ? 0 : 1;
+  }
+  if ((path == NULL) || (w == 0U) || (h == 0U) || (out_w == 0U) || (out_h == 0U))
+  {
+    usage();
+    return 2;
+  }
+  return (measure_file(path, w, h, out_w, out_h) == 0) ? 0 : 1;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
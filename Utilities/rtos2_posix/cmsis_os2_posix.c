@@ -0,0 +1,361 @@
+/**
+  ******************************************************************************
+  * @file    cmsis_os2_posix.c
+  * @brief   Host shim: the CMSIS-RTOS2 calls of the firmware on pthreads.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                              CMSIS-RTOS2 on pthreads
+  *          ===================================================================
+  *           Enough of Drivers/CMSIS/RTOS2/Include/cmsis_os2.h to run
+  *           Src/pipeline.c on a host:
+  *             - kernel: osKernelInitialize, osKernelStart,
+  *               osKernelGetState, osKernelGetTickCount (1 ms ticks),
+  *             - threads: osThreadNew, osThreadGetId, osDelay,
+  *             - thread flags: osThreadFlagsSet, osThreadFlagsWait,
+  *             - message queues: osMessageQueueNew, osMessageQueuePut,
+  *               osMessageQueueGet, osMessageQueueGetCount.
+  *           Threads created before osKernelStart() wait for it. Priorities
+  *           and stack memory are ignored: the host scheduler decides, so
+  *           the shim checks the ordering and the ownership of the buffers,
+  *           not the deadlines. osKernelStart() never returns, a thread
+  *           ends the program with exit().
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "cmsis_os2.h"
+
+typedef struct
+{
+  pthread_t        thread;
+  osThreadFunc_t   func;
+  void            *argument;
+  pthread_mutex_t  lock;
+  pthread_cond_t   cond;
+  uint32_t         flags;
+} Shim_ThreadTypeDef;
+
+typedef struct
+{
+  pthread_mutex_t  lock;
+  pthread_cond_t   not_empty;
+  pthread_cond_t   not_full;
+  uint32_t         msg_count;
+  uint32_t         msg_size;
+  uint32_t         head;
+  uint32_t         count;
+  uint8_t         *data;
+} Shim_QueueTypeDef;
+
+static pthread_mutex_t kernel_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t kernel_cond = PTHREAD_COND_INITIALIZER;
+static osKernelState_t kernel_state = osKernelInactive;
+static struct timespec kernel_epoch;
+static __thread Shim_ThreadTypeDef *shim_self;
+
+/* Absolute deadline timeout ms from now */
+static void Shim_Deadline(uint32_t timeout, struct timespec *ts)
+{
+  clock_gettime(CLOCK_REALTIME, ts);
+  ts->tv_sec += timeout / 1000U;
+  ts->tv_nsec += (long)(timeout % 1000U) * 1000000L;
+  if (ts->tv_nsec >= 1000000000L)
+  {
+    ts->tv_sec++;
+    ts->tv_nsec -= 1000000000L;
+  }
+}
+
+/* Waits on cond until woken or the timeout expires, 0 on timeout */
+static int Shim_Wait(pthread_cond_t *cond, pthread_mutex_t *lock, uint32_t timeout)
+{
+  struct timespec ts;
+
+  if (timeout == 0U)
+  {
+    return 0;
+  }
+  if (timeout == osWaitForever)
+  {
+    pthread_cond_wait(cond, lock);
+    return 1;
+  }
+  Shim_Deadline(timeout, &ts);
+  return (pthread_cond_timedwait(cond, lock, &ts) == ETIMEDOUT) ? 0 : 1;
+}
+
+static void *Shim_Start(void *arg)
+{
+  Shim_ThreadTypeDef *t = (Shim_ThreadTypeDef *)arg;
+
+  shim_self = t;
+  pthread_mutex_lock(&kernel_lock);
+  while (kernel_state != osKernelRunning)
+  {
+    pthread_cond_wait(&kernel_cond, &kernel_lock);
+  }
+  pthread_mutex_unlock(&kernel_lock);
+  t->func(t->argument);
+  return NULL;
+}
+
+/*  ==== Kernel ==== */
+
+osStatus_t osKernelInitialize(void)
+{
+  pthread_mutex_lock(&kernel_lock);
+  clock_gettime(CLOCK_MONOTONIC, &kernel_epoch);
+  kernel_state = osKernelReady;
+  pthread_mutex_unlock(&kernel_lock);
+  return osOK;
+}
+
+osStatus_t osKernelStart(void)
+{
+  pthread_mutex_lock(&kernel_lock);
+  if (kernel_state != osKernelReady)
+  {
+    pthread_mutex_unlock(&kernel_lock);
+    return osError;
+  }
+  kernel_state = osKernelRunning;
+  pthread_cond_broadcast(&kernel_cond);
+  pthread_mutex_unlock(&kernel_lock);
+  for (;;)
+  {
+    pause();
+  }
+}
+
+osKernelState_t osKernelGetState(void)
+{
+  return kernel_state;
+}
+
+uint32_t osKernelGetTickCount(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)(((now.tv_sec - kernel_epoch.tv_sec) * 1000L) +
+                    ((now.tv_nsec - kernel_epoch.tv_nsec) / 1000000L));
+}
+
+/*  ==== Threads ==== */
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+  Shim_ThreadTypeDef *t;
+
+  (void)attr;
+  if ((func == NULL) || (kernel_state == osKernelInactive))
+  {
+    return NULL;
+  }
+  t = calloc(1, sizeof(Shim_ThreadTypeDef));
+  if (t == NULL)
+  {
+    return NULL;
+  }
+  t->func = func;
+  t->argument = argument;
+  pthread_mutex_init(&t->lock, NULL);
+  pthread_cond_init(&t->cond, NULL);
+  if (pthread_create(&t->thread, NULL, Shim_Start, t) != 0)
+  {
+    free(t);
+    return NULL;
+  }
+  pthread_detach(t->thread);
+  return (osThreadId_t)t;
+}
+
+osThreadId_t osThreadGetId(void)
+{
+  return (osThreadId_t)shim_self;
+}
+
+osStatus_t osDelay(uint32_t ticks)
+{
+  struct timespec ts;
+
+  ts.tv_sec = ticks / 1000U;
+  ts.tv_nsec = (long)(ticks % 1000U) * 1000000L;
+  while ((nanosleep(&ts, &ts) != 0) && (errno == EINTR))
+  {
+  }
+  return osOK;
+}
+
+/*  ==== Thread flags ==== */
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags)
+{
+  Shim_ThreadTypeDef *t = (Shim_ThreadTypeDef *)thread_id;
+  uint32_t result;
+
+  if ((t == NULL) || ((flags & 0x80000000U) != 0U))
+  {
+    return (uint32_t)osFlagsErrorParameter;
+  }
+  pthread_mutex_lock(&t->lock);
+  t->flags |= flags;
+  result = t->flags;
+  pthread_cond_broadcast(&t->cond);
+  pthread_mutex_unlock(&t->lock);
+  return result;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout)
+{
+  Shim_ThreadTypeDef *t = shim_self;
+  uint32_t result;
+  int match;
+
+  if (t == NULL)
+  {
+    return (uint32_t)osFlagsErrorUnknown;
+  }
+  pthread_mutex_lock(&t->lock);
+  for (;;)
+  {
+    match = ((options & osFlagsWaitAll) != 0U) ? ((t->flags & flags) == flags)
+                                               : ((t->flags & flags) != 0U);
+    if (match)
+    {
+      break;
+    }
+    if (Shim_Wait(&t->cond, &t->lock, timeout) == 0)
+    {
+      pthread_mutex_unlock(&t->lock);
+      return (timeout == 0U) ? (uint32_t)osFlagsErrorResource : (uint32_t)osFlagsErrorTimeout;
+    }
+  }
+  result = t->flags;
+  if ((options & osFlagsNoClear) == 0U)
+  {
+    t->flags &= ~flags;
+  }
+  pthread_mutex_unlock(&t->lock);
+  return result;
+}
+
+/*  ==== Message queues ==== */
+
+osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr)
+{
+  Shim_QueueTypeDef *q;
+
+  (void)attr;
+  if ((msg_count == 0U) || (msg_size == 0U))
+  {
+    return NULL;
+  }
+  q = calloc(1, sizeof(Shim_QueueTypeDef));
+  if (q == NULL)
+  {
+    return NULL;
+  }
+  q->data = calloc(msg_count, msg_size);
+  if (q->data == NULL)
+  {
+    free(q);
+    return NULL;
+  }
+  q->msg_count = msg_count;
+  q->msg_size = msg_size;
+  pthread_mutex_init(&q->lock, NULL);
+  pthread_cond_init(&q->not_empty, NULL);
+  pthread_cond_init(&q->not_full, NULL);
+  return (osMessageQueueId_t)q;
+}
+
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
+{
+  Shim_QueueTypeDef *q = (Shim_QueueTypeDef *)mq_id;
+  uint32_t tail;
+
+  (void)msg_prio;
+  if ((q == NULL) || (msg_ptr == NULL))
+  {
+    return osErrorParameter;
+  }
+  pthread_mutex_lock(&q->lock);
+  while (q->count == q->msg_count)
+  {
+    if (Shim_Wait(&q->not_full, &q->lock, timeout) == 0)
+    {
+      pthread_mutex_unlock(&q->lock);
+      return (timeout == 0U) ? osErrorResource : osErrorTimeout;
+    }
+  }
+  tail = (q->head + q->count) % q->msg_count;
+  memcpy(&q->data[tail * q->msg_size], msg_ptr, q->msg_size);
+  q->count++;
+  pthread_cond_signal(&q->not_empty);
+  pthread_mutex_unlock(&q->lock);
+  return osOK;
+}
+
+osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+{
+  Shim_QueueTypeDef *q = (Shim_QueueTypeDef *)mq_id;
+
+  if ((q == NULL) || (msg_ptr == NULL))
+  {
+    return osErrorParameter;
+  }
+  pthread_mutex_lock(&q->lock);
+  while (q->count == 0U)
+  {
+    if (Shim_Wait(&q->not_empty, &q->lock, timeout) == 0)
+    {
+      pthread_mutex_unlock(&q->lock);
+      return (timeout == 0U) ? osErrorResource : osErrorTimeout;
+    }
+  }
+  memcpy(msg_ptr, &q->data[q->head * q->msg_size], q->msg_size);
+  q->head = (q->head + 1U) % q->msg_count;
+  q->count--;
+  if (msg_prio != NULL)
+  {
+    *msg_prio = 0U;
+  }
+  pthread_cond_signal(&q->not_full);
+  pthread_mutex_unlock(&q->lock);
+  return osOK;
+}
+
+uint32_t osMessageQueueGetCount(osMessageQueueId_t mq_id)
+{
+  Shim_QueueTypeDef *q = (Shim_QueueTypeDef *)mq_id;
+  uint32_t count;
+
+  if (q == NULL)
+  {
+    return 0U;
+  }
+  pthread_mutex_lock(&q->lock);
+  count = q->count;
+  pthread_mutex_unlock(&q->lock);
+  return count;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
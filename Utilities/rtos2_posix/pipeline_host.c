@@ -0,0 +1,254 @@
+/**
+  ******************************************************************************
+  * @file    pipeline_host.c
+  * @brief   Host run of the frame pipeline on the CMSIS-RTOS2 shim.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                Pipeline on a host
+  *          ===================================================================
+  *           Src/pipeline.c runs with the test pattern and the tile delta
+  *           encoder of the firmware, the USB class is replaced by a thread
+  *           draining each payload at a fixed rate and calling
+  *           Pipeline_FrameSent() like the FrameDone interrupt. At the end of
+  *           each transfer the payload is decoded and compared with the
+  *           pattern frame rendered again: a buffer reused while in flight,
+  *           a frame out of order or a lost key frame fails the run.
+  *           The device is configured and streams from the start, the frame
+  *           sources are set up then as with BOOT_LAZY_INIT, and the boot
+  *           stages of Src/boot.c give the time to the first frame.
+  *
+  *           Build, from the repository root:
+  *             cc -O2 -pthread -IInc -IDrivers/CMSIS/RTOS2/Include
+  *                -o pipeline_host Utilities/rtos2_posix/pipeline_host.c
+  *                Utilities/rtos2_posix/cmsis_os2_posix.c Src/pipeline.c
+  *                Src/test_pattern.c Src/tile_delta.c Src/boot.c
+  *           Usage: pipeline_host [frames] [bytes_per_ms]
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "pipeline.h"
+#include "boot.h"
+#include "test_pattern.h"
+#include "tile_delta.h"
+
+#define HOST_WIDTH                      640U
+#define HOST_HEIGHT                     480U
+#define HOST_FRAME_SIZE                 ((HOST_WIDTH * HOST_HEIGHT * 3U) / 2U)
+#define HOST_PAYLOAD_SIZE               TILE_DELTA_MAX_SIZE(HOST_WIDTH, HOST_HEIGHT)
+
+static TestPattern_TypeDef       pattern;
+static TileDelta_EncoderTypeDef  encoder;
+static Pipeline_BufferTypeDef    raw[PIPELINE_BUFFERS];
+static Pipeline_BufferTypeDef    out[PIPELINE_BUFFERS];
+static uint32_t                  frame_number;
+
+/* Simulated class: one pending frame, drained at host_rate bytes per ms */
+static const Pipeline_BufferTypeDef * volatile host_next;
+static volatile uint8_t          host_busy;
+static uint32_t                  host_rate = 1000U;
+static uint32_t                  host_frames = 100U;
+
+uint32_t Boot_HostTime(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000U);
+}
+
+static void Host_Planes(uint8_t *data, TestPattern_PlanesTypeDef *planes)
+{
+  planes->y = data;
+  planes->cb = data + (HOST_WIDTH * HOST_HEIGHT);
+  planes->cr = planes->cb + ((HOST_WIDTH * HOST_HEIGHT) / 4U);
+  planes->pitch = HOST_WIDTH;
+}
+
+static int32_t Host_Capture(Pipeline_BufferTypeDef *buf)
+{
+  TestPattern_PlanesTypeDef planes;
+
+  Host_Planes(buf->data, &planes);
+  TestPattern_Render(&pattern, frame_number, &planes);
+  buf->frame = frame_number;
+  buf->capture = osKernelGetTickCount();
+  buf->streams = 0x01U;
+  buf->flags = (frame_number == 0U) ? PIPELINE_FLAG_KEY : 0U;
+  buf->len = HOST_FRAME_SIZE;
+  frame_number++;
+  return 0;
+}
+
+static uint32_t Host_Encode(const Pipeline_BufferTypeDef *src, Pipeline_BufferTypeDef *dst)
+{
+  TestPattern_PlanesTypeDef planes;
+  TileDelta_FrameTypeDef frame;
+
+  if ((src->flags & PIPELINE_FLAG_KEY) != 0U)
+  {
+    TileDelta_ForceKey(&encoder);
+  }
+  Host_Planes(src->data, &planes);
+  frame.y = planes.y;
+  frame.cb = planes.cb;
+  frame.cr = planes.cr;
+  return TileDelta_Encode(&encoder, &frame, dst->data, dst->size);
+}
+
+static void Host_Send(const Pipeline_BufferTypeDef *buf)
+{
+  host_busy = 1U;
+  host_next = buf;
+}
+
+static uint8_t Host_Busy(const Pipeline_BufferTypeDef *buf)
+{
+  (void)buf;
+  return host_busy;
+}
+
+static const Pipeline_OpsTypeDef host_ops =
+{
+  Host_Capture,
+  Host_Encode,
+  Host_Send,
+  Host_Busy
+};
+
+/* Drains the frames handed over and checks them against the pattern */
+static void Host_UsbTask(void *argument)
+{
+  static uint8_t picture[HOST_FRAME_SIZE];
+  static uint8_t expected[HOST_FRAME_SIZE];
+  const Pipeline_BufferTypeDef *buf;
+  TestPattern_PlanesTypeDef planes;
+  TileDelta_FrameTypeDef dst;
+  Pipeline_StatsTypeDef stats;
+  uint32_t received = 0U, start = osKernelGetTickCount(), latency = 0U;
+  int32_t last = -1;
+
+  (void)argument;
+  Host_Planes(picture, &planes);
+  dst.y = planes.y;
+  dst.cb = planes.cb;
+  dst.cr = planes.cr;
+  while (received < host_frames)
+  {
+    buf = host_next;
+    if (buf == NULL)
+    {
+      osDelay(1U);
+      continue;
+    }
+    host_next = NULL;
+    osDelay((buf->len + host_rate - 1U) / host_rate);
+
+    /* the buffer must still hold the frame at the end of the transfer */
+    if ((int32_t)buf->frame <= last)
+    {
+      printf("frame %u after frame %d\n", buf->frame, last);
+      exit(1);
+    }
+    last = (int32_t)buf->frame;
+    Host_Planes(expected, &planes);
+    TestPattern_Render(&pattern, buf->frame, &planes);
+    if ((TileDelta_Decode(buf->data, buf->len, &dst, HOST_WIDTH, HOST_HEIGHT) != 0) ||
+        (memcmp(picture, expected, HOST_FRAME_SIZE) != 0))
+    {
+      printf("frame %u: decoded picture differs\n", buf->frame);
+      exit(1);
+    }
+    latency += osKernelGetTickCount() - buf->capture;
+    Boot_Mark(BOOT_STAGE_FIRST_FRAME);
+    received++;
+    host_busy = 0U;
+    Pipeline_FrameSent();
+  }
+
+  Pipeline_GetStats(&stats);
+  printf("%u frames in %u ms, %u bytes/ms: capture %u, encode %u, sent %u, dropped %u\n",
+         received, osKernelGetTickCount() - start, host_rate,
+         stats.captured, stats.encoded, stats.sent, stats.dropped);
+  printf("mean capture to end of transfer %u ms, longest encode %u ms\n",
+         latency / received, stats.encode_max);
+  Boot_Report();
+  exit(0);
+}
+
+/* Frame sources of the first stream start */
+static int Host_InitMedia(void)
+{
+  static uint8_t ref[HOST_FRAME_SIZE];
+  uint32_t i;
+
+  if ((TestPattern_Init(&pattern, TEST_PATTERN_BOX, HOST_WIDTH, HOST_HEIGHT) != 0) ||
+      (TileDelta_Init(&encoder, HOST_WIDTH, HOST_HEIGHT, ref) != 0))
+  {
+    return -1;
+  }
+  encoder.threshold = 0U;
+  for (i = 0U; i < PIPELINE_BUFFERS; i++)
+  {
+    raw[i].data = malloc(HOST_FRAME_SIZE);
+    raw[i].size = HOST_FRAME_SIZE;
+    out[i].data = malloc(HOST_PAYLOAD_SIZE);
+    out[i].size = HOST_PAYLOAD_SIZE;
+    if ((raw[i].data == NULL) || (out[i].data == NULL))
+    {
+      return -1;
+    }
+  }
+  if (Pipeline_Init(&host_ops, raw, out) != 0)
+  {
+    return -1;
+  }
+  Boot_Mark(BOOT_STAGE_MEDIA);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 1)
+  {
+    host_frames = (uint32_t)strtoul(argv[1], NULL, 0);
+  }
+  if (argc > 2)
+  {
+    host_rate = (uint32_t)strtoul(argv[2], NULL, 0);
+  }
+  if ((host_frames == 0U) || (host_rate == 0U))
+  {
+    printf("usage: pipeline_host [frames] [bytes_per_ms]\n");
+    return 2;
+  }
+
+  osKernelInitialize();
+  Boot_Init();
+  /* enumerated, the host starts the stream at once */
+  Boot_Mark(BOOT_STAGE_CONFIGURED);
+  Boot_Mark(BOOT_STAGE_STREAM);
+  if ((Host_InitMedia() != 0) || (osThreadNew(Host_UsbTask, NULL, NULL) == NULL))
+  {
+    return 1;
+  }
+  osKernelStart();
+  return 1;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
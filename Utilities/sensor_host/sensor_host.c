@@ -0,0 +1,275 @@
+/**
+  ******************************************************************************
+  * @file    sensor_host.c
+  * @brief   Host test of the sensor layer: probe, register batches and image
+  *          controls against a mock sensor on a model of the bus.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                               Sensor on a host
+  *          ===================================================================
+  *           The bus model answers the mock sensor address only, so the probe
+  *           goes through the OV backends before it finds the mock. The mock
+  *           holds two banks of 256 registers, selected through register
+  *           0xFF, and does not acknowledge writes while it resets. Time
+  *           steps by 1 ms; each step completes the write in flight, as the
+  *           I2C interrupt would, then runs Sensor_Process() as the main
+  *           loop does. A frame ends every 66 ms: the mock latches its
+  *           control registers there, and the next frame is rendered from
+  *           them. The test fails when:
+  *             - the probe does not find the mock,
+  *             - a write is sent during the reset delay of the register
+  *               table, or the table did not set the output format,
+  *             - the first control batch does not write every control
+  *               register,
+  *             - a control change is written before the frame boundary,
+  *               takes more writes than the registers it changed, or shows
+  *               in the frame during which it was written,
+  *             - a write not acknowledged is not sent again, or a batch that
+  *               failed is not followed by a rewrite of every control
+  *               register.
+  *
+  *           Build, from the repository root:
+  *             cc -O2 -IInc -o sensor_host Utilities/sensor_host/sensor_host.c
+  *                Src/sensor.c Src/sensor_ov7670.c Src/sensor_ov2640.c
+  *                Src/sensor_ov5640.c Src/sensor_mock.c
+  *           Usage: sensor_host
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "sensor.h"
+
+#if !SENSOR_HOST
+#error "sensor_host builds the host variant of the sensor layer"
+#endif
+
+/* 15 fps */
+#define HOST_FRAME_MS                   66U
+
+/* Registers of the mock, bank 0 and 1 */
+static uint8_t host_regs[2][256];
+static uint8_t host_bank;
+static uint32_t host_reset_end;         /* ms, writes not acknowledged until then */
+static uint32_t host_time;
+static uint32_t host_nack;              /* writes to refuse, injected */
+static uint32_t host_reset_writes;      /* writes sent during the reset */
+
+/* Controls latched at the last frame boundary, frames rendered from them */
+static uint8_t host_latched[256];
+static int32_t host_level;              /* mean level of the last frame */
+
+/**
+  * @brief  Time hook of the sensor layer.
+  * @retval ms
+  */
+uint32_t Sensor_HostTime(void)
+{
+  return host_time;
+}
+
+/**
+  * @brief  Read hook of the sensor layer: the mock answers, the OV sensors
+  *         are absent.
+  * @retval 0 if acknowledged
+  */
+int32_t Sensor_HostRead(uint8_t address, uint16_t reg, uint8_t *value)
+{
+  if (address != SENSOR_MOCK_ADDRESS)
+  {
+    return -1;
+  }
+  *value = host_regs[(reg >> 8) & 1U][reg & 0xFFU];
+  return 0;
+}
+
+/**
+  * @brief  Write hook of the sensor layer, register address without the
+  *         bank, as on the wire.
+  * @retval 0 if acknowledged
+  */
+int32_t Sensor_HostWrite(uint8_t address, uint16_t reg, uint8_t value)
+{
+  if (address != SENSOR_MOCK_ADDRESS)
+  {
+    return -1;
+  }
+  if ((int32_t)(host_reset_end - host_time) > 0)
+  {
+    host_reset_writes++;
+    return -1;
+  }
+  if (host_nack != 0U)
+  {
+    host_nack--;
+    return -1;
+  }
+  if (reg == SENSOR_BANK_REG)
+  {
+    host_bank = value & 1U;
+    return 0;
+  }
+  host_regs[host_bank][reg & 0xFFU] = value;
+  if ((host_bank == 0U) && ((reg & 0xFFU) == (SENSOR_MOCK_REG_RESET & 0xFFU)) && ((value & 0x80U) != 0U))
+  {
+    memset(host_regs, 0, sizeof(host_regs));
+    host_regs[1][SENSOR_MOCK_REG_ID & 0xFFU] = SENSOR_MOCK_ID;
+    host_bank = 0U;
+    /* reset takes the whole delay of the table */
+    host_reset_end = host_time + SENSOR_MOCK_RESET_MS;
+  }
+  return 0;
+}
+
+static uint16_t reg16(uint16_t hi, uint16_t lo)
+{
+  return (uint16_t)((host_regs[1][hi & 0xFFU] << 8) | host_regs[1][lo & 0xFFU]);
+}
+
+/**
+  * @brief  Renders a frame from the controls latched at its start.
+  */
+static void render(void)
+{
+  uint32_t exposure = ((uint32_t)host_latched[SENSOR_MOCK_REG_EXPOSURE_HI & 0xFFU] << 8) |
+                      host_latched[SENSOR_MOCK_REG_EXPOSURE_LO & 0xFFU];
+  uint32_t contrast = host_latched[SENSOR_MOCK_REG_CONTRAST & 0xFFU];
+  int32_t brightness = (int8_t)host_latched[SENSOR_MOCK_REG_BRIGHTNESS & 0xFFU];
+
+  host_level = (int32_t)((exposure * contrast) / 256U) + brightness;
+}
+
+/**
+  * @brief  Steps the time, frame boundaries included.
+  */
+static void run(uint32_t ms)
+{
+  while (ms-- != 0U)
+  {
+    host_time++;
+    Sensor_HostComplete(0);
+    if ((host_time % HOST_FRAME_MS) == 0U)
+    {
+      /* the frame that ends was rendered from the previous latch */
+      render();
+      memcpy(host_latched, host_regs[1], sizeof(host_latched));
+      Sensor_FrameBoundary();
+    }
+    Sensor_Process();
+  }
+}
+
+/**
+  * @brief  Steps the time to the next frame boundary.
+  */
+static void run_to_frame(void)
+{
+  run(HOST_FRAME_MS - (host_time % HOST_FRAME_MS));
+}
+
+static uint32_t check(const char *name, int ok)
+{
+  printf("%-44s %s\n", name, ok ? "ok" : "FAIL");
+  return ok ? 0U : 1U;
+}
+
+int main(void)
+{
+  Sensor_StatsTypeDef stats, last;
+  uint32_t fails = 0U;
+  int32_t level;
+  int ok;
+
+  host_time = 1000U;
+  host_regs[1][SENSOR_MOCK_REG_ID & 0xFFU] = SENSOR_MOCK_ID;
+
+  ok = (Sensor_Init() == 0) && (strcmp(Sensor_GetName(), "mock") == 0);
+  fails += check("probe finds the mock", ok);
+
+  run(20U);
+  ok = (host_reset_writes == 0U) && (host_regs[0][SENSOR_MOCK_REG_FORMAT & 0xFFU] == 0x01U) &&
+       (host_regs[0][SENSOR_MOCK_REG_WIDTH8 & 0xFFU] == (640U / 8U)) &&
+       (host_regs[0][SENSOR_MOCK_REG_HEIGHT8 & 0xFFU] == (480U / 8U));
+  fails += check("register table waits out the reset", ok);
+
+  /* the first control batch waits for a frame boundary as well */
+  run(HOST_FRAME_MS + 20U);
+  Sensor_GetStats(&stats);
+  ok = (Sensor_Busy() == 0U) && (stats.batches == 2U) &&
+       (host_regs[1][SENSOR_MOCK_REG_FLAGS & 0xFFU] == (SENSOR_MOCK_FLAG_AE | SENSOR_MOCK_FLAG_AWB)) &&
+       (reg16(SENSOR_MOCK_REG_EXPOSURE_HI, SENSOR_MOCK_REG_EXPOSURE_LO) == 333U) &&
+       (host_regs[1][SENSOR_MOCK_REG_CONTRAST & 0xFFU] == 0x40U) &&
+       (reg16(SENSOR_MOCK_REG_WB_HI, SENSOR_MOCK_REG_WB_LO) == 4600U) &&
+       (stats.writes == (5U + 9U));
+  fails += check("first control batch writes every register", ok);
+
+  /* a change early in a frame: written at its end, seen in the next frame */
+  run_to_frame();
+  run(1U);
+  Sensor_GetStats(&last);
+  Sensor_SetControl(SENSOR_CTRL_BRIGHTNESS, 50);
+  Sensor_SetControl(SENSOR_CTRL_EXPOSURE, 500);
+  run(HOST_FRAME_MS - 2U);
+  ok = (host_regs[1][SENSOR_MOCK_REG_BRIGHTNESS & 0xFFU] == 0U) &&
+       (reg16(SENSOR_MOCK_REG_EXPOSURE_HI, SENSOR_MOCK_REG_EXPOSURE_LO) == 333U);
+  fails += check("control change held until the frame boundary", ok);
+  run(1U);
+  level = host_level;
+  run(5U);
+  Sensor_GetStats(&stats);
+  ok = (host_regs[1][SENSOR_MOCK_REG_BRIGHTNESS & 0xFFU] == 50U) &&
+       (reg16(SENSOR_MOCK_REG_EXPOSURE_HI, SENSOR_MOCK_REG_EXPOSURE_LO) == 500U) &&
+       ((stats.writes - last.writes) == 2U) && ((stats.batches - last.batches) == 1U);
+  fails += check("control change written after the boundary", ok);
+  run_to_frame();
+  ok = (host_level == level);
+  run_to_frame();
+  ok = ok && (host_level == ((500 * 0x40) / 256) + 50);
+  fails += check("control change shows in the next frame", ok);
+
+  /* two writes refused: sent again, the batch completes */
+  Sensor_GetStats(&last);
+  host_nack = 2U;
+  Sensor_SetControl(SENSOR_CTRL_GAIN, 64);
+  run(HOST_FRAME_MS + 5U);
+  Sensor_GetStats(&stats);
+  ok = (reg16(SENSOR_MOCK_REG_GAIN_HI, SENSOR_MOCK_REG_GAIN_LO) == 64U) &&
+       ((stats.retries - last.retries) == 2U) && (stats.errors == last.errors);
+  fails += check("refused write sent again", ok);
+
+  /* every try refused: the batch fails, every register is written again */
+  Sensor_GetStats(&last);
+  host_nack = SENSOR_WRITE_TRIES;
+  Sensor_SetControl(SENSOR_CTRL_GAIN, 128);
+  run(HOST_FRAME_MS + 5U);
+  Sensor_GetStats(&stats);
+  ok = ((stats.errors - last.errors) == 1U) && (reg16(SENSOR_MOCK_REG_GAIN_HI, SENSOR_MOCK_REG_GAIN_LO) == 64U);
+  fails += check("batch given up after the tries", ok);
+  Sensor_GetStats(&last);
+  run(2U * HOST_FRAME_MS);
+  Sensor_GetStats(&stats);
+  ok = (reg16(SENSOR_MOCK_REG_GAIN_HI, SENSOR_MOCK_REG_GAIN_LO) == 128U) &&
+       ((stats.writes - last.writes) == 9U) && (Sensor_Busy() == 0U);
+  fails += check("failed batch followed by a full rewrite", ok);
+
+  Sensor_GetStats(&stats);
+  printf("batches=%u writes=%u retries=%u errors=%u\n",
+         stats.batches, stats.writes, stats.retries, stats.errors);
+  printf("%s\n", (fails != 0U) ? "FAIL" : "PASS");
+  return (fails != 0U) ? 1 : 0;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,518 @@
+/**
+  ******************************************************************************
+  * @file    tile_host.c
+  * @brief   Host tool: compression ratio and quality of the TDLT format on
+  *          recorded sequences, decoded with the reference decoder.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                TDLT on a host
+  *          ===================================================================
+  *           Src/tile_delta.c builds on a host with the portable C version of
+  *           the tile SAD, and TileDelta_Decode() there is the reference
+  *           decoder of the TDLT format (index 2). The tool decodes every
+  *           payload into a frame of its own, as a host application would,
+  *           and compares it with the source:
+  *             - ratio: raw YCbCr 4:2:0 bytes per payload byte,
+  *             - PSNR (peak 255) of luma and chroma over the sequence,
+  *             - sync: the decoded frame equals the encoder reference after
+  *               every payload.
+  *           -i encodes a recorded sequence, raw planar 4:2:0 frames of
+  *           width x height x 3 / 2 bytes, at each threshold of -t, with a
+  *           key frame every -k frames:
+  *             ffmpeg -i clip.mp4 -f rawvideo -pix_fmt yuv420p clip.yuv
+  *           -p decodes payloads captured from the camera instead, back to
+  *           back as a TDLT stream is stored by v4l2-ctl --stream-to; a
+  *           payload gives its own length. With -i as well, the frames it
+  *           decodes are compared with that sequence; -o writes them.
+  *           -s runs a synthetic fixed view (textured background, sensor
+  *           noise, an object crossing it) and fails when:
+  *             - the decoder ever differs from the encoder reference,
+  *             - threshold 0 is not lossless,
+  *             - a higher threshold does not compress more,
+  *             - key frames are missing at the interval or on request,
+  *             - TileDelta_Decode() accepts a truncated payload, a payload
+  *               of another size, or one that is not TDLT.
+  *
+  *           Build, from the repository root:
+  *             cc -O2 -IInc -o tile_host Utilities/tile_host/tile_host.c
+  *                Src/tile_delta.c -lm
+  *           Usage: tile_host -s
+  *                  tile_host -i clip.yuv -w width -h height [-t 0,2,4,8]
+  *                            [-k key_interval]
+  *                  tile_host -p capture.tdlt -w width -h height
+  *                            [-i clip.yuv] [-o decoded.yuv]
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include "tile_delta.h"
+
+#if TILE_USE_SIMD
+#error "tile_host builds the portable C version of the tile codec"
+#endif
+
+#define HOST_THRESHOLDS_MAX             16U
+
+/* Synthetic view of -s */
+#define HOST_SIM_WIDTH                  128U
+#define HOST_SIM_HEIGHT                 96U
+#define HOST_SIM_FRAMES                 60U
+#define HOST_SIM_OBJECT                 24U
+
+typedef struct
+{
+  uint16_t   width;
+  uint16_t   height;
+  uint32_t   pixels;
+  uint32_t   frame_bytes;
+} Host_SizeTypeDef;
+
+typedef struct
+{
+  uint64_t   bytes;      /* payload bytes */
+  uint32_t   frames;
+  uint32_t   keys;
+  uint32_t   tiles;      /* tiles sent */
+  uint32_t   errors;     /* payloads refused or decoder out of sync */
+  double     sse_y;
+  double     sse_c;
+  uint32_t   compared;   /* frames compared with a source */
+} Host_ResultTypeDef;
+
+static void frame_planes(const Host_SizeTypeDef *size, uint8_t *buf, TileDelta_FrameTypeDef *frame)
+{
+  frame->y = buf;
+  frame->cb = buf + size->pixels;
+  frame->cr = frame->cb + (size->pixels / 4U);
+}
+
+static void compare(const Host_SizeTypeDef *size, const uint8_t *src, const uint8_t *dec,
+                    Host_ResultTypeDef *result)
+{
+  uint32_t i;
+  int32_t d;
+
+  for (i = 0U; i < size->frame_bytes; i++)
+  {
+    d = (int32_t)src[i] - (int32_t)dec[i];
+    if (i < size->pixels)
+    {
+      result->sse_y += (double)(d * d);
+    }
+    else
+    {
+      result->sse_c += (double)(d * d);
+    }
+  }
+  result->compared++;
+}
+
+static double psnr(double sse, double samples)
+{
+  double mse = sse / samples;
+
+  return (mse > 0.0) ? (10.0 * log10(65025.0 / mse)) : 99.0;
+}
+
+static void print_result(const char *name, const Host_SizeTypeDef *size, const Host_ResultTypeDef *result)
+{
+  printf("%-14s %u frames, %u keys, %6.1f tiles/frame, %8.0f bytes/frame, %6.2f:1",
+         name, result->frames, result->keys,
+         (double)result->tiles / (double)result->frames,
+         (double)result->bytes / (double)result->frames,
+         ((double)size->frame_bytes * result->frames) / (double)result->bytes);
+  if (result->compared != 0U)
+  {
+    printf(", PSNR Y %5.2f dB, CbCr %5.2f dB",
+           psnr(result->sse_y, (double)size->pixels * result->compared),
+           psnr(result->sse_c, (double)(size->frame_bytes - size->pixels) * result->compared));
+  }
+  printf(", %s\n", (result->errors == 0U) ? "decoder in sync" : "DECODER MISMATCH");
+}
+
+/**
+  * @brief  Adds one payload to the result, decoded into dec.
+  * @retval 0, -1 if the decoder refused it
+  */
+static int decode(const Host_SizeTypeDef *size, const uint8_t *payload, uint32_t len, uint8_t *dec,
+                  Host_ResultTypeDef *result)
+{
+  TileDelta_FrameTypeDef frame;
+
+  frame_planes(size, dec, &frame);
+  result->bytes += len;
+  result->frames++;
+  if (TileDelta_Decode(payload, len, &frame, size->width, size->height) != 0)
+  {
+    result->errors++;
+    return -1;
+  }
+  result->keys += ((payload[3] & TILE_DELTA_FLAG_KEY) != 0U) ? 1U : 0U;
+  result->tiles += (uint32_t)payload[12] | ((uint32_t)payload[13] << 8);
+  return 0;
+}
+
+/**
+  * @brief  Encodes a sequence of frames at one threshold and decodes it.
+  * @param  next: fills the source frame n, returns 0 at the end
+  * @retval None
+  */
+static void run(const Host_SizeTypeDef *size, uint8_t threshold, uint16_t key_interval,
+                int (*next)(void *ctx, uint32_t n, uint8_t *src), void *ctx, Host_ResultTypeDef *result)
+{
+  TileDelta_EncoderTypeDef enc;
+  TileDelta_FrameTypeDef src;
+  uint8_t *src_buf = malloc(size->frame_bytes);
+  uint8_t *ref = malloc(size->frame_bytes);
+  uint8_t *dec = calloc(1, size->frame_bytes);
+  uint32_t max = TILE_DELTA_MAX_SIZE(size->width, size->height);
+  uint8_t *out = malloc(max);
+  uint32_t n, len;
+
+  memset(result, 0, sizeof(*result));
+  frame_planes(size, src_buf, &src);
+  TileDelta_Init(&enc, size->width, size->height, ref);
+  enc.threshold = threshold;
+  enc.key_interval = key_interval;
+  for (n = 0U; next(ctx, n, src_buf) != 0; n++)
+  {
+    len = TileDelta_Encode(&enc, &src, out, max);
+    if ((decode(size, out, len, dec, result) == 0) && (memcmp(dec, ref, size->frame_bytes) != 0))
+    {
+      result->errors++;
+    }
+    compare(size, src_buf, dec, result);
+  }
+  free(out);
+  free(dec);
+  free(ref);
+  free(src_buf);
+}
+
+/* Recorded sequence of -i */
+typedef struct
+{
+  FILE                     *f;
+  const Host_SizeTypeDef   *size;
+} Host_FileTypeDef;
+
+static int next_file(void *ctx, uint32_t n, uint8_t *src)
+{
+  Host_FileTypeDef *file = ctx;
+
+  if (n == 0U)
+  {
+    rewind(file->f);
+  }
+  return fread(src, 1, file->size->frame_bytes, file->f) == file->size->frame_bytes;
+}
+
+/**
+  * @brief  Synthetic fixed view: textured background, sensor noise of +-1
+  *         and an object crossing the scene.
+  */
+static int next_synthetic(void *ctx, uint32_t n, uint8_t *src)
+{
+  static uint32_t seed;
+  const Host_SizeTypeDef *size = ctx;
+  uint32_t x, y, v, ox = (n * 3U) % (HOST_SIM_WIDTH - HOST_SIM_OBJECT), oy = 30U;
+  uint8_t *cb = src + size->pixels;
+  uint8_t *cr = cb + (size->pixels / 4U);
+
+  if (n >= HOST_SIM_FRAMES)
+  {
+    return 0;
+  }
+  if (n == 0U)
+  {
+    seed = 1U;
+  }
+  for (y = 0U; y < HOST_SIM_HEIGHT; y++)
+  {
+    for (x = 0U; x < HOST_SIM_WIDTH; x++)
+    {
+      v = 60U + ((x * 5U + y * 3U) & 0x3FU) + (((x >> 3) ^ (y >> 3)) & 1U) * 40U;
+      if ((x >= ox) && (x < (ox + HOST_SIM_OBJECT)) && (y >= oy) && (y < (oy + HOST_SIM_OBJECT)))
+      {
+        v = 220U - ((x - ox) * 2U);
+      }
+      seed = (seed * 1103515245U) + 12345U;
+      v = v + ((seed >> 16) % 3U) - 1U;
+      src[(y * HOST_SIM_WIDTH) + x] = (uint8_t)v;
+    }
+  }
+  for (y = 0U; y < (HOST_SIM_HEIGHT / 2U); y++)
+  {
+    for (x = 0U; x < (HOST_SIM_WIDTH / 2U); x++)
+    {
+      v = ((2U * x) >= ox) && ((2U * x) < (ox + HOST_SIM_OBJECT)) &&
+          ((2U * y) >= oy) && ((2U * y) < (oy + HOST_SIM_OBJECT));
+      cb[(y * (HOST_SIM_WIDTH / 2U)) + x] = (uint8_t)((v != 0U) ? 90U : (128U + (x & 7U)));
+      cr[(y * (HOST_SIM_WIDTH / 2U)) + x] = (uint8_t)((v != 0U) ? 200U : (128U - (y & 7U)));
+    }
+  }
+  return 1;
+}
+
+static uint32_t check(const char *name, int ok)
+{
+  printf("%-44s %s\n", name, ok ? "ok" : "FAIL");
+  return ok ? 0U : 1U;
+}
+
+/**
+  * @brief  Self-test on the synthetic view.
+  * @retval 0 if it passed
+  */
+static int self_test(void)
+{
+  static const uint8_t thresholds[] = {0U, 1U, 2U, 4U, 8U};
+  static uint8_t src_buf[(HOST_SIM_WIDTH * HOST_SIM_HEIGHT * 3U) / 2U];
+  static uint8_t ref[sizeof(src_buf)], dec[sizeof(src_buf)];
+  static uint8_t out[TILE_DELTA_MAX_SIZE(HOST_SIM_WIDTH, HOST_SIM_HEIGHT)];
+  const Host_SizeTypeDef size = {HOST_SIM_WIDTH, HOST_SIM_HEIGHT, HOST_SIM_WIDTH * HOST_SIM_HEIGHT,
+                                 sizeof(src_buf)};
+  Host_ResultTypeDef result;
+  TileDelta_EncoderTypeDef enc;
+  TileDelta_FrameTypeDef src, frame;
+  uint32_t fails = 0U, t, n, len;
+  uint64_t last_bytes = 0U;
+  char name[16];
+  int sync = 1, smaller = 1, keys = 0, ok;
+
+  for (t = 0U; t < (sizeof(thresholds) / sizeof(thresholds[0])); t++)
+  {
+    run(&size, thresholds[t], 20U, next_synthetic, (void *)&size, &result);
+    snprintf(name, sizeof(name), "threshold %u", thresholds[t]);
+    print_result(name, &size, &result);
+    sync = sync && (result.errors == 0U);
+    if (t == 0U)
+    {
+      fails += check("threshold 0 lossless", (result.sse_y == 0.0) && (result.sse_c == 0.0));
+      keys = (result.keys == (HOST_SIM_FRAMES / 20U));
+    }
+    else
+    {
+      smaller = smaller && (result.bytes < last_bytes);
+    }
+    last_bytes = result.bytes;
+  }
+  fails += check("decoder in sync with the encoder", sync);
+  fails += check("higher threshold compresses more", smaller);
+
+  /* a key frame on request, in the middle of the interval */
+  frame_planes(&size, src_buf, &src);
+  frame_planes(&size, dec, &frame);
+  TileDelta_Init(&enc, HOST_SIM_WIDTH, HOST_SIM_HEIGHT, ref);
+  enc.key_interval = 0U;
+  ok = keys;
+  for (n = 0U; n < 10U; n++)
+  {
+    next_synthetic((void *)&size, n, src_buf);
+    if (n == 6U)
+    {
+      TileDelta_ForceKey(&enc);
+    }
+    len = TileDelta_Encode(&enc, &src, out, sizeof(out));
+    ok = ok && (((out[3] & TILE_DELTA_FLAG_KEY) != 0U) == ((n == 0U) || (n == 6U)));
+  }
+  fails += check("key frames at the interval and on request", ok);
+
+  /* payloads the decoder must refuse, the frame shown untouched */
+  memset(dec, 0x5A, sizeof(dec));
+  memcpy(ref, dec, sizeof(dec));
+  ok = (TileDelta_Decode(out, len - 1U, &frame, HOST_SIM_WIDTH, HOST_SIM_HEIGHT) != 0) &&
+       (TileDelta_Decode(out, len + 1U, &frame, HOST_SIM_WIDTH, HOST_SIM_HEIGHT) != 0) &&
+       (TileDelta_Decode(out, 8U, &frame, HOST_SIM_WIDTH, HOST_SIM_HEIGHT) != 0) &&
+       (TileDelta_Decode(out, len, &frame, HOST_SIM_WIDTH - TILE_SIZE, HOST_SIM_HEIGHT) != 0);
+  out[1] = 'X';
+  ok = ok && (TileDelta_Decode(out, len, &frame, HOST_SIM_WIDTH, HOST_SIM_HEIGHT) != 0);
+  out[1] = 'D';
+  out[2] = TILE_DELTA_VERSION + 1U;
+  ok = ok && (TileDelta_Decode(out, len, &frame, HOST_SIM_WIDTH, HOST_SIM_HEIGHT) != 0) &&
+       (memcmp(dec, ref, sizeof(dec)) == 0);
+  fails += check("malformed payloads refused", ok);
+
+  printf("%s\n", (fails != 0U) ? "FAIL" : "PASS");
+  return (fails != 0U) ? -1 : 0;
+}
+
+/**
+  * @brief  Encodes a recorded sequence at each threshold.
+  * @retval 0, -1 on error
+  */
+static int encode_file(const char *path, const Host_SizeTypeDef *size, const uint8_t *thresholds,
+                       uint32_t count, uint16_t key_interval)
+{
+  Host_FileTypeDef file = {fopen(path, "rb"), size};
+  Host_ResultTypeDef result;
+  uint32_t t, errors = 0U;
+  char name[16];
+
+  if (file.f == NULL)
+  {
+    perror(path);
+    return -1;
+  }
+  for (t = 0U; t < count; t++)
+  {
+    run(size, thresholds[t], key_interval, next_file, &file, &result);
+    if (result.frames == 0U)
+    {
+      fprintf(stderr, "%s: no %ux%u frame\n", path, size->width, size->height);
+      fclose(file.f);
+      return -1;
+    }
+    snprintf(name, sizeof(name), "threshold %u", thresholds[t]);
+    print_result(name, size, &result);
+    errors += result.errors;
+  }
+  fclose(file.f);
+  return (errors == 0U) ? 0 : -1;
+}
+
+/**
+  * @brief  Decodes captured payloads, compared with the source if given.
+  * @retval 0, -1 on error
+  */
+static int decode_capture(const char *path, const Host_SizeTypeDef *size, const char *source,
+                          const char *output)
+{
+  FILE *f = fopen(path, "rb");
+  FILE *s = (source != NULL) ? fopen(source, "rb") : NULL;
+  FILE *o = (output != NULL) ? fopen(output, "wb") : NULL;
+  uint32_t max = TILE_DELTA_MAX_SIZE(size->width, size->height);
+  uint32_t bitmap = ((uint32_t)(size->width / TILE_SIZE) * (size->height / TILE_SIZE) + 7U) / 8U;
+  uint8_t *payload = malloc(max);
+  uint8_t *dec = calloc(1, size->frame_bytes);
+  uint8_t *src = malloc(size->frame_bytes);
+  Host_ResultTypeDef result;
+  uint32_t len;
+  int r = 0;
+
+  if ((f == NULL) || ((source != NULL) && (s == NULL)) || ((output != NULL) && (o == NULL)))
+  {
+    perror((f == NULL) ? path : ((s == NULL) && (source != NULL)) ? source : output);
+    r = -1;
+  }
+  memset(&result, 0, sizeof(result));
+  while ((r == 0) && (fread(payload, 1, TILE_DELTA_HEADER_SIZE, f) == TILE_DELTA_HEADER_SIZE))
+  {
+    len = TILE_DELTA_HEADER_SIZE + bitmap + (((uint32_t)payload[12] | ((uint32_t)payload[13] << 8)) * TILE_BYTES);
+    if ((payload[0] != 'T') || (payload[1] != 'D') || (len > max) ||
+        (fread(payload + TILE_DELTA_HEADER_SIZE, 1, len - TILE_DELTA_HEADER_SIZE, f) !=
+         (len - TILE_DELTA_HEADER_SIZE)))
+    {
+      fprintf(stderr, "%s: payload %u is not a %ux%u TDLT payload\n", path, result.frames,
+              size->width, size->height);
+      r = -1;
+      break;
+    }
+    if (decode(size, payload, len, dec, &result) != 0)
+    {
+      fprintf(stderr, "%s: payload %u refused by the decoder\n", path, result.frames - 1U);
+      r = -1;
+      break;
+    }
+    if ((s != NULL) && (fread(src, 1, size->frame_bytes, s) == size->frame_bytes))
+    {
+      compare(size, src, dec, &result);
+    }
+    if (o != NULL)
+    {
+      fwrite(dec, 1, size->frame_bytes, o);
+    }
+  }
+  if (result.frames != 0U)
+  {
+    print_result("capture", size, &result);
+  }
+  if (f != NULL) fclose(f);
+  if (s != NULL) fclose(s);
+  if (o != NULL) fclose(o);
+  free(src);
+  free(dec);
+  free(payload);
+  return r;
+}
+
+static void usage(void)
+{
+  fprintf(stderr,
+          "usage: tile_host -s\n"
+          "       tile_host -i clip.yuv -w width -h height [-t 0,2,4,8] [-k key_interval]\n"
+          "       tile_host -p capture.tdlt -w width -h height [-i clip.yuv] [-o decoded.yuv]\n");
+}
+
+int main(int argc, char **argv)
+{
+  uint8_t thresholds[HOST_THRESHOLDS_MAX] = {0U, 2U, TILE_DELTA_THRESHOLD_DEFAULT, 8U};
+  uint32_t count = 4U, width = 0U, height = 0U;
+  uint16_t key_interval = TILE_DELTA_KEY_INTERVAL_DEFAULT;
+  const char *source = NULL, *capture = NULL, *output = NULL;
+  Host_SizeTypeDef size;
+  char *p;
+  int opt, simulated = 0;
+
+  while ((opt = getopt(argc, argv, "si:p:o:w:h:t:k:")) != -1)
+  {
+    switch (opt)
+    {
+    case 's': simulated = 1; break;
+    case 'i': source = optarg; break;
+    case 'p': capture = optarg; break;
+    case 'o': output = optarg; break;
+    case 'w': width = (uint32_t)strtoul(optarg, NULL, 0); break;
+    case 'h': height = (uint32_t)strtoul(optarg, NULL, 0); break;
+    case 'k': key_interval = (uint16_t)strtoul(optarg, NULL, 0); break;
+    case 't':
+      for (count = 0U, p = optarg; (count < HOST_THRESHOLDS_MAX) && (*p != '\0'); count++)
+      {
+        thresholds[count] = (uint8_t)strtoul(p, &p, 0);
+        p += (*p == ',') ? 1 : 0;
+      }
+      break;
+    default: usage(); return 2;
+    }
+  }
+
+  if (simulated != 0)
+  {
+    return (self_test() == 0) ? 0 : 1;
+  }
+  if (((source == NULL) && (capture == NULL)) || (count == 0U) ||
+      (width == 0U) || (height == 0U) || ((width % TILE_SIZE) != 0U) || ((height % TILE_SIZE) != 0U) ||
+      (width > 0xFFFFU) || (height > 0xFFFFU))
+  {
+    usage();
+    return 2;
+  }
+  size.width = (uint16_t)width;
+  size.height = (uint16_t)height;
+  size.pixels = width * height;
+  size.frame_bytes = (size.pixels * 3U) / 2U;
+  if (capture != NULL)
+  {
+    return (decode_capture(capture, &size, source, output) == 0) ? 0 : 1;
+  }
+  return (encode_file(source, &size, thresholds, count, key_interval) == 0) ? 0 : 1;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
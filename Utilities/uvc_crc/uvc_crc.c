@@ -0,0 +1,607 @@
+/**
+  ******************************************************************************
+  * @file    uvc_crc.c
+  * @brief   Host tool: corrupted and dropped frames of the camera, from the
+  *          frame CRC of the UVC payload headers.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                 UVC CRC tool
+  *          ===================================================================
+  *           With XU_ROI_FRAME_CRC_CONTROL on, every payload of a frame ends
+  *           its header with a frame CRC block: dwFrameNumber, then the
+  *           CRC-32/MPEG-2 of the frame data from the first payload to the
+  *           end of this one. The uvcvideo metadata node only keeps the
+  *           standard header fields, so the tool reads the isochronous
+  *           payloads themselves from a usbmon capture:
+  *             tcpdump -i usbmonN -w capture.pcap   (link type 220)
+  *           Per stream (IN endpoint) it follows the frames by FID and EOF,
+  *           runs the same CRC over the received data and compares it with
+  *           each block:
+  *             - corrupted: a CRC differs although every payload arrived,
+  *             - incomplete: a payload was lost, the controller reported an
+  *               error on its isochronous packet,
+  *             - dropped: dwFrameNumber skips frames the device numbered,
+  *               none of their payloads arrived.
+  *           The first payload whose CRC differs locates the damage.
+  *
+  *           Build, from the repository root:
+  *             cc -O2 -IInc -o uvc_crc Utilities/uvc_crc/uvc_crc.c
+  *                Src/frame_crc.c Src/codec_tables.c
+  *           Usage: uvc_crc -d /dev/video0 [-o 0|1]
+  *                  uvc_crc -p capture.pcap [-e endpoint] [-v]
+  *                  uvc_crc -s frames [-v]
+  *           -d turns the frame CRC of the camera on (or off with -o 0), -s
+  *           runs two interleaved simulated streams through the firmware
+  *           CRC code, with a model of the CRC unit, injects corrupted,
+  *           lost and dropped frames and checks that each one is found.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "frame_crc.h"
+
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <linux/usb/video.h>
+#include <linux/uvcvideo.h>
+#endif
+
+/* Same values as usbd_uvc.h */
+#define UVC_ID_EXTENSION_UNIT           4U
+#define XU_ROI_FRAME_CRC_CONTROL        0x07U
+#define UVC_HEADER_FID                  0x01U
+#define UVC_HEADER_EOF                  0x02U
+#define UVC_HEADER_PTS                  0x04U
+#define UVC_HEADER_SCR                  0x08U
+#define UVC_HEADER_EOH                  0x80U
+#define UVC_HEADER_CRC_LEN              8U
+
+/* pcap file with the usbmon binary header (LINKTYPE_USB_LINUX_MMAPPED) */
+#define PCAP_HEADER                     24U
+#define PCAP_RECORD                     16U
+#define PCAP_LINK_USB_MMAPPED           220U
+#define USBMON_HEADER                   64U
+#define USBMON_ISO_DESC                 16U
+#define USBMON_XFER_ISO                 0U
+
+#define MAX_STREAMS                     16U
+#define MAX_PAYLOAD                     1023U
+
+typedef struct
+{
+  uint8_t   ep;
+  uint8_t   in_frame;      /* a frame is open */
+  uint8_t   fid;
+  uint8_t   has_block;     /* the frame carries frame CRC blocks */
+  uint8_t   lost;          /* a payload of the frame was lost */
+  uint8_t   gap;           /* a payload was lost since the last one received */
+  uint8_t   after_gap;     /* the frame opened after a lost payload */
+  uint8_t   corrupt;       /* a CRC of the frame differed */
+  uint8_t   number_known;
+  uint32_t  number;        /* dwFrameNumber of the frame */
+  uint32_t  last_number;   /* of the last frame with a block */
+  uint32_t  crc;           /* over the data received */
+  uint32_t  payloads;
+  uint32_t  bad_payload;   /* first payload with a different CRC */
+  uint32_t  bytes;
+  /* totals */
+  uint32_t  frames;
+  uint32_t  good;
+  uint32_t  corrupted;
+  uint32_t  incomplete;
+  uint32_t  unchecked;     /* no frame CRC block */
+  uint32_t  dropped;
+  uint32_t  errors;        /* payloads with an isochronous error */
+} Stream;
+
+static Stream streams[MAX_STREAMS];
+static uint32_t stream_count;
+static int verbose;
+
+static uint32_t get32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+static Stream *stream_of(uint8_t ep)
+{
+  uint32_t i;
+
+  for (i = 0U; i < stream_count; i++)
+  {
+    if (streams[i].ep == ep)
+    {
+      return &streams[i];
+    }
+  }
+  if (stream_count == MAX_STREAMS)
+  {
+    return NULL;
+  }
+  memset(&streams[stream_count], 0, sizeof(Stream));
+  streams[stream_count].ep = ep;
+  return &streams[stream_count++];
+}
+
+/**
+  * @brief  Closes the open frame of a stream and counts it.
+  * @param  s: stream
+  * @param  eof: 1 if its last payload had the EOF bit
+  * @retval None
+  */
+static void frame_end(Stream *s, int eof)
+{
+  const char *verdict;
+
+  if (s->in_frame == 0U)
+  {
+    return;
+  }
+  s->in_frame = 0U;
+  s->frames++;
+  if (s->has_block == 0U)
+  {
+    s->unchecked++;
+    verdict = "no CRC";
+  }
+  else if ((s->lost != 0U) || ((s->corrupt != 0U) && (s->after_gap != 0U)))
+  {
+    /* a frame whose first payloads were lost differs from the start */
+    s->incomplete++;
+    verdict = "incomplete";
+  }
+  else if (s->corrupt != 0U)
+  {
+    s->corrupted++;
+    verdict = "CORRUPTED";
+  }
+  else
+  {
+    s->good++;
+    verdict = "ok";
+  }
+  if ((verbose != 0) || ((s->corrupt != 0U) && (s->lost == 0U) && (s->after_gap == 0U)))
+  {
+    printf("ep 0x%02X frame %6u: %u payloads, %u bytes, %s%s", s->ep, s->number,
+           s->payloads, s->bytes, verdict, (eof != 0) ? "" : ", no EOF");
+    if (s->corrupt != 0U)
+    {
+      printf(", CRC differs from payload %u", s->bad_payload);
+    }
+    printf("\n");
+  }
+}
+
+/**
+  * @brief  Analyses one isochronous payload.
+  * @param  ep: IN endpoint address
+  * @param  status: status of the isochronous packet, 0 if received
+  * @param  p: payload, header and data
+  * @param  len: payload length
+  * @retval None
+  */
+static void payload(uint8_t ep, int32_t status, const uint8_t *p, uint32_t len)
+{
+  Stream *s = stream_of(ep);
+  uint32_t hlen, std = 2U, number = 0U, crc = 0U;
+  uint8_t info, fid, block = 0U;
+
+  if (s == NULL)
+  {
+    return;
+  }
+  if (status != 0)
+  {
+    /* the data of this payload is gone: it belonged to the open frame or
+       to the first payloads of the next one */
+    s->errors++;
+    s->gap = 1U;
+    if (s->in_frame != 0U)
+    {
+      s->lost = 1U;
+    }
+    return;
+  }
+  if (len < 2U)
+  {
+    return;
+  }
+  hlen = p[0];
+  info = p[1];
+  if ((hlen < 2U) || (hlen > len))
+  {
+    if (s->in_frame != 0U)
+    {
+      s->lost = 1U;
+    }
+    return;
+  }
+  std += ((info & UVC_HEADER_PTS) != 0U) ? 4U : 0U;
+  std += ((info & UVC_HEADER_SCR) != 0U) ? 6U : 0U;
+  if (hlen >= (std + UVC_HEADER_CRC_LEN))
+  {
+    block = 1U;
+    number = get32(&p[std]);
+    crc = get32(&p[std + 4U]);
+  }
+  if ((hlen == len) && (block == 0U))
+  {
+    /* empty payload of a skipped frame interval */
+    return;
+  }
+
+  fid = info & UVC_HEADER_FID;
+  if ((s->in_frame != 0U) && ((fid != s->fid) || ((block != 0U) && (number != s->number))))
+  {
+    frame_end(s, 0);
+  }
+  if (s->in_frame == 0U)
+  {
+    s->in_frame = 1U;
+    s->fid = fid;
+    s->has_block = block;
+    s->lost = 0U;
+    s->after_gap = s->gap;
+    s->corrupt = 0U;
+    s->number = number;
+    s->crc = FRAME_CRC_INIT;
+    s->payloads = 0U;
+    s->bytes = 0U;
+    if (block != 0U)
+    {
+      if ((s->number_known != 0U) && ((uint32_t)(number - s->last_number) > 1U) &&
+          ((uint32_t)(number - s->last_number) < 0x80000000U))
+      {
+        s->dropped += number - s->last_number - 1U;
+        if (verbose != 0)
+        {
+          printf("ep 0x%02X frames %u to %u dropped\n", s->ep, s->last_number + 1U, number - 1U);
+        }
+      }
+      s->last_number = number;
+      s->number_known = 1U;
+    }
+  }
+
+  s->gap = 0U;
+  s->crc = FrameCrc_Software(s->crc, &p[hlen], len - hlen);
+  s->bytes += len - hlen;
+  if ((block != 0U) && (s->crc != crc) && (s->corrupt == 0U))
+  {
+    s->corrupt = 1U;
+    s->bad_payload = s->payloads;
+  }
+  s->payloads++;
+  if ((info & UVC_HEADER_EOF) != 0U)
+  {
+    frame_end(s, 1);
+  }
+}
+
+/**
+  * @brief  Prints the totals of each stream.
+  * @retval number of frames found damaged or dropped
+  */
+static uint32_t report(void)
+{
+  uint32_t i, bad = 0U;
+
+  if (stream_count == 0U)
+  {
+    printf("no isochronous IN payload found\n");
+    return 0U;
+  }
+  for (i = 0U; i < stream_count; i++)
+  {
+    Stream *s = &streams[i];
+
+    frame_end(s, 0);
+    printf("ep 0x%02X: %u frames, %u ok, %u corrupted, %u incomplete, %u dropped, %u without CRC, "
+           "%u payload errors\n", s->ep, s->frames, s->good, s->corrupted, s->incomplete,
+           s->dropped, s->unchecked, s->errors);
+    bad += s->corrupted + s->incomplete + s->dropped;
+  }
+  return bad;
+}
+
+/**
+  * @brief  Reads the isochronous IN completions of a usbmon capture.
+  * @param  path: pcap file
+  * @param  ep: endpoint address to keep, 0 for all
+  * @retval 0 on success
+  */
+static int read_pcap(const char *path, uint8_t ep)
+{
+  uint8_t hdr[PCAP_HEADER], rec[PCAP_RECORD];
+  uint8_t *buf;
+  uint32_t size, magic, n, ndesc, data;
+  FILE *f = fopen(path, "rb");
+
+  if (f == NULL)
+  {
+    perror(path);
+    return -1;
+  }
+  if (fread(hdr, 1, sizeof(hdr), f) != sizeof(hdr))
+  {
+    fprintf(stderr, "%s: not a pcap file\n", path);
+    fclose(f);
+    return -1;
+  }
+  magic = get32(hdr);
+  if ((magic != 0xA1B2C3D4U) && (magic != 0xA1B23C4DU))
+  {
+    fprintf(stderr, "%s: not a little endian pcap file (pcapng: convert with editcap -F pcap)\n", path);
+    fclose(f);
+    return -1;
+  }
+  if (get32(&hdr[20]) != PCAP_LINK_USB_MMAPPED)
+  {
+    fprintf(stderr, "%s: link type %u, a usbmon capture with isochronous descriptors (220) is needed\n",
+            path, get32(&hdr[20]));
+    fclose(f);
+    return -1;
+  }
+  buf = malloc(get32(&hdr[16]) + USBMON_HEADER);
+  if (buf == NULL)
+  {
+    perror("malloc");
+    fclose(f);
+    return -1;
+  }
+
+  while (fread(rec, 1, sizeof(rec), f) == sizeof(rec))
+  {
+    size = get32(&rec[8]);
+    if ((size > (get32(&hdr[16]) + USBMON_HEADER)) || (fread(buf, 1, size, f) != size))
+    {
+      fprintf(stderr, "%s: truncated record\n", path);
+      break;
+    }
+    /* completions of isochronous IN transfers */
+    if ((size < USBMON_HEADER) || (buf[8] != 'C') || (buf[9] != USBMON_XFER_ISO) ||
+        ((buf[10] & 0x80U) == 0U) || ((ep != 0U) && (buf[10] != ep)))
+    {
+      continue;
+    }
+    ndesc = get32(&buf[60]);
+    data = USBMON_HEADER + (ndesc * USBMON_ISO_DESC);
+    if (data > size)
+    {
+      continue;
+    }
+    for (n = 0U; n < ndesc; n++)
+    {
+      const uint8_t *d = &buf[USBMON_HEADER + (n * USBMON_ISO_DESC)];
+      int32_t status = (int32_t)get32(d);
+      uint32_t off = get32(&d[4]), len = get32(&d[8]);
+
+      if ((status == 0) && (len == 0U))
+      {
+        continue;
+      }
+      if ((data + off + len) > size)
+      {
+        /* cut by the snapshot length */
+        status = -1;
+        len = 0U;
+      }
+      payload(buf[10], status, &buf[data + off], len);
+    }
+  }
+  free(buf);
+  fclose(f);
+  return 0;
+}
+
+/**
+  * @brief  Builds the payloads of one frame as the firmware does.
+  * @param  ep: endpoint
+  * @param  number: dwFrameNumber
+  * @param  probe: 1 to add PTS and SCR, as in latency probe mode
+  * @param  packet: payload size
+  * @param  damage: 0 none, 1 flip a data bit, 2 lose a payload
+  * @retval None
+  */
+static void simulate_frame(uint8_t ep, uint32_t number, uint8_t probe, uint32_t packet, int damage)
+{
+  static uint8_t frame[40000];
+  static uint8_t fid[2];
+  uint8_t p[MAX_PAYLOAD];
+  uint32_t len = 20000U + (uint32_t)(rand() % 20000), pos = 0U, k = 0U, hlen, n, i;
+  uint32_t crc = FRAME_CRC_INIT;
+  uint32_t victim = (uint32_t)rand() % 8U;
+  uint8_t *f = &fid[ep & 1U];
+
+  for (i = 0U; i < len; i++)
+  {
+    frame[i] = (uint8_t)rand();
+  }
+  *f ^= UVC_HEADER_FID;
+  while (pos < len)
+  {
+    hlen = 2U + ((probe != 0U) ? 10U : 0U) + UVC_HEADER_CRC_LEN;
+    n = ((len - pos) < (packet - hlen)) ? (len - pos) : (packet - hlen);
+    p[0] = (uint8_t)hlen;
+    p[1] = (uint8_t)(*f | UVC_HEADER_EOH | (((pos + n) == len) ? UVC_HEADER_EOF : 0U) |
+                     ((probe != 0U) ? (UVC_HEADER_PTS | UVC_HEADER_SCR) : 0U));
+    memset(&p[2], 0, hlen - 2U);
+    put32(&p[hlen - UVC_HEADER_CRC_LEN], number);
+    memcpy(&p[hlen], &frame[pos], n);
+    crc = FrameCrc_Update(crc, &p[hlen], n);
+    put32(&p[hlen - 4U], crc);
+    pos += n;
+    if ((damage == 1) && (k == victim))
+    {
+      /* the bus CRC let a bit through */
+      p[hlen + (n / 2U)] ^= 0x10U;
+    }
+    payload(ep, ((damage == 2) && (k == victim)) ? -71 : 0, p, hlen + n);
+    k++;
+  }
+}
+
+/**
+  * @brief  Two interleaved streams with injected faults.
+  * @param  count: frames per stream
+  * @retval 0 if every fault is found and nothing else
+  */
+static int simulate(uint32_t count)
+{
+  uint32_t n, e, expect[2][3] = {{0U}}, fails = 0U;
+  int damage;
+
+  srand(1);
+  FrameCrc_Init();
+  for (n = 1U; n <= count; n++)
+  {
+    for (e = 0U; e < 2U; e++)
+    {
+      uint32_t number = n + (e * 1000U);
+
+      if (((n % 13U) == (5U + e)) && (n < count))
+      {
+        expect[e][2]++;            /* never sent, found from the next frame */
+        continue;
+      }
+      damage = ((n % 7U) == (3U + e)) ? 1 : (((n % 11U) == (2U + e)) ? 2 : 0);
+      if (damage != 0)
+      {
+        expect[e][damage - 1]++;
+      }
+      simulate_frame((uint8_t)(0x81U + e), number, (uint8_t)e, (e == 0U) ? 448U : 1022U, damage);
+    }
+  }
+  report();
+  for (e = 0U; e < 2U; e++)
+  {
+    Stream *s = stream_of((uint8_t)(0x81U + e));
+
+    if ((s->corrupted != expect[e][0]) || (s->incomplete != expect[e][1]) ||
+        (s->dropped != expect[e][2]) || (s->unchecked != 0U))
+    {
+      printf("ep 0x%02X: %u corrupted, %u incomplete, %u dropped expected\n", s->ep,
+             expect[e][0], expect[e][1], expect[e][2]);
+      fails++;
+    }
+  }
+  printf("%s\n", (fails != 0U) ? "FAIL" : "PASS");
+  return (fails != 0U) ? -1 : 0;
+}
+
+#ifdef __linux__
+/**
+  * @brief  Sets XU_ROI_FRAME_CRC_CONTROL.
+  * @retval 0 on success
+  */
+static int set_frame_crc(const char *video, uint8_t enable)
+{
+  struct uvc_xu_control_query q;
+  int fd = open(video, O_RDWR), r;
+
+  if (fd < 0)
+  {
+    perror(video);
+    return -1;
+  }
+  memset(&q, 0, sizeof(q));
+  q.unit = UVC_ID_EXTENSION_UNIT;
+  q.selector = XU_ROI_FRAME_CRC_CONTROL;
+  q.query = UVC_SET_CUR;
+  q.size = 1;
+  q.data = &enable;
+  do
+  {
+    r = ioctl(fd, UVCIOC_CTRL_QUERY, &q);
+  } while ((r < 0) && (errno == EINTR));
+  if (r < 0)
+  {
+    perror("frame CRC control");
+  }
+  close(fd);
+  return r;
+}
+#endif
+
+static void usage(void)
+{
+  fprintf(stderr,
+          "usage: uvc_crc -d video_node [-o 0|1]\n"
+          "       uvc_crc -p capture.pcap [-e endpoint] [-v]\n"
+          "       uvc_crc -s frames [-v]\n");
+}
+
+int main(int argc, char **argv)
+{
+  const char *video = NULL, *capture = NULL;
+  uint32_t simulated = 0U;
+  uint8_t ep = 0U, enable = 1U;
+  int opt, r;
+
+  while ((opt = getopt(argc, argv, "d:o:p:e:s:v")) != -1)
+  {
+    switch (opt)
+    {
+    case 'd': video = optarg; break;
+    case 'o': enable = (uint8_t)strtoul(optarg, NULL, 0); break;
+    case 'p': capture = optarg; break;
+    case 'e': ep = (uint8_t)strtoul(optarg, NULL, 0); break;
+    case 's': simulated = (uint32_t)strtoul(optarg, NULL, 0); break;
+    case 'v': verbose = 1; break;
+    default: usage(); return 2;
+    }
+  }
+
+  if (simulated != 0U)
+  {
+    return (simulate(simulated) == 0) ? 0 : 1;
+  }
+#ifdef __linux__
+  if (video != NULL)
+  {
+    return (set_frame_crc(video, enable) == 0) ? 0 : 1;
+  }
+#else
+  (void)video;
+  (void)enable;
+#endif
+  if (capture == NULL)
+  {
+    usage();
+    return 2;
+  }
+  r = read_pcap(capture, ep);
+  if (r != 0)
+  {
+    return 1;
+  }
+  return (report() != 0U) ? 1 : 0;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
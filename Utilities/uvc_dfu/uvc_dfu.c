@@ -0,0 +1,529 @@
+/**
+  ******************************************************************************
+  * @file    uvc_dfu.c
+  * @brief   Host tool: firmware update of the camera over its DFU runtime
+  *          interface, while it streams.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                UVC DFU tool
+  *          ===================================================================
+  *           The camera takes a new image on the DFU interface after its
+  *           UVC functions without leaving runtime mode: uvcvideo keeps the
+  *           video interfaces, the tool claims the DFU one through usbfs.
+  *           The image is the .bin of the firmware, padded to a word with
+  *           0xFF, followed by its CRC-32/MPEG-2. The tool:
+  *             - sends it in DFU_DNLOAD blocks of wTransferSize bytes, and
+  *               polls DFU_GETSTATUS after each one. The device answers
+  *               dfuDNLOAD-IDLE at once while it has a free buffer, the
+  *               next block follows without waiting for the flash,
+  *               dfuDNBUSY with a poll timeout while a sector is erased,
+  *             - ends with a zero length DFU_DNLOAD, then polls through
+  *               dfuMANIFEST until the device has checked the image back in
+  *               dfuIDLE,
+  *             - with -r, sends DFU_DETACH: the device boots the other bank.
+  *           A device that refused the image stays in dfuERROR with the
+  *           reason in bStatus, the next run clears it.
+  *
+  *           Build, from the repository root:
+  *             cc -O2 -IInc -o uvc_dfu Utilities/uvc_dfu/uvc_dfu.c
+  *                Src/dfu.c Src/frame_crc.c Src/codec_tables.c
+  *           Usage: uvc_dfu -d /dev/bus/usb/BBB/DDD -f image.bin [-i itf] [-r]
+  *                  uvc_dfu -s
+  *           -s runs the firmware update code against a model of the flash
+  *           bank and its timings, with a host sending at the pace of the
+  *           poll timeouts, checks the programmed bank, the refused
+  *           images and that the flash is locked again after each one, and
+  *           prints the time a transfer takes.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "dfu.h"
+#include "frame_crc.h"
+
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/time.h>
+#include <linux/usbdevice_fs.h>
+#endif
+
+/* Same value as usbd_uvc.h, with two UVC functions */
+#define USB_DFU_IF_NUM                  4U
+
+/* bmRequestType of the DFU class requests to an interface */
+#define DFU_REQ_OUT                     0x21U
+#define DFU_REQ_IN                      0xA1U
+
+/* Time a DFU_DNLOAD block and its DFU_GETSTATUS take on the bus, model */
+#define SIM_BLOCK_US                    2000U
+
+static const char *state_name(uint8_t state)
+{
+  static const char *names[] =
+  {
+    "appIDLE", "appDETACH", "dfuIDLE", "dfuDNLOAD-SYNC", "dfuDNBUSY", "dfuDNLOAD-IDLE",
+    "dfuMANIFEST-SYNC", "dfuMANIFEST", "dfuMANIFEST-WAIT-RESET", "dfuUPLOAD-IDLE", "dfuERROR"
+  };
+  return (state < (sizeof(names) / sizeof(names[0]))) ? names[state] : "?";
+}
+
+/**
+  * @brief  Pads an image to a word and appends its CRC.
+  * @param  data: image, room for 3 + DFU_CRC_LEN more bytes
+  * @param  len: image length
+  * @retval length to send
+  */
+static uint32_t seal_image(uint8_t *data, uint32_t len)
+{
+  uint32_t crc;
+
+  while ((len % 4U) != 0U)
+  {
+    data[len++] = 0xFFU;
+  }
+  crc = FrameCrc_Software(FRAME_CRC_INIT, data, len);
+  data[len++] = (uint8_t)crc;
+  data[len++] = (uint8_t)(crc >> 8);
+  data[len++] = (uint8_t)(crc >> 16);
+  data[len++] = (uint8_t)(crc >> 24);
+  return len;
+}
+
+/**
+  * @brief  A simulated host request to the firmware code.
+  * @retval length of the data, -1 if the request stalls
+  */
+static int32_t sim_request(uint8_t request, uint16_t value, uint8_t *data, uint16_t length)
+{
+  uint8_t *buf = NULL;
+  int32_t len = Dfu_Request(request, value, length, &buf);
+
+  if (len < 0)
+  {
+    return -1;
+  }
+  if ((request == DFU_DNLOAD) && (length != 0U))
+  {
+    memcpy(buf, data, length);
+    Dfu_DataReceived();
+  }
+  else if ((len > 0) && (data != NULL))
+  {
+    memcpy(data, buf, (size_t)len);
+  }
+  return len;
+}
+
+/**
+  * @brief  Sends an image to the firmware code, with the flash interrupts
+  *         and the main loop it would get, on a simulated clock.
+  * @param  image: sealed image
+  * @param  len: its length
+  * @param  abort_at: block after which the host aborts and starts again, 0
+  *         for none
+  * @param  us: set to the simulated time
+  * @retval final bState, dfuIDLE once the image is checked
+  */
+static uint8_t sim_download(const uint8_t *image, uint32_t len, uint32_t abort_at, uint64_t *us)
+{
+  uint8_t status[DFU_STATUS_LEN];
+  uint64_t now = 0U, usb_next = 0U, flash_end = 0U;
+  uint32_t sent = 0U, busy, chunk;
+  uint16_t block = 0U;
+  int manifest = 0;
+
+  status[4] = Dfu_GetState();
+  if (status[4] == DFU_STATE_ERROR)
+  {
+    sim_request(DFU_CLRSTATUS, 0U, NULL, 0U);
+  }
+  for (;;)
+  {
+    busy = Dfu_HostBusyUs();
+    if ((busy != 0U) && (flash_end <= usb_next))
+    {
+      /* end of the flash operation, the interrupt starts the next one */
+      now = flash_end;
+      Dfu_FlashIrq();
+      flash_end = now + Dfu_HostBusyUs();
+      continue;
+    }
+    now = usb_next;
+    (void)Dfu_Process();
+
+    if ((status[4] == DFU_STATE_DNBUSY) || (manifest != 0))
+    {
+      /* only polls until the device takes a block again */
+    }
+    else if (sent == len)
+    {
+      if (sim_request(DFU_DNLOAD, block, NULL, 0U) < 0)
+      {
+        break;
+      }
+      manifest = 1;
+    }
+    else
+    {
+      chunk = ((len - sent) < DFU_TRANSFER_SIZE) ? (len - sent) : DFU_TRANSFER_SIZE;
+      if (sim_request(DFU_DNLOAD, block, (uint8_t *)&image[sent], (uint16_t)chunk) < 0)
+      {
+        break;
+      }
+      sent += chunk;
+      block++;
+      if ((abort_at != 0U) && (block == abort_at))
+      {
+        sim_request(DFU_ABORT, 0U, NULL, 0U);
+        abort_at = 0U;
+        sent = 0U;
+        block = 0U;
+      }
+    }
+    /* the pended flash interrupt, when the flash is idle */
+    if (Dfu_HostBusyUs() == 0U)
+    {
+      Dfu_FlashIrq();
+      flash_end = now + Dfu_HostBusyUs();
+    }
+
+    sim_request(DFU_GETSTATUS, 0U, status, DFU_STATUS_LEN);
+    if ((status[4] == DFU_STATE_ERROR) || ((manifest != 0) && (status[4] == DFU_STATE_IDLE)))
+    {
+      break;
+    }
+    usb_next = now + SIM_BLOCK_US + (((uint32_t)status[1] | ((uint32_t)status[2] << 8)) * 1000U);
+  }
+  *us = now;
+  return Dfu_GetState();
+}
+
+/**
+  * @brief  Firmware update of a 300 KB image, and of images the device
+  *         must refuse.
+  * @retval 0 if each one ends as it should
+  */
+static int simulate(void)
+{
+  static uint8_t image[DFU_BANK_SIZE];
+  uint32_t len = 300U * 1024U + 2U, n, fails = 0U, seed = 1U;
+  uint64_t us;
+  uint8_t state, status[DFU_STATUS_LEN];
+
+  for (n = 0U; n < len; n++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    image[n] = (uint8_t)(seed >> 16);
+  }
+  memset(&image[4096], 0xFF, 8192);        /* erased words are skipped */
+  image[0] = 0x00; image[1] = 0x00; image[2] = 0x03; image[3] = 0x20;   /* stack 0x20030000 */
+  image[4] = 0x89; image[5] = 0x01; image[6] = 0x00; image[7] = 0x08;   /* reset 0x08000189 */
+  len = seal_image(image, len);
+
+  Dfu_Init();
+  memset(Dfu_HostBank(), 0x5A, DFU_BANK_SIZE);   /* what an older image left */
+  state = sim_download(image, len, 0U, &us);
+  printf("image %u bytes: %s in %.2f s simulated\n", len, state_name(state), us / 1e6);
+  if ((state != DFU_STATE_IDLE) || (memcmp(Dfu_HostBank(), image, len) != 0) || (Dfu_HostLocked() == 0U))
+  {
+    fails++;
+  }
+  sim_request(DFU_DETACH, 0U, NULL, 0U);
+  (void)Dfu_Process();
+  printf("detach: %u reset into the other bank\n", Dfu_HostResets());
+  if (Dfu_HostResets() != 1U)
+  {
+    fails++;
+  }
+
+  /* aborted after 40 blocks, then sent again in full */
+  state = sim_download(image, len, 40U, &us);
+  printf("aborted and sent again: %s in %.2f s simulated\n", state_name(state), us / 1e6);
+  if ((state != DFU_STATE_IDLE) || (memcmp(Dfu_HostBank(), image, len) != 0) || (Dfu_HostLocked() == 0U))
+  {
+    fails++;
+  }
+
+  /* a flipped bit: the CRC differs */
+  image[70000] ^= 0x10U;
+  state = sim_download(image, len, 0U, &us);
+  sim_request(DFU_GETSTATUS, 0U, status, DFU_STATUS_LEN);
+  printf("corrupted: %s status %u\n", state_name(state), status[0]);
+  if ((state != DFU_STATE_ERROR) || (status[0] != DFU_STATUS_ERR_VERIFY) || (Dfu_HostLocked() == 0U))
+  {
+    fails++;
+  }
+  image[70000] ^= 0x10U;
+
+  /* a valid CRC over an image with its stack in CCM RAM: the boot loader
+     would not start it */
+  len -= DFU_CRC_LEN;
+  image[3] = 0x10;
+  len = seal_image(image, len);
+  state = sim_download(image, len, 0U, &us);
+  sim_request(DFU_GETSTATUS, 0U, status, DFU_STATUS_LEN);
+  printf("stack in CCM: %s status %u\n", state_name(state), status[0]);
+  if ((state != DFU_STATE_ERROR) || (status[0] != DFU_STATUS_ERR_FIRMWARE))
+  {
+    fails++;
+  }
+  if (sim_request(DFU_DETACH, 0U, NULL, 0U) >= 0)
+  {
+    fails++;                               /* nothing to boot */
+  }
+
+  /* aborted while a sector is erased: the flash is locked once the erase
+     is over, not during it */
+  sim_request(DFU_CLRSTATUS, 0U, NULL, 0U);
+  sim_request(DFU_DNLOAD, 0U, image, DFU_TRANSFER_SIZE);
+  Dfu_FlashIrq();
+  sim_request(DFU_ABORT, 0U, NULL, 0U);
+  n = ((Dfu_HostBusyUs() != 0U) && (Dfu_HostLocked() == 0U)) ? 1U : 0U;
+  Dfu_FlashIrq();
+  printf("aborted during an erase: flash %s\n", (Dfu_HostLocked() != 0U) ? "locked" : "unlocked");
+  if ((n == 0U) || (Dfu_HostLocked() == 0U))
+  {
+    fails++;
+  }
+
+  /* a block out of sequence */
+  sim_request(DFU_DNLOAD, 0U, image, DFU_TRANSFER_SIZE);
+  if ((sim_request(DFU_DNLOAD, 2U, image, DFU_TRANSFER_SIZE) >= 0) || (Dfu_HostLocked() == 0U))
+  {
+    fails++;
+  }
+  printf("block out of sequence: %s\n", state_name(Dfu_GetState()));
+  printf("%s\n", (fails != 0U) ? "FAIL" : "PASS");
+  return (fails != 0U) ? -1 : 0;
+}
+
+#ifdef __linux__
+/**
+  * @brief  Control request to the DFU interface.
+  * @retval length transferred, -1 on error or stall
+  */
+static int dfu_control(int fd, uint8_t itf, uint8_t type, uint8_t request, uint16_t value,
+                       uint8_t *data, uint16_t length)
+{
+  struct usbdevfs_ctrltransfer ctrl;
+  int r;
+
+  memset(&ctrl, 0, sizeof(ctrl));
+  ctrl.bRequestType = type;
+  ctrl.bRequest = request;
+  ctrl.wValue = value;
+  ctrl.wIndex = itf;
+  ctrl.wLength = length;
+  ctrl.timeout = 5000U;
+  ctrl.data = data;
+  do
+  {
+    r = ioctl(fd, USBDEVFS_CONTROL, &ctrl);
+  } while ((r < 0) && (errno == EINTR));
+  return r;
+}
+
+/**
+  * @brief  DFU_GETSTATUS, then waits for its poll timeout.
+  * @retval bState, or -1
+  */
+static int dfu_status(int fd, uint8_t itf, uint8_t *status)
+{
+  uint32_t poll;
+
+  if (dfu_control(fd, itf, DFU_REQ_IN, DFU_GETSTATUS, 0U, status, DFU_STATUS_LEN) != (int)DFU_STATUS_LEN)
+  {
+    perror("DFU_GETSTATUS");
+    return -1;
+  }
+  poll = (uint32_t)status[1] | ((uint32_t)status[2] << 8) | ((uint32_t)status[3] << 16);
+  if (poll != 0U)
+  {
+    usleep(poll * 1000U);
+  }
+  return status[4];
+}
+
+/**
+  * @brief  Sends an image to a camera.
+  * @param  node: usbfs node of the camera
+  * @param  itf: DFU interface number
+  * @param  file: firmware .bin
+  * @param  detach: 1 to boot it once checked
+  * @retval 0 on success
+  */
+static int update(const char *node, uint8_t itf, const char *file, int detach)
+{
+  static uint8_t image[DFU_BANK_SIZE + 8U];
+  uint8_t status[DFU_STATUS_LEN];
+  struct timeval t0, t1;
+  uint32_t len, sent = 0U, chunk;
+  uint16_t block = 0U;
+  unsigned int claim = itf;
+  int fd, state, ret = -1;
+  FILE *f = fopen(file, "rb");
+
+  if (f == NULL)
+  {
+    perror(file);
+    return -1;
+  }
+  len = (uint32_t)fread(image, 1, DFU_BANK_SIZE + 1U, f);
+  fclose(f);
+  if ((len + 3U + DFU_CRC_LEN) > DFU_BANK_SIZE)
+  {
+    fprintf(stderr, "%s: larger than a flash bank\n", file);
+    return -1;
+  }
+  len = seal_image(image, len);
+
+  fd = open(node, O_RDWR);
+  if (fd < 0)
+  {
+    perror(node);
+    return -1;
+  }
+  if (ioctl(fd, USBDEVFS_CLAIMINTERFACE, &claim) < 0)
+  {
+    perror("claim DFU interface");
+    close(fd);
+    return -1;
+  }
+
+  state = dfu_status(fd, itf, status);
+  if (state == DFU_STATE_ERROR)
+  {
+    dfu_control(fd, itf, DFU_REQ_OUT, DFU_CLRSTATUS, 0U, NULL, 0U);
+  }
+  else if ((state != DFU_STATE_APP_IDLE) && (state != DFU_STATE_IDLE))
+  {
+    dfu_control(fd, itf, DFU_REQ_OUT, DFU_ABORT, 0U, NULL, 0U);
+  }
+
+  gettimeofday(&t0, NULL);
+  for (;;)
+  {
+    chunk = ((len - sent) < DFU_TRANSFER_SIZE) ? (len - sent) : DFU_TRANSFER_SIZE;
+    if (dfu_control(fd, itf, DFU_REQ_OUT, DFU_DNLOAD, block, &image[sent], (uint16_t)chunk) < 0)
+    {
+      perror("DFU_DNLOAD");
+      break;
+    }
+    do
+    {
+      state = dfu_status(fd, itf, status);
+    } while ((state == DFU_STATE_DNBUSY) || (state == DFU_STATE_MANIFEST) ||
+             (state == DFU_STATE_MANIFEST_SYNC));
+    if (state != (int)((chunk != 0U) ? DFU_STATE_DNLOAD_IDLE : DFU_STATE_IDLE))
+    {
+      fprintf(stderr, "block %u: %s, status %u\n", block, (state < 0) ? "no status" : state_name((uint8_t)state),
+              status[0]);
+      break;
+    }
+    if (chunk == 0U)
+    {
+      ret = 0;
+      break;
+    }
+    sent += chunk;
+    block++;
+    if ((block % 64U) == 0U)
+    {
+      fprintf(stderr, "\r%u / %u bytes", sent, len);
+    }
+  }
+  gettimeofday(&t1, NULL);
+
+  if (ret == 0)
+  {
+    double s = (double)(t1.tv_sec - t0.tv_sec) + ((double)(t1.tv_usec - t0.tv_usec) / 1e6);
+
+    printf("\r%u bytes written and checked in %.1f s, %.0f KB/s\n", len, s, (len / 1024.0) / s);
+    if (detach != 0)
+    {
+      /* the device resets into the other bank once the request is over */
+      if (dfu_control(fd, itf, DFU_REQ_OUT, DFU_DETACH, DFU_DETACH_MS, NULL, 0U) < 0)
+      {
+        perror("DFU_DETACH");
+        ret = -1;
+      }
+      else
+      {
+        printf("booting the new image\n");
+      }
+    }
+  }
+  else
+  {
+    dfu_control(fd, itf, DFU_REQ_OUT, DFU_ABORT, 0U, NULL, 0U);
+  }
+  ioctl(fd, USBDEVFS_RELEASEINTERFACE, &claim);
+  close(fd);
+  return ret;
+}
+#endif
+
+static void usage(void)
+{
+  fprintf(stderr,
+          "usage: uvc_dfu -d usbfs_node -f image.bin [-i interface] [-r]\n"
+          "       uvc_dfu -s\n");
+}
+
+int main(int argc, char **argv)
+{
+  const char *node = NULL, *file = NULL;
+  uint8_t itf = USB_DFU_IF_NUM;
+  int opt, simulated = 0, detach = 0;
+
+  while ((opt = getopt(argc, argv, "d:f:i:rs")) != -1)
+  {
+    switch (opt)
+    {
+    case 'd': node = optarg; break;
+    case 'f': file = optarg; break;
+    case 'i': itf = (uint8_t)strtoul(optarg, NULL, 0); break;
+    case 'r': detach = 1; break;
+    case 's': simulated = 1; break;
+    default: usage(); return 2;
+    }
+  }
+
+  if (simulated != 0)
+  {
+    return (simulate() == 0) ? 0 : 1;
+  }
+#ifdef __linux__
+  if ((node != NULL) && (file != NULL))
+  {
+    return (update(node, itf, file, detach) == 0) ? 0 : 1;
+  }
+#else
+  (void)node;
+  (void)file;
+  (void)itf;
+  (void)detach;
+#endif
+  usage();
+  return 2;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
@@ -0,0 +1,562 @@
+/**
+  ******************************************************************************
+  * @file    uvc_latency.c
+  * @brief   Host tool: per frame latency of the camera, from the UVC payload
+  *          headers sent in latency probe mode.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                UVC latency tool
+  *          ===================================================================
+  *           In latency probe mode (XU_ROI_LATENCY_PROBE_CONTROL) every
+  *           payload header carries the capture time of its frame (PTS) and
+  *           the device clock sampled with the USB frame number (SCR). The
+  *           Linux uvcvideo driver hands these headers out on the metadata
+  *           node of the camera (V4L2_META_FMT_UVC), each one stamped with
+  *           the host USB frame number at reception. For the last payload of
+  *           a frame:
+  *             age at send = (SCR clock - PTS) / dwClockFrequency
+  *             transit     = host frame number - SCR frame number (1 ms)
+  *             latency     = age at send + transit
+  *           The device and the host count the same bus frames, so no clock
+  *           recovery is needed, the resolution is the 1 ms USB frame.
+  *
+  *           Build: cc -O2 -o uvc_latency uvc_latency.c
+  *           Usage: uvc_latency -d /dev/video0 -m /dev/video1 [-n frames]
+  *                              [-c clock_hz] [-w record.bin] [-v]
+  *                  uvc_latency -r record.bin [-c clock_hz] [-v]
+  *                  uvc_latency -s frames [-v]
+  *           -w records the metadata buffers, -r replays a record without a
+  *           camera, -s feeds the same analysis with simulated buffers laid
+  *           out as the firmware and the driver write them.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/select.h>
+#include <linux/usb/video.h>
+#include <linux/uvcvideo.h>
+#include <linux/videodev2.h>
+#endif
+
+/* Same values as usbd_uvc.h */
+#define UVC_ID_EXTENSION_UNIT           4U
+#define XU_ROI_LATENCY_PROBE_CONTROL    0x04U
+#define UVC_HEADER_PTS                  0x04U
+#define UVC_HEADER_SCR                  0x08U
+#define LATENCY_CLOCK_HZ                1000000U
+
+/* uvcvideo metadata block: host time and frame number, then the payload header */
+#define META_BLOCK_HEADER               10U
+
+#define META_BUFFERS                    4U
+#define META_BUFFER_SIZE                16384U
+#define HISTOGRAM_BINS                  100U    /* 1 ms each */
+
+typedef struct
+{
+  uint32_t  frame;
+  double    first_ms;    /* latency of the first payload of the frame */
+  double    last_ms;     /* latency of the last payload, the frame is complete */
+} FrameLatency;
+
+static FrameLatency *frames;
+static uint32_t frame_count;
+static uint32_t frame_alloc;
+static uint32_t clock_hz = LATENCY_CLOCK_HZ;
+static int verbose;
+
+static uint16_t get16(const uint8_t *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void put16(uint8_t *p, uint16_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+/**
+  * @brief  Latency of one payload header.
+  * @param  block: metadata block
+  * @param  ms: latency in milliseconds
+  * @retval 0 if the header carries a PTS and an SCR
+  */
+static int block_latency(const uint8_t *block, double *ms)
+{
+  uint16_t host_sof = get16(&block[8]);
+  uint8_t len = block[10];
+  uint8_t info = block[11];
+  uint32_t pts, stc;
+  uint16_t sof;
+
+  if (((info & (UVC_HEADER_PTS | UVC_HEADER_SCR)) != (UVC_HEADER_PTS | UVC_HEADER_SCR)) || (len < 12U))
+  {
+    return -1;
+  }
+  pts = get32(&block[12]);
+  stc = get32(&block[16]);
+  sof = get16(&block[20]) & 0x07FFU;
+  *ms = ((double)(uint32_t)(stc - pts) * 1000.0) / clock_hz +
+        (double)((uint16_t)(host_sof - sof) & 0x07FFU);
+  return 0;
+}
+
+/**
+  * @brief  Analyses the metadata buffer of one frame.
+  * @param  buf: blocks written by the driver
+  * @param  size: bytes used
+  * @retval None
+  */
+static void meta_frame(const uint8_t *buf, uint32_t size)
+{
+  FrameLatency f;
+  uint32_t pos = 0U;
+  int found = 0;
+  double ms;
+
+  while ((pos + META_BLOCK_HEADER + 2U) <= size)
+  {
+    uint32_t len = buf[pos + META_BLOCK_HEADER];
+
+    if ((len < 2U) || ((pos + META_BLOCK_HEADER + len) > size))
+    {
+      break;
+    }
+    if (block_latency(&buf[pos], &ms) == 0)
+    {
+      if (found == 0)
+      {
+        f.first_ms = ms;
+      }
+      f.last_ms = ms;
+      found = 1;
+    }
+    pos += META_BLOCK_HEADER + len;
+  }
+  if (found == 0)
+  {
+    return;
+  }
+  f.frame = frame_count;
+  if (frame_count == frame_alloc)
+  {
+    frame_alloc = (frame_alloc != 0U) ? (frame_alloc * 2U) : 256U;
+    frames = realloc(frames, frame_alloc * sizeof(FrameLatency));
+    if (frames == NULL)
+    {
+      perror("realloc");
+      exit(1);
+    }
+  }
+  frames[frame_count++] = f;
+  if (verbose)
+  {
+    printf("frame %6u: first payload %7.2f ms, complete %7.2f ms\n", f.frame, f.first_ms, f.last_ms);
+  }
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+  * @brief  Prints the latency distribution of the complete frames.
+  * @retval None
+  */
+static void report(void)
+{
+  uint32_t hist[HISTOGRAM_BINS + 1U] = {0};
+  uint32_t i, peak = 1U;
+  double *v, sum = 0.0;
+
+  if (frame_count == 0U)
+  {
+    printf("no frame with PTS and SCR, is the latency probe mode on?\n");
+    return;
+  }
+  v = malloc(frame_count * sizeof(double));
+  if (v == NULL)
+  {
+    perror("malloc");
+    exit(1);
+  }
+  for (i = 0U; i < frame_count; i++)
+  {
+    uint32_t bin = (uint32_t)frames[i].last_ms;
+
+    v[i] = frames[i].last_ms;
+    sum += v[i];
+    hist[(bin < HISTOGRAM_BINS) ? bin : HISTOGRAM_BINS]++;
+  }
+  qsort(v, frame_count, sizeof(double), cmp_double);
+
+  printf("%u frames, capture to complete frame on the host:\n", frame_count);
+  printf("  min %.2f  mean %.2f  p50 %.2f  p90 %.2f  p99 %.2f  max %.2f ms\n",
+         v[0], sum / frame_count, v[frame_count / 2U], v[(frame_count * 9U) / 10U],
+         v[(frame_count * 99U) / 100U], v[frame_count - 1U]);
+  for (i = 0U; i <= HISTOGRAM_BINS; i++)
+  {
+    peak = (hist[i] > peak) ? hist[i] : peak;
+  }
+  for (i = 0U; i <= HISTOGRAM_BINS; i++)
+  {
+    if (hist[i] != 0U)
+    {
+      uint32_t bar = (hist[i] * 60U + peak - 1U) / peak;
+
+      printf((i < HISTOGRAM_BINS) ? "  %3u ms %6u " : " >%3u ms %6u ", i, hist[i]);
+      while (bar-- != 0U)
+      {
+        putchar('#');
+      }
+      putchar('\n');
+    }
+  }
+  free(v);
+}
+
+/**
+  * @brief  Replays metadata buffers recorded with -w.
+  * @param  path: record
+  * @retval 0 on success
+  */
+static int replay(const char *path)
+{
+  static uint8_t buf[META_BUFFER_SIZE];
+  uint8_t len[4];
+  FILE *f = fopen(path, "rb");
+
+  if (f == NULL)
+  {
+    perror(path);
+    return -1;
+  }
+  while (fread(len, 1, 4, f) == 4U)
+  {
+    uint32_t size = get32(len);
+
+    if ((size > sizeof(buf)) || (fread(buf, 1, size, f) != size))
+    {
+      fprintf(stderr, "%s: truncated record\n", path);
+      break;
+    }
+    meta_frame(buf, size);
+  }
+  fclose(f);
+  return 0;
+}
+
+/**
+  * @brief  Simulates the metadata of a stream: a frame captured every
+  *         66.7 ms, encoded in 8 ms, then sent at one payload per 1 ms USB
+  *         frame, and received one frame later by the host.
+  * @param  count: frames
+  * @retval 0 on success
+  */
+static int simulate(uint32_t count)
+{
+  static uint8_t buf[META_BUFFER_SIZE];
+  uint32_t n, k, payloads, size;
+  uint32_t pts, stc;
+  uint16_t sof;
+
+  srand(1);
+  for (n = 0U; n < count; n++)
+  {
+    pts = n * 66667U;
+    stc = pts + 8000U + (uint32_t)(rand() % 3000);
+    payloads = 20U + (uint32_t)(rand() % 30);
+    size = 0U;
+    for (k = 0U; (k < payloads) && ((size + META_BLOCK_HEADER + 12U) <= sizeof(buf)); k++)
+    {
+      sof = (uint16_t)((stc / 1000U) & 0x07FFU);
+      memset(&buf[size], 0, 8);
+      put16(&buf[size + 8U], (uint16_t)((sof + 1U) & 0x07FFU));
+      buf[size + 10U] = 12U;
+      buf[size + 11U] = UVC_HEADER_PTS | UVC_HEADER_SCR | 0x80U | (n & 1U);
+      put32(&buf[size + 12U], pts);
+      put32(&buf[size + 16U], stc);
+      put16(&buf[size + 20U], sof);
+      size += META_BLOCK_HEADER + 12U;
+      stc += 1000U;
+    }
+    meta_frame(buf, size);
+  }
+  return 0;
+}
+
+#ifdef __linux__
+static int xioctl(int fd, unsigned long req, void *arg)
+{
+  int r;
+
+  do
+  {
+    r = ioctl(fd, req, arg);
+  } while ((r < 0) && (errno == EINTR));
+  return r;
+}
+
+static int set_probe(int fd, uint8_t enable)
+{
+  struct uvc_xu_control_query q;
+
+  memset(&q, 0, sizeof(q));
+  q.unit = UVC_ID_EXTENSION_UNIT;
+  q.selector = XU_ROI_LATENCY_PROBE_CONTROL;
+  q.query = UVC_SET_CUR;
+  q.size = 1;
+  q.data = &enable;
+  return xioctl(fd, UVCIOC_CTRL_QUERY, &q);
+}
+
+/**
+  * @brief  Queues count mmap buffers of a node and starts streaming.
+  * @retval 0 on success
+  */
+static int start(int fd, uint32_t type, void **maps, uint32_t count)
+{
+  struct v4l2_requestbuffers req;
+  struct v4l2_buffer b;
+  uint32_t i;
+
+  memset(&req, 0, sizeof(req));
+  req.count = count;
+  req.type = type;
+  req.memory = V4L2_MEMORY_MMAP;
+  if (xioctl(fd, VIDIOC_REQBUFS, &req) < 0)
+  {
+    return -1;
+  }
+  for (i = 0U; i < req.count; i++)
+  {
+    memset(&b, 0, sizeof(b));
+    b.type = type;
+    b.memory = V4L2_MEMORY_MMAP;
+    b.index = i;
+    if (xioctl(fd, VIDIOC_QUERYBUF, &b) < 0)
+    {
+      return -1;
+    }
+    maps[i] = mmap(NULL, b.length, PROT_READ, MAP_SHARED, fd, b.m.offset);
+    if ((maps[i] == MAP_FAILED) || (xioctl(fd, VIDIOC_QBUF, &b) < 0))
+    {
+      return -1;
+    }
+  }
+  return xioctl(fd, VIDIOC_STREAMON, &type);
+}
+
+/**
+  * @brief  Streams the camera and analyses its metadata.
+  * @retval 0 on success
+  */
+static int capture(const char *video, const char *meta, uint32_t count, const char *record)
+{
+  void *vmaps[META_BUFFERS], *mmaps[META_BUFFERS];
+  uint32_t vtype = V4L2_BUF_TYPE_VIDEO_CAPTURE, mtype = V4L2_BUF_TYPE_META_CAPTURE;
+  struct v4l2_format fmt;
+  struct v4l2_buffer b;
+  FILE *out = NULL;
+  int vfd, mfd;
+  uint32_t received = 0U;
+
+  vfd = open(video, O_RDWR);
+  mfd = open(meta, O_RDWR);
+  if ((vfd < 0) || (mfd < 0))
+  {
+    perror("open");
+    return -1;
+  }
+  memset(&fmt, 0, sizeof(fmt));
+  fmt.type = mtype;
+  fmt.fmt.meta.dataformat = V4L2_META_FMT_UVC;
+  fmt.fmt.meta.buffersize = META_BUFFER_SIZE;
+  if (xioctl(mfd, VIDIOC_S_FMT, &fmt) < 0)
+  {
+    perror("metadata format");
+    return -1;
+  }
+  if (set_probe(vfd, 1U) < 0)
+  {
+    perror("latency probe control");
+    return -1;
+  }
+  if ((start(mfd, mtype, mmaps, META_BUFFERS) < 0) || (start(vfd, vtype, vmaps, META_BUFFERS) < 0))
+  {
+    perror("stream");
+    set_probe(vfd, 0U);
+    return -1;
+  }
+  if (record != NULL)
+  {
+    out = fopen(record, "wb");
+    if (out == NULL)
+    {
+      perror(record);
+    }
+  }
+
+  while (received < count)
+  {
+    fd_set fds;
+    int maxfd = (vfd > mfd) ? vfd : mfd;
+
+    FD_ZERO(&fds);
+    FD_SET(vfd, &fds);
+    FD_SET(mfd, &fds);
+    if (select(maxfd + 1, &fds, NULL, NULL, NULL) < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      break;
+    }
+    if (FD_ISSET(vfd, &fds))
+    {
+      /* the pictures themselves are not needed, give the buffer back */
+      memset(&b, 0, sizeof(b));
+      b.type = vtype;
+      b.memory = V4L2_MEMORY_MMAP;
+      if (xioctl(vfd, VIDIOC_DQBUF, &b) == 0)
+      {
+        xioctl(vfd, VIDIOC_QBUF, &b);
+      }
+    }
+    if (FD_ISSET(mfd, &fds))
+    {
+      memset(&b, 0, sizeof(b));
+      b.type = mtype;
+      b.memory = V4L2_MEMORY_MMAP;
+      if (xioctl(mfd, VIDIOC_DQBUF, &b) == 0)
+      {
+        if (out != NULL)
+        {
+          uint8_t len[4];
+
+          put32(len, b.bytesused);
+          fwrite(len, 1, 4, out);
+          fwrite(mmaps[b.index], 1, b.bytesused, out);
+        }
+        meta_frame(mmaps[b.index], b.bytesused);
+        received++;
+        xioctl(mfd, VIDIOC_QBUF, &b);
+      }
+    }
+  }
+
+  xioctl(vfd, VIDIOC_STREAMOFF, &vtype);
+  xioctl(mfd, VIDIOC_STREAMOFF, &mtype);
+  set_probe(vfd, 0U);
+  if (out != NULL)
+  {
+    fclose(out);
+  }
+  close(vfd);
+  close(mfd);
+  return 0;
+}
+#endif
+
+static void usage(void)
+{
+  fprintf(stderr,
+          "usage: uvc_latency -d video_node -m metadata_node [-n frames] [-c clock_hz] [-w record] [-v]\n"
+          "       uvc_latency -r record [-c clock_hz] [-v]\n"
+          "       uvc_latency -s frames [-v]\n");
+}
+
+int main(int argc, char **argv)
+{
+  const char *video = NULL, *meta = NULL, *record = NULL, *playback = NULL;
+  uint32_t count = 300U, simulated = 0U;
+  int opt, r = -1;
+
+  while ((opt = getopt(argc, argv, "d:m:n:c:w:r:s:v")) != -1)
+  {
+    switch (opt)
+    {
+    case 'd': video = optarg; break;
+    case 'm': meta = optarg; break;
+    case 'n': count = (uint32_t)strtoul(optarg, NULL, 0); break;
+    case 'c': clock_hz = (uint32_t)strtoul(optarg, NULL, 0); break;
+    case 'w': record = optarg; break;
+    case 'r': playback = optarg; break;
+    case 's': simulated = (uint32_t)strtoul(optarg, NULL, 0); break;
+    case 'v': verbose = 1; break;
+    default: usage(); return 2;
+    }
+  }
+  if (clock_hz == 0U)
+  {
+    usage();
+    return 2;
+  }
+
+  if (simulated != 0U)
+  {
+    r = simulate(simulated);
+  }
+  else if (playback != NULL)
+  {
+    r = replay(playback);
+  }
+#ifdef __linux__
+  else if ((video != NULL) && (meta != NULL))
+  {
+    r = capture(video, meta, count, record);
+  }
+#endif
+  else
+  {
+    usage();
+    return 2;
+  }
+  if (r == 0)
+  {
+    report();
+  }
+  free(frames);
+  return (r == 0) ? 0 : 1;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/
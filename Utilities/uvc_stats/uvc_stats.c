@@ -0,0 +1,304 @@
+/**
+  ******************************************************************************
+  * @file    uvc_stats.c
+  * @brief   Host tool: streaming statistics of the camera, from the
+  *          statistics extension unit.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                UVC stats tool
+  *          ===================================================================
+  *           The statistics unit (ID 6) of each camera answers GET_CUR on:
+  *             - XU_STATS_COUNTERS_CONTROL: uptime in s, then the totals of
+  *               the function and of the encoder, 32-bit and wrapping,
+  *             - XU_STATS_RATES_CONTROL: the same per second over the last
+  *               window of the device, its length in ms first.
+  *           The tool polls both and prints one line of key=value pairs per
+  *           poll, for a collector to scrape. A counter smaller than at the
+  *           previous poll means the device restarted, not a wrap, when the
+  *           uptime went back as well.
+  *
+  *           Build, from the repository root:
+  *             cc -O2 -IInc -o uvc_stats Utilities/uvc_stats/uvc_stats.c
+  *                Src/stats.c
+  *           Usage: uvc_stats -d /dev/video0 [-i seconds] [-n polls]
+  *                  uvc_stats -s
+  *           -s counts simulated traffic with the firmware statistics code
+  *           and checks what the tool decodes from its control data.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 Duvitech.
+  * All rights reserved.</center></h2>
+  *
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "stats.h"
+
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <linux/usb/video.h>
+#include <linux/uvcvideo.h>
+#endif
+
+/* Same values as usbd_uvc.h */
+#define UVC_ID_STATS_UNIT               6U
+#define XU_STATS_COUNTERS_CONTROL       0x01U
+#define XU_STATS_RATES_CONTROL          0x02U
+#define UVC_STATS_CONTROL_LEN           40U
+
+#if UVC_STATS_CONTROL_LEN != STATS_INFO_LEN
+#error "UVC_STATS_CONTROL_LEN differs from the firmware"
+#endif
+
+typedef struct
+{
+  uint32_t  time;          /* uptime in s, or window in ms */
+  uint32_t  frames;
+  uint32_t  bytes;
+  uint32_t  underruns;
+  uint32_t  skipped;
+  uint32_t  dropped;
+  uint32_t  incomplete;
+  uint32_t  encoded;
+  uint32_t  encode_time;   /* us, or us per s */
+  uint32_t  encode_max;    /* us */
+} Stats;
+
+static uint32_t host_time;
+
+/**
+  * @brief  Time hook of the firmware statistics code.
+  * @retval us
+  */
+uint32_t Stats_HostTime(void)
+{
+  return host_time;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+  * @brief  Decodes the control data, in the order of StatsControl.
+  */
+static void decode(const uint8_t *data, Stats *s)
+{
+  s->time = get32(&data[0]);
+  s->frames = get32(&data[4]);
+  s->bytes = get32(&data[8]);
+  s->underruns = get32(&data[12]);
+  s->skipped = get32(&data[16]);
+  s->dropped = get32(&data[20]);
+  s->incomplete = get32(&data[24]);
+  s->encoded = get32(&data[28]);
+  s->encode_time = get32(&data[32]);
+  s->encode_max = get32(&data[36]);
+}
+
+static void print_line(const Stats *total, const Stats *rate)
+{
+  printf("up=%u frames=%u bytes=%u underruns=%u skipped=%u dropped=%u incomplete=%u "
+         "encoded=%u encode_max_us=%u window_ms=%u fps=%u bytes_per_s=%u "
+         "encode_fps=%u encode_load=%.1f%% window_encode_max_us=%u\n",
+         total->time, total->frames, total->bytes, total->underruns, total->skipped,
+         total->dropped, total->incomplete, total->encoded, total->encode_max,
+         rate->time, rate->frames, rate->bytes, rate->encoded,
+         rate->encode_time / 10000.0, rate->encode_max);
+  fflush(stdout);
+}
+
+/**
+  * @brief  Two streams and the encoder over five windows, one of them
+  *         stretched by a late main loop.
+  * @retval 0 if the decoded totals and rates are the ones counted
+  */
+static int simulate(void)
+{
+  uint8_t data[STATS_INFO_LEN];
+  Stats total, rate;
+  uint32_t ms, fails = 0U;
+
+  host_time = 0xFFFF0000U;               /* the TIM2 count wraps in the first window */
+  Stats_Init();
+  for (ms = 1U; ms <= 5500U; ms++)
+  {
+    host_time += 1000U;
+    Stats_Add(0U, STATS_BYTES, 1023U);
+    if ((ms % 50U) == 0U)
+    {
+      Stats_Add(0U, STATS_FRAMES, 1U);
+      Stats_Add(1U, STATS_FRAMES, 1U);
+      Stats_Add(STATS_DEVICE, STATS_ENCODED, 1U);
+      Stats_Add(STATS_DEVICE, STATS_ENCODE_TIME, 12000U);
+      Stats_Max(STATS_DEVICE, STATS_ENCODE_MAX, (ms < 1000U) ? 30000U : 12000U);
+    }
+    if ((ms % 500U) == 0U)
+    {
+      Stats_Add(1U, STATS_UNDERRUNS, 1U);
+    }
+    if (ms == 2500U)
+    {
+      Stats_Add(1U, STATS_ISO_INCOMPLETE, 3U);
+      Stats_Add(0U, STATS_DROPPED, 1U);
+    }
+    if ((ms < 4000U) || (ms >= 5500U))   /* no processing from 4 s to 5.5 s */
+    {
+      Stats_Process();
+    }
+  }
+
+  Stats_GetInfo(0U, 0U, data);
+  decode(data, &total);
+  Stats_GetInfo(0U, 1U, data);
+  decode(data, &rate);
+  print_line(&total, &rate);
+  if ((total.time != 5U) || (total.frames != 110U) || (total.bytes != (5500U * 1023U)) ||
+      (total.dropped != 1U) || (total.encoded != 110U) || (total.encode_max != 30000U) ||
+      (rate.time != 2500U) || (rate.frames != 20U) || (rate.bytes != 1023000U) ||
+      (rate.encode_time != 240000U) || (rate.encode_max != 12000U))
+  {
+    fails++;
+  }
+
+  Stats_GetInfo(1U, 0U, data);
+  decode(data, &total);
+  Stats_GetInfo(1U, 1U, data);
+  decode(data, &rate);
+  print_line(&total, &rate);
+  if ((total.underruns != 11U) || (total.incomplete != 3U) || (total.bytes != 0U) ||
+      (rate.underruns != 2U) || (rate.frames != 20U))
+  {
+    fails++;
+  }
+  printf("%s\n", (fails != 0U) ? "FAIL" : "PASS");
+  return (fails != 0U) ? -1 : 0;
+}
+
+#ifdef __linux__
+/**
+  * @brief  GET_CUR of a control of the statistics unit.
+  * @retval 0 on success
+  */
+static int get_control(int fd, uint8_t selector, uint8_t *data)
+{
+  struct uvc_xu_control_query q;
+  int r;
+
+  memset(&q, 0, sizeof(q));
+  q.unit = UVC_ID_STATS_UNIT;
+  q.selector = selector;
+  q.query = UVC_GET_CUR;
+  q.size = UVC_STATS_CONTROL_LEN;
+  q.data = data;
+  do
+  {
+    r = ioctl(fd, UVCIOC_CTRL_QUERY, &q);
+  } while ((r < 0) && (errno == EINTR));
+  return r;
+}
+
+/**
+  * @brief  Polls the statistics of a camera.
+  * @param  video: video node
+  * @param  interval: s between polls
+  * @param  polls: 0 to run until stopped
+  * @retval 0 on success
+  */
+static int poll_camera(const char *video, uint32_t interval, uint32_t polls)
+{
+  uint8_t data[UVC_STATS_CONTROL_LEN];
+  Stats total, rate;
+  uint32_t n;
+  int fd = open(video, O_RDWR);
+
+  if (fd < 0)
+  {
+    perror(video);
+    return -1;
+  }
+  for (n = 0U; (polls == 0U) || (n < polls); n++)
+  {
+    if (n != 0U)
+    {
+      sleep(interval);
+    }
+    if (get_control(fd, XU_STATS_COUNTERS_CONTROL, data) < 0)
+    {
+      perror("statistics counters");
+      close(fd);
+      return -1;
+    }
+    decode(data, &total);
+    if (get_control(fd, XU_STATS_RATES_CONTROL, data) < 0)
+    {
+      perror("statistics rates");
+      close(fd);
+      return -1;
+    }
+    decode(data, &rate);
+    print_line(&total, &rate);
+  }
+  close(fd);
+  return 0;
+}
+#endif
+
+static void usage(void)
+{
+  fprintf(stderr,
+          "usage: uvc_stats -d video_node [-i seconds] [-n polls]\n"
+          "       uvc_stats -s\n");
+}
+
+int main(int argc, char **argv)
+{
+  const char *video = NULL;
+  uint32_t interval = 1U, polls = 1U;
+  int opt, simulated = 0;
+
+  while ((opt = getopt(argc, argv, "d:i:n:s")) != -1)
+  {
+    switch (opt)
+    {
+    case 'd': video = optarg; break;
+    case 'i': interval = (uint32_t)strtoul(optarg, NULL, 0); break;
+    case 'n': polls = (uint32_t)strtoul(optarg, NULL, 0); break;
+    case 's': simulated = 1; break;
+    default: usage(); return 2;
+    }
+  }
+
+  if (simulated != 0)
+  {
+    return (simulate() == 0) ? 0 : 1;
+  }
+#ifdef __linux__
+  if (video != NULL)
+  {
+    return (poll_camera(video, interval, polls) == 0) ? 0 : 1;
+  }
+#else
+  (void)interval;
+  (void)polls;
+#endif
+  usage();
+  return 2;
+}
+
+/************************ (C) COPYRIGHT Duvitech *****END OF FILE****/